@@ -0,0 +1,91 @@
+package com.pubmatic.sdk.openwrap.reactnative
+
+import android.app.Activity
+import android.content.Context
+import com.google.android.gms.ads.MobileAds
+import com.google.android.gms.ads.admanager.AdManagerAdRequest
+import com.pubmatic.sdk.common.POBAdSize
+import com.pubmatic.sdk.openwrap.banner.POBBannerEvent
+import com.pubmatic.sdk.openwrap.eventhandler.dfp.DFPBannerEventHandler
+import com.pubmatic.sdk.openwrap.eventhandler.dfp.DFPInterstitialEventHandler
+import com.pubmatic.sdk.openwrap.eventhandler.dfp.DFPRewardedEventHandler
+import com.pubmatic.sdk.openwrap.interstitial.POBInterstitialEvent
+import com.pubmatic.sdk.rewardedad.POBRewardedAdEvent
+import kotlin.concurrent.thread
+
+/**
+ * Creates the GAM event handlers used for header bidding. This implementation is compiled when
+ * PubmaticOpenwrapSdk_gamEventHandlerEnabled=true, see src/nogam for the one used otherwise.
+ *
+ * The config listener of every handler is invoked once the OpenWrap auction is over, right before
+ * the GAM request. It applies the custom targeting natively and marks the switch from waiting on
+ * OpenWrap to waiting on GAM in the latency timer.
+ */
+internal object POBRNGamEventHandlers {
+
+    const val isAvailable = true
+
+    private const val INIT_THREAD_NAME = "POBRNGamInit"
+
+    /**
+     * Starts the GAM SDK when the plugin is created, so that its initialization runs in parallel
+     * with the first OpenWrap auction instead of delaying the first GAM request. The initialization
+     * runs on a background thread, as recommended by Google, to keep it off the JS and UI threads.
+     */
+    fun initialize(context: Context) {
+        val applicationContext = context.applicationContext
+        thread(name = INIT_THREAD_NAME) { MobileAds.initialize(applicationContext) }
+    }
+
+    fun bannerEventHandler(
+        context: Context,
+        config: POBRNGamConfig,
+        adSizes: Array<POBAdSize>,
+        latencyTimer: POBRNLatencyTimer
+    ): POBBannerEvent? {
+        val eventHandler = DFPBannerEventHandler(context, config.adUnitId, *adSizes)
+        eventHandler.setConfigListener { _, requestBuilder, _ ->
+            onAdServerRequest(requestBuilder, config, latencyTimer)
+        }
+        return eventHandler
+    }
+
+    fun interstitialEventHandler(
+        activity: Activity,
+        config: POBRNGamConfig,
+        latencyTimer: POBRNLatencyTimer
+    ): POBInterstitialEvent? {
+        val eventHandler = DFPInterstitialEventHandler(activity, config.adUnitId)
+        eventHandler.setConfigListener { requestBuilder, _ ->
+            onAdServerRequest(requestBuilder, config, latencyTimer)
+        }
+        return eventHandler
+    }
+
+    fun rewardedEventHandler(
+        activity: Activity,
+        config: POBRNGamConfig,
+        latencyTimer: POBRNLatencyTimer
+    ): POBRewardedAdEvent? {
+        val eventHandler = DFPRewardedEventHandler(activity, config.adUnitId)
+        eventHandler.setConfigListener { requestBuilder, _ ->
+            onAdServerRequest(requestBuilder, config, latencyTimer)
+        }
+        return eventHandler
+    }
+
+    private fun onAdServerRequest(
+        requestBuilder: AdManagerAdRequest.Builder,
+        config: POBRNGamConfig,
+        latencyTimer: POBRNLatencyTimer
+    ) {
+        latencyTimer.markAdServerRequest()
+        for ((key, values) in config.customTargeting) {
+            if (values.size == 1) {
+                requestBuilder.addCustomTargeting(key, values[0])
+            } else {
+                requestBuilder.addCustomTargeting(key, values)
+            }
+        }
+    }
+}
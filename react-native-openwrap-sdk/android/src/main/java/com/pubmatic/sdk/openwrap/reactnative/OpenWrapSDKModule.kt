@@ -1,12 +1,15 @@
 package com.pubmatic.sdk.openwrap.reactnative
 
+import com.facebook.react.bridge.Promise
 import com.facebook.react.bridge.ReactApplicationContext
 import com.facebook.react.bridge.ReactContextBaseJavaModule
 import com.facebook.react.bridge.ReactMethod
 import com.pubmatic.sdk.common.OpenWrapSDK
 import com.pubmatic.sdk.common.log.POBLog
+import com.pubmatic.sdk.openwrap.reactnative.POBSDKPluginConstant.KEY_GAM_SUPPORTED
 import com.pubmatic.sdk.openwrap.reactnative.POBSDKPluginConstant.KEY_SDK_VERSION
 import org.json.JSONException
+import org.json.JSONObject
 
 /**
  * Class responsible for setting properties {@link OpenWrapSDK} through ReactContextBaseJavaModule
@@ -15,6 +18,11 @@ import org.json.JSONException
 class OpenWrapSDKModule(reactContext: ReactApplicationContext) :
   ReactContextBaseJavaModule(reactContext) {
 
+  init {
+    // Never let the bundled configuration override the values set by JS, see POBRNPluginStartup.
+    POBRNPluginStartup.awaitConfig(reactContext)
+  }
+
   override fun getName(): String {
     return NAME
   }
@@ -23,12 +31,13 @@ class OpenWrapSDKModule(reactContext: ReactApplicationContext) :
    * Use constants to return OpenWrap SDK version.
    * By default all the @ReactMethods are async by nature and requires Promises or Callback implementation
    * to make any property value available.
-   * The constants through getConstants() will be loaded at the time of loading OpenWrapSDKModule by JS so the SDK version
-   * will be always available to use with synchronous way.
+   * The constants through getConstants() are loaded when JS first accesses OpenWrapSDKModule, i.e. on the first
+   * OpenWrapSDK.getVersion() or isGamSupported() call, so the SDK version is always available in a synchronous way.
    */
   override fun getConstants(): MutableMap<String, Any>? {
     val map = HashMap<String, Any>()
     map[KEY_SDK_VERSION] = OpenWrapSDK.getVersion()
+    map[KEY_GAM_SUPPORTED] = POBRNGamEventHandlers.isAvailable
     return map
   }
 
@@ -49,6 +58,7 @@ class OpenWrapSDKModule(reactContext: ReactApplicationContext) :
     val level = POBSDKPluginParserHelper.parseLogLevel(logLevel)
     level?.let {
       OpenWrapSDK.setLogLevel(it)
+      POBRNSDKConfigurator.invalidate(POBSDKPluginConstant.CONFIG_LOG_LEVEL_KEY)
     }
   }
 
@@ -59,6 +69,7 @@ class OpenWrapSDKModule(reactContext: ReactApplicationContext) :
   @ReactMethod
   fun allowLocationAccess(allowLocationAccess: Boolean){
     OpenWrapSDK.allowLocationAccess(allowLocationAccess)
+    POBRNSDKConfigurator.invalidate(POBSDKPluginConstant.CONFIG_ALLOW_LOCATION_ACCESS_KEY)
   }
 
   /**
@@ -68,6 +79,7 @@ class OpenWrapSDKModule(reactContext: ReactApplicationContext) :
   @ReactMethod
   fun setCoppa(coppa: Boolean){
     OpenWrapSDK.setCoppa(coppa)
+    POBRNSDKConfigurator.invalidate(POBSDKPluginConstant.CONFIG_COPPA_KEY)
   }
 
   /**
@@ -77,6 +89,7 @@ class OpenWrapSDKModule(reactContext: ReactApplicationContext) :
   @ReactMethod
   fun setSSLEnabled(sslEnabled: Boolean){
     OpenWrapSDK.setSSLEnabled(sslEnabled)
+    POBRNSDKConfigurator.invalidate(POBSDKPluginConstant.CONFIG_SSL_ENABLED_KEY)
   }
 
   /**
@@ -87,6 +100,7 @@ class OpenWrapSDKModule(reactContext: ReactApplicationContext) :
   @ReactMethod
   fun setUseInternalBrowser(useInternalBrowser: Boolean){
     OpenWrapSDK.setUseInternalBrowser(useInternalBrowser)
+    POBRNSDKConfigurator.invalidate(POBSDKPluginConstant.CONFIG_USE_INTERNAL_BROWSER_KEY)
   }
 
   /**
@@ -96,6 +110,7 @@ class OpenWrapSDKModule(reactContext: ReactApplicationContext) :
   @ReactMethod
   fun allowAdvertisingId(allowAdvertisingId: Boolean){
     OpenWrapSDK.allowAdvertisingId(allowAdvertisingId)
+    POBRNSDKConfigurator.invalidate(POBSDKPluginConstant.CONFIG_ALLOW_ADVERTISING_ID_KEY)
   }
 
 
@@ -113,6 +128,7 @@ class OpenWrapSDKModule(reactContext: ReactApplicationContext) :
   fun setApplicationInfo(applicationInfo: String){
     try {
       OpenWrapSDK.setApplicationInfo(POBSDKPluginParserHelper.parseJsonToApplicationInfo(applicationInfo))
+      POBRNSDKConfigurator.invalidate(POBSDKPluginConstant.CONFIG_APPLICATION_INFO_KEY)
     }catch (exception: JSONException){
       POBLog.warn(NAME, POBSDKPluginConstant.APP_INFO_WARN_MSG + "${exception.message}")
     }
@@ -131,6 +147,7 @@ class OpenWrapSDKModule(reactContext: ReactApplicationContext) :
   fun setLocation(location: String){
     try {
       OpenWrapSDK.setLocation(POBSDKPluginParserHelper.parseJsonToLocation(location))
+      POBRNSDKConfigurator.invalidate(POBSDKPluginConstant.CONFIG_LOCATION_KEY)
     }catch (exception: JSONException){
       POBLog.warn(NAME, POBSDKPluginConstant.LOCATION_WARN_MSG + "${exception.message}")
     }
@@ -155,11 +172,369 @@ class OpenWrapSDKModule(reactContext: ReactApplicationContext) :
   fun setUserInfo(userInfo: String){
     try {
       OpenWrapSDK.setUserInfo(POBSDKPluginParserHelper.parseJsonToUserInfo(userInfo))
+      POBRNSDKConfigurator.invalidate(POBSDKPluginConstant.CONFIG_USER_INFO_KEY)
     }catch (exception: JSONException){
       POBLog.warn(NAME, POBSDKPluginConstant.USERINFO_WARN_MSG + "${exception.message}")
     }
   }
 
+  /**
+   * To apply the global configuration on {@link OpenWrapSDK} in one call.
+   * Values unchanged since the previous configuration are skipped.
+   * @param config expects json string in below format, every key is optional.
+   * {
+    "logLevel": 4,
+    "allowLocationAccess": true,
+    "coppa": false,
+    "sslEnabled": true,
+    "useInternalBrowser": false,
+    "allowAdvertisingId": true,
+    "applicationInfo": {...},
+    "userInfo": {...},
+    "location": {...}
+    }
+   */
+  @ReactMethod
+  fun configure(config: String){
+    try {
+      POBRNSDKConfigurator.apply(JSONObject(config))
+    }catch (exception: JSONException){
+      POBLog.warn(NAME, POBSDKPluginConstant.CONFIG_WARN_MSG + "${exception.message}")
+    }
+  }
+
+  /**
+   * To register the in-house mediation rule of a placement, evaluated natively on bid received.
+   * @param adUnitId ad unit id of the placement
+   * @param rule expects json string in below format, every key is optional.
+   * {
+    "floor": 0.5,
+    "partnerFloors": { "pubmatic": 0.8 },
+    "allowedPartners": ["pubmatic", "appnexus"],
+    "maxWaitMs": 500
+    }
+   */
+  @ReactMethod
+  fun setMediationRule(adUnitId: String, rule: String){
+    try {
+      POBRNMediationRule.register(adUnitId, POBRNMediationRule.build(rule))
+    }catch (exception: JSONException){
+      POBLog.warn(NAME, POBSDKPluginConstant.MEDIATION_RULE_WARN_MSG + "${exception.message}")
+    }
+  }
+
+  /**
+   * To remove the in-house mediation rule of a placement.
+   * @param adUnitId ad unit id of the placement
+   */
+  @ReactMethod
+  fun removeMediationRule(adUnitId: String){
+    POBRNMediationRule.unregister(adUnitId)
+  }
+
+  /**
+   * To register request parameters once, parsed natively and applied to the ads whose request
+   * parameters refer to the template by "templateId".
+   * @param templateId id of the template, replaces the template previously registered with this id
+   * @param params expects json string of the request parameters, see [POBRNRequestTemplate.build]
+   */
+  @ReactMethod
+  fun registerRequestTemplate(templateId: String, params: String){
+    try {
+      POBRNRequestTemplate.register(templateId, POBRNRequestTemplate.build(JSONObject(params)))
+    }catch (exception: JSONException){
+      POBLog.warn(NAME, POBSDKPluginConstant.TEMPLATE_WARN_MSG + "${exception.message}")
+    }
+  }
+
+  /**
+   * To register impression parameters once, see [registerRequestTemplate].
+   * @param params expects json string of the impression parameters, see [POBRNImpressionTemplate.build]
+   */
+  @ReactMethod
+  fun registerImpressionTemplate(templateId: String, params: String){
+    try {
+      POBRNImpressionTemplate.register(templateId, POBRNImpressionTemplate.build(JSONObject(params)))
+    }catch (exception: JSONException){
+      POBLog.warn(NAME, POBSDKPluginConstant.TEMPLATE_WARN_MSG + "${exception.message}")
+    }
+  }
+
+  /**
+   * To remove the request and impression templates registered with the given id.
+   */
+  @ReactMethod
+  fun removeTemplate(templateId: String){
+    POBRNRequestTemplate.unregister(templateId)
+    POBRNImpressionTemplate.unregister(templateId)
+  }
+
+  /**
+   * To enable or disable the lifecycle tracing of the plugin ad instances.
+   * @param enabled expects Boolean value.
+   */
+  @ReactMethod
+  fun setTracingEnabled(enabled: Boolean){
+    POBRNTracer.setEnabled(enabled)
+  }
+
+  /**
+   * To enable or disable the Perfetto/systrace sections around the plugin hot paths.
+   * @param enabled expects Boolean value.
+   */
+  @ReactMethod
+  fun setSystemTracingEnabled(enabled: Boolean){
+    POBRNSystemTrace.setEnabled(enabled)
+  }
+
+  /**
+   * To remove all the recorded lifecycle trace entries.
+   */
+  @ReactMethod
+  fun clearTrace(){
+    POBRNTracer.clear()
+  }
+
+  /**
+   * To get the recorded lifecycle trace entries.
+   * @param promise resolved with the trace in Chrome trace-event JSON format.
+   */
+  @ReactMethod
+  fun getTrace(promise: Promise){
+    promise.resolve(POBRNTracer.toChromeTraceJson())
+  }
+
+  /**
+   * To get the ad latency percentiles measured per ad format and ad unit id.
+   * @param promise resolved with the JSON array of latency stats.
+   */
+  @ReactMethod
+  fun getLatencyStats(promise: Promise){
+    promise.resolve(POBRNLatencyTracker.toJson().toString())
+  }
+
+  /**
+   * To remove all the measured ad latencies.
+   */
+  @ReactMethod
+  fun resetLatencyStats(){
+    POBRNLatencyTracker.reset()
+  }
+
+  /**
+   * To attach the measured ad latencies to the ad event payloads.
+   * @param enabled expects Boolean value.
+   */
+  @ReactMethod
+  fun setLatencyInEventPayloadEnabled(enabled: Boolean){
+    POBRNLatencyTracker.isPayloadEnabled = enabled
+  }
+
+  /**
+   * To get the number of auctions started and avoided by the request coalescing, per ad unit.
+   * @param promise resolved with the JSON string of the stats.
+   */
+  @ReactMethod
+  fun getRequestCoalescingStats(promise: Promise){
+    promise.resolve(POBRNRequestCoalescer.toJson().toString())
+  }
+
+  /**
+   * To remove all the request coalescing stats.
+   */
+  @ReactMethod
+  fun resetRequestCoalescingStats(){
+    POBRNRequestCoalescer.resetStats()
+  }
+
+  /**
+   * To limit the banner loads in flight, see [POBRNBannerLoadScheduler].
+   * @param count maximum number of concurrent banner loads, 0 for no limit.
+   */
+  @ReactMethod
+  fun setMaxConcurrentBannerLoads(count: Int){
+    currentActivity?.runOnUiThread {
+      POBRNBannerLoadScheduler.maxConcurrentLoads = count
+    }
+  }
+
+  /**
+   * To align the banner auto refreshes in shared windows, see [POBRNBannerRefreshCoordinator].
+   * @param enabled expects Boolean value.
+   */
+  @ReactMethod
+  fun setBannerRefreshAlignmentEnabled(enabled: Boolean){
+    currentActivity?.runOnUiThread {
+      POBRNBannerRefreshCoordinator.isEnabled = enabled
+    }
+  }
+
+  /**
+   * To get the banner requests, radio wake ups and estimated radio active time, without and with
+   * the refresh alignment.
+   * @param promise resolved with the JSON string of the stats.
+   */
+  @ReactMethod
+  fun getBannerRefreshStats(promise: Promise){
+    promise.resolve(POBRNBannerRefreshCoordinator.toJson().toString())
+  }
+
+  /**
+   * To remove all the banner refresh stats.
+   */
+  @ReactMethod
+  fun resetBannerRefreshStats(){
+    POBRNBannerRefreshCoordinator.resetStats()
+  }
+
+  /**
+   * To get the banner refreshes and loads held back while the full screen ads were showing, and the
+   * estimated bytes freed, see [POBRNFullScreenArbiter].
+   * @param promise resolved with the JSON string of the stats.
+   */
+  @ReactMethod
+  fun getFullScreenArbitrationStats(promise: Promise){
+    promise.resolve(POBRNFullScreenArbiter.toJson().toString())
+  }
+
+  /**
+   * To remove all the full screen arbitration stats.
+   */
+  @ReactMethod
+  fun resetFullScreenArbitrationStats(){
+    POBRNFullScreenArbiter.resetStats()
+  }
+
+  /**
+   * To set the number of WebViews kept warm by POBRNWebViewPool.
+   * @param size number of WebViews, 0 to disable the pool.
+   */
+  @ReactMethod
+  fun setWebViewPoolSize(size: Int){
+    currentActivity?.runOnUiThread {
+      POBRNWebViewPool.maxSize = size
+    }
+    POBRNSDKConfigurator.invalidate(POBSDKPluginConstant.CONFIG_WEBVIEW_POOL_SIZE_KEY)
+  }
+
+  /**
+   * To enable the prefetch of the video media files into POBRNMediaCache.
+   * @param enabled expects Boolean value.
+   * @param maxBytes maximum size of the cached files in bytes.
+   */
+  @ReactMethod
+  fun setMediaPrecacheEnabled(enabled: Boolean, maxBytes: Double){
+    POBRNMediaCache.isEnabled = enabled
+    POBRNMediaCache.maxBytes = maxBytes.toLong()
+  }
+
+  /**
+   * To get the media prefetch stats, e.g. the number of downloads and the bytes downloaded.
+   * @param promise resolved with the JSON string of the stats.
+   */
+  @ReactMethod
+  fun getMediaCacheStats(promise: Promise){
+    promise.resolve(POBRNMediaCache.toJson().toString())
+  }
+
+  /**
+   * To remove all the media cache stats.
+   */
+  @ReactMethod
+  fun resetMediaCacheStats(){
+    POBRNMediaCache.resetStats()
+  }
+
+  /**
+   * To send a win or loss notice through POBRNNoticeDispatcher, persisted until it is delivered.
+   * @param url notice URL, its macros already replaced.
+   */
+  @ReactMethod
+  fun sendNotice(url: String){
+    POBRNNoticeDispatcher.enqueue(url)
+  }
+
+  /**
+   * To get the notice queue depth, delivery counts and delivery latency.
+   * @param promise resolved with the JSON string of the stats.
+   */
+  @ReactMethod
+  fun getNoticeStats(promise: Promise){
+    promise.resolve(POBRNNoticeDispatcher.toJson().toString())
+  }
+
+  /**
+   * To remove all the notice stats.
+   */
+  @ReactMethod
+  fun resetNoticeStats(){
+    POBRNNoticeDispatcher.resetStats()
+  }
+
+  /**
+   * To enable the recording of the auction outcomes into POBRNBidLandscape.
+   * @param enabled expects Boolean value.
+   * @param capacity number of auction outcomes retained.
+   */
+  @ReactMethod
+  fun setBidLandscapeEnabled(enabled: Boolean, capacity: Double){
+    POBRNBidLandscape.setEnabled(enabled, capacity.toInt())
+  }
+
+  /**
+   * To get the per partner win rates and per ad unit price percentiles of the recorded auctions.
+   * @param promise resolved with the JSON string of the summary.
+   */
+  @ReactMethod
+  fun getBidLandscapeSummary(promise: Promise){
+    promise.resolve(POBRNBidLandscape.summary().toString())
+  }
+
+  /**
+   * To export the recorded auction outcomes into a binary file, e.g. to be uploaded.
+   * @param promise resolved with the path of the file, null if nothing is recorded.
+   */
+  @ReactMethod
+  fun exportBidLandscape(promise: Promise){
+    promise.resolve(POBRNBidLandscape.export()?.absolutePath)
+  }
+
+  /**
+   * To remove all the recorded auction outcomes.
+   */
+  @ReactMethod
+  fun clearBidLandscape(){
+    POBRNBidLandscape.clear()
+  }
+
+  /**
+   * To defer the loads of the full screen ads until their predicted show falls within the bid validity window.
+   * @param enabled expects Boolean value.
+   */
+  @ReactMethod
+  fun setPreloadSchedulingEnabled(enabled: Boolean){
+    currentActivity?.runOnUiThread {
+      POBRNPreloadScheduler.setEnabled(enabled)
+    }
+  }
+
+  /**
+   * To get the per ad unit wasted auctions and bytes, and the show rate and timings learned by POBRNPreloadScheduler.
+   * @param promise resolved with the JSON string of the stats.
+   */
+  @ReactMethod
+  fun getPreloadStats(promise: Promise){
+    promise.resolve(POBRNPreloadScheduler.toJson().toString())
+  }
+
+  /**
+   * To remove all the preload stats.
+   */
+  @ReactMethod
+  fun resetPreloadStats(){
+    POBRNPreloadScheduler.resetStats()
+  }
+
   /**
    * Required methods introduced React Native 0.65
    * Empty implementation to resolve addListener warning in react native.
@@ -1,13 +1,53 @@
 package com.pubmatic.sdk.openwrap.reactnative
 
-import com.facebook.react.ReactPackage
+import com.facebook.react.TurboReactPackage
 import com.facebook.react.bridge.NativeModule
 import com.facebook.react.bridge.ReactApplicationContext
+import com.facebook.react.module.model.ReactModuleInfo
+import com.facebook.react.module.model.ReactModuleInfoProvider
+import com.facebook.react.uimanager.ViewManager
 
-class OpenWrapSDKPackage : ReactPackage {
-  override fun createNativeModules(reactApplicationContext: ReactApplicationContext): List<NativeModule> {
-    return listOf(OpenWrapSDKModule(reactApplicationContext),POBRNInterstitialModule(reactApplicationContext), POBRNRewardedAdModule(reactApplicationContext))
+/**
+ * Provides the plugin modules: the bridge registers their [ReactModuleInfo] at launch, and creates
+ * the modules on the JS thread the first time JS accesses them.
+ *
+ * The plugin startup does not wait for them: it starts, off the main thread, when the bridge sets
+ * the plugin up, see [POBRNPluginStartup].
+ */
+class OpenWrapSDKPackage : TurboReactPackage() {
+
+  override fun getModule(name: String, reactContext: ReactApplicationContext): NativeModule? {
+    POBRNPluginStartup.start(reactContext)
+    return when (name) {
+      OpenWrapSDKModule.NAME -> OpenWrapSDKModule(reactContext)
+      POBRNInterstitialModule.NAME -> POBRNInterstitialModule(reactContext)
+      POBRNRewardedAdModule.NAME -> POBRNRewardedAdModule(reactContext)
+      else -> null
+    }
+  }
+
+  override fun getReactModuleInfoProvider() = ReactModuleInfoProvider {
+    mapOf(
+      // Only OpenWrapSDKModule exports constants, i.e. the SDK version.
+      OpenWrapSDKModule.NAME to moduleInfo(OpenWrapSDKModule.NAME, OpenWrapSDKModule::class.java.name, false, true),
+      POBRNInterstitialModule.NAME to moduleInfo(POBRNInterstitialModule.NAME, POBRNInterstitialModule::class.java.name, false, false),
+      POBRNRewardedAdModule.NAME to moduleInfo(POBRNRewardedAdModule.NAME, POBRNRewardedAdModule::class.java.name, false, false)
+    )
+  }
+
+  override fun createViewManagers(reactApplicationContext: ReactApplicationContext): List<ViewManager<*, *>> {
+    // Called when the bridge sets up the UI manager at launch, ahead of any JS call.
+    POBRNPluginStartup.start(reactApplicationContext)
+    return listOf(POBRNBannerViewManager())
   }
 
-  override fun createViewManagers(reactApplicationContext: ReactApplicationContext) = listOf(POBRNBannerViewManager())
+  private fun moduleInfo(name: String, className: String, needsEagerInit: Boolean, hasConstants: Boolean) = ReactModuleInfo(
+    name,
+    className,
+    false, // canOverrideExistingModule
+    needsEagerInit,
+    hasConstants,
+    false, // isCxxModule
+    false // isTurboModule
+  )
 }
@@ -14,7 +14,8 @@ class POBAdUnitDetails private constructor(
     val requestParams: String?,
     val impressionParams: String?,
     val enableGetBidPrice: Int?,
-    val adSizes: Array<POBAdSize>
+    val adSizes: Array<POBAdSize>,
+    val gamConfig: POBRNGamConfig? = null
 
 ) {
 
@@ -26,6 +27,7 @@ class POBAdUnitDetails private constructor(
         /**
          * Parses and builds {@link POBAdUnitDetails} from ad unit json string in below format
          * {"publisherId": "pub_id", "profileId": 1234, "adUnitId": "test_ad_unit", "adSizes": [{"width": 320, "height": 50}]}
+         * Optionally with "gam" details for GAM header bidding, see {@link POBRNGamConfig#build}
          * @param adUnitDetailsJson the json string that contains ad unit details
          * @return POBAdUnitDetails newly created instance of {@link POBAdUnitDetails}
          * @throws JSONException if invalid keys provided in the json
@@ -59,6 +61,10 @@ class POBAdUnitDetails private constructor(
                 enableGetBidPrice = json.getInt(POBSDKPluginConstant.ENABLE_GET_BID_PRICE)
             }
 
+            val gamConfig = json.optJSONObject(POBSDKPluginConstant.GAM_CONFIG_KEY)?.let {
+                POBRNGamConfig.build(it)
+            }
+
             return POBAdUnitDetails(
                 json.getString(POBSDKPluginConstant.PUBLISHER_ID),
                 json.getInt(POBSDKPluginConstant.PROFILE_ID),
@@ -67,6 +73,7 @@ class POBAdUnitDetails private constructor(
                 impression,
                 enableGetBidPrice,
                 adSizes.toTypedArray(),
+                gamConfig
             )
         }
     }
@@ -0,0 +1,11 @@
+package com.pubmatic.sdk.openwrap.reactnative
+
+/**
+ * Ad formats supported by the plugin. The [value] is used wherever the format needs to be reported
+ * to JS, e.g. in traces and stats.
+ */
+enum class POBRNAdFormat(val value: String) {
+    BANNER("banner"),
+    INTERSTITIAL("interstitial"),
+    REWARDED("rewarded")
+}
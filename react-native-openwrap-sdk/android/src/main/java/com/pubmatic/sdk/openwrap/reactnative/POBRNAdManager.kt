@@ -7,6 +7,9 @@ object POBRNAdManager {
 
     private var instanceMap : HashMap<String, POBRNFullScreenAd> = HashMap();
 
+    // Instance ids of the ads of each show group, in the order they were added, see POBRNShowFallback.
+    private val groupMap : HashMap<String, LinkedHashSet<String>> = HashMap()
+
     /**
      *  Method to put ad object in AdManager map
      */
@@ -33,5 +36,46 @@ object POBRNAdManager {
      */
     fun remove(instanceId: String) {
         instanceMap.remove(instanceId)
+        groupMap.values.forEach { it.remove(instanceId) }
+        groupMap.values.removeAll { it.isEmpty() }
+    }
+
+    /**
+     *  Method to add ad object with given instance id to a show group
+     */
+    fun addToGroup(group : String, instanceId : String) {
+        groupMap.getOrPut(group) { LinkedHashSet() }.add(instanceId)
+    }
+
+    /**
+     *  Method to remove ad object with given instance id from a show group
+     */
+    fun removeFromGroup(group : String, instanceId : String) {
+        val instanceIds = groupMap[group] ?: return
+        instanceIds.remove(instanceId)
+        if (instanceIds.isEmpty()) {
+            groupMap.remove(group)
+        }
+    }
+
+    /**
+     *  Method to get the instance ids of the ad objects of a show group, in the order they were added
+     */
+    fun group(group : String) : List<String> {
+        return groupMap[group]?.toList() ?: emptyList()
+    }
+
+    /**
+     *  Method to get the show groups containing the ad object with given instance id
+     */
+    fun groupsOf(instanceId : String) : List<String> {
+        return groupMap.filterValues { it.contains(instanceId) }.keys.toList()
+    }
+
+    /**
+     *  Method to get the number of ad objects alive in AdManager map
+     */
+    fun size() : Int {
+        return instanceMap.size
     }
 }
\ No newline at end of file
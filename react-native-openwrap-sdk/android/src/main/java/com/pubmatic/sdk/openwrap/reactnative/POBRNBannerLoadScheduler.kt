@@ -0,0 +1,205 @@
+package com.pubmatic.sdk.openwrap.reactnative
+
+import android.graphics.Rect
+import android.os.Handler
+import android.os.Looper
+import android.view.Choreographer
+import android.view.View
+
+/**
+ * Schedules the banner loads, so that a screen mounting many banners does not start all their
+ * auctions and renderings at once.
+ *
+ * - At most [maxConcurrentLoads] loads are in flight, a load is in flight until its ad is received,
+ *   failed or the banner is destroyed, or at most [MAX_IN_FLIGHT_MILLIS].
+ * - Pending loads start in the order of their visibility: visible banners first, the most visible
+ *   one first, then the banners closest to the viewport, then in the order they were requested.
+ * - While the pending banners move faster than [FLING_VELOCITY_DP_PER_SECOND], i.e. during a fast
+ *   scroll or fling, no load is started.
+ * - While [isSuspended], e.g. during a full screen ad, no load is started.
+ *
+ * The pending banners are checked on every frame until a load can start, so the views have been laid
+ * out and their velocity is known. All the methods are expected to be called on the main thread.
+ */
+object POBRNBannerLoadScheduler {
+
+    /**
+     * A banner load waiting for its turn.
+     * @param view the banner view, used to measure its visibility and velocity
+     * @param start starts the load
+     */
+    class Task(val view: View, val start: () -> Unit) {
+        internal var sequence = 0L
+        internal var lastX = Int.MIN_VALUE
+        internal var lastY = Int.MIN_VALUE
+        internal var lastFrameNanos = 0L
+        internal val timeout = Runnable { POBRNBannerLoadScheduler.finish(this) }
+    }
+
+    /**
+     * Maximum number of banner loads in flight, 0 for no limit.
+     */
+    var maxConcurrentLoads = DEFAULT_MAX_CONCURRENT_LOADS
+        set(value) {
+            field = value.coerceAtLeast(0)
+            scheduleFrame()
+        }
+
+    /**
+     * Defers the pending loads until set back to false, see [POBRNFullScreenArbiter].
+     */
+    var isSuspended = false
+        set(value) {
+            field = value
+            scheduleFrame()
+        }
+
+    private val pending = ArrayList<Task>()
+    private val inFlight = HashSet<Task>()
+    private var nextSequence = 0L
+    private var isFrameScheduled = false
+    private val handler by lazy { Handler(Looper.getMainLooper()) }
+    private val location = IntArray(2)
+    private val visibleRect = Rect()
+
+    private val frameCallback = Choreographer.FrameCallback { frameTimeNanos ->
+        isFrameScheduled = false
+        onFrame(frameTimeNanos)
+    }
+
+    /**
+     * Queues the load of a banner. A task already queued or in flight is not queued again.
+     */
+    fun enqueue(task: Task) {
+        if (pending.contains(task) || inFlight.contains(task)) {
+            return
+        }
+        task.sequence = nextSequence++
+        pending.add(task)
+        scheduleFrame()
+    }
+
+    /**
+     * Marks the load of the task as finished, or removes it from the queue, which frees its slot
+     * for the next pending load.
+     */
+    fun finish(task: Task) {
+        pending.remove(task)
+        if (inFlight.remove(task)) {
+            handler.removeCallbacks(task.timeout)
+            scheduleFrame()
+        }
+    }
+
+    /**
+     * Returns the fraction of the view visible on screen, from 0 to 1.
+     */
+    fun visibleFraction(view: View): Float {
+        val area = view.width.toLong() * view.height
+        if (area == 0L || !view.isShown || !view.getGlobalVisibleRect(visibleRect)) {
+            return 0f
+        }
+        return (visibleRect.width().toLong() * visibleRect.height()).toFloat() / area
+    }
+
+    internal fun pendingCount() = pending.size
+
+    internal fun inFlightCount() = inFlight.size
+
+    private fun hasFreeSlot() = maxConcurrentLoads == 0 || inFlight.size < maxConcurrentLoads
+
+    private fun scheduleFrame() {
+        if (isFrameScheduled || isSuspended || pending.isEmpty() || !hasFreeSlot()) {
+            return
+        }
+        isFrameScheduled = true
+        Choreographer.getInstance().postFrameCallback(frameCallback)
+    }
+
+    internal fun onFrame(frameTimeNanos: Long) {
+        // Every pending view is sampled on each frame, so that the velocity is always measured
+        // against the previous frame.
+        var isFlinging = false
+        for (task in pending) {
+            isFlinging = sampleVelocity(task, frameTimeNanos) || isFlinging
+        }
+        if (!isFlinging && !isSuspended) {
+            dispatch()
+        }
+        scheduleFrame()
+    }
+
+    private fun dispatch() {
+        while (pending.isNotEmpty() && hasFreeSlot()) {
+            val task = pending.minWithOrNull(priorityComparator()) ?: return
+            pending.remove(task)
+            inFlight.add(task)
+            handler.postDelayed(task.timeout, MAX_IN_FLIGHT_MILLIS)
+            task.start()
+        }
+    }
+
+    /**
+     * @return true if the view of the task moved faster than the fling velocity since the last frame.
+     */
+    private fun sampleVelocity(task: Task, frameTimeNanos: Long): Boolean {
+        val view = task.view
+        if (!view.isAttachedToWindow) {
+            task.lastFrameNanos = 0L
+            return false
+        }
+        view.getLocationOnScreen(location)
+        val elapsedNanos = frameTimeNanos - task.lastFrameNanos
+        val isFlinging = task.lastFrameNanos != 0L && elapsedNanos > 0 && run {
+            val distance = Math.hypot(
+                (location[0] - task.lastX).toDouble(), (location[1] - task.lastY).toDouble()
+            )
+            val velocity = distance / view.resources.displayMetrics.density * NANOS_PER_SECOND / elapsedNanos
+            velocity > FLING_VELOCITY_DP_PER_SECOND
+        }
+        task.lastX = location[0]
+        task.lastY = location[1]
+        task.lastFrameNanos = frameTimeNanos
+        return isFlinging
+    }
+
+    private fun priorityComparator(): Comparator<Task> {
+        val fractions = HashMap<Task, Float>()
+        val distances = HashMap<Task, Long>()
+        for (task in pending) {
+            fractions[task] = visibleFraction(task.view)
+            distances[task] = distanceToViewport(task.view)
+        }
+        return compareByDescending<Task> { fractions[it] }
+            .thenBy { distances[it] }
+            .thenBy { it.sequence }
+    }
+
+    /**
+     * Returns the distance in pixels from the view to the visible area of its window, or
+     * [Long.MAX_VALUE] if it is not attached or laid out yet.
+     */
+    private fun distanceToViewport(view: View): Long {
+        if (!view.isAttachedToWindow || view.width == 0 || view.height == 0) {
+            return Long.MAX_VALUE
+        }
+        view.getWindowVisibleDisplayFrame(visibleRect)
+        view.getLocationOnScreen(location)
+        val dx = maxOf(visibleRect.left - (location[0] + view.width), location[0] - visibleRect.right, 0)
+        val dy = maxOf(visibleRect.top - (location[1] + view.height), location[1] - visibleRect.bottom, 0)
+        return dx.toLong() + dy
+    }
+
+    internal fun reset() {
+        pending.clear()
+        inFlight.clear()
+        nextSequence = 0L
+        isSuspended = false
+        maxConcurrentLoads = DEFAULT_MAX_CONCURRENT_LOADS
+    }
+
+    const val DEFAULT_MAX_CONCURRENT_LOADS = 2
+    const val FLING_VELOCITY_DP_PER_SECOND = 1000.0
+    const val MAX_IN_FLIGHT_MILLIS = 10_000L
+    private const val NANOS_PER_SECOND = 1_000_000_000.0
+}
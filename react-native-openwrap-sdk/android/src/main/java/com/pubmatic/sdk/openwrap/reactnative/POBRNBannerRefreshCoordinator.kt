@@ -0,0 +1,290 @@
+package com.pubmatic.sdk.openwrap.reactnative
+
+import android.os.Handler
+import android.os.Looper
+import android.os.SystemClock
+import org.json.JSONObject
+
+/**
+ * Aligns the auto refreshes of the banners on screen, so that they hit the network together
+ * instead of waking the cellular radio up once per banner and per cycle. Disabled by default,
+ * see [isEnabled].
+ *
+ * Once enabled, the SDK auto refresh of every received banner with a refresh interval is paused,
+ * and the banners are refreshed through force refresh in batches instead:
+ * - A banner is due one refresh interval after its ad was received, and may be delayed by up to
+ *   [MAX_DELAY_FRACTION] of its interval. It is never refreshed earlier than its bid allows.
+ * - A batch fires at the earliest time every banner of the batch is due, grouping the banners
+ *   whose allowed windows overlap, see [nextBatch]. Banners refreshed together stay aligned.
+ *
+ * Every banner response is also recorded against a radio model, counting the requests, the radio
+ * wake ups and the radio active time, separately for the uncoordinated and coordinated modes, so
+ * that both can be compared. All the methods are expected to be called on the main thread, except
+ * the stats ones.
+ */
+object POBRNBannerRefreshCoordinator {
+
+    /**
+     * A banner whose refresh is coordinated.
+     */
+    interface Banner {
+        fun pauseAutoRefresh()
+
+        fun resumeAutoRefresh()
+
+        /**
+         * Refreshes the banner now.
+         * @return false if the banner could not refresh, e.g. while the user interacts with it
+         */
+        fun refresh(): Boolean
+    }
+
+    internal class Entry(val banner: Banner, val intervalMillis: Long, var dueMillis: Long) {
+        var isPausedByUser = false
+        var isRefreshing = false
+
+        /** Latest time the banner may refresh. */
+        val deadlineMillis: Long
+            get() = dueMillis + (intervalMillis * MAX_DELAY_FRACTION).toLong()
+    }
+
+    /**
+     * Radio usage counters of one mode.
+     */
+    private class RadioUsage {
+        var requests = 0
+        var wakeUps = 0
+        var radioActiveMillis = 0L
+        var elapsedMillis = 0L
+
+        fun toJson(): JSONObject = JSONObject()
+            .put(REQUESTS_KEY, requests)
+            .put(WAKE_UPS_KEY, wakeUps)
+            .put(RADIO_ACTIVE_MILLIS_KEY, radioActiveMillis)
+            .put(ELAPSED_MILLIS_KEY, elapsedMillis)
+    }
+
+    /**
+     * Enables the coordinated refreshes. Disabling it resumes the SDK auto refresh of the
+     * coordinated banners.
+     */
+    var isEnabled = false
+        set(value) {
+            if (field == value) {
+                return
+            }
+            accumulateElapsed()
+            field = value
+            if (!value) {
+                entries.values.filter { !it.isPausedByUser }.forEach { it.banner.resumeAutoRefresh() }
+                entries.clear()
+                schedule()
+            }
+        }
+
+    /**
+     * Holds the batches until set back to false, see [POBRNFullScreenArbiter]. The batches due
+     * meanwhile fire right away once resumed.
+     */
+    var isSuspended = false
+        set(value) {
+            field = value
+            schedule()
+        }
+
+    private val entries = LinkedHashMap<Banner, Entry>()
+    private val handler by lazy { Handler(Looper.getMainLooper()) }
+    private val batchRunnable = Runnable { fireBatch() }
+    private var uncoordinated = RadioUsage()
+    private var coordinated = RadioUsage()
+    private var radioActiveUntilMillis = 0L
+    private var modeStartMillis = SystemClock.uptimeMillis()
+
+    /**
+     * Takes over the refresh of a banner whose ad was received, if enabled and the bid has a
+     * refresh interval.
+     * @param refreshIntervalSeconds refresh interval of the received bid
+     */
+    fun onAdReceived(banner: Banner, refreshIntervalSeconds: Int) {
+        val previous = entries.remove(banner)
+        if (!isEnabled || refreshIntervalSeconds <= 0) {
+            schedule()
+            return
+        }
+        val intervalMillis = refreshIntervalSeconds * MILLIS_PER_SECOND
+        val entry = Entry(banner, intervalMillis, SystemClock.uptimeMillis() + intervalMillis)
+        entry.isPausedByUser = previous?.isPausedByUser == true
+        entries[banner] = entry
+        banner.pauseAutoRefresh()
+        schedule()
+    }
+
+    /**
+     * Retries a coordinated banner whose refresh failed, e.g. with no fill, one refresh interval later.
+     */
+    fun onAdFailed(banner: Banner) {
+        val entry = entries[banner] ?: return
+        entry.isRefreshing = false
+        entry.dueMillis = SystemClock.uptimeMillis() + entry.intervalMillis
+        schedule()
+    }
+
+    /**
+     * Pauses the refresh of a coordinated banner on the app request.
+     * @return false if the banner is not coordinated
+     */
+    fun pause(banner: Banner): Boolean {
+        val entry = entries[banner] ?: return false
+        entry.isPausedByUser = true
+        schedule()
+        return true
+    }
+
+    /**
+     * Resumes the refresh of a coordinated banner on the app request, one refresh interval later.
+     * @return false if the banner is not coordinated
+     */
+    fun resume(banner: Banner): Boolean {
+        val entry = entries[banner] ?: return false
+        if (entry.isPausedByUser) {
+            entry.isPausedByUser = false
+            entry.dueMillis = SystemClock.uptimeMillis() + entry.intervalMillis
+            schedule()
+        }
+        return true
+    }
+
+    /**
+     * Returns true if the refresh of the banner is coordinated.
+     */
+    fun isCoordinated(banner: Banner) = entries.containsKey(banner)
+
+    /**
+     * Stops coordinating the refresh of a destroyed banner.
+     */
+    fun remove(banner: Banner) {
+        if (entries.remove(banner) != null) {
+            schedule()
+        }
+    }
+
+    /**
+     * Records a banner ad response, i.e. a network request, against the radio model.
+     */
+    @Synchronized
+    fun recordRequest() {
+        val now = SystemClock.uptimeMillis()
+        val usage = if (isEnabled) coordinated else uncoordinated
+        usage.requests++
+        if (now >= radioActiveUntilMillis) {
+            // The radio was idle, it wakes up and stays active for the tail time.
+            usage.wakeUps++
+            usage.radioActiveMillis += RADIO_TAIL_MILLIS
+        } else {
+            // The request extends the tail of the active radio.
+            usage.radioActiveMillis += now + RADIO_TAIL_MILLIS - radioActiveUntilMillis
+        }
+        radioActiveUntilMillis = now + RADIO_TAIL_MILLIS
+    }
+
+    /**
+     * Returns the requests, radio wake ups, estimated radio active time and elapsed time, for the
+     * uncoordinated and coordinated modes.
+     */
+    @Synchronized
+    fun toJson(): JSONObject {
+        accumulateElapsed()
+        return JSONObject()
+            .put(UNCOORDINATED_KEY, uncoordinated.toJson())
+            .put(COORDINATED_KEY, coordinated.toJson())
+    }
+
+    @Synchronized
+    fun resetStats() {
+        uncoordinated = RadioUsage()
+        coordinated = RadioUsage()
+        radioActiveUntilMillis = 0L
+        modeStartMillis = SystemClock.uptimeMillis()
+    }
+
+    /**
+     * Returns the fire time and the banners of the next batch: starting from the banner due first,
+     * the banners are added while their allowed windows, from due time to deadline, overlap. The
+     * batch fires at the latest due time of its banners.
+     */
+    internal fun nextBatch(candidates: Collection<Entry>): Pair<Long, List<Entry>>? {
+        val sorted = candidates.sortedBy { it.dueMillis }
+        val first = sorted.firstOrNull() ?: return null
+        var fireMillis = first.dueMillis
+        var deadlineMillis = first.deadlineMillis
+        val batch = arrayListOf(first)
+        for (entry in sorted.drop(1)) {
+            if (entry.dueMillis > deadlineMillis) {
+                break
+            }
+            batch.add(entry)
+            fireMillis = entry.dueMillis
+            deadlineMillis = minOf(deadlineMillis, entry.deadlineMillis)
+        }
+        return fireMillis to batch
+    }
+
+    internal fun entryCount() = entries.size
+
+    private fun schedule() {
+        handler.removeCallbacks(batchRunnable)
+        if (isSuspended) {
+            return
+        }
+        val (fireMillis, _) = nextBatch(schedulableEntries()) ?: return
+        handler.postAtTime(batchRunnable, fireMillis)
+    }
+
+    private fun schedulableEntries() = entries.values.filter { !it.isPausedByUser && !it.isRefreshing }
+
+    private fun fireBatch() {
+        val (_, batch) = nextBatch(schedulableEntries()) ?: return
+        val now = SystemClock.uptimeMillis()
+        for (entry in batch) {
+            if (entry.dueMillis > now) {
+                continue
+            }
+            if (entry.banner.refresh()) {
+                // Rescheduled once the refreshed ad is received or failed.
+                entry.isRefreshing = true
+            } else {
+                entry.dueMillis = now + entry.intervalMillis
+            }
+        }
+        schedule()
+    }
+
+    @Synchronized
+    private fun accumulateElapsed() {
+        val now = SystemClock.uptimeMillis()
+        (if (isEnabled) coordinated else uncoordinated).elapsedMillis += now - modeStartMillis
+        modeStartMillis = now
+    }
+
+    internal fun reset() {
+        isEnabled = false
+        isSuspended = false
+        entries.clear()
+        handler.removeCallbacks(batchRunnable)
+        resetStats()
+    }
+
+    /** Share of its refresh interval by which the refresh of a banner may be delayed. */
+    const val MAX_DELAY_FRACTION = 0.25
+
+    /** Time the cellular radio stays in its high power state after a transfer, typical of LTE. */
+    const val RADIO_TAIL_MILLIS = 10_000L
+
+    private const val MILLIS_PER_SECOND = 1000L
+    private const val UNCOORDINATED_KEY = "uncoordinated"
+    private const val COORDINATED_KEY = "coordinated"
+    private const val REQUESTS_KEY = "requests"
+    private const val WAKE_UPS_KEY = "wakeUps"
+    private const val RADIO_ACTIVE_MILLIS_KEY = "radioActiveMillis"
+    private const val ELAPSED_MILLIS_KEY = "elapsedMillis"
+}
@@ -1,13 +1,16 @@
 package com.pubmatic.sdk.openwrap.reactnative
 
+import android.os.SystemClock
 import android.view.View
 import android.view.ViewGroup
+import android.view.ViewTreeObserver
 import android.widget.FrameLayout
 import com.facebook.react.bridge.Arguments
 import com.facebook.react.bridge.WritableMap
 import com.facebook.react.uimanager.ThemedReactContext
 import com.facebook.react.uimanager.events.RCTEventEmitter
 import com.pubmatic.sdk.common.POBError
+import com.pubmatic.sdk.common.log.POBLog
 import com.pubmatic.sdk.openwrap.banner.POBBannerView
 import com.pubmatic.sdk.openwrap.core.POBBid
 import com.pubmatic.sdk.openwrap.core.POBBidEvent
@@ -24,8 +27,76 @@ class POBRNBannerView(val reactContext: ThemedReactContext) : FrameLayout(reactC
     private var banner: POBBannerView? = null
     private var viewId: Int = 0
     private var isLoaded = false
+    private var latencyTimer: POBRNLatencyTimer? = null
+    private var adUnitId: String? = null
+    // Bid of the current auction, received through the bid event listener.
+    private var pendingBid: POBBid? = null
+    // Instance id of the system trace sections, the view id once the banner is loaded.
+    private var traceInstanceId: String? = null
+    private var loadTask: POBRNBannerLoadScheduler.Task? = null
+    private var firstVisibleListener: FirstVisibleListener? = null
+    private var loadKey: String? = null
+    private var isLoadInFlight = false
+    private var hasBidEventListener = false
+    private var isAutoRefreshPausedByApp = false
+    private var receivedMillis = 0L
     var isBannerViewCreated = false
 
+    // Refreshes this banner on behalf of POBRNBannerRefreshCoordinator.
+    private val refreshTarget = object : POBRNBannerRefreshCoordinator.Banner {
+        override fun pauseAutoRefresh() {
+            banner?.pauseAutoRefresh()
+        }
+
+        override fun resumeAutoRefresh() {
+            banner?.resumeAutoRefresh()
+        }
+
+        override fun refresh(): Boolean {
+            val banner = banner ?: return false
+            // Resumed so that the paused state does not hold the refresh back, paused again by
+            // the coordinator once the ad is received.
+            banner.resumeAutoRefresh()
+            latencyTimer?.markLoad()
+            val isRefreshing = banner.forceRefresh()
+            if (!isRefreshing) {
+                banner.pauseAutoRefresh()
+                latencyTimer?.markLoadFailed()
+            }
+            return isRefreshing
+        }
+    }
+
+    // Pauses this banner while a full screen ad is showing, on behalf of POBRNFullScreenArbiter.
+    private val arbiterTarget = object : POBRNFullScreenArbiter.Banner {
+        override val refreshIntervalSeconds: Int
+            get() = banner?.bid?.refreshInterval ?: 0
+
+        override val refreshDueMillis: Long
+            get() = if (refreshIntervalSeconds > 0) receivedMillis + refreshIntervalSeconds * 1000L else 0L
+
+        override fun setSuspended(isSuspended: Boolean, isRefreshDue: Boolean) {
+            // The banners paused by the app stay paused, the coordinator holds the coordinated ones.
+            val banner = banner
+            if (banner == null || isAutoRefreshPausedByApp ||
+                POBRNBannerRefreshCoordinator.isCoordinated(refreshTarget)
+            ) {
+                return
+            }
+            if (isSuspended) {
+                banner.pauseAutoRefresh()
+                return
+            }
+            banner.resumeAutoRefresh()
+            if (isRefreshDue) {
+                latencyTimer?.markLoad()
+                if (!banner.forceRefresh()) {
+                    latencyTimer?.markLoadFailed()
+                }
+            }
+        }
+    }
+
     companion object {
         const val TAG = "POBRNBannerView"
     }
@@ -37,67 +108,136 @@ class POBRNBannerView(val reactContext: ThemedReactContext) : FrameLayout(reactC
     fun loadAd(adUnitIdDetails: String) {
         isBannerViewCreated = true
         viewId = id
+        traceInstanceId = viewId.toString()
+        trace(POBRNTracer.Step.CREATE)
         try {
             // Initialise POBBannerView by setting up ad unit details
-            val bannerAdUnitConfig = POBAdUnitDetails.build(adUnitIdDetails)
-            val banner = POBBannerView(context)
-
-            banner.init(
+            val bannerAdUnitConfig = POBRNSystemTrace.section("parseAdUnit", traceInstanceId, null) {
+                POBAdUnitDetails.build(adUnitIdDetails)
+            }
+            val key = POBRNRequestCoalescer.key(
                 bannerAdUnitConfig.publisherId, bannerAdUnitConfig.profileId,
-                bannerAdUnitConfig.adUnitId, *bannerAdUnitConfig.adSizes
+                bannerAdUnitConfig.adUnitId, adUnitIdDetails
             )
+            if (key == loadKey && (isLoadInFlight || loadTask != null)) {
+                // The same ad is already loading in this banner.
+                POBRNRequestCoalescer.recordAvoided(
+                    bannerAdUnitConfig.adUnitId, POBRNRequestCoalescer.Avoided.DUPLICATE
+                )
+                return
+            }
+            loadKey = key
+            adUnitId = bannerAdUnitConfig.adUnitId
+            (POBRNRequestCoalescer.adopt(key, bannerAdUnitConfig.adUnitId) as? ParkedBanner)?.let {
+                adoptBanner(it)
+                return
+            }
+            val banner = POBBannerView(context)
+            val timer = POBRNLatencyTimer(POBRNAdFormat.BANNER, bannerAdUnitConfig.adUnitId)
+            latencyTimer = timer
 
-            // check if 'get bid price' feature is enabled then only set bid event listener
-            bannerAdUnitConfig.enableGetBidPrice?.let { enableGetBidPrice ->
-                if(enableGetBidPrice == 1) {
-                    banner.setBidEventListener(this)
-                }
+            // Header bidding through GAM when its details are provided and the event handler is included.
+            val eventHandler = bannerAdUnitConfig.gamConfig?.let { gamConfig ->
+                POBRNGamEventHandlers.bannerEventHandler(context, gamConfig, bannerAdUnitConfig.adSizes, timer)
+            }
+            if (bannerAdUnitConfig.gamConfig != null && eventHandler == null) {
+                POBLog.warn(TAG, POBSDKPluginConstant.GAM_UNAVAILABLE_WARN_MSG + bannerAdUnitConfig.adUnitId)
+            }
+            if (eventHandler != null) {
+                banner.init(
+                    bannerAdUnitConfig.publisherId, bannerAdUnitConfig.profileId,
+                    bannerAdUnitConfig.adUnitId, eventHandler
+                )
+            } else {
+                banner.init(
+                    bannerAdUnitConfig.publisherId, bannerAdUnitConfig.profileId,
+                    bannerAdUnitConfig.adUnitId, *bannerAdUnitConfig.adSizes
+                )
+            }
+
+            // check if 'get bid price' feature is enabled or a native mediation rule is registered,
+            // then only set bid event listener
+            hasBidEventListener = bannerAdUnitConfig.enableGetBidPrice == 1 ||
+                POBRNMediationRule.forAdUnit(bannerAdUnitConfig.adUnitId) != null
+            if (hasBidEventListener) {
+                banner.setBidEventListener(this)
             }
 
             // set up listener
             banner.setListener(BannerListener())
             banner.adRequest?.let { request ->
+                bannerAdUnitConfig.gamConfig?.owNetworkTimeoutSeconds()?.let { request.networkTimeout = it }
                 bannerAdUnitConfig.requestParams?.let { requestParams ->
-                    POBSDKPluginUtils.setRequestParams(request, requestParams)
+                    trace(POBRNTracer.Step.SET_REQUEST_PARAMS)
+                    POBRNSystemTrace.section("setRequestParams", traceInstanceId, adUnitId) {
+                        POBSDKPluginUtils.setRequestParams(request, requestParams)
+                    }
                 }
             }
             banner.impression?.let { impression ->
                 bannerAdUnitConfig.impressionParams?.let { impressionParams ->
-                    POBSDKPluginUtils.setImpressionParams(impression, impressionParams)
+                    trace(POBRNTracer.Step.SET_IMPRESSION_PARAMS)
+                    POBRNSystemTrace.section("setImpressionParams", traceInstanceId, adUnitId) {
+                        POBSDKPluginUtils.setImpressionParams(impression, impressionParams)
+                    }
                 }
             }
-            banner.loadAd()
             this.banner = banner
             addView(banner)
+            POBRNFullScreenArbiter.register(arbiterTarget)
+
+            // The load starts once the scheduler gives this banner its turn.
+            finishLoadTask()
+            removeFirstVisibleListener()
+            timer.markLoadRequested()
+            val task = POBRNBannerLoadScheduler.Task(this) {
+                trace(POBRNTracer.Step.LOAD)
+                timer.markLoad()
+                isLoadInFlight = true
+                POBRNRequestCoalescer.recordAuction(bannerAdUnitConfig.adUnitId)
+                banner.loadAd()
+            }
+            loadTask = task
+            POBRNBannerLoadScheduler.enqueue(task)
         } catch (e: JSONException) {
             val errorMsg = "${POBSDKPluginConstant.INVALID_REQUEST_FAILURE_MSG} with $e"
-            reactContext.getJSModule<RCTEventEmitter>(RCTEventEmitter::class.java)
-                .receiveEvent(
-                    viewId,
-                    POBSDKPluginConstant.AD_FAILED_TO_LOAD_EVENT,
-                    convertPOBErrorToWritableMap(POBError(POBError.INVALID_REQUEST, errorMsg))
-                )
+            emitEvent(
+                POBSDKPluginConstant.AD_FAILED_TO_LOAD_EVENT,
+                convertPOBErrorToWritableMap(POBError(POBError.INVALID_REQUEST, errorMsg))
+            )
         }
     }
 
     override fun onBidReceived(bidEvent: POBBidEvent, bid: POBBid) {
-        // Create writable map and add width, height and other bid data
-        val bidMap: WritableMap = bid.toMap()
-        reactContext.getJSModule(RCTEventEmitter::class.java)
-            .receiveEvent(
-                viewId,
-                POBSDKPluginConstant.BID_RECEIVED_EVENT,
-                bidMap
+        trace(POBRNTracer.Step.BID_RECEIVED)
+        pendingBid = bid
+        latencyTimer?.markBidReceived()
+        val rule = adUnitId?.let { POBRNMediationRule.forAdUnit(it) }
+        if (rule != null) {
+            // Evaluate the registered mediation rule right away and only notify its outcome.
+            val outcome = rule.apply(
+                bidEvent, bid, latencyTimer?.durationMillis(POBRNLatencyTracker.Metric.LOAD_TO_BID)
             )
+            trace(if (outcome.isWin) POBRNTracer.Step.PROCEED_TO_LOAD else POBRNTracer.Step.PROCEED_ON_ERROR)
+            val outcomeMap = Arguments.createMap()
+            outcomeMap.putBoolean(POBSDKPluginConstant.MEDIATION_WON_KEY, outcome.isWin)
+            outcomeMap.putString(POBSDKPluginConstant.MEDIATION_REASON_KEY, outcome.reason)
+            outcome.error?.let { outcomeMap.putInt(POBSDKPluginConstant.ERROR_CODE_KEY, it.ordinal) }
+            outcomeMap.putDouble(POBSDKPluginConstant.PRICE, bid.price)
+            bid.partnerName?.let { outcomeMap.putString(POBSDKPluginConstant.PARTNER_NAME, it) }
+            attachLatency(outcomeMap)
+            emitEvent(POBSDKPluginConstant.MEDIATION_OUTCOME_EVENT, outcomeMap)
+            return
+        }
+        // Create writable map and add width, height and other bid data
+        val bidMap: WritableMap = POBRNSystemTrace.section("toMap", traceInstanceId, adUnitId) { bid.toMap() }
+        attachLatency(bidMap)
+        emitEvent(POBSDKPluginConstant.BID_RECEIVED_EVENT, bidMap)
     }
 
     override fun onBidFailed(bidEvent: POBBidEvent, error: POBError) {
-        reactContext.getJSModule(RCTEventEmitter::class.java)
-            .receiveEvent(
-                viewId,
-                POBSDKPluginConstant.BID_FAILED_EVENT,
-                convertPOBErrorToWritableMap(error)
-            )
+        trace(POBRNTracer.Step.BID_FAILED)
+        emitEvent(POBSDKPluginConstant.BID_FAILED_EVENT, convertPOBErrorToWritableMap(error))
     }
 
     /**
@@ -106,6 +246,7 @@ class POBRNBannerView(val reactContext: ThemedReactContext) : FrameLayout(reactC
      * appropriate errors will be logged
      */
     fun proceedToLoadAd() {
+        trace(POBRNTracer.Step.PROCEED_TO_LOAD)
         val proceedToLoadAdStatus = if (banner?.proceedToLoadAd() == true ) 1 else 0
         // dispatch proceedToLoadAd event with its status.
         val proceedToLoadAdStatusMap: WritableMap = Arguments.createMap()
@@ -113,12 +254,7 @@ class POBRNBannerView(val reactContext: ThemedReactContext) : FrameLayout(reactC
             POBSDKPluginConstant.BANNER_PROCEED_TO_LOAD_AD_STATUS,
             proceedToLoadAdStatus
         )
-        reactContext.getJSModule(RCTEventEmitter::class.java)
-            .receiveEvent(
-                viewId,
-                POBSDKPluginConstant.BANNER_PROCEED_TO_LOAD_AD_EVENT,
-                proceedToLoadAdStatusMap
-            )
+        emitEvent(POBSDKPluginConstant.BANNER_PROCEED_TO_LOAD_AD_EVENT, proceedToLoadAdStatusMap)
 
     }
 
@@ -136,6 +272,7 @@ class POBRNBannerView(val reactContext: ThemedReactContext) : FrameLayout(reactC
      *              proceedOnError(BidEventError#BID_EXPIRED);
      */
     fun proceedOnError(error : String) {
+        trace(POBRNTracer.Step.PROCEED_ON_ERROR)
         val errors = error.split("_")
         banner?.proceedOnError(errors[0].toBidEventError())
     }
@@ -147,10 +284,18 @@ class POBRNBannerView(val reactContext: ThemedReactContext) : FrameLayout(reactC
      * 2 resume state will applied to already paused banner ad.
      */
     fun setAutoRefreshState(autoRefreshState: Int) {
+        // The coordinated banners keep the SDK auto refresh paused, the coordinator handles the state.
         if (autoRefreshState == 1) {
-            banner?.pauseAutoRefresh()
+            isAutoRefreshPausedByApp = true
+            if (!POBRNBannerRefreshCoordinator.pause(refreshTarget)) {
+                banner?.pauseAutoRefresh()
+            }
         } else if (autoRefreshState == 2) {
-            banner?.resumeAutoRefresh()
+            isAutoRefreshPausedByApp = false
+            // While a full screen ad is showing, the arbiter resumes the banner once closed.
+            if (!POBRNBannerRefreshCoordinator.resume(refreshTarget) && !POBRNFullScreenArbiter.isShowing) {
+                banner?.resumeAutoRefresh()
+            }
         }
     }
 
@@ -162,19 +307,18 @@ class POBRNBannerView(val reactContext: ThemedReactContext) : FrameLayout(reactC
      */
     fun forceRefresh(value: Int) {
         if(value != 0){
+            latencyTimer?.markLoad()
             val forceRefreshStatus = banner?.forceRefresh() == true
+            if (!forceRefreshStatus) {
+                latencyTimer?.markLoadFailed()
+            }
             // dispatch on ad force refresh event with its status.
             val forceRefreshStatusMap: WritableMap = Arguments.createMap()
             forceRefreshStatusMap.putBoolean(
                 POBSDKPluginConstant.BANNER_FORCE_REFRESH_STATUS,
                 forceRefreshStatus
             )
-            reactContext.getJSModule(RCTEventEmitter::class.java)
-                .receiveEvent(
-                    viewId,
-                    POBSDKPluginConstant.BANNER_FORCE_REFRESH_EVENT,
-                    forceRefreshStatusMap
-                )
+            emitEvent(POBSDKPluginConstant.BANNER_FORCE_REFRESH_EVENT, forceRefreshStatusMap)
         }
     }
 
@@ -191,12 +335,7 @@ class POBRNBannerView(val reactContext: ThemedReactContext) : FrameLayout(reactC
                 POBSDKPluginConstant.BANNER_BID_EXPIRED_STATUS,
                 if (isBidExpired) 1 else 0
             )
-            reactContext.getJSModule(RCTEventEmitter::class.java)
-                .receiveEvent(
-                    viewId,
-                    POBSDKPluginConstant.BANNER_BID_EVENT,
-                    bidExpiredStatusMap
-                )
+            emitEvent(POBSDKPluginConstant.BANNER_BID_EVENT, bidExpiredStatusMap)
         }
     }
 
@@ -209,11 +348,128 @@ class POBRNBannerView(val reactContext: ThemedReactContext) : FrameLayout(reactC
     }
 
     private fun updateLayout(view: View) {
-        view.measure(
-            MeasureSpec.makeMeasureSpec(width, MeasureSpec.EXACTLY),
-            MeasureSpec.makeMeasureSpec(height, MeasureSpec.EXACTLY)
-        )
-        view.layout(left, top, left + width, top + height)
+        POBRNSystemTrace.section("updateLayout", traceInstanceId, adUnitId) {
+            view.measure(
+                MeasureSpec.makeMeasureSpec(width, MeasureSpec.EXACTLY),
+                MeasureSpec.makeMeasureSpec(height, MeasureSpec.EXACTLY)
+            )
+            view.layout(left, top, left + width, top + height)
+        }
+    }
+
+    /**
+     * Dispatches the event of this banner to the JS layer.
+     */
+    private fun emitEvent(eventName: String, params: WritableMap?) {
+        POBRNSystemTrace.section("emitEvent", traceInstanceId, adUnitId) {
+            reactContext.getJSModule(RCTEventEmitter::class.java).receiveEvent(viewId, eventName, params)
+        }
+    }
+
+    /**
+     * Records the outcome of the current auction into [POBRNBidLandscape].
+     */
+    private fun recordAuction(bid: POBBid?, isRendered: Boolean) {
+        pendingBid = null
+        adUnitId?.let { POBRNBidLandscape.record(POBRNAdFormat.BANNER, it, bid, isRendered) }
+    }
+
+    /**
+     * Records the lifecycle step of this banner. The view id is used as the trace instance id.
+     */
+    private fun trace(step: POBRNTracer.Step) {
+        if (POBRNTracer.isEnabled()) {
+            POBRNTracer.record(POBRNAdFormat.BANNER, viewId.toString(), step)
+        }
+    }
+
+    /**
+     * Adds the durations measured for the current load to the given event map, if enabled through
+     * [POBRNLatencyTracker.isPayloadEnabled].
+     */
+    private fun attachLatency(map: WritableMap) {
+        val timer = latencyTimer ?: return
+        if (!POBRNLatencyTracker.isPayloadEnabled) {
+            return
+        }
+        val latency = timer.toJson()
+        if (latency.length() == 0) {
+            return
+        }
+        val latencyMap = Arguments.createMap()
+        for (key in latency.keys()) {
+            latencyMap.putDouble(key, latency.getDouble(key))
+        }
+        map.putMap(POBSDKPluginConstant.LATENCY_KEY, latencyMap)
+    }
+
+    /**
+     * Measures the load to first frame latency on the next draw pass of the given view.
+     */
+    private fun awaitFirstFrame(view: View) {
+        val timer = latencyTimer ?: return
+        view.viewTreeObserver.addOnPreDrawListener(object : ViewTreeObserver.OnPreDrawListener {
+            override fun onPreDraw(): Boolean {
+                view.viewTreeObserver.removeOnPreDrawListener(this)
+                timer.markFirstFrame()
+                return true
+            }
+        })
+    }
+
+    /**
+     * Measures the load request to first visible latency once the given view is visible on screen,
+     * checking on every layout and scroll until then.
+     */
+    private fun awaitFirstVisible(view: View) {
+        val timer = latencyTimer ?: return
+        if (!timer.isFirstVisiblePending || firstVisibleListener != null) {
+            return
+        }
+        if (POBRNBannerLoadScheduler.visibleFraction(view) > 0f) {
+            timer.markFirstVisible()
+            return
+        }
+        val listener = FirstVisibleListener(view, timer)
+        firstVisibleListener = listener
+        view.viewTreeObserver.addOnGlobalLayoutListener(listener)
+        view.viewTreeObserver.addOnScrollChangedListener(listener)
+    }
+
+    private fun removeFirstVisibleListener() {
+        firstVisibleListener?.let { listener ->
+            val observer = listener.view.viewTreeObserver
+            observer.removeOnGlobalLayoutListener(listener)
+            observer.removeOnScrollChangedListener(listener)
+        }
+        firstVisibleListener = null
+    }
+
+    /**
+     * Takes over the banner parked by a destroyed view with the same request, replaying its load
+     * result if already received.
+     */
+    private fun adoptBanner(parked: ParkedBanner) {
+        val banner = parked.banner
+        finishLoadTask()
+        removeFirstVisibleListener()
+        latencyTimer = parked.timer
+        hasBidEventListener = false
+        isLoadInFlight = true
+        this.banner = banner
+        addView(banner)
+        POBRNFullScreenArbiter.register(arbiterTarget)
+        val listener = BannerListener()
+        banner.setListener(listener)
+        parked.replay(listener)
+    }
+
+    /**
+     * Releases the slot of the current load in [POBRNBannerLoadScheduler], or removes it from its queue.
+     */
+    private fun finishLoadTask() {
+        loadTask?.let { POBRNBannerLoadScheduler.finish(it) }
+        loadTask = null
     }
 
     private fun convertPOBErrorToWritableMap(error: POBError): WritableMap {
@@ -223,15 +479,71 @@ class POBRNBannerView(val reactContext: ThemedReactContext) : FrameLayout(reactC
         return errorMap
     }
 
+    private inner class FirstVisibleListener(val view: View, private val timer: POBRNLatencyTimer) :
+        ViewTreeObserver.OnGlobalLayoutListener, ViewTreeObserver.OnScrollChangedListener {
+
+        override fun onGlobalLayout() = check()
+
+        override fun onScrollChanged() = check()
+
+        private fun check() {
+            if (POBRNBannerLoadScheduler.visibleFraction(view) > 0f) {
+                removeFirstVisibleListener()
+                timer.markFirstVisible()
+            }
+        }
+    }
+
+    /**
+     * A banner whose view was destroyed while its load was in flight, parked in
+     * [POBRNRequestCoalescer] until adopted. Records the load result meanwhile.
+     */
+    private class ParkedBanner(val banner: POBBannerView, val timer: POBRNLatencyTimer?) :
+        POBBannerView.POBBannerViewListener() {
+        private var isReceived = false
+        private var error: POBError? = null
+
+        override fun onAdReceived(bannerView: POBBannerView) {
+            isReceived = true
+        }
+
+        override fun onAdFailed(bannerView: POBBannerView, error: POBError) {
+            this.error = error
+        }
+
+        fun replay(listener: POBBannerView.POBBannerViewListener) {
+            if (isReceived) {
+                listener.onAdReceived(banner)
+            } else {
+                error?.let { listener.onAdFailed(banner, it) }
+            }
+        }
+    }
+
     private inner class BannerListener : POBBannerView.POBBannerViewListener() {
         override fun onAdReceived(bannerView: POBBannerView) {
+            trace(POBRNTracer.Step.AD_RECEIVED)
             isLoaded = true
+            isLoadInFlight = false
+            finishLoadTask()
+            recordAuction(bannerView.bid ?: pendingBid, isRendered = true)
+            latencyTimer?.markAdReceived()
+            receivedMillis = SystemClock.uptimeMillis()
+            POBRNBannerRefreshCoordinator.recordRequest()
+            POBRNBannerRefreshCoordinator.onAdReceived(refreshTarget, bannerView.bid?.refreshInterval ?: 0)
+            POBRNFullScreenArbiter.recordBannerResponse(bannerView.bid?.creative?.length ?: 0)
+            if (POBRNFullScreenArbiter.isShowing) {
+                // Received while a full screen ad is showing, the next refresh waits until it is closed.
+                arbiterTarget.setSuspended(isSuspended = true, isRefreshDue = false)
+            }
+            awaitFirstFrame(bannerView)
+            awaitFirstVisible(bannerView)
             // Create writable map and add width, height and other bid data
-            val bidMap = bannerView.bid?.toMap()
+            val bidMap = POBRNSystemTrace.section("toMap", traceInstanceId, adUnitId) { bannerView.bid?.toMap() }
+            bidMap?.let { attachLatency(it) }
 
             // dispatch on ad receive event with bid details map.
-            reactContext.getJSModule(RCTEventEmitter::class.java)
-                .receiveEvent(viewId, POBSDKPluginConstant.AD_RECEIVED_EVENT, bidMap)
+            emitEvent(POBSDKPluginConstant.AD_RECEIVED_EVENT, bidMap)
 
             // OW IB Video starts rendering when frame is completely attached and layout pass.
             // Below delay workaround is required, in order to work InBanner Video ads
@@ -250,34 +562,35 @@ class POBRNBannerView(val reactContext: ThemedReactContext) : FrameLayout(reactC
         }
 
         override fun onAdFailed(bannerView: POBBannerView, error: POBError) {
-            reactContext.getJSModule(RCTEventEmitter::class.java)
-                .receiveEvent(
-                    viewId,
-                    POBSDKPluginConstant.AD_FAILED_TO_LOAD_EVENT,
-                    convertPOBErrorToWritableMap(error)
-                )
+            trace(POBRNTracer.Step.AD_FAILED_TO_LOAD)
+            isLoadInFlight = false
+            finishLoadTask()
+            recordAuction(pendingBid, isRendered = false)
+            latencyTimer?.markLoadFailed()
+            POBRNBannerRefreshCoordinator.recordRequest()
+            POBRNBannerRefreshCoordinator.onAdFailed(refreshTarget)
+            emitEvent(POBSDKPluginConstant.AD_FAILED_TO_LOAD_EVENT, convertPOBErrorToWritableMap(error))
         }
 
 
         override fun onAdClicked(bannerView: POBBannerView) {
-            reactContext.getJSModule(RCTEventEmitter::class.java)
-                .receiveEvent(viewId, POBSDKPluginConstant.AD_CLICKED_EVENT, null)
+            trace(POBRNTracer.Step.CLICK)
+            emitEvent(POBSDKPluginConstant.AD_CLICKED_EVENT, null)
         }
 
         override fun onAdOpened(bannerView: POBBannerView) {
-            reactContext.getJSModule(RCTEventEmitter::class.java)
-                .receiveEvent(viewId, POBSDKPluginConstant.AD_OPENED_EVENT, null)
+            trace(POBRNTracer.Step.AD_OPENED)
+            emitEvent(POBSDKPluginConstant.AD_OPENED_EVENT, null)
         }
 
         override fun onAdClosed(bannerView: POBBannerView) {
-            reactContext.getJSModule(RCTEventEmitter::class.java)
-                .receiveEvent(viewId, POBSDKPluginConstant.AD_CLOSED_EVENT, null)
+            trace(POBRNTracer.Step.CLOSE)
+            emitEvent(POBSDKPluginConstant.AD_CLOSED_EVENT, null)
         }
 
 
         override fun onAppLeaving(bannerView: POBBannerView) {
-            reactContext.getJSModule(RCTEventEmitter::class.java)
-                .receiveEvent(viewId, POBSDKPluginConstant.APP_LEAVE_EVENT, null)
+            emitEvent(POBSDKPluginConstant.APP_LEAVE_EVENT, null)
         }
 
         /**
@@ -309,8 +622,32 @@ class POBRNBannerView(val reactContext: ThemedReactContext) : FrameLayout(reactC
      * Cleans up the banner view.
      */
     fun destroy() {
-        banner?.setListener(null)
-        banner?.destroy()
+        trace(POBRNTracer.Step.DESTROY)
+        finishLoadTask()
+        removeFirstVisibleListener()
+        POBRNBannerRefreshCoordinator.remove(refreshTarget)
+        POBRNFullScreenArbiter.unregister(arbiterTarget)
+        val banner = banner
+        val key = loadKey
+        if (banner != null && key != null && isLoadInFlight && !hasBidEventListener) {
+            // Park the load in flight, so that a banner with the same request, e.g. after a remount,
+            // adopts it instead of starting another auction. The bid event flow waits on the JS side,
+            // so such banners are not parked.
+            removeView(banner)
+            val parked = ParkedBanner(banner, latencyTimer)
+            banner.setListener(parked)
+            POBRNRequestCoalescer.park(key, parked) {
+                banner.setListener(null)
+                banner.destroy()
+            }
+        } else {
+            banner?.setListener(null)
+            banner?.destroy()
+        }
+        this.banner = null
+        isLoadInFlight = false
+        loadKey = null
+        receivedMillis = 0L
         removeAllViews()
     }
 }
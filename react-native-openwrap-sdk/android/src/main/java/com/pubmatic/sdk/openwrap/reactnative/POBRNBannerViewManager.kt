@@ -175,6 +175,13 @@ class POBRNBannerViewManager : SimpleViewManager<POBRNBannerView>() {
                 POBSDKPluginConstant.BANNER_BID_EVENT
             )
         )
+        builder.put(
+            POBSDKPluginConstant.MEDIATION_OUTCOME_EVENT,
+            MapBuilder.of(
+                POBSDKPluginConstant.BANNER_EVENT_REGISTRATION_KEY,
+                POBSDKPluginConstant.MEDIATION_OUTCOME_EVENT
+            )
+        )
         return builder.build()
     }
 
@@ -0,0 +1,475 @@
+package com.pubmatic.sdk.openwrap.reactnative
+
+import android.content.Context
+import com.pubmatic.sdk.common.log.POBLog
+import com.pubmatic.sdk.openwrap.core.POBBid
+import org.json.JSONArray
+import org.json.JSONObject
+import java.io.File
+import java.io.IOException
+import java.io.RandomAccessFile
+import java.nio.ByteBuffer
+import java.nio.ByteOrder
+import java.nio.MappedByteBuffer
+import java.nio.channels.FileChannel
+
+/**
+ * Opt-in on-device log of the auction outcomes, i.e. the bid landscape, used to tune the floors.
+ * Disabled by default, see [setEnabled].
+ *
+ * Every outcome is appended as a fixed width binary row to a memory-mapped rolling file,
+ * [FILE_NAME], so recording neither allocates JS objects nor performs I/O per auction. Once the
+ * file holds [capacity] rows, the oldest rows are overwritten. The ad unit ids, partner names and
+ * deal ids are interned in a string table of the same file. Once the table is full, it is rebuilt
+ * with the strings of the retained rows only, the strings of the overwritten rows being reclaimed.
+ * The deal ids, unbounded, may only fill [DEAL_STRING_CAPACITY] slots, so the ad unit ids and
+ * partner names always find room.
+ *
+ * File layout, little endian:
+ * - header of [HEADER_SIZE] bytes: magic "PBL1", version, row size, row capacity, string capacity,
+ *   number of rows ever written (the row of index n being at n % capacity), number of strings.
+ * - string table of [STRING_CAPACITY] slots of [STRING_SLOT_SIZE] bytes: length, UTF-8 bytes.
+ * - rows of [ROW_SIZE] bytes: timestamp in ms, price, ad unit id, partner name and deal id string
+ *   indexes ([NO_STRING] if none), ad format ordinal, [Outcome] code.
+ *
+ * The methods may be called from any thread.
+ */
+object POBRNBidLandscape {
+
+    /**
+     * Outcome of an auction, as seen by the plugin.
+     */
+    enum class Outcome(val code: Int) {
+        /** No bid was received. */
+        NO_BID(0),
+        /** A bid was received but not rendered, e.g. the app proceeded on error. */
+        LOST(1),
+        /** The bid was rendered. */
+        WON(2)
+    }
+
+    /** Whether the auction outcomes are recorded. */
+    @Volatile
+    var isEnabled = false
+        private set
+
+    private var directory: File? = null
+    private var buffer: MappedByteBuffer? = null
+    private var capacity = 0
+    private var rowCount = 0L
+    // Row count from which the string table may be rebuilt again, see compactStrings.
+    private var nextCompactionRowCount = 0L
+    private var compactionCount = 0
+    private val strings = ArrayList<String>()
+    private val stringIndexes = HashMap<String, Int>()
+
+    /**
+     * Keeps the directory of the log file, the file being opened once enabled.
+     */
+    fun initialize(context: Context) {
+        (context.applicationContext ?: context).filesDir?.let { initialize(it) }
+    }
+
+    @Synchronized
+    internal fun initialize(directory: File) {
+        this.directory = directory
+    }
+
+    /**
+     * Enables or disables the recording. The rows recorded by the previous sessions are kept,
+     * unless the capacity changed.
+     * @param capacity number of rows retained by the rolling file
+     */
+    @Synchronized
+    fun setEnabled(enabled: Boolean, capacity: Int = DEFAULT_CAPACITY) {
+        if (!enabled) {
+            isEnabled = false
+            buffer?.force()
+            return
+        }
+        val directory = directory ?: return
+        if (buffer == null || this.capacity != capacity) {
+            open(File(directory, FILE_NAME), capacity.coerceAtLeast(1))
+        }
+        isEnabled = buffer != null
+    }
+
+    /**
+     * Records the outcome of an auction of the given ad unit, once its ad is received or failed.
+     * @param bid the received bid, null if no bid was received
+     * @param isRendered whether the ad of the bid was received
+     */
+    fun record(format: POBRNAdFormat, adUnitId: String, bid: POBBid?, isRendered: Boolean) {
+        if (!isEnabled) {
+            return
+        }
+        val outcome = when {
+            bid == null -> Outcome.NO_BID
+            isRendered -> Outcome.WON
+            else -> Outcome.LOST
+        }
+        record(System.currentTimeMillis(), format, adUnitId, bid?.partnerName, bid?.dealId, bid?.price ?: 0.0, outcome)
+    }
+
+    @Synchronized
+    internal fun record(
+        timestampMillis: Long,
+        format: POBRNAdFormat,
+        adUnitId: String,
+        partnerName: String?,
+        dealId: String?,
+        price: Double,
+        outcome: Outcome
+    ) {
+        val buffer = buffer ?: return
+        val compactions = compactionCount
+        var adUnit = intern(adUnitId)
+        var partner = intern(partnerName)
+        val deal = intern(dealId, DEAL_STRING_CAPACITY)
+        if (compactionCount != compactions) {
+            // The table was rebuilt, at most once per row, the first strings may have moved.
+            adUnit = intern(adUnitId)
+            partner = intern(partnerName)
+        }
+        val position = rowPosition(rowCount % capacity)
+        buffer.putLong(position, timestampMillis)
+        buffer.putDouble(position + 8, price)
+        buffer.putShort(position + 16, adUnit.toShort())
+        buffer.putShort(position + 18, partner.toShort())
+        buffer.putShort(position + 20, deal.toShort())
+        buffer.put(position + 22, format.ordinal.toByte())
+        buffer.put(position + 23, outcome.code.toByte())
+        // The row count is published once the row is complete.
+        rowCount++
+        buffer.putLong(ROW_COUNT_OFFSET, rowCount)
+    }
+
+    /**
+     * Returns the summary of the retained rows:
+     * - per partner, the number of bids and wins, and the win rate.
+     * - per ad unit, the number of auctions and of auctions without bid, and the bid price
+     *   percentiles.
+     */
+    @Synchronized
+    fun summary(): JSONObject {
+        val partners = LinkedHashMap<Int, IntArray>()
+        val prices = LinkedHashMap<Int, MutableList<Double>>()
+        val noBids = HashMap<Int, Int>()
+        val buffer = buffer
+        if (buffer != null) {
+            forEachRow { position ->
+                val adUnit = index(buffer.getShort(position + 16))
+                val outcome = buffer.get(position + 23).toInt()
+                val adUnitPrices = prices.getOrPut(adUnit) { ArrayList() }
+                if (outcome == Outcome.NO_BID.code) {
+                    noBids[adUnit] = (noBids[adUnit] ?: 0) + 1
+                    return@forEachRow
+                }
+                adUnitPrices.add(buffer.getDouble(position + 8))
+                val partnerCounts = partners.getOrPut(index(buffer.getShort(position + 18))) { IntArray(2) }
+                partnerCounts[0]++
+                if (outcome == Outcome.WON.code) {
+                    partnerCounts[1]++
+                }
+            }
+        }
+        val partnersJson = JSONArray()
+        partners.forEach { (partner, counts) ->
+            partnersJson.put(
+                JSONObject()
+                    .put(PARTNER_NAME_KEY, stringAt(partner) ?: JSONObject.NULL)
+                    .put(BIDS_KEY, counts[0])
+                    .put(WINS_KEY, counts[1])
+                    .put(WIN_RATE_KEY, counts[1].toDouble() / counts[0])
+            )
+        }
+        val adUnitsJson = JSONArray()
+        prices.forEach { (adUnit, adUnitPrices) ->
+            adUnitPrices.sort()
+            val noBidCount = noBids[adUnit] ?: 0
+            adUnitsJson.put(
+                JSONObject()
+                    .put(AD_UNIT_ID_KEY, stringAt(adUnit) ?: JSONObject.NULL)
+                    .put(AUCTIONS_KEY, adUnitPrices.size + noBidCount)
+                    .put(NO_BIDS_KEY, noBidCount)
+                    .put(PRICE_P50_KEY, percentile(adUnitPrices, 50.0))
+                    .put(PRICE_P90_KEY, percentile(adUnitPrices, 90.0))
+                    .put(PRICE_P99_KEY, percentile(adUnitPrices, 99.0))
+            )
+        }
+        return JSONObject()
+            .put(ROWS_KEY, minOf(rowCount, capacity.toLong()))
+            .put(PARTNERS_KEY, partnersJson)
+            .put(AD_UNITS_KEY, adUnitsJson)
+    }
+
+    /**
+     * Writes the retained rows, oldest first, into a file of the same layout sized to the rows,
+     * e.g. to be uploaded.
+     * @return the exported file, null if the recording was never enabled or the export failed
+     */
+    @Synchronized
+    fun export(): File? {
+        val buffer = buffer ?: return null
+        val directory = directory ?: return null
+        val retained = minOf(rowCount, capacity.toLong()).toInt()
+        val export = ByteBuffer.allocate(HEADER_SIZE + STRING_CAPACITY * STRING_SLOT_SIZE + maxOf(retained, 1) * ROW_SIZE)
+            .order(ByteOrder.LITTLE_ENDIAN)
+        writeHeader(export, maxOf(retained, 1))
+        export.putLong(ROW_COUNT_OFFSET, retained.toLong())
+        export.putInt(STRING_COUNT_OFFSET, strings.size)
+        for (i in 0 until STRING_CAPACITY * STRING_SLOT_SIZE) {
+            export.put(HEADER_SIZE + i, buffer.get(HEADER_SIZE + i))
+        }
+        var row = 0
+        forEachRow { position ->
+            val exportPosition = HEADER_SIZE + STRING_CAPACITY * STRING_SLOT_SIZE + row++ * ROW_SIZE
+            for (i in 0 until ROW_SIZE) {
+                export.put(exportPosition + i, buffer.get(position + i))
+            }
+        }
+        val exportFile = File(directory, EXPORT_FILE_NAME)
+        return try {
+            exportFile.writeBytes(export.array())
+            exportFile
+        } catch (e: IOException) {
+            POBLog.warn(TAG, POBSDKPluginConstant.BID_LANDSCAPE_FAILURE_MSG + e)
+            null
+        }
+    }
+
+    /**
+     * Removes all the recorded rows and strings.
+     */
+    @Synchronized
+    fun clear() {
+        val buffer = buffer ?: return
+        rowCount = 0
+        nextCompactionRowCount = 0
+        strings.clear()
+        stringIndexes.clear()
+        buffer.putLong(ROW_COUNT_OFFSET, 0)
+        buffer.putInt(STRING_COUNT_OFFSET, 0)
+    }
+
+    /**
+     * Maps the log file, restoring its rows and strings if it has the expected layout, otherwise
+     * the file is recreated.
+     */
+    private fun open(file: File, capacity: Int) {
+        this.buffer = null
+        this.capacity = capacity
+        rowCount = 0
+        nextCompactionRowCount = 0
+        strings.clear()
+        stringIndexes.clear()
+        val size = HEADER_SIZE + STRING_CAPACITY * STRING_SLOT_SIZE + capacity.toLong() * ROW_SIZE
+        val buffer = try {
+            RandomAccessFile(file, "rw").use { randomAccessFile ->
+                if (randomAccessFile.length() != size) {
+                    randomAccessFile.setLength(0)
+                    randomAccessFile.setLength(size)
+                }
+                // The mapping stays valid once the channel is closed.
+                randomAccessFile.channel.map(FileChannel.MapMode.READ_WRITE, 0, size)
+            }
+        } catch (e: IOException) {
+            POBLog.warn(TAG, POBSDKPluginConstant.BID_LANDSCAPE_FAILURE_MSG + e)
+            return
+        }
+        buffer.order(ByteOrder.LITTLE_ENDIAN)
+        if (buffer.getInt(0) == MAGIC && buffer.getShort(4).toInt() == VERSION &&
+            buffer.getInt(CAPACITY_OFFSET) == capacity) {
+            rowCount = buffer.getLong(ROW_COUNT_OFFSET)
+            val stringCount = buffer.getInt(STRING_COUNT_OFFSET).coerceIn(0, STRING_CAPACITY)
+            for (i in 0 until stringCount) {
+                val string = readString(buffer, i)
+                stringIndexes[string] = i
+                strings.add(string)
+            }
+        } else {
+            writeHeader(buffer, capacity)
+        }
+        this.buffer = buffer
+    }
+
+    private fun writeHeader(buffer: ByteBuffer, capacity: Int) {
+        buffer.putInt(0, MAGIC)
+        buffer.putShort(4, VERSION.toShort())
+        buffer.putShort(6, ROW_SIZE.toShort())
+        buffer.putInt(CAPACITY_OFFSET, capacity)
+        buffer.putInt(12, STRING_CAPACITY)
+        buffer.putLong(ROW_COUNT_OFFSET, 0)
+        buffer.putInt(STRING_COUNT_OFFSET, 0)
+    }
+
+    /**
+     * Returns the index of the given string in the string table, adding it if needed. The strings
+     * longer than the slot are truncated. Returns [NO_STRING] for null, or if the table stays full
+     * once rebuilt.
+     * @param limit number of slots the string may be added within
+     */
+    private fun intern(value: String?, limit: Int = STRING_CAPACITY): Int {
+        val buffer = buffer ?: return NO_STRING
+        if (value == null) {
+            return NO_STRING
+        }
+        val bytes = truncate(value.toByteArray(Charsets.UTF_8))
+        val string = String(bytes, Charsets.UTF_8)
+        stringIndexes[string]?.let { return it }
+        if (strings.size >= limit) {
+            compactStrings(buffer)
+            if (strings.size >= limit) {
+                return NO_STRING
+            }
+        }
+        val index = strings.size
+        writeString(buffer, index, bytes)
+        strings.add(string)
+        stringIndexes[string] = index
+        buffer.putInt(STRING_COUNT_OFFSET, strings.size)
+        return index
+    }
+
+    /**
+     * Rebuilds the string table with the strings of the retained rows, but the row about to be
+     * overwritten, and updates the rows with their new indexes. Runs at most once every
+     * [capacity] / 16 rows, as it scans all of them.
+     */
+    private fun compactStrings(buffer: ByteBuffer) {
+        if (rowCount < nextCompactionRowCount) {
+            return
+        }
+        nextCompactionRowCount = rowCount + maxOf(capacity / 16, 1)
+        compactionCount++
+        val retained = minOf(rowCount, capacity.toLong())
+        if (rowCount >= capacity) {
+            // The oldest row, overwritten by the row being recorded.
+            val position = rowPosition(rowCount % capacity)
+            STRING_OFFSETS.forEach { buffer.putShort(position + it, NO_STRING.toShort()) }
+        }
+        val kept = ArrayList<String>()
+        val newIndexes = HashMap<Int, Int>()
+        for (row in rowCount - retained until rowCount) {
+            val position = rowPosition(row % capacity)
+            for (offset in STRING_OFFSETS) {
+                val index = index(buffer.getShort(position + offset))
+                val newIndex = if (index < strings.size) {
+                    newIndexes.getOrPut(index) { kept.add(strings[index]); kept.size - 1 }
+                } else {
+                    NO_STRING
+                }
+                buffer.putShort(position + offset, newIndex.toShort())
+            }
+        }
+        strings.clear()
+        stringIndexes.clear()
+        kept.forEachIndexed { index, string ->
+            writeString(buffer, index, string.toByteArray(Charsets.UTF_8))
+            strings.add(string)
+            stringIndexes[string] = index
+        }
+        buffer.putInt(STRING_COUNT_OFFSET, strings.size)
+    }
+
+    private fun writeString(buffer: ByteBuffer, index: Int, bytes: ByteArray) {
+        val position = HEADER_SIZE + index * STRING_SLOT_SIZE
+        buffer.put(position, bytes.size.toByte())
+        bytes.forEachIndexed { i, byte -> buffer.put(position + 1 + i, byte) }
+    }
+
+    /**
+     * Truncates the UTF-8 bytes to the slot, without splitting a character.
+     */
+    private fun truncate(bytes: ByteArray): ByteArray {
+        if (bytes.size <= MAX_STRING_BYTES) {
+            return bytes
+        }
+        var length = MAX_STRING_BYTES
+        while (length > 0 && (bytes[length].toInt() and 0xC0) == 0x80) {
+            length--
+        }
+        return bytes.copyOf(length)
+    }
+
+    private fun readString(buffer: ByteBuffer, index: Int): String {
+        val position = HEADER_SIZE + index * STRING_SLOT_SIZE
+        val length = (buffer.get(position).toInt() and 0xFF).coerceAtMost(MAX_STRING_BYTES)
+        val bytes = ByteArray(length) { buffer.get(position + 1 + it) }
+        return String(bytes, Charsets.UTF_8)
+    }
+
+    private fun stringAt(index: Int): String? = strings.getOrNull(index)
+
+    private fun index(value: Short): Int = value.toInt() and 0xFFFF
+
+    private fun rowPosition(row: Long): Int = HEADER_SIZE + STRING_CAPACITY * STRING_SLOT_SIZE + row.toInt() * ROW_SIZE
+
+    /**
+     * Calls the block with the position of every retained row, oldest first.
+     */
+    private inline fun forEachRow(block: (Int) -> Unit) {
+        val retained = minOf(rowCount, capacity.toLong())
+        for (row in rowCount - retained until rowCount) {
+            block(rowPosition(row % capacity))
+        }
+    }
+
+    /**
+     * Nearest rank percentile of the sorted values, 0 if empty.
+     */
+    private fun percentile(sortedValues: List<Double>, percentile: Double): Double {
+        if (sortedValues.isEmpty()) {
+            return 0.0
+        }
+        val rank = Math.ceil(percentile / 100.0 * sortedValues.size).toInt().coerceIn(1, sortedValues.size)
+        return sortedValues[rank - 1]
+    }
+
+    @Synchronized
+    internal fun reset() {
+        isEnabled = false
+        directory = null
+        buffer = null
+        capacity = 0
+        rowCount = 0
+        nextCompactionRowCount = 0
+        strings.clear()
+        stringIndexes.clear()
+    }
+
+    const val FILE_NAME = "pobrn_bid_landscape.bin"
+    const val EXPORT_FILE_NAME = "pobrn_bid_landscape_export.bin"
+    const val DEFAULT_CAPACITY = 16_384
+    const val HEADER_SIZE = 32
+    const val ROW_SIZE = 24
+    const val STRING_CAPACITY = 1024
+    const val STRING_SLOT_SIZE = 64
+    const val DEAL_STRING_CAPACITY = 768
+    const val NO_STRING = 0xFFFF
+
+    private const val TAG = "POBRNBidLandscape"
+    // "PBL1" in little endian.
+    private const val MAGIC = 0x314C4250
+    private const val VERSION = 1
+    private const val CAPACITY_OFFSET = 8
+    private const val ROW_COUNT_OFFSET = 16
+    private const val STRING_COUNT_OFFSET = 24
+    private const val MAX_STRING_BYTES = STRING_SLOT_SIZE - 1
+    // Offsets of the ad unit id, partner name and deal id indexes in a row.
+    private val STRING_OFFSETS = intArrayOf(16, 18, 20)
+
+    private const val ROWS_KEY = "rows"
+    private const val PARTNERS_KEY = "partners"
+    private const val AD_UNITS_KEY = "adUnits"
+    private const val PARTNER_NAME_KEY = "partnerName"
+    private const val BIDS_KEY = "bids"
+    private const val WINS_KEY = "wins"
+    private const val WIN_RATE_KEY = "winRate"
+    private const val AD_UNIT_ID_KEY = "adUnitId"
+    private const val AUCTIONS_KEY = "auctions"
+    private const val NO_BIDS_KEY = "noBids"
+    private const val PRICE_P50_KEY = "priceP50"
+    private const val PRICE_P90_KEY = "priceP90"
+    private const val PRICE_P99_KEY = "priceP99"
+}
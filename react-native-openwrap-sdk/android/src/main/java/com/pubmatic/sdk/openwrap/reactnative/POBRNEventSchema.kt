@@ -0,0 +1,90 @@
+// Generated by scripts/generate-event-schema.js from scripts/event-schema.json, do not edit.
+package com.pubmatic.sdk.openwrap.reactnative
+
+/**
+ * Ids of the full screen ad events and codes of their payload keys, shared with the iOS and JS
+ * layers. An event is emitted as `{"i": instanceId, "e": event id, "x": ext}`, the top level keys
+ * of the ext being replaced by their codes.
+ */
+internal object POBRNEventSchema {
+
+    //region: Event ids
+    /** The ad is received. */
+    const val AD_RECEIVED = 0
+    /** The ad failed to load. */
+    const val AD_FAILED_TO_LOAD = 1
+    /** The ad failed to show. */
+    const val AD_FAILED_TO_SHOW = 2
+    /** The ad is clicked. */
+    const val AD_CLICKED = 3
+    /** The ad is presented in full screen. */
+    const val AD_OPENED = 4
+    /** The ad is dismissed. */
+    const val AD_CLOSED = 5
+    /** The received ad expired. */
+    const val AD_EXPIRED = 6
+    /** The app goes to the background after a click. */
+    const val APP_LEAVING = 7
+    /** The user earned the reward of a rewarded ad. */
+    const val RECEIVE_REWARD = 8
+    /** The video of the ad played until its end. */
+    const val VIDEO_PLAYBACK_COMPLETED = 9
+    /** The OpenWrap bid is received, waiting for proceedToLoadAd or proceedOnError. */
+    const val BID_RECEIVED = 10
+    /** No OpenWrap bid is received. */
+    const val BID_FAILED = 11
+    /** The native mediation rule decided on the OpenWrap bid. */
+    const val MEDIATION_OUTCOME = 12
+    const val EVENT_COUNT = 13
+    //endregion
+
+    //region: Event names
+    const val AD_RECEIVED_NAME = "onAdReceived"
+    const val AD_FAILED_TO_LOAD_NAME = "onAdFailedToLoad"
+    const val AD_FAILED_TO_SHOW_NAME = "onAdFailedToShow"
+    const val AD_CLICKED_NAME = "onAdClicked"
+    const val AD_OPENED_NAME = "onAdOpened"
+    const val AD_CLOSED_NAME = "onAdClosed"
+    const val AD_EXPIRED_NAME = "onAdExpired"
+    const val APP_LEAVING_NAME = "onAppLeaving"
+    const val RECEIVE_REWARD_NAME = "onReceiveReward"
+    const val VIDEO_PLAYBACK_COMPLETED_NAME = "onVideoPlaybackCompleted"
+    const val BID_RECEIVED_NAME = "onBidReceived"
+    const val BID_FAILED_NAME = "onBidFailed"
+    const val MEDIATION_OUTCOME_NAME = "onMediationOutcome"
+    //endregion
+
+    //region: Envelope keys
+    const val INSTANCE_ID_KEY = "i"
+    const val EVENT_KEY = "e"
+    const val EXT_KEY = "x"
+    //endregion
+
+    /** Codes of the ext keys, by key name. */
+    val KEY_CODES: Map<String, String> = hashMapOf(
+        "errorCode" to "c",
+        "errorMessage" to "m",
+        "price" to "p",
+        "grossPrice" to "g",
+        "targeting" to "t",
+        "width" to "w",
+        "height" to "h",
+        "crType" to "ct",
+        "partnerName" to "pn",
+        "bidId" to "b",
+        "impressionId" to "im",
+        "bundle" to "bu",
+        "status" to "s",
+        "creativeId" to "ci",
+        "nurl" to "nu",
+        "lurl" to "lu",
+        "creative" to "cr",
+        "dealId" to "d",
+        "refreshInterval" to "ri",
+        "rewardAmount" to "ra",
+        "rewardCurrencyType" to "rc",
+        "latency" to "l",
+        "won" to "wo",
+        "reason" to "r"
+    )
+}
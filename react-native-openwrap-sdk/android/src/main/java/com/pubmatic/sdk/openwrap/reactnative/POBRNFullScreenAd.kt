@@ -69,4 +69,14 @@ interface POBRNFullScreenAd {
      * Method to check if Bid is expired for the Ad
      */
     fun isBidExpired() : Boolean
+
+    /**
+     * Method to check if a load of the Full Screen ad is in progress
+     */
+    fun isLoading() : Boolean
+
+    /**
+     * Method to get the price of the bid of the Full Screen ad, 0 if it has no bid
+     */
+    fun getBidPrice() : Double
 }
\ No newline at end of file
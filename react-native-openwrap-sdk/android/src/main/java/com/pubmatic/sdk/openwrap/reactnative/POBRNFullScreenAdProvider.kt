@@ -13,6 +13,13 @@ interface POBRNFullScreenAdProvider {
      */
     fun createAdInstance(instanceId : String, publisherId : String, profileId : Int, adUnitId : String)
 
+    /**
+     * Method to create instance of full screen ad for GAM header bidding
+     *
+     * @param gamConfig the GAM details json, see [POBRNGamConfig.build]
+     */
+    fun createGamAdInstance(instanceId : String, publisherId : String, profileId : Int, adUnitId : String, gamConfig : String)
+
     /**
      * Method to load ad
      */
@@ -73,4 +80,22 @@ interface POBRNFullScreenAdProvider {
      * @param promise Used to resolve with the 1 or 0 value based on bid expiry
      */
     fun isBidExpired(instanceId : String, promise: Promise)
+
+    /**
+     * Method to add the Full screen ad with associated [instanceId] to a show group, see [POBRNShowFallback]
+     */
+    fun addToGroup(group : String, instanceId : String)
+
+    /**
+     * Method to remove the Full screen ad with associated [instanceId] from a show group
+     */
+    fun removeFromGroup(group : String, instanceId : String)
+
+    /**
+     * Method to show the best ready Full screen ad of a show group, see [POBRNShowFallback]
+     *
+     * @param budgetMillis Time to wait for a loading ad when none of the group is ready
+     * @param promise Used to resolve with the instance id of the ad shown, null if none was shown
+     */
+    fun showBestAvailable(group : String, budgetMillis : Double, promise: Promise)
 }
\ No newline at end of file
@@ -0,0 +1,192 @@
+package com.pubmatic.sdk.openwrap.reactnative
+
+import android.os.SystemClock
+import org.json.JSONObject
+
+/**
+ * Gives the full screen ads priority over the banners: from the first interstitial or rewarded ad
+ * opened until the last one is closed or destroyed, the banners do not compete with it for the
+ * bandwidth and the CPU.
+ *
+ * - The auto refresh of every banner is paused, including the coordinated refreshes of
+ *   [POBRNBannerRefreshCoordinator], and the banner loads queued in [POBRNBannerLoadScheduler]
+ *   are deferred.
+ * - Once closed, the refreshes and the loads resume. The banners whose refresh fell due during the
+ *   show refresh right away.
+ *
+ * The stats estimate the bandwidth freed: the refreshes suppressed and the loads deferred during
+ * the shows, times the average size of the banner responses. The creative assets are not counted,
+ * so it is a lower bound. All the methods are expected to be called on the main thread, except the
+ * stats ones.
+ */
+object POBRNFullScreenArbiter {
+
+    /**
+     * A banner paused while a full screen ad is showing.
+     */
+    interface Banner {
+        /** Refresh interval of the current bid in seconds, 0 if the banner does not refresh. */
+        val refreshIntervalSeconds: Int
+
+        /** Uptime at which the current bid is due for refresh, 0 if the banner does not refresh. */
+        val refreshDueMillis: Long
+
+        /**
+         * Pauses or resumes the banner.
+         * @param isSuspended false once the full screen ads are closed
+         * @param isRefreshDue true if the refresh of the banner fell due during the show
+         */
+        fun setSuspended(isSuspended: Boolean, isRefreshDue: Boolean)
+    }
+
+    private class Stats {
+        var shows = 0
+        var showMillis = 0L
+        var suspendedBanners = 0
+        var suppressedRefreshes = 0L
+        var deferredLoads = 0
+        var caughtUpBanners = 0
+        var responses = 0
+        var responseBytes = 0L
+    }
+
+    private val banners = LinkedHashSet<Banner>()
+    private val showingAds = HashSet<String>()
+    private var showStartMillis = 0L
+    private var stats = Stats()
+
+    /** True while a full screen ad is showing. */
+    val isShowing: Boolean
+        get() = showingAds.isNotEmpty()
+
+    /**
+     * Registers a banner, paused right away if a full screen ad is showing.
+     */
+    fun register(banner: Banner) {
+        if (banners.add(banner) && isShowing) {
+            banner.setSuspended(isSuspended = true, isRefreshDue = false)
+        }
+    }
+
+    fun unregister(banner: Banner) {
+        banners.remove(banner)
+    }
+
+    /**
+     * Pauses the banners when the first full screen ad opens.
+     * @param instanceId the full screen ad instance
+     */
+    fun onFullScreenOpened(instanceId: String) {
+        if (!showingAds.add(instanceId) || showingAds.size > 1) {
+            return
+        }
+        showStartMillis = SystemClock.uptimeMillis()
+        POBRNBannerLoadScheduler.isSuspended = true
+        POBRNBannerRefreshCoordinator.isSuspended = true
+        banners.forEach { it.setSuspended(isSuspended = true, isRefreshDue = false) }
+        synchronized(this) {
+            stats.shows++
+            stats.suspendedBanners += banners.size
+        }
+    }
+
+    /**
+     * Resumes the banners when the last full screen ad is closed, failed to show or destroyed.
+     * @param instanceId the full screen ad instance
+     */
+    fun onFullScreenClosed(instanceId: String) {
+        if (!showingAds.remove(instanceId) || showingAds.isNotEmpty()) {
+            return
+        }
+        val now = SystemClock.uptimeMillis()
+        val showMillis = now - showStartMillis
+        var suppressedRefreshes = 0L
+        var caughtUpBanners = 0
+        // Copied, resuming may refresh a banner which registers again.
+        for (banner in banners.toList()) {
+            val dueMillis = banner.refreshDueMillis
+            val isRefreshDue = dueMillis in 1..now
+            if (isRefreshDue) {
+                suppressedRefreshes += suppressedRefreshes(
+                    dueMillis, banner.refreshIntervalSeconds * MILLIS_PER_SECOND, showStartMillis, now
+                )
+                caughtUpBanners++
+            }
+            banner.setSuspended(isSuspended = false, isRefreshDue = isRefreshDue)
+        }
+        val deferredLoads = POBRNBannerLoadScheduler.pendingCount()
+        POBRNBannerRefreshCoordinator.isSuspended = false
+        POBRNBannerLoadScheduler.isSuspended = false
+        synchronized(this) {
+            stats.showMillis += showMillis
+            stats.suppressedRefreshes += suppressedRefreshes
+            stats.caughtUpBanners += caughtUpBanners
+            stats.deferredLoads += deferredLoads
+        }
+    }
+
+    /**
+     * Records the size of a banner response, averaged to estimate the bandwidth freed.
+     */
+    @Synchronized
+    fun recordBannerResponse(bytes: Int) {
+        stats.responses++
+        stats.responseBytes += bytes
+    }
+
+    /**
+     * Returns the number of shows, their duration, the banners paused, the refreshes suppressed,
+     * the loads deferred, the banners refreshed on close and the estimated bytes freed.
+     */
+    @Synchronized
+    fun toJson(): JSONObject {
+        val averageResponseBytes = if (stats.responses == 0) 0L else stats.responseBytes / stats.responses
+        return JSONObject()
+            .put(SHOWS_KEY, stats.shows)
+            .put(SHOW_MILLIS_KEY, stats.showMillis)
+            .put(SUSPENDED_BANNERS_KEY, stats.suspendedBanners)
+            .put(SUPPRESSED_REFRESHES_KEY, stats.suppressedRefreshes)
+            .put(DEFERRED_LOADS_KEY, stats.deferredLoads)
+            .put(CAUGHT_UP_BANNERS_KEY, stats.caughtUpBanners)
+            .put(AVERAGE_RESPONSE_BYTES_KEY, averageResponseBytes)
+            .put(BYTES_FREED_KEY, (stats.suppressedRefreshes + stats.deferredLoads) * averageResponseBytes)
+    }
+
+    @Synchronized
+    fun resetStats() {
+        stats = Stats()
+    }
+
+    /**
+     * Returns the number of refreshes, every interval from the due time on, which fell within the show.
+     */
+    internal fun suppressedRefreshes(dueMillis: Long, intervalMillis: Long, showStartMillis: Long, showEndMillis: Long): Long {
+        if (intervalMillis <= 0 || dueMillis > showEndMillis) {
+            return 0
+        }
+        val firstMillis = if (dueMillis >= showStartMillis) {
+            dueMillis
+        } else {
+            dueMillis + (showStartMillis - dueMillis + intervalMillis - 1) / intervalMillis * intervalMillis
+        }
+        return if (firstMillis > showEndMillis) 0 else 1 + (showEndMillis - firstMillis) / intervalMillis
+    }
+
+    internal fun reset() {
+        banners.clear()
+        showingAds.clear()
+        POBRNBannerLoadScheduler.isSuspended = false
+        POBRNBannerRefreshCoordinator.isSuspended = false
+        resetStats()
+    }
+
+    private const val MILLIS_PER_SECOND = 1000L
+    private const val SHOWS_KEY = "shows"
+    private const val SHOW_MILLIS_KEY = "showMillis"
+    private const val SUSPENDED_BANNERS_KEY = "suspendedBanners"
+    private const val SUPPRESSED_REFRESHES_KEY = "suppressedRefreshes"
+    private const val DEFERRED_LOADS_KEY = "deferredLoads"
+    private const val CAUGHT_UP_BANNERS_KEY = "caughtUpBanners"
+    private const val AVERAGE_RESPONSE_BYTES_KEY = "averageResponseBytes"
+    private const val BYTES_FREED_KEY = "estimatedBytesFreed"
+}
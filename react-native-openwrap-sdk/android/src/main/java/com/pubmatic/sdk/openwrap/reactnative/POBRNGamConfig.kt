@@ -0,0 +1,70 @@
+package com.pubmatic.sdk.openwrap.reactnative
+
+import org.json.JSONArray
+import org.json.JSONException
+import org.json.JSONObject
+import kotlin.math.ceil
+
+/**
+ * Model class, maintains the GAM header bidding details of an ad unit.
+ * @param adUnitId the GAM ad unit id
+ * @param customTargeting custom targeting applied natively on every GAM request
+ * @param owTimeoutMillis maximum time to wait for the OpenWrap bid before the GAM request,
+ *                        0 to keep the OpenWrap SDK default
+ */
+class POBRNGamConfig private constructor(
+    val adUnitId: String,
+    val customTargeting: Map<String, List<String>>,
+    val owTimeoutMillis: Long
+) {
+
+    /**
+     * Returns the OpenWrap network timeout to apply on the request, in seconds as expected by
+     * {@link POBRequest#setNetworkTimeout}, or null if no timeout is configured.
+     */
+    fun owNetworkTimeoutSeconds(): Int? {
+        if (owTimeoutMillis <= 0) {
+            return null
+        }
+        return maxOf(1, ceil(owTimeoutMillis / MILLIS_PER_SECOND).toInt())
+    }
+
+    companion object {
+        private const val MILLIS_PER_SECOND = 1000.0
+
+        /**
+         * Parses the GAM details from below json format, customTargeting values can be a string or
+         * an array of strings.
+         * {
+            "adUnitId": "/15671365/pm_sdk/PMSDK-Demo-App-Banner",
+            "customTargeting": { "section": "sports", "tags": ["a", "b"] },
+            "owTimeoutMs": 1000
+            }
+         * @throws JSONException if the json is invalid or has no adUnitId
+         */
+        @Throws(JSONException::class)
+        fun build(json: JSONObject): POBRNGamConfig {
+            val customTargeting = LinkedHashMap<String, List<String>>()
+            json.optJSONObject(POBSDKPluginConstant.GAM_CUSTOM_TARGETING_KEY)?.let { targeting ->
+                for (key in targeting.keys()) {
+                    val value = targeting.get(key)
+                    customTargeting[key] = if (value is JSONArray) {
+                        List(value.length()) { value.getString(it) }
+                    } else {
+                        listOf(value.toString())
+                    }
+                }
+            }
+            return POBRNGamConfig(
+                json.getString(POBSDKPluginConstant.AD_UNIT_ID),
+                customTargeting,
+                json.optLong(POBSDKPluginConstant.GAM_OW_TIMEOUT_KEY, 0)
+            )
+        }
+
+        @Throws(JSONException::class)
+        fun build(json: String): POBRNGamConfig {
+            return build(JSONObject(json))
+        }
+    }
+}
@@ -0,0 +1,86 @@
+package com.pubmatic.sdk.openwrap.reactnative
+
+import com.pubmatic.sdk.openwrap.core.POBImpression
+import com.pubmatic.sdk.openwrap.core.POBRequest.AdPosition
+import org.json.JSONException
+import org.json.JSONObject
+import java.util.concurrent.ConcurrentHashMap
+
+/**
+ * Parsed, immutable impression parameters, see [POBRNRequestTemplate]. The custom params, usually
+ * the largest part of the parameters, are converted once at registration.
+ */
+class POBRNImpressionTemplate private constructor(
+    val testCreativeId: String?,
+    val customParams: Map<String, List<String>>?,
+    val adPosition: AdPosition?
+) {
+
+    /**
+     * Sets the parameters of this template on the impression.
+     */
+    fun applyTo(impression: POBImpression) {
+        testCreativeId?.let { impression.testCreativeId = it }
+        customParams?.let { impression.setCustomParam(it) }
+        adPosition?.let { impression.adPosition = it }
+    }
+
+    companion object {
+
+        private val templates = ConcurrentHashMap<String, POBRNImpressionTemplate>()
+
+        /**
+         * Parses the impression parameters, every key is optional.
+         * {"testCreativeId": "id", "customParams": "{\"key\": [\"value\"]}", "adPosition": 1}
+         * @throws JSONException if a value has an invalid type
+         */
+        @Throws(JSONException::class)
+        fun build(json: JSONObject): POBRNImpressionTemplate {
+            val customParams = if (json.has(POBSDKPluginConstant.POBRN_CUSTOM_PARAMS_KEY)) {
+                POBSDKPluginUtils.convertJsonStringToMap(json.getString(POBSDKPluginConstant.POBRN_CUSTOM_PARAMS_KEY))
+                    .takeIf { it.isNotEmpty() }
+            } else null
+            val adPosition = if (json.has(POBSDKPluginConstant.POBRN_AD_POSITION_KEY)) {
+                when (json.getInt(POBSDKPluginConstant.POBRN_AD_POSITION_KEY)) {
+                    0 -> AdPosition.UNKNOWN
+                    1 -> AdPosition.ABOVE_THE_FOLD
+                    3 -> AdPosition.BELOW_THE_FOLD
+                    4 -> AdPosition.HEADER
+                    5 -> AdPosition.FOOTER
+                    6 -> AdPosition.SIDEBAR
+                    7 -> AdPosition.FULL_SCREEN
+                    else -> null
+                }
+            } else null
+            return POBRNImpressionTemplate(
+                if (json.has(POBSDKPluginConstant.POBRN_TEST_CREATIVE_ID_KEY))
+                    json.getString(POBSDKPluginConstant.POBRN_TEST_CREATIVE_ID_KEY) else null,
+                customParams,
+                adPosition
+            )
+        }
+
+        /**
+         * Registers the template of the given id, replacing the previous one. The ads already
+         * created keep the parameters they were set up with.
+         */
+        fun register(templateId: String, template: POBRNImpressionTemplate) {
+            templates[templateId] = template
+        }
+
+        fun unregister(templateId: String) {
+            templates.remove(templateId)
+        }
+
+        /**
+         * Returns the template registered with the given id, if any.
+         */
+        fun forId(templateId: String?): POBRNImpressionTemplate? {
+            return templateId?.let { templates[it] }
+        }
+
+        internal fun reset() {
+            templates.clear()
+        }
+    }
+}
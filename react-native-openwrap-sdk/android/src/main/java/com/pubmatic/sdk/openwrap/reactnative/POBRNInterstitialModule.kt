@@ -4,6 +4,8 @@ import com.facebook.react.bridge.Promise
 import com.facebook.react.bridge.ReactApplicationContext
 import com.facebook.react.bridge.ReactContextBaseJavaModule
 import com.facebook.react.bridge.ReactMethod
+import com.pubmatic.sdk.common.log.POBLog
+import org.json.JSONException
 
 /**
  *  RN Module class used to create POBInterstitial ad object.This class communicates with React side interstitial class
@@ -31,6 +33,31 @@ class POBRNInterstitialModule(reactContext: ReactApplicationContext) :
         }
     }
 
+    @ReactMethod
+    override fun createGamAdInstance(
+        instanceId: String, publisherId: String, profileId: Int, adUnitId: String, gamConfig: String
+    ) {
+        currentActivity?.runOnUiThread {
+            if (!POBRNAdManager.contains(instanceId)) {
+                val config = try {
+                    POBRNGamConfig.build(gamConfig)
+                } catch (exception: JSONException) {
+                    POBLog.warn(NAME, POBSDKPluginConstant.GAM_UNAVAILABLE_WARN_MSG + "$adUnitId: ${exception.message}")
+                    null
+                }
+                val interstitial = POBRNInterstitialAd(
+                    instanceId,
+                    publisherId,
+                    profileId,
+                    adUnitId,
+                    reactApplicationContext,
+                    config
+                )
+                POBRNAdManager.put(instanceId, interstitial)
+            }
+        }
+    }
+
     @ReactMethod
     override fun loadAd(instanceId: String) {
         currentActivity?.runOnUiThread {
@@ -125,6 +152,35 @@ class POBRNInterstitialModule(reactContext: ReactApplicationContext) :
         }
     }
 
+    @ReactMethod
+    override fun addToGroup(group: String, instanceId: String) {
+        currentActivity?.runOnUiThread {
+            POBRNAdManager.addToGroup(group, instanceId)
+        }
+    }
+
+    @ReactMethod
+    override fun removeFromGroup(group: String, instanceId: String) {
+        currentActivity?.runOnUiThread {
+            POBRNAdManager.removeFromGroup(group, instanceId)
+        }
+    }
+
+    /**
+     * Method to show the best ready ad of a show group, interstitial or rewarded
+     */
+    @ReactMethod
+    override fun showBestAvailable(group: String, budgetMillis: Double, promise: Promise) {
+        val activity = currentActivity
+        if (activity == null) {
+            promise.resolve(null)
+            return
+        }
+        activity.runOnUiThread {
+            POBRNShowFallback.showBestAvailable(group, budgetMillis.toLong()) { promise.resolve(it) }
+        }
+    }
+
     @ReactMethod
     override fun destroy(instanceId: String) {
         currentActivity?.runOnUiThread {
@@ -0,0 +1,110 @@
+package com.pubmatic.sdk.openwrap.reactnative
+
+/**
+ * Log-linear latency histogram in the spirit of HdrHistogram. Values are recorded in microseconds,
+ * values below 128 are counted exactly and every power of two range above it is split into 64
+ * linear sub buckets, which bounds the relative error of any reported value to 1/64 (~1.6%) while
+ * keeping the footprint fixed at [BUCKET_COUNT] counters regardless of the recorded values.
+ *
+ * The class is not thread safe, callers are expected to synchronize access.
+ */
+class POBRNLatencyHistogram {
+
+    private val counts = IntArray(BUCKET_COUNT)
+
+    /**
+     * Total number of recorded values.
+     */
+    var count: Long = 0
+        private set
+
+    /**
+     * Highest recorded value in microseconds.
+     */
+    var max: Long = 0
+        private set
+
+    /**
+     * Records a single value. Negative values are ignored and values above [MAX_VALUE] are clamped.
+     *
+     * @param valueMicros latency in microseconds.
+     */
+    fun record(valueMicros: Long) {
+        if (valueMicros < 0) {
+            return
+        }
+        val value = minOf(valueMicros, MAX_VALUE)
+        counts[indexOf(value)]++
+        count++
+        if (value > max) {
+            max = value
+        }
+    }
+
+    /**
+     * Returns the value at the given percentile, i.e. the highest value equivalent to the bucket
+     * holding the requested rank, capped by the highest recorded value.
+     *
+     * @param percentile percentile in the range (0, 100].
+     * @return latency in microseconds, 0 if nothing has been recorded.
+     */
+    fun valueAtPercentile(percentile: Double): Long {
+        if (count == 0L) {
+            return 0
+        }
+        val rank = maxOf(1L, Math.ceil(percentile.coerceIn(0.0, 100.0) / 100.0 * count).toLong())
+        var cumulative = 0L
+        for (index in counts.indices) {
+            cumulative += counts[index]
+            if (cumulative >= rank) {
+                return minOf(highestValueAt(index), max)
+            }
+        }
+        return max
+    }
+
+    /**
+     * Removes all the recorded values.
+     */
+    fun reset() {
+        counts.fill(0)
+        count = 0
+        max = 0
+    }
+
+    companion object {
+        private const val SUB_BUCKET_BITS = 7
+        private const val SUB_BUCKET_COUNT = 1 shl SUB_BUCKET_BITS
+        private const val SUB_BUCKET_HALF = SUB_BUCKET_COUNT shr 1
+
+        /**
+         * Highest trackable value in microseconds (~35 minutes).
+         */
+        const val MAX_VALUE = Int.MAX_VALUE.toLong()
+
+        /**
+         * Number of counters held by a histogram.
+         */
+        const val BUCKET_COUNT = SUB_BUCKET_COUNT + (Int.SIZE_BITS - 1 - SUB_BUCKET_BITS) * SUB_BUCKET_HALF
+
+        internal fun indexOf(value: Long): Int {
+            if (value < SUB_BUCKET_COUNT) {
+                return value.toInt()
+            }
+            // Shift that brings the value into the [SUB_BUCKET_HALF, SUB_BUCKET_COUNT) range.
+            val shift = (63 - java.lang.Long.numberOfLeadingZeros(value)) - (SUB_BUCKET_BITS - 1)
+            return SUB_BUCKET_COUNT + (shift - 1) * SUB_BUCKET_HALF +
+                    ((value shr shift).toInt() - SUB_BUCKET_HALF)
+        }
+
+        internal fun highestValueAt(index: Int): Long {
+            if (index < SUB_BUCKET_COUNT) {
+                return index.toLong()
+            }
+            val offset = index - SUB_BUCKET_COUNT
+            val shift = offset / SUB_BUCKET_HALF + 1
+            val subBucket = offset % SUB_BUCKET_HALF + SUB_BUCKET_HALF
+            return ((subBucket + 1).toLong() shl shift) - 1
+        }
+    }
+}
@@ -0,0 +1,171 @@
+package com.pubmatic.sdk.openwrap.reactnative
+
+import org.json.JSONObject
+
+/**
+ * Measures the latency metrics of a single ad instance and reports them to [POBRNLatencyTracker].
+ * Every load starts a new measurement, the durations of the latest load and show are retained so
+ * they can be attached to the event payloads.
+ *
+ * All the methods are expected to be called on the main thread, like the SDK callbacks.
+ */
+class POBRNLatencyTimer(private val format: POBRNAdFormat, private val adUnitId: String) {
+
+    private var loadRequestNanos = NOT_STARTED
+    private var firstVisibleStartNanos = NOT_STARTED
+    private var loadStartNanos = NOT_STARTED
+    private var bidReceivedNanos = NOT_STARTED
+    private var adServerRequestNanos = NOT_STARTED
+    private var renderStartNanos = NOT_STARTED
+    private var showStartNanos = NOT_STARTED
+    private val durations = LongArray(POBRNLatencyTracker.Metric.values().size) { NOT_STARTED }
+
+    /**
+     * Marks the request of a banner load, queued by [POBRNBannerLoadScheduler] until [markLoad].
+     */
+    fun markLoadRequested() {
+        loadRequestNanos = System.nanoTime()
+        firstVisibleStartNanos = loadRequestNanos
+    }
+
+    /**
+     * Marks the start of a load, including banner force refreshes.
+     */
+    fun markLoad() {
+        loadStartNanos = System.nanoTime()
+        bidReceivedNanos = NOT_STARTED
+        adServerRequestNanos = NOT_STARTED
+        renderStartNanos = NOT_STARTED
+        durations.fill(NOT_STARTED)
+        measure(POBRNLatencyTracker.Metric.QUEUE_WAIT, loadRequestNanos, loadStartNanos)
+        loadRequestNanos = NOT_STARTED
+    }
+
+    fun markBidReceived() {
+        val now = System.nanoTime()
+        measure(POBRNLatencyTracker.Metric.LOAD_TO_BID, loadStartNanos, now)
+        bidReceivedNanos = now
+    }
+
+    /**
+     * Marks the request to the ad server, made by the GAM event handler once the OpenWrap auction
+     * is over.
+     */
+    fun markAdServerRequest() {
+        val now = System.nanoTime()
+        measure(POBRNLatencyTracker.Metric.LOAD_TO_AD_SERVER_REQUEST, loadStartNanos, now)
+        adServerRequestNanos = now
+    }
+
+    /**
+     * Marks the ad received callback. Consumes the load start, so the auto refreshes of a banner,
+     * which are not preceded by a loadAd() call, are not measured.
+     */
+    fun markAdReceived() {
+        val now = System.nanoTime()
+        measure(POBRNLatencyTracker.Metric.BID_TO_AD_RECEIVED, bidReceivedNanos, now)
+        measure(POBRNLatencyTracker.Metric.LOAD_TO_AD_RECEIVED, loadStartNanos, now)
+        measure(POBRNLatencyTracker.Metric.AD_SERVER_REQUEST_TO_AD_RECEIVED, adServerRequestNanos, now)
+        renderStartNanos = loadStartNanos
+        loadStartNanos = NOT_STARTED
+        bidReceivedNanos = NOT_STARTED
+        adServerRequestNanos = NOT_STARTED
+    }
+
+    /**
+     * Marks the first frame drawn after the ad has been received.
+     */
+    fun markFirstFrame() {
+        measure(POBRNLatencyTracker.Metric.LOAD_TO_FIRST_FRAME, renderStartNanos, System.nanoTime())
+        renderStartNanos = NOT_STARTED
+    }
+
+    /**
+     * True from the banner load request until the received ad is visible or the load failed.
+     */
+    val isFirstVisiblePending: Boolean
+        get() = firstVisibleStartNanos != NOT_STARTED
+
+    /**
+     * Marks the received ad visible on screen for the first time since the load request.
+     */
+    fun markFirstVisible() {
+        measure(POBRNLatencyTracker.Metric.REQUEST_TO_FIRST_VISIBLE, firstVisibleStartNanos, System.nanoTime())
+        firstVisibleStartNanos = NOT_STARTED
+    }
+
+    /**
+     * Marks a failed load, so the next ad received callback is not measured against it.
+     */
+    fun markLoadFailed() {
+        firstVisibleStartNanos = NOT_STARTED
+        loadStartNanos = NOT_STARTED
+        bidReceivedNanos = NOT_STARTED
+        adServerRequestNanos = NOT_STARTED
+    }
+
+    fun markShow() {
+        showStartNanos = System.nanoTime()
+    }
+
+    fun markOpened() {
+        measure(POBRNLatencyTracker.Metric.SHOW_TO_OPENED, showStartNanos, System.nanoTime())
+        showStartNanos = NOT_STARTED
+    }
+
+    /**
+     * Attaches the durations measured so far, in milliseconds, to the given event payload if
+     * [POBRNLatencyTracker.isPayloadEnabled] is set.
+     *
+     * @return the payload, a new one if [ext] is null and there is something to attach.
+     */
+    fun attachTo(ext: JSONObject?): JSONObject? {
+        if (!POBRNLatencyTracker.isPayloadEnabled) {
+            return ext
+        }
+        val latency = toJson()
+        if (latency.length() == 0) {
+            return ext
+        }
+        val payload = ext ?: JSONObject()
+        payload.put(POBSDKPluginConstant.LATENCY_KEY, latency)
+        return payload
+    }
+
+    /**
+     * Returns the duration of the given metric measured for the current load or show, in
+     * milliseconds, or null if it is not measured yet.
+     */
+    fun durationMillis(metric: POBRNLatencyTracker.Metric): Double? {
+        val duration = durations[metric.ordinal]
+        return if (duration == NOT_STARTED) null else duration / NANOS_PER_MILLI
+    }
+
+    /**
+     * Returns the durations measured so far keyed by metric, in milliseconds.
+     */
+    fun toJson(): JSONObject {
+        val latency = JSONObject()
+        for (metric in POBRNLatencyTracker.Metric.values()) {
+            val duration = durations[metric.ordinal]
+            if (duration != NOT_STARTED) {
+                latency.put(metric.key, duration / NANOS_PER_MILLI)
+            }
+        }
+        return latency
+    }
+
+    private fun measure(metric: POBRNLatencyTracker.Metric, startNanos: Long, endNanos: Long) {
+        if (startNanos == NOT_STARTED) {
+            return
+        }
+        val duration = endNanos - startNanos
+        durations[metric.ordinal] = duration
+        POBRNLatencyTracker.record(format, adUnitId, metric, duration)
+    }
+
+    companion object {
+        private const val NOT_STARTED = Long.MIN_VALUE
+        private const val NANOS_PER_MILLI = 1_000_000.0
+    }
+}
@@ -0,0 +1,112 @@
+package com.pubmatic.sdk.openwrap.reactnative
+
+import org.json.JSONArray
+import org.json.JSONObject
+
+/**
+ * Accumulates the ad latency histograms per ad format, ad unit id and [Metric]. Ad instances
+ * measure their own durations through [POBRNLatencyTimer] and report them here.
+ */
+object POBRNLatencyTracker {
+
+    /**
+     * Latency metrics measured by the plugin.
+     */
+    enum class Metric(val key: String) {
+        /** From loadAd() to the bid received callback. Requires the bid event listener. */
+        LOAD_TO_BID("loadToBid"),
+        /** From the bid received callback to the ad received callback. Requires the bid event listener. */
+        BID_TO_AD_RECEIVED("bidToAdReceived"),
+        /** From loadAd() to the ad received callback. */
+        LOAD_TO_AD_RECEIVED("loadToAdReceived"),
+        /** From show() to the ad opened callback. Full screen ads only. */
+        SHOW_TO_OPENED("showToOpened"),
+        /** From loadAd() to the first frame drawn with the rendered ad. Banner ads only. */
+        LOAD_TO_FIRST_FRAME("loadToFirstFrame"),
+        /** From loadAd() to the GAM request, i.e. the wait on the OpenWrap auction. GAM header bidding only. */
+        LOAD_TO_AD_SERVER_REQUEST("loadToAdServerRequest"),
+        /** From the GAM request to the ad received callback, i.e. the wait on GAM. GAM header bidding only. */
+        AD_SERVER_REQUEST_TO_AD_RECEIVED("adServerRequestToAdReceived"),
+        /** From the banner load request to the start of its load by [POBRNBannerLoadScheduler]. Banner ads only. */
+        QUEUE_WAIT("queueWait"),
+        /** From the banner load request to the received ad being visible on screen. Banner ads only. */
+        REQUEST_TO_FIRST_VISIBLE("requestToFirstVisible")
+    }
+
+    /**
+     * Controls whether the durations measured for an ad instance are attached to its event payloads.
+     */
+    @Volatile
+    var isPayloadEnabled = false
+
+    private val histograms = LinkedHashMap<String, Placement>()
+
+    private class Placement(val format: POBRNAdFormat, val adUnitId: String) {
+        val metrics = arrayOfNulls<POBRNLatencyHistogram>(Metric.values().size)
+    }
+
+    /**
+     * Records a measured duration.
+     *
+     * @param durationNanos duration in nanoseconds.
+     */
+    fun record(format: POBRNAdFormat, adUnitId: String, metric: Metric, durationNanos: Long) {
+        synchronized(histograms) {
+            val placement = histograms.getOrPut("${format.value}:$adUnitId") {
+                Placement(format, adUnitId)
+            }
+            val histogram = placement.metrics[metric.ordinal]
+                ?: POBRNLatencyHistogram().also { placement.metrics[metric.ordinal] = it }
+            histogram.record(durationNanos / NANOS_PER_MICRO)
+        }
+    }
+
+    /**
+     * Removes all the recorded durations.
+     */
+    fun reset() {
+        synchronized(histograms) {
+            histograms.clear()
+        }
+    }
+
+    /**
+     * Returns the latency summary of every recorded placement and metric as a JSON array. Each entry
+     * contains adFormat, adUnitId, metric, count and the p50, p90, p99 and max values in milliseconds.
+     */
+    fun toJson(): JSONArray {
+        val stats = JSONArray()
+        synchronized(histograms) {
+            for (placement in histograms.values) {
+                for (metric in Metric.values()) {
+                    val histogram = placement.metrics[metric.ordinal] ?: continue
+                    val entry = JSONObject()
+                    entry.put(AD_FORMAT_KEY, placement.format.value)
+                    entry.put(POBSDKPluginConstant.AD_UNIT_ID, placement.adUnitId)
+                    entry.put(METRIC_KEY, metric.key)
+                    entry.put(COUNT_KEY, histogram.count)
+                    entry.put(P50_KEY, toMillis(histogram.valueAtPercentile(50.0)))
+                    entry.put(P90_KEY, toMillis(histogram.valueAtPercentile(90.0)))
+                    entry.put(P99_KEY, toMillis(histogram.valueAtPercentile(99.0)))
+                    entry.put(MAX_KEY, toMillis(histogram.max))
+                    stats.put(entry)
+                }
+            }
+        }
+        return stats
+    }
+
+    private fun toMillis(micros: Long): Double {
+        return micros / MICROS_PER_MILLI
+    }
+
+    private const val NANOS_PER_MICRO = 1_000L
+    private const val MICROS_PER_MILLI = 1_000.0
+    private const val AD_FORMAT_KEY = "adFormat"
+    private const val METRIC_KEY = "metric"
+    private const val COUNT_KEY = "count"
+    private const val P50_KEY = "p50"
+    private const val P90_KEY = "p90"
+    private const val P99_KEY = "p99"
+    private const val MAX_KEY = "max"
+}
@@ -0,0 +1,279 @@
+package com.pubmatic.sdk.openwrap.reactnative
+
+import android.content.Context
+import android.net.ConnectivityManager
+import com.pubmatic.sdk.common.log.POBLog
+import org.json.JSONObject
+import java.io.File
+import java.io.IOException
+import java.net.HttpURLConnection
+import java.net.URL
+import java.security.MessageDigest
+import java.util.concurrent.Executor
+import java.util.concurrent.Executors
+
+/**
+ * Size bounded LRU disk cache of the video media files referenced by the VAST creatives of the
+ * received bids. Disabled by default, see [isEnabled].
+ *
+ * - Once a video ad is received, on an unmetered network, the media file of the rendition fitting
+ *   the screen best is downloaded, see [selectMediaFile].
+ * - The files of a bid are evicted when the bid expires or its ad is destroyed, unless another
+ *   received bid references them, and the least recently used files are evicted above [maxBytes].
+ * - A prefetch of a media file already cached, e.g. by an earlier bid of the same creative, does
+ *   not download it again.
+ *
+ * The OpenWrap SDK player does not read the cached files, it downloads the media file again when
+ * the ad plays. The stats therefore only describe the prefetch traffic, which adds to the one of
+ * the playback: no bytes are reported as saved.
+ *
+ * Downloads run on a single background thread, the other methods may be called from any thread.
+ */
+object POBRNMediaCache {
+
+    /**
+     * A media file of a VAST creative.
+     */
+    data class MediaFile(val url: String, val type: String?, val width: Int, val height: Int, val bitrate: Int)
+
+    private class Stats {
+        var prefetches = 0
+        var alreadyCached = 0
+        var downloads = 0
+        var skippedMetered = 0
+        var failures = 0
+        var bytesDownloaded = 0L
+    }
+
+    /** Enables the prefetch of the video media files. */
+    @Volatile
+    var isEnabled = false
+
+    /** Maximum size of the cached files in bytes. */
+    @Volatile
+    var maxBytes = DEFAULT_MAX_BYTES
+        set(value) {
+            field = value.coerceAtLeast(0L)
+            synchronized(this) { trim() }
+        }
+
+    internal var executor: Executor = Executors.newSingleThreadExecutor()
+
+    // Cached files by media URL, in access order.
+    private val files = LinkedHashMap<String, File>(16, 0.75f, true)
+    // Media URLs referenced by every bid still alive, keyed by the ad instance.
+    private val references = HashMap<String, String>()
+    private var stats = Stats()
+    private var cachedBytes = 0L
+    private var isDirectoryCleared = false
+
+    /**
+     * Prefetches the media file of the given bid creative, if it is a VAST video and the network
+     * is unmetered. The previous bid of the same key is evicted first.
+     * @param key the ad instance the bid belongs to
+     */
+    fun prefetch(context: Context, key: String, creative: String?) {
+        evict(key)
+        if (!isEnabled || creative == null || !creative.contains(VAST_TAG)) {
+            return
+        }
+        val connectivityManager = context.getSystemService(Context.CONNECTIVITY_SERVICE) as? ConnectivityManager
+        if (connectivityManager == null || connectivityManager.isActiveNetworkMetered) {
+            synchronized(this) { stats.skippedMetered++ }
+            return
+        }
+        val metrics = context.resources.displayMetrics
+        val mediaFile = selectMediaFile(parseMediaFiles(creative), metrics.widthPixels, metrics.heightPixels) ?: return
+        prefetchMediaFile(File(context.cacheDir, DIRECTORY_NAME), key, mediaFile.url)
+    }
+
+    /**
+     * Evicts the media file of the bid of the given key, unless another bid references it.
+     */
+    @Synchronized
+    fun evict(key: String) {
+        val url = references.remove(key) ?: return
+        if (!references.containsValue(url)) {
+            files.remove(url)?.let { delete(it) }
+        }
+    }
+
+    /**
+     * Returns the cached file of the given media URL, null if not cached.
+     */
+    @Synchronized
+    fun cachedFile(url: String): File? = files[url]
+
+    /**
+     * Returns the prefetch stats: number of prefetches, of prefetches of an already cached file, of
+     * downloads, of prefetches skipped on metered networks and of failed downloads, the bytes
+     * downloaded and the size of the cached files.
+     */
+    @Synchronized
+    fun toJson(): JSONObject = JSONObject()
+        .put(PREFETCHES_KEY, stats.prefetches)
+        .put(ALREADY_CACHED_KEY, stats.alreadyCached)
+        .put(DOWNLOADS_KEY, stats.downloads)
+        .put(SKIPPED_METERED_KEY, stats.skippedMetered)
+        .put(FAILURES_KEY, stats.failures)
+        .put(BYTES_DOWNLOADED_KEY, stats.bytesDownloaded)
+        .put(CACHED_BYTES_KEY, cachedBytes)
+
+    @Synchronized
+    fun resetStats() {
+        stats = Stats()
+    }
+
+    /**
+     * Returns the media files of the given VAST creative.
+     */
+    internal fun parseMediaFiles(vast: String): List<MediaFile> {
+        return MEDIA_FILE_REGEX.findAll(vast).mapNotNull { match ->
+            val attributes = ATTRIBUTE_REGEX.findAll(match.groupValues[1])
+                .associate { it.groupValues[1].lowercase() to it.groupValues[2] }
+            val url = match.groupValues[2].trim().removePrefix(CDATA_START).removeSuffix(CDATA_END).trim()
+            if (url.isEmpty()) {
+                null
+            } else {
+                MediaFile(
+                    url,
+                    attributes["type"],
+                    attributes["width"]?.toIntOrNull() ?: 0,
+                    attributes["height"]?.toIntOrNull() ?: 0,
+                    attributes["bitrate"]?.toIntOrNull() ?: 0
+                )
+            }
+        }.toList()
+    }
+
+    /**
+     * Returns the rendition fitting the screen best: a progressive MP4 or 3GPP file, the largest
+     * one fitting the screen, else the smallest one. Equal sizes are ordered by lowest bitrate.
+     */
+    internal fun selectMediaFile(mediaFiles: List<MediaFile>, screenWidth: Int, screenHeight: Int): MediaFile? {
+        val playable = mediaFiles.filter { it.type == null || it.type in PLAYABLE_TYPES }
+        if (playable.isEmpty()) {
+            return null
+        }
+        // Compare the longest sides, the ad may play in either orientation.
+        val screen = maxOf(screenWidth, screenHeight)
+        val fitting = playable.filter { maxOf(it.width, it.height) <= screen }
+        return if (fitting.isNotEmpty()) {
+            fitting.maxWithOrNull(compareBy<MediaFile> { it.width * it.height }.thenByDescending { it.bitrate })
+        } else {
+            playable.minWithOrNull(compareBy<MediaFile> { it.width * it.height }.thenBy { it.bitrate })
+        }
+    }
+
+    internal fun prefetchMediaFile(directory: File, key: String, url: String) {
+        synchronized(this) {
+            references[key] = url
+            stats.prefetches++
+            if (files[url] != null) {
+                stats.alreadyCached++
+                return
+            }
+            stats.downloads++
+        }
+        executor.execute { download(directory, url) }
+    }
+
+    private fun download(directory: File, url: String) {
+        synchronized(this) {
+            if (files.containsKey(url)) {
+                return
+            }
+            // The bids do not outlive the process, so the files of the previous runs are stale.
+            if (!isDirectoryCleared) {
+                isDirectoryCleared = true
+                directory.listFiles()?.forEach { it.delete() }
+            }
+        }
+        val file = File(directory, sha1(url))
+        val tempFile = File(directory, file.name + TEMP_SUFFIX)
+        var connection: HttpURLConnection? = null
+        try {
+            directory.mkdirs()
+            connection = URL(url).openConnection() as HttpURLConnection
+            connection.connectTimeout = TIMEOUT_MILLIS
+            connection.readTimeout = TIMEOUT_MILLIS
+            if (connection.responseCode != HttpURLConnection.HTTP_OK) {
+                throw IOException("HTTP ${connection.responseCode}")
+            }
+            val length = connection.inputStream.use { input ->
+                tempFile.outputStream().use { output -> input.copyTo(output) }
+            }
+            if (!tempFile.renameTo(file)) {
+                throw IOException("Unable to rename $tempFile")
+            }
+            synchronized(this) {
+                stats.bytesDownloaded += length
+                if (references.containsValue(url)) {
+                    files[url] = file
+                    cachedBytes += length
+                    trim()
+                } else {
+                    // The bid was evicted meanwhile.
+                    file.delete()
+                }
+            }
+        } catch (e: IOException) {
+            tempFile.delete()
+            synchronized(this) { stats.failures++ }
+            POBLog.warn(TAG, POBSDKPluginConstant.MEDIA_CACHE_DOWNLOAD_FAILURE_MSG + url + " with " + e)
+        } finally {
+            connection?.disconnect()
+        }
+    }
+
+    /** Evicts the least recently used files above [maxBytes]. Expected to be called while holding the lock. */
+    private fun trim() {
+        val iterator = files.entries.iterator()
+        while (cachedBytes > maxBytes && iterator.hasNext()) {
+            val file = iterator.next().value
+            iterator.remove()
+            delete(file)
+        }
+    }
+
+    private fun delete(file: File) {
+        cachedBytes -= file.length()
+        file.delete()
+    }
+
+    private fun sha1(value: String): String {
+        return MessageDigest.getInstance("SHA-1").digest(value.toByteArray())
+            .joinToString("") { "%02x".format(it) }
+    }
+
+    @Synchronized
+    internal fun reset() {
+        files.values.forEach { it.delete() }
+        files.clear()
+        references.clear()
+        cachedBytes = 0L
+        resetStats()
+        isEnabled = false
+        maxBytes = DEFAULT_MAX_BYTES
+    }
+
+    const val DEFAULT_MAX_BYTES = 50L * 1024 * 1024
+    private const val TAG = "POBRNMediaCache"
+    private const val DIRECTORY_NAME = "pobrn_media"
+    private const val TEMP_SUFFIX = ".tmp"
+    private const val TIMEOUT_MILLIS = 10_000
+    private const val VAST_TAG = "<VAST"
+    private const val CDATA_START = "<![CDATA["
+    private const val CDATA_END = "]]>"
+    private val PLAYABLE_TYPES = setOf("video/mp4", "video/3gpp")
+    private val MEDIA_FILE_REGEX = Regex("<MediaFile\\b([^>]*)>(.*?)</MediaFile>", RegexOption.DOT_MATCHES_ALL)
+    private val ATTRIBUTE_REGEX = Regex("(\\w+)\\s*=\\s*\"([^\"]*)\"")
+
+    private const val PREFETCHES_KEY = "prefetches"
+    private const val ALREADY_CACHED_KEY = "alreadyCached"
+    private const val DOWNLOADS_KEY = "downloads"
+    private const val SKIPPED_METERED_KEY = "skippedMetered"
+    private const val FAILURES_KEY = "failures"
+    private const val BYTES_DOWNLOADED_KEY = "bytesDownloaded"
+    private const val CACHED_BYTES_KEY = "cachedBytes"
+}
@@ -0,0 +1,147 @@
+package com.pubmatic.sdk.openwrap.reactnative
+
+import com.pubmatic.sdk.openwrap.core.POBBid
+import com.pubmatic.sdk.openwrap.core.POBBidEvent
+import org.json.JSONException
+import org.json.JSONObject
+import java.util.concurrent.ConcurrentHashMap
+
+/**
+ * Declarative in-house mediation rule of a placement. When a rule is registered for an ad unit id,
+ * the received OpenWrap bid is evaluated natively in onBidReceived and the ad proceeds to load, or
+ * to error, without waiting for JS. JS is only notified of the [Outcome].
+ */
+class POBRNMediationRule private constructor(
+    val floor: Double,
+    val partnerFloors: Map<String, Double>,
+    val allowedPartners: List<String>,
+    val maxWaitMillis: Long
+) {
+
+    /**
+     * Result of a rule evaluation.
+     * @param error the bid event error to proceed with, null if the OpenWrap bid won
+     */
+    class Outcome(val reason: String, val error: POBBidEvent.BidEventError?, val bid: POBBid) {
+
+        val isWin: Boolean
+            get() = error == null
+
+        fun toJson(): JSONObject {
+            val json = JSONObject()
+            json.put(POBSDKPluginConstant.MEDIATION_WON_KEY, isWin)
+            json.put(POBSDKPluginConstant.MEDIATION_REASON_KEY, reason)
+            error?.let { json.put(POBSDKPluginConstant.ERROR_CODE_KEY, it.ordinal) }
+            json.put(POBSDKPluginConstant.PRICE, bid.price)
+            bid.partnerName?.let { json.put(POBSDKPluginConstant.PARTNER_NAME, it) }
+            return json
+        }
+    }
+
+    /**
+     * Evaluates the bid against this rule, in below order: bid expiry and status, max wait,
+     * allowed partners and floors. The max wait only makes a late bid lose, it does not time out
+     * a bid still awaited.
+     * @param bid the received OpenWrap bid
+     * @param waitMillis time from loadAd to the bid, null if unknown
+     */
+    fun evaluate(bid: POBBid, waitMillis: Double?): Outcome {
+        if (bid.isExpired) {
+            return Outcome(REASON_BID_EXPIRED, POBBidEvent.BidEventError.BID_EXPIRED, bid)
+        }
+        if (bid.status != BID_STATUS_OK) {
+            return Outcome(REASON_BID_STATUS, POBBidEvent.BidEventError.CLIENT_SIDE_AUCTION_LOSS, bid)
+        }
+        if (maxWaitMillis > 0 && waitMillis != null && waitMillis > maxWaitMillis) {
+            return Outcome(REASON_MAX_WAIT_EXCEEDED, POBBidEvent.BidEventError.CLIENT_SIDE_AUCTION_LOSS, bid)
+        }
+        val partner = bid.partnerName
+        if (allowedPartners.isNotEmpty() && (partner == null || !allowedPartners.contains(partner))) {
+            return Outcome(REASON_PARTNER_NOT_ALLOWED, POBBidEvent.BidEventError.CLIENT_SIDE_AUCTION_LOSS, bid)
+        }
+        val partnerFloor = partner?.let { partnerFloors[it] } ?: floor
+        if (bid.price < partnerFloor) {
+            return Outcome(REASON_BELOW_FLOOR, POBBidEvent.BidEventError.CLIENT_SIDE_AUCTION_LOSS, bid)
+        }
+        return Outcome(REASON_WON, null, bid)
+    }
+
+    /**
+     * Evaluates the bid and proceeds the bid flow of the ad accordingly.
+     * @return the outcome, to be notified to JS
+     */
+    fun apply(bidEvent: POBBidEvent, bid: POBBid, waitMillis: Double?): Outcome {
+        val outcome = evaluate(bid, waitMillis)
+        val error = outcome.error
+        if (error == null) {
+            bidEvent.proceedToLoadAd()
+        } else {
+            bidEvent.proceedOnError(error)
+        }
+        return outcome
+    }
+
+    companion object {
+        const val REASON_WON = "won"
+        const val REASON_BID_EXPIRED = "bidExpired"
+        const val REASON_BID_STATUS = "bidStatus"
+        const val REASON_MAX_WAIT_EXCEEDED = "maxWaitExceeded"
+        const val REASON_PARTNER_NOT_ALLOWED = "partnerNotAllowed"
+        const val REASON_BELOW_FLOOR = "belowFloor"
+
+        private const val BID_STATUS_OK = 1
+
+        private val rules = ConcurrentHashMap<String, POBRNMediationRule>()
+
+        /**
+         * Parses the rule json, expects below format, every key is optional.
+         * {
+            "floor": 0.5,
+            "partnerFloors": { "pubmatic": 0.8 },
+            "allowedPartners": ["pubmatic", "appnexus"],
+            "maxWaitMs": 500
+            }
+         * @throws JSONException if invalid json provided
+         */
+        @Throws(JSONException::class)
+        fun build(ruleJson: String): POBRNMediationRule {
+            val json = JSONObject(ruleJson)
+            val partnerFloors = HashMap<String, Double>()
+            json.optJSONObject(POBSDKPluginConstant.MEDIATION_PARTNER_FLOORS_KEY)?.let { floors ->
+                for (partner in floors.keys()) {
+                    partnerFloors[partner] = floors.getDouble(partner)
+                }
+            }
+            val allowedPartners = ArrayList<String>()
+            json.optJSONArray(POBSDKPluginConstant.MEDIATION_ALLOWED_PARTNERS_KEY)?.let { partners ->
+                for (i in 0 until partners.length()) {
+                    allowedPartners.add(partners.getString(i))
+                }
+            }
+            return POBRNMediationRule(
+                json.optDouble(POBSDKPluginConstant.MEDIATION_FLOOR_KEY, 0.0),
+                partnerFloors,
+                allowedPartners,
+                json.optLong(POBSDKPluginConstant.MEDIATION_MAX_WAIT_KEY, 0)
+            )
+        }
+
+        /**
+         * Registers the rule of the given ad unit id, replacing the previous one.
+         */
+        fun register(adUnitId: String, rule: POBRNMediationRule) {
+            rules[adUnitId] = rule
+        }
+
+        fun unregister(adUnitId: String) {
+            rules.remove(adUnitId)
+        }
+
+        /**
+         * Returns the rule registered for the given ad unit id, if any.
+         */
+        fun forAdUnit(adUnitId: String): POBRNMediationRule? {
+            return rules[adUnitId]
+        }
+    }
+}
@@ -0,0 +1,411 @@
+package com.pubmatic.sdk.openwrap.reactnative
+
+import android.content.Context
+import android.net.ConnectivityManager
+import android.net.Network
+import android.net.NetworkCapabilities
+import android.net.NetworkRequest
+import com.pubmatic.sdk.common.log.POBLog
+import org.json.JSONObject
+import java.io.File
+import java.io.FileOutputStream
+import java.io.IOException
+import java.net.HttpURLConnection
+import java.net.URL
+import java.util.concurrent.Executors
+import java.util.concurrent.ScheduledExecutorService
+import java.util.concurrent.ScheduledFuture
+import java.util.concurrent.ThreadLocalRandom
+import java.util.concurrent.TimeUnit
+
+/**
+ * Delivers the win and loss notices, i.e. the nurl and lurl of the bids, of the client side
+ * auctions run by the app.
+ *
+ * - Every notice is appended to a small on-disk queue, [QUEUE_FILE_NAME], before being sent, so
+ *   that it survives the app being offline or killed. The delivered and dropped notices are
+ *   appended as done records, and the file is rewritten once mostly made of done records.
+ * - The notices are sent in batches, so that the notices of an auction share a single radio wake
+ *   up and connection. A batch starts [BATCH_DELAY_MILLIS] after the first queued notice and sends
+ *   at most [MAX_REQUESTS_PER_BATCH] notices, the batches being at least [BATCH_DELAY_MILLIS] apart.
+ * - A failed notice is retried with an exponential backoff from [INITIAL_BACKOFF_MILLIS] up to
+ *   [MAX_BACKOFF_MILLIS]. It is dropped after [MAX_ATTEMPTS] attempts, on a client error or once
+ *   older than [MAX_AGE_MILLIS]. While offline, the notices are held and sent once the network is
+ *   back.
+ *
+ * The queue is only accessed from a single background thread, the other methods may be called
+ * from any thread.
+ */
+object POBRNNoticeDispatcher {
+
+    internal class Notice(val id: Long, val url: String, val enqueuedMillis: Long) {
+        var attempts = 0
+        var nextAttemptMillis = 0L
+    }
+
+    private class Stats {
+        var enqueued = 0
+        var delivered = 0
+        var retries = 0
+        var dropped = 0
+        var restored = 0
+        // Time from enqueue to delivery, in milliseconds.
+        val latency = POBRNLatencyHistogram()
+    }
+
+    internal var executor: ScheduledExecutorService = Executors.newSingleThreadScheduledExecutor()
+
+    /** Delay before the first batch, and minimum delay between two batches. */
+    internal var batchDelayMillis = BATCH_DELAY_MILLIS
+
+    internal var initialBackoffMillis = INITIAL_BACKOFF_MILLIS
+
+    private var isInitialized = false
+
+    // Queued notices by id, in enqueue order.
+    private val notices = LinkedHashMap<Long, Notice>()
+    private var queueFile: File? = null
+    private var nextId = 1L
+    private var doneRecords = 0
+    private var flushTask: ScheduledFuture<*>? = null
+    private var flushMillis = 0L
+    private var lastBatchMillis = 0L
+    private var isOffline = false
+    private var stats = Stats()
+
+    @Volatile
+    private var queueDepth = 0
+
+    /**
+     * Restores the notices queued by the previous sessions and starts sending them once online.
+     * Only the first call has an effect.
+     */
+    @Synchronized
+    fun initialize(context: Context) {
+        val filesDir = (context.applicationContext ?: context).filesDir
+        if (isInitialized || filesDir == null) {
+            return
+        }
+        isInitialized = true
+        open(File(filesDir, QUEUE_FILE_NAME))
+        registerNetworkCallback(context)
+    }
+
+    /**
+     * Queues a notice, persisted until it is delivered or dropped.
+     * @param url notice URL, its macros already replaced
+     */
+    fun enqueue(url: String) {
+        if (!url.startsWith(HTTP_SCHEME) || url.any { it == '\n' || it == '\r' || it == FIELD_SEPARATOR }) {
+            POBLog.warn(TAG, POBSDKPluginConstant.NOTICE_INVALID_URL_MSG + url)
+            return
+        }
+        val enqueuedMillis = System.currentTimeMillis()
+        executor.execute {
+            val notice = Notice(nextId++, url, enqueuedMillis)
+            notices[notice.id] = notice
+            append(listOf(enqueuedRecord(notice)))
+            synchronized(this) { stats.enqueued++ }
+            // Drop the oldest notices above the queue capacity.
+            while (notices.size > MAX_QUEUE_SIZE) {
+                val oldest = notices.values.first()
+                notices.remove(oldest.id)
+                append(listOf(doneRecord(oldest)))
+                synchronized(this) { stats.dropped++ }
+            }
+            queueDepth = notices.size
+            scheduleFlush(batchDelayMillis)
+        }
+    }
+
+    /**
+     * Returns the queue depth, the number of notices queued, delivered, retried, dropped and
+     * restored from disk, and the delivery latency percentiles in milliseconds.
+     */
+    @Synchronized
+    fun toJson(): JSONObject = JSONObject()
+        .put(QUEUE_DEPTH_KEY, queueDepth)
+        .put(ENQUEUED_KEY, stats.enqueued)
+        .put(DELIVERED_KEY, stats.delivered)
+        .put(RETRIES_KEY, stats.retries)
+        .put(DROPPED_KEY, stats.dropped)
+        .put(RESTORED_KEY, stats.restored)
+        .put(LATENCY_P50_KEY, stats.latency.valueAtPercentile(50.0))
+        .put(LATENCY_P95_KEY, stats.latency.valueAtPercentile(95.0))
+        .put(LATENCY_MAX_KEY, stats.latency.max)
+
+    @Synchronized
+    fun resetStats() {
+        stats = Stats()
+    }
+
+    /**
+     * Loads the queue from the given file, then sends the restored notices.
+     */
+    internal fun open(file: File) {
+        executor.execute {
+            queueFile = file
+            load(file)
+            scheduleFlush(0)
+        }
+    }
+
+    /**
+     * Holds the notices while offline, and sends them right away once back online.
+     */
+    internal fun onConnectivityChanged(isConnected: Boolean) {
+        executor.execute {
+            val wasOffline = isOffline
+            isOffline = !isConnected
+            if (wasOffline && isConnected) {
+                notices.values.forEach { it.nextAttemptMillis = 0L }
+                scheduleFlush(0)
+            }
+        }
+    }
+
+    /**
+     * Returns the delay before the given retry: exponential from [initialBackoffMillis], capped by
+     * [MAX_BACKOFF_MILLIS], with up to 20% of random jitter so that the clients do not retry in sync.
+     */
+    internal fun backoffMillis(attempts: Int): Long {
+        val backoff = minOf(initialBackoffMillis shl minOf(attempts - 1, MAX_BACKOFF_SHIFT), MAX_BACKOFF_MILLIS)
+        return backoff + ThreadLocalRandom.current().nextLong(backoff / 5 + 1)
+    }
+
+    private fun load(file: File) {
+        val text = try {
+            if (file.exists()) file.readText() else ""
+        } catch (e: IOException) {
+            POBLog.warn(TAG, POBSDKPluginConstant.NOTICE_QUEUE_FAILURE_MSG + e)
+            ""
+        }
+        // The last record is incomplete, i.e. without separator, if the app was killed while writing it.
+        for (line in text.split(RECORD_SEPARATOR).dropLast(1)) {
+            val fields = line.split(FIELD_SEPARATOR, limit = ENQUEUED_FIELD_COUNT)
+            val id = fields.getOrNull(1)?.toLongOrNull() ?: continue
+            when (fields[0]) {
+                ENQUEUED_RECORD -> {
+                    val enqueuedMillis = fields.getOrNull(2)?.toLongOrNull() ?: continue
+                    val url = fields.getOrNull(3) ?: continue
+                    notices[id] = Notice(id, url, enqueuedMillis)
+                    nextId = maxOf(nextId, id + 1)
+                }
+                DONE_RECORD -> notices.remove(id)
+            }
+        }
+        val now = System.currentTimeMillis()
+        val expired = notices.values.filter { now - it.enqueuedMillis > MAX_AGE_MILLIS }
+        expired.forEach { notices.remove(it.id) }
+        synchronized(this) {
+            stats.restored += notices.size
+            stats.dropped += expired.size
+        }
+        queueDepth = notices.size
+        // Start from a file holding the restored notices only.
+        compact()
+    }
+
+    /**
+     * Schedules a batch in the given delay, unless one is scheduled earlier. The batches are kept
+     * [batchDelayMillis] apart.
+     */
+    private fun scheduleFlush(delayMillis: Long) {
+        if (isOffline || notices.isEmpty()) {
+            return
+        }
+        val now = System.currentTimeMillis()
+        val millis = maxOf(now + delayMillis, lastBatchMillis + batchDelayMillis)
+        val task = flushTask
+        if (task != null && flushMillis <= millis) {
+            return
+        }
+        task?.cancel(false)
+        flushMillis = millis
+        flushTask = executor.schedule({ flush() }, millis - now, TimeUnit.MILLISECONDS)
+    }
+
+    private fun flush() {
+        flushTask = null
+        if (isOffline) {
+            return
+        }
+        val now = System.currentTimeMillis()
+        lastBatchMillis = now
+        val records = ArrayList<String>()
+        val batch = notices.values.filter { it.nextAttemptMillis <= now }.take(MAX_REQUESTS_PER_BATCH)
+        for (notice in batch) {
+            val result = if (now - notice.enqueuedMillis > MAX_AGE_MILLIS) REJECTED else send(notice.url)
+            if (result == FAILED) {
+                notice.attempts++
+                if (notice.attempts < MAX_ATTEMPTS) {
+                    notice.nextAttemptMillis = System.currentTimeMillis() + backoffMillis(notice.attempts)
+                    synchronized(this) { stats.retries++ }
+                    continue
+                }
+            }
+            notices.remove(notice.id)
+            records.add(doneRecord(notice))
+            if (result == DELIVERED) {
+                synchronized(this) {
+                    stats.delivered++
+                    stats.latency.record(System.currentTimeMillis() - notice.enqueuedMillis)
+                }
+            } else {
+                synchronized(this) { stats.dropped++ }
+                POBLog.debug(TAG, POBSDKPluginConstant.NOTICE_DROPPED_MSG + notice.url)
+            }
+        }
+        append(records)
+        doneRecords += records.size
+        if (doneRecords >= COMPACT_THRESHOLD && doneRecords > notices.size) {
+            compact()
+        }
+        queueDepth = notices.size
+        val nextAttemptMillis = notices.values.minOfOrNull { it.nextAttemptMillis } ?: return
+        scheduleFlush(maxOf(0L, nextAttemptMillis - System.currentTimeMillis()))
+    }
+
+    /**
+     * Sends a notice.
+     * @return [DELIVERED], [REJECTED] on a client error or [FAILED] if the notice should be retried
+     */
+    private fun send(url: String): Int {
+        return try {
+            val connection = URL(url).openConnection() as HttpURLConnection
+            connection.connectTimeout = TIMEOUT_MILLIS
+            connection.readTimeout = TIMEOUT_MILLIS
+            val code = connection.responseCode
+            // Consume the body without disconnecting, so that the next notice of the batch reuses
+            // the connection.
+            (if (code < HttpURLConnection.HTTP_BAD_REQUEST) connection.inputStream else connection.errorStream)
+                ?.use { it.readBytes() }
+            when {
+                code < HttpURLConnection.HTTP_BAD_REQUEST -> DELIVERED
+                code == HttpURLConnection.HTTP_CLIENT_TIMEOUT || code == HTTP_TOO_MANY_REQUESTS ||
+                    code >= HttpURLConnection.HTTP_INTERNAL_ERROR -> FAILED
+                else -> REJECTED
+            }
+        } catch (e: IOException) {
+            FAILED
+        }
+    }
+
+    private fun append(records: List<String>) {
+        val file = queueFile ?: return
+        if (records.isEmpty()) {
+            return
+        }
+        try {
+            FileOutputStream(file, true).bufferedWriter().use { writer ->
+                records.forEach { writer.write(it + RECORD_SEPARATOR) }
+            }
+        } catch (e: IOException) {
+            POBLog.warn(TAG, POBSDKPluginConstant.NOTICE_QUEUE_FAILURE_MSG + e)
+        }
+    }
+
+    /** Rewrites the queue file with the queued notices only. */
+    private fun compact() {
+        val file = queueFile ?: return
+        val tempFile = File(file.path + TEMP_SUFFIX)
+        try {
+            tempFile.bufferedWriter().use { writer ->
+                notices.values.forEach { writer.write(enqueuedRecord(it) + RECORD_SEPARATOR) }
+            }
+            if (!tempFile.renameTo(file)) {
+                throw IOException("Unable to rename $tempFile")
+            }
+            doneRecords = 0
+        } catch (e: IOException) {
+            tempFile.delete()
+            POBLog.warn(TAG, POBSDKPluginConstant.NOTICE_QUEUE_FAILURE_MSG + e)
+        }
+    }
+
+    private fun enqueuedRecord(notice: Notice) =
+        "$ENQUEUED_RECORD$FIELD_SEPARATOR${notice.id}$FIELD_SEPARATOR${notice.enqueuedMillis}$FIELD_SEPARATOR${notice.url}"
+
+    private fun doneRecord(notice: Notice) = "$DONE_RECORD$FIELD_SEPARATOR${notice.id}"
+
+    private fun registerNetworkCallback(context: Context) {
+        val connectivityManager = context.getSystemService(Context.CONNECTIVITY_SERVICE) as? ConnectivityManager ?: return
+        val request = NetworkRequest.Builder().addCapability(NetworkCapabilities.NET_CAPABILITY_INTERNET).build()
+        connectivityManager.registerNetworkCallback(request, object : ConnectivityManager.NetworkCallback() {
+            // Networks providing internet, only accessed on the executor.
+            private val networks = HashSet<Network>()
+
+            override fun onAvailable(network: Network) {
+                executor.execute { networks.add(network) }
+                onConnectivityChanged(true)
+            }
+
+            override fun onLost(network: Network) {
+                executor.execute {
+                    networks.remove(network)
+                    if (networks.isEmpty()) {
+                        onConnectivityChanged(false)
+                    }
+                }
+            }
+        })
+    }
+
+    /**
+     * Forgets the queue, keeping its file, as if the app was restarted.
+     */
+    internal fun reset() {
+        executor.submit {
+            flushTask?.cancel(false)
+            flushTask = null
+            notices.clear()
+            queueFile = null
+            nextId = 1L
+            doneRecords = 0
+            lastBatchMillis = 0L
+            isOffline = false
+            queueDepth = 0
+        }.get()
+        synchronized(this) {
+            isInitialized = false
+            resetStats()
+        }
+        batchDelayMillis = BATCH_DELAY_MILLIS
+        initialBackoffMillis = INITIAL_BACKOFF_MILLIS
+    }
+
+    const val QUEUE_FILE_NAME = "pobrn_notices.log"
+    const val MAX_QUEUE_SIZE = 500
+    const val MAX_REQUESTS_PER_BATCH = 10
+    const val MAX_ATTEMPTS = 8
+    const val BATCH_DELAY_MILLIS = 1_000L
+    const val INITIAL_BACKOFF_MILLIS = 5_000L
+    const val MAX_BACKOFF_MILLIS = 30 * 60 * 1000L
+    const val MAX_AGE_MILLIS = 24 * 60 * 60 * 1000L
+
+    private const val TAG = "POBRNNoticeDispatcher"
+    private const val HTTP_SCHEME = "http"
+    private const val HTTP_TOO_MANY_REQUESTS = 429
+    private const val TIMEOUT_MILLIS = 10_000
+    private const val MAX_BACKOFF_SHIFT = 20
+    private const val COMPACT_THRESHOLD = 100
+    private const val TEMP_SUFFIX = ".tmp"
+    private const val FIELD_SEPARATOR = '\t'
+    private const val RECORD_SEPARATOR = "\n"
+    private const val ENQUEUED_RECORD = "E"
+    private const val DONE_RECORD = "D"
+    private const val ENQUEUED_FIELD_COUNT = 4
+    private const val DELIVERED = 0
+    private const val REJECTED = 1
+    private const val FAILED = 2
+
+    private const val QUEUE_DEPTH_KEY = "queueDepth"
+    private const val ENQUEUED_KEY = "enqueued"
+    private const val DELIVERED_KEY = "delivered"
+    private const val RETRIES_KEY = "retries"
+    private const val DROPPED_KEY = "dropped"
+    private const val RESTORED_KEY = "restored"
+    private const val LATENCY_P50_KEY = "latencyP50Millis"
+    private const val LATENCY_P95_KEY = "latencyP95Millis"
+    private const val LATENCY_MAX_KEY = "latencyMaxMillis"
+}
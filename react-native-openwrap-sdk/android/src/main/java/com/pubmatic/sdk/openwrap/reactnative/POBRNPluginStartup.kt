@@ -0,0 +1,68 @@
+package com.pubmatic.sdk.openwrap.reactnative
+
+import android.content.Context
+import java.util.concurrent.CountDownLatch
+import java.util.concurrent.atomic.AtomicBoolean
+import kotlin.concurrent.thread
+
+/**
+ * Runs the plugin startup once: the bundled configuration, the GAM start, the resume of the
+ * persisted notices and bid landscape, and the WebView prewarm.
+ *
+ * [OpenWrapSDKPackage] starts it when the bridge sets the plugin up at launch, so that apps which
+ * only use the banner or full screen ads, or load an ad before their first OpenWrapSDK call, get it
+ * too, while the plugin modules are still created lazily. The work runs on a background thread,
+ * only the prewarm being posted to the main thread.
+ */
+object POBRNPluginStartup {
+
+    private val isStarted = AtomicBoolean(false)
+    private var configLatch = CountDownLatch(1)
+
+    /**
+     * Starts the plugin, if not started yet. It may be called from any thread.
+     * @param context the application context
+     */
+    fun start(context: Context) {
+        if (!isStarted.compareAndSet(false, true)) {
+            return
+        }
+        val applicationContext = context.applicationContext ?: context
+        val latch = configLatch
+        // Warm the WebView engine once the app is idle, ahead of the first creative render.
+        POBRNWebViewPool.prewarm(applicationContext)
+        thread(name = THREAD_NAME) {
+            try {
+                // Apply the bundled configuration, if any, before the JS bundle uses the SDK.
+                POBRNSDKConfigurator.applyBundledConfig(applicationContext)
+            } finally {
+                latch.countDown()
+            }
+            // Start GAM, when included, in parallel with the first OpenWrap auction.
+            POBRNGamEventHandlers.initialize(applicationContext)
+            // Resume the delivery of the notices queued by the previous sessions.
+            POBRNNoticeDispatcher.initialize(applicationContext)
+            POBRNBidLandscape.initialize(applicationContext)
+        }
+    }
+
+    /**
+     * Blocks until the bundled configuration is applied, so that it never overrides a value set by
+     * JS. Starts the plugin if not started yet.
+     * @param context the application context
+     */
+    fun awaitConfig(context: Context) {
+        start(context)
+        configLatch.await()
+    }
+
+    /**
+     * Allows the startup to run again, as if the app was restarted.
+     */
+    internal fun reset() {
+        configLatch = CountDownLatch(1)
+        isStarted.set(false)
+    }
+
+    private const val THREAD_NAME = "POBRNStartup"
+}
@@ -0,0 +1,372 @@
+package com.pubmatic.sdk.openwrap.reactnative
+
+import android.os.Handler
+import android.os.Looper
+import android.os.SystemClock
+import org.json.JSONArray
+import org.json.JSONObject
+
+/**
+ * Schedules the loads of the full screen ads, so the ads preloaded ahead of their show do not expire
+ * unseen, each expiry being a wasted auction, creative download and render.
+ *
+ * Per ad unit, it learns from the ads of the session:
+ * - the time from the load call to the show of the ad, and the validity of a bid, from the receipt
+ *   to the expiry of the ad, as moving averages;
+ * - the expiry rate of the ads received, as a moving average of the received ads expired unseen.
+ *
+ * When enabled, a load is deferred until the predicted show falls within the bid validity window,
+ * with a margin: by the predicted load to show time, minus [VALIDITY_MARGIN] of the validity. An ad
+ * unit whose expiry rate exceeds [MAX_EXPIRY_RATE] is throttled: its loads wait while one of its
+ * ads is received and not shown yet. The wasted auctions, the received ads expired unseen, and their
+ * creative bytes are accounted for even if disabled.
+ *
+ * All the methods are expected to be called on the main thread, except the stats ones.
+ */
+object POBRNPreloadScheduler {
+
+    /**
+     * Validity of a bid until one expired on the ad unit, in milliseconds.
+     */
+    const val DEFAULT_VALIDITY_MILLIS = 30 * 60 * 1000L
+
+    /**
+     * Share of the bid validity within which the predicted show must fall.
+     */
+    const val VALIDITY_MARGIN = 0.8
+
+    /**
+     * Expiry rate above which the loads of an ad unit are throttled.
+     */
+    const val MAX_EXPIRY_RATE = 0.5
+
+    /**
+     * Number of received ads shown or expired before an ad unit can be throttled.
+     */
+    const val MIN_SAMPLES = 5
+
+    /**
+     * Weight of the latest sample in the moving averages.
+     */
+    private const val SMOOTHING = 0.2
+
+    /**
+     * What is learned of an ad unit, with its stats.
+     */
+    private class Placement {
+        var loadToShowMillis = 0.0
+        var validityMillis = DEFAULT_VALIDITY_MILLIS.toDouble()
+        var expiryRate = 0.0
+        var samples = 0
+        var hasShown = false
+        var hasExpired = false
+        // Ads received and neither shown nor expired yet.
+        var idleAds = 0
+        val throttledLoads = LinkedHashMap<String, Runnable>()
+
+        var loads = 0
+        var deferredLoads = 0
+        var received = 0
+        var shown = 0
+        var expired = 0
+        var wastedBytes = 0L
+
+        val isThrottled: Boolean
+            get() = samples >= MIN_SAMPLES && expiryRate > MAX_EXPIRY_RATE
+    }
+
+    /**
+     * An ad between its load call and its show or expiry.
+     */
+    private class Ad(val adUnitId: String, val loadMillis: Long) {
+        var receivedMillis = 0L
+        var bytes = 0
+        // Load deferred by the scheduler, with the runnable posted to run it.
+        var load: Runnable? = null
+        var deferredLoad: Runnable? = null
+    }
+
+    private val handler by lazy { Handler(Looper.getMainLooper()) }
+
+    private val placements = HashMap<String, Placement>()
+
+    private val ads = HashMap<String, Ad>()
+
+    @Volatile
+    private var enabled = false
+
+    /**
+     * Enables or disables the deferral of the loads. Disabling starts the deferred loads right away.
+     */
+    fun setEnabled(enabled: Boolean) {
+        this.enabled = enabled
+        if (!enabled) {
+            val loads = ArrayList<Runnable>()
+            synchronized(this) {
+                for (ad in ads.values) {
+                    ad.deferredLoad?.let { handler.removeCallbacks(it) }
+                    ad.load?.let { loads.add(it) }
+                    ad.load = null
+                    ad.deferredLoad = null
+                }
+                placements.values.forEach { loads.addAll(it.throttledLoads.values); it.throttledLoads.clear() }
+            }
+            loads.forEach { it.run() }
+        }
+    }
+
+    fun isEnabled(): Boolean = enabled
+
+    /**
+     * Runs the load of an ad now, or once its predicted show falls within the bid validity window.
+     * A load scheduled earlier for the same ad is replaced.
+     *
+     * @param load starts the load, run on the main thread
+     */
+    fun schedule(adUnitId: String, instanceId: String, load: Runnable) {
+        cancel(instanceId)
+        var deferredLoad: Runnable? = null
+        val delayMillis = synchronized(this) {
+            val placement = placements.getOrPut(adUnitId) { Placement() }
+            val ad = Ad(adUnitId, SystemClock.elapsedRealtime())
+            ads[instanceId] = ad
+            placement.loads++
+            if (!enabled) {
+                return@synchronized 0L
+            }
+            if (placement.isThrottled && placement.idleAds > 0) {
+                placement.deferredLoads++
+                placement.throttledLoads[instanceId] = load
+                return
+            }
+            val delayMillis = deferral(placement)
+            if (delayMillis > 0) {
+                placement.deferredLoads++
+                deferredLoad = Runnable {
+                    synchronized(this) {
+                        ad.load = null
+                        ad.deferredLoad = null
+                    }
+                    load.run()
+                }
+                ad.load = load
+                ad.deferredLoad = deferredLoad
+            }
+            delayMillis
+        }
+        val posted = deferredLoad
+        if (posted != null) {
+            handler.postDelayed(posted, delayMillis)
+        } else {
+            load.run()
+        }
+    }
+
+    /**
+     * Returns true if the load of an ad is deferred or throttled, i.e. scheduled and not started yet.
+     */
+    @Synchronized
+    fun isDeferred(instanceId: String): Boolean {
+        val ad = ads[instanceId] ?: return false
+        return ad.load != null || placements[ad.adUnitId]?.throttledLoads?.containsKey(instanceId) == true
+    }
+
+    /**
+     * Starts the deferred or throttled load of an ad right away, e.g. when a show point cannot wait
+     * for it. The time from the load call is still learned from the original call.
+     *
+     * @return true if a load was started, false if none was deferred
+     */
+    fun runNow(instanceId: String): Boolean {
+        val load = synchronized(this) {
+            val ad = ads[instanceId] ?: return false
+            ad.deferredLoad?.let { handler.removeCallbacks(it) }
+            val load = ad.load ?: placements[ad.adUnitId]?.throttledLoads?.remove(instanceId) ?: return false
+            ad.load = null
+            ad.deferredLoad = null
+            load
+        }
+        load.run()
+        return true
+    }
+
+    /**
+     * Records the receipt of an ad.
+     * @param bytes size of the creative, counted as wasted if the ad expires unseen
+     */
+    @Synchronized
+    fun onAdReceived(instanceId: String, bytes: Int) {
+        val ad = ads[instanceId] ?: return
+        val placement = placements[ad.adUnitId] ?: return
+        if (ad.receivedMillis == 0L) {
+            placement.idleAds++
+        }
+        ad.receivedMillis = SystemClock.elapsedRealtime()
+        ad.bytes = bytes
+        placement.received++
+    }
+
+    /**
+     * Records the show of an ad, learning the time from its load call.
+     */
+    fun onAdShown(instanceId: String) {
+        val loads = synchronized(this) {
+            val ad = ads.remove(instanceId) ?: return
+            val placement = placements[ad.adUnitId] ?: return
+            val loadToShowMillis = (SystemClock.elapsedRealtime() - ad.loadMillis).toDouble()
+            placement.loadToShowMillis = if (placement.hasShown) {
+                placement.loadToShowMillis + SMOOTHING * (loadToShowMillis - placement.loadToShowMillis)
+            } else {
+                loadToShowMillis
+            }
+            placement.hasShown = true
+            placement.shown++
+            settle(ad, placement, isExpired = false)
+        }
+        loads.forEach { it.run() }
+    }
+
+    /**
+     * Records the expiry of an ad, learning the bid validity, and accounts for the wasted auction.
+     */
+    fun onAdExpired(instanceId: String) {
+        val loads = synchronized(this) {
+            val ad = ads.remove(instanceId) ?: return
+            val placement = placements[ad.adUnitId] ?: return
+            if (ad.receivedMillis > 0) {
+                val validityMillis = (SystemClock.elapsedRealtime() - ad.receivedMillis).toDouble()
+                placement.validityMillis = if (placement.hasExpired) {
+                    placement.validityMillis + SMOOTHING * (validityMillis - placement.validityMillis)
+                } else {
+                    validityMillis
+                }
+                placement.hasExpired = true
+            }
+            placement.expired++
+            placement.wastedBytes += ad.bytes
+            settle(ad, placement, isExpired = true)
+        }
+        loads.forEach { it.run() }
+    }
+
+    /**
+     * Cancels the deferred load of an ad and forgets it, e.g. when the ad is destroyed.
+     */
+    fun cancel(instanceId: String) {
+        val loads = synchronized(this) {
+            val ad = ads.remove(instanceId) ?: return
+            val placement = placements[ad.adUnitId] ?: return
+            ad.deferredLoad?.let { handler.removeCallbacks(it) }
+            placement.throttledLoads.remove(instanceId)
+            if (ad.receivedMillis > 0) {
+                placement.idleAds--
+                releaseThrottledLoads(placement)
+            } else {
+                emptyList()
+            }
+        }
+        loads.forEach { it.run() }
+    }
+
+    /**
+     * Returns per ad unit the loads, the loads deferred, the ads received, shown and expired, the
+     * wasted bytes, and what is learned: the show and expiry rates, the load to show time and the
+     * bid validity.
+     */
+    @Synchronized
+    fun toJson(): JSONObject {
+        val adUnits = JSONArray()
+        placements.forEach { (adUnitId, placement) ->
+            adUnits.put(
+                JSONObject()
+                    .put(AD_UNIT_ID_KEY, adUnitId)
+                    .put(LOADS_KEY, placement.loads)
+                    .put(DEFERRED_LOADS_KEY, placement.deferredLoads)
+                    .put(RECEIVED_KEY, placement.received)
+                    .put(SHOWN_KEY, placement.shown)
+                    .put(WASTED_AUCTIONS_KEY, placement.expired)
+                    .put(WASTED_BYTES_KEY, placement.wastedBytes)
+                    .put(SHOW_RATE_KEY, if (placement.received == 0) 0.0 else placement.shown.toDouble() / placement.received)
+                    .put(EXPIRY_RATE_KEY, placement.expiryRate)
+                    .put(LOAD_TO_SHOW_MILLIS_KEY, placement.loadToShowMillis.toLong())
+                    .put(VALIDITY_MILLIS_KEY, placement.validityMillis.toLong())
+                    .put(THROTTLED_KEY, placement.isThrottled)
+            )
+        }
+        return JSONObject().put(AD_UNITS_KEY, adUnits)
+    }
+
+    /**
+     * Removes the stats, keeping what is learned of the ad units.
+     */
+    @Synchronized
+    fun resetStats() {
+        placements.values.forEach {
+            it.loads = 0
+            it.deferredLoads = 0
+            it.received = 0
+            it.shown = 0
+            it.expired = 0
+            it.wastedBytes = 0
+        }
+    }
+
+    /**
+     * Returns the delay of a load, for the predicted show to fall within the bid validity window.
+     */
+    internal fun deferral(loadToShowMillis: Double, validityMillis: Double): Long {
+        return maxOf(0.0, loadToShowMillis - VALIDITY_MARGIN * validityMillis).toLong()
+    }
+
+    private fun deferral(placement: Placement): Long {
+        return if (placement.hasShown) deferral(placement.loadToShowMillis, placement.validityMillis) else 0
+    }
+
+    /**
+     * Updates the expiry rate with a received ad shown or expired.
+     * @return the throttled loads to start
+     */
+    private fun settle(ad: Ad, placement: Placement, isExpired: Boolean): List<Runnable> {
+        ad.deferredLoad?.let { handler.removeCallbacks(it) }
+        if (ad.receivedMillis == 0L) {
+            return emptyList()
+        }
+        placement.expiryRate += SMOOTHING * ((if (isExpired) 1.0 else 0.0) - placement.expiryRate)
+        placement.samples++
+        placement.idleAds--
+        return releaseThrottledLoads(placement)
+    }
+
+    /**
+     * Returns the throttled loads of an ad unit, once none of its ads is waiting for a show.
+     */
+    private fun releaseThrottledLoads(placement: Placement): List<Runnable> {
+        if (placement.idleAds > 0 && placement.isThrottled) {
+            return emptyList()
+        }
+        val loads = placement.throttledLoads.values.toList()
+        placement.throttledLoads.clear()
+        return loads
+    }
+
+    internal fun reset() {
+        ads.values.forEach { ad -> ad.deferredLoad?.let { handler.removeCallbacks(it) } }
+        ads.clear()
+        placements.clear()
+        enabled = false
+    }
+
+    private const val AD_UNITS_KEY = "adUnits"
+    private const val AD_UNIT_ID_KEY = "adUnitId"
+    private const val LOADS_KEY = "loads"
+    private const val DEFERRED_LOADS_KEY = "deferredLoads"
+    private const val RECEIVED_KEY = "received"
+    private const val SHOWN_KEY = "shown"
+    private const val WASTED_AUCTIONS_KEY = "wastedAuctions"
+    private const val WASTED_BYTES_KEY = "wastedBytes"
+    private const val SHOW_RATE_KEY = "showRate"
+    private const val EXPIRY_RATE_KEY = "expiryRate"
+    private const val LOAD_TO_SHOW_MILLIS_KEY = "loadToShowMillis"
+    private const val VALIDITY_MILLIS_KEY = "validityMillis"
+    private const val THROTTLED_KEY = "throttled"
+}
@@ -0,0 +1,200 @@
+package com.pubmatic.sdk.openwrap.reactnative
+
+import android.os.Handler
+import android.os.Looper
+import com.pubmatic.sdk.common.POBError
+import org.json.JSONArray
+import org.json.JSONObject
+import java.util.ArrayDeque
+
+/**
+ * Coalesces identical concurrent ad requests, keyed by publisher id, profile id, ad unit id and the
+ * hash of the request and impression parameters. A bid is rendered once only, so a request cannot
+ * share the ad of another one, instead:
+ * - A load of an ad already loading is ignored.
+ * - Full screen loads of the same key run one at a time, a load queued behind the running one, the
+ *   leader, starts once the leader completes. If the leader has no fill, the queued loads fail with
+ *   the same error without an auction.
+ * - A banner destroyed while its load is in flight is parked for [PARK_TIMEOUT_MILLIS], so that a
+ *   banner created with the same key, e.g. on a remount, adopts the load instead of starting another.
+ *
+ * The number of auctions started and avoided per ad unit is available through [toJson].
+ * All the methods are expected to be called on the main thread, except the stats ones.
+ */
+object POBRNRequestCoalescer {
+
+    /**
+     * A coalesced load of a full screen ad.
+     */
+    interface Flight {
+        /** Starts the auction. */
+        fun start()
+
+        /** Fails the load with the error of the leader, without an auction. */
+        fun fail(error: POBError)
+    }
+
+    /**
+     * Reason an auction was avoided, reported in the stats.
+     */
+    enum class Avoided(val key: String) {
+        /** Load of an ad which is already loading. */
+        DUPLICATE("duplicate"),
+        /** Queued full screen load failed with the no fill of its leader. */
+        SHARED_NO_FILL("sharedNoFill"),
+        /** Banner load adopted from a parked banner. */
+        ADOPTED("adopted")
+    }
+
+    private class Parked(val value: Any, val expire: Runnable)
+
+    private class Counters {
+        var auctions = 0
+        var queued = 0
+        val avoided = IntArray(Avoided.values().size)
+    }
+
+    private val flights = HashMap<String, ArrayDeque<Flight>>()
+    private val parked = HashMap<String, Parked>()
+    private val stats = LinkedHashMap<String, Counters>()
+    private val handler by lazy { Handler(Looper.getMainLooper()) }
+
+    /**
+     * Returns the coalescing key of a request.
+     * @param params the request and impression parameters, or any other input of the request
+     */
+    fun key(publisherId: String, profileId: Int, adUnitId: String, vararg params: String?): String {
+        return "$publisherId:$profileId:$adUnitId:${params.contentHashCode()}"
+    }
+
+    /**
+     * Loads the given full screen ad, now if no other load of the key is running, otherwise once the
+     * running one completes.
+     */
+    fun load(key: String, adUnitId: String, flight: Flight) {
+        val queue = flights.getOrPut(key) { ArrayDeque() }
+        if (queue.contains(flight)) {
+            recordAvoided(adUnitId, Avoided.DUPLICATE)
+            return
+        }
+        queue.addLast(flight)
+        if (queue.size == 1) {
+            recordAuction(adUnitId)
+            flight.start()
+        } else {
+            recordQueued(adUnitId)
+        }
+    }
+
+    /**
+     * Completes the load of the given full screen ad, or removes it from the queue, and starts the
+     * next queued load of the key.
+     * @param error the load error, null if the ad is received or the load is cancelled
+     */
+    fun complete(key: String, adUnitId: String, flight: Flight, error: POBError? = null) {
+        val queue = flights[key] ?: return
+        if (queue.peekFirst() !== flight) {
+            queue.remove(flight)
+            return
+        }
+        queue.removeFirst()
+        if (error?.errorCode == POBError.NO_ADS_AVAILABLE) {
+            while (queue.isNotEmpty()) {
+                recordAvoided(adUnitId, Avoided.SHARED_NO_FILL)
+                queue.removeFirst().fail(error)
+            }
+        }
+        val next = queue.peekFirst()
+        if (next == null) {
+            flights.remove(key)
+        } else {
+            recordAuction(adUnitId)
+            next.start()
+        }
+    }
+
+    /**
+     * Parks a banner whose load is in flight, until it is adopted or [onExpire] is called after
+     * [PARK_TIMEOUT_MILLIS]. A banner already parked with the same key expires right away.
+     */
+    fun park(key: String, value: Any, onExpire: () -> Unit) {
+        val expire = Runnable {
+            if (parked[key]?.value === value) {
+                parked.remove(key)
+            }
+            onExpire()
+        }
+        parked.put(key, Parked(value, expire))?.let {
+            handler.removeCallbacks(it.expire)
+            it.expire.run()
+        }
+        handler.postDelayed(expire, PARK_TIMEOUT_MILLIS)
+    }
+
+    /**
+     * Returns the banner parked with the given key, if any, which is then no longer parked.
+     */
+    fun adopt(key: String, adUnitId: String): Any? {
+        val entry = parked.remove(key) ?: return null
+        handler.removeCallbacks(entry.expire)
+        recordAvoided(adUnitId, Avoided.ADOPTED)
+        return entry.value
+    }
+
+    @Synchronized
+    fun recordAuction(adUnitId: String) {
+        counters(adUnitId).auctions++
+    }
+
+    @Synchronized
+    private fun recordQueued(adUnitId: String) {
+        counters(adUnitId).queued++
+    }
+
+    @Synchronized
+    fun recordAvoided(adUnitId: String, reason: Avoided) {
+        counters(adUnitId).avoided[reason.ordinal]++
+    }
+
+    /**
+     * Returns the stats of every ad unit as a JSON array. Each entry contains adUnitId, the number
+     * of auctions started, of loads queued and of auctions avoided, in total and per [Avoided] reason.
+     */
+    @Synchronized
+    fun toJson(): JSONArray {
+        val json = JSONArray()
+        for ((adUnitId, counters) in stats) {
+            val avoided = JSONObject()
+            Avoided.values().forEach { avoided.put(it.key, counters.avoided[it.ordinal]) }
+            json.put(
+                JSONObject()
+                    .put(POBSDKPluginConstant.AD_UNIT_ID, adUnitId)
+                    .put(AUCTIONS_KEY, counters.auctions)
+                    .put(QUEUED_KEY, counters.queued)
+                    .put(AVOIDED_KEY, counters.avoided.sum())
+                    .put(AVOIDED_BY_REASON_KEY, avoided)
+            )
+        }
+        return json
+    }
+
+    @Synchronized
+    fun resetStats() {
+        stats.clear()
+    }
+
+    internal fun reset() {
+        flights.clear()
+        parked.values.forEach { handler.removeCallbacks(it.expire) }
+        parked.clear()
+        resetStats()
+    }
+
+    private fun counters(adUnitId: String) = stats.getOrPut(adUnitId) { Counters() }
+
+    const val PARK_TIMEOUT_MILLIS = 3_000L
+    private const val AUCTIONS_KEY = "auctions"
+    private const val QUEUED_KEY = "queued"
+    private const val AVOIDED_KEY = "avoided"
+    private const val AVOIDED_BY_REASON_KEY = "avoidedByReason"
+}
@@ -0,0 +1,85 @@
+package com.pubmatic.sdk.openwrap.reactnative
+
+import com.pubmatic.sdk.openwrap.core.POBRequest
+import org.json.JSONException
+import org.json.JSONObject
+import java.util.concurrent.ConcurrentHashMap
+
+/**
+ * Parsed, immutable request parameters. Registered once by id as a template, it is applied to the
+ * requests of every ad referring to it by "templateId", without resending and parsing the
+ * parameters per ad. Null values are not applied.
+ */
+class POBRNRequestTemplate private constructor(
+    val testMode: Boolean?,
+    val bidSummary: Boolean?,
+    val serverUrl: String?,
+    val debugEnabled: Boolean?,
+    val versionId: Int?,
+    val networkTimeout: Int?
+) {
+
+    /**
+     * Sets the parameters of this template on the request.
+     */
+    fun applyTo(request: POBRequest) {
+        testMode?.let { request.enableTestMode(it) }
+        bidSummary?.let { request.enableBidSummary(it) }
+        serverUrl?.let { request.adServerUrl = it }
+        debugEnabled?.let { request.enableDebugState(it) }
+        versionId?.let { request.versionId = it }
+        networkTimeout?.let { request.networkTimeout = it }
+    }
+
+    companion object {
+
+        private val templates = ConcurrentHashMap<String, POBRNRequestTemplate>()
+
+        /**
+         * Parses the request parameters, every key is optional.
+         * {"testMode": true, "bidSummary": true, "serverUrl": "https://...", "debugEnabled": false,
+         * "versionId": 3, "networkTimeout": 5}
+         * @throws JSONException if a value has an invalid type
+         */
+        @Throws(JSONException::class)
+        fun build(json: JSONObject): POBRNRequestTemplate {
+            return POBRNRequestTemplate(
+                if (json.has(POBSDKPluginConstant.POBRN_ENABLE_TEST_MODE_KEY))
+                    json.getBoolean(POBSDKPluginConstant.POBRN_ENABLE_TEST_MODE_KEY) else null,
+                if (json.has(POBSDKPluginConstant.POBRN_ENABLE_BID_SUMMARY_KEY))
+                    json.getBoolean(POBSDKPluginConstant.POBRN_ENABLE_BID_SUMMARY_KEY) else null,
+                if (json.has(POBSDKPluginConstant.POBRN_SERVER_URL_KEY))
+                    json.getString(POBSDKPluginConstant.POBRN_SERVER_URL_KEY) else null,
+                if (json.has(POBSDKPluginConstant.POBRN_ENABLE_RESPONSE_DEBUGGING_KEY))
+                    json.getBoolean(POBSDKPluginConstant.POBRN_ENABLE_RESPONSE_DEBUGGING_KEY) else null,
+                if (json.has(POBSDKPluginConstant.POBRN_VERSION_ID_KEY))
+                    json.getInt(POBSDKPluginConstant.POBRN_VERSION_ID_KEY) else null,
+                if (json.has(POBSDKPluginConstant.POBRN_NETWORK_TIMEOUT_KEY))
+                    json.getInt(POBSDKPluginConstant.POBRN_NETWORK_TIMEOUT_KEY) else null
+            )
+        }
+
+        /**
+         * Registers the template of the given id, replacing the previous one. The ads already
+         * created keep the parameters they were set up with.
+         */
+        fun register(templateId: String, template: POBRNRequestTemplate) {
+            templates[templateId] = template
+        }
+
+        fun unregister(templateId: String) {
+            templates.remove(templateId)
+        }
+
+        /**
+         * Returns the template registered with the given id, if any.
+         */
+        fun forId(templateId: String?): POBRNRequestTemplate? {
+            return templateId?.let { templates[it] }
+        }
+
+        internal fun reset() {
+            templates.clear()
+        }
+    }
+}
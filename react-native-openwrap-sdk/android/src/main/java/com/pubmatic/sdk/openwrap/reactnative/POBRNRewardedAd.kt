@@ -2,6 +2,7 @@ package com.pubmatic.sdk.openwrap.reactnative
 
 import com.facebook.react.bridge.ReactApplicationContext
 import com.pubmatic.sdk.common.POBError
+import com.pubmatic.sdk.common.log.POBLog
 import com.pubmatic.sdk.openwrap.core.POBBid
 import com.pubmatic.sdk.openwrap.core.POBBidEvent
 import com.pubmatic.sdk.openwrap.core.POBBidEventListener
@@ -15,26 +16,85 @@ import org.json.JSONObject
  */
 class POBRNRewardedAd(
     private val instanceId: String,
-    publisherId: String,
-    profileId: Int,
-    adUnitId: String,
-    private val context: ReactApplicationContext
+    private val publisherId: String,
+    private val profileId: Int,
+    private val adUnitId: String,
+    private val context: ReactApplicationContext,
+    gamConfig: POBRNGamConfig? = null
 ) : POBRNFullScreenAd {
 
     private val rewarded: POBRewardedAd?
 
+    private val latencyTimer = POBRNLatencyTimer(POBRNAdFormat.REWARDED, adUnitId)
+
+    private var requestParams: String? = null
+
+    private var impressionParams: String? = null
+
+    // Bid of the current auction, received through the bid event listener.
+    private var pendingBid: POBBid? = null
+
+    private val scheduledLoad = Runnable { load() }
+
+    // Key of the current load in POBRNRequestCoalescer.
+    private var flightKey: String? = null
+
+    private val flight = object : POBRNRequestCoalescer.Flight {
+        override fun start() = startLoad()
+
+        override fun fail(error: POBError) {
+            flightKey = null
+            emitLoadFailed(error)
+        }
+    }
+
     /**
      *  Init block to initialize rewarded ad object
      */
     init {
-        rewarded =
+        POBRNTracer.record(POBRNAdFormat.REWARDED, instanceId, POBRNTracer.Step.CREATE)
+        // Header bidding through GAM when its details are provided and the event handler is included.
+        val eventHandler = gamConfig?.let { config ->
+            context.currentActivity?.let { activity ->
+                POBRNGamEventHandlers.rewardedEventHandler(activity, config, latencyTimer)
+            }
+        }
+        if (gamConfig != null && eventHandler == null) {
+            POBLog.warn(TAG, POBSDKPluginConstant.GAM_UNAVAILABLE_WARN_MSG + adUnitId)
+        }
+        rewarded = if (eventHandler != null) {
+            POBRewardedAd.getRewardedAd(context, publisherId, profileId, adUnitId, eventHandler)
+        } else {
             POBRewardedAd.getRewardedAd(context, publisherId, profileId, adUnitId)
+        }
+        gamConfig?.owNetworkTimeoutSeconds()?.let { rewarded?.adRequest?.networkTimeout = it }
         rewarded?.setListener(POBRewardedAdListener(instanceId))
         // Setting the adPosition to fullScreen for Rewarded Ads.
         rewarded?.impression?.adPosition = POBRequest.AdPosition.FULL_SCREEN
     }
 
     override fun loadAd() {
+        // Preloads are deferred until their predicted show falls within the bid validity window.
+        POBRNPreloadScheduler.schedule(adUnitId, instanceId, scheduledLoad)
+    }
+
+    private fun load() {
+        // Identical loads run one at a time, see POBRNRequestCoalescer.
+        val key = POBRNRequestCoalescer.key(publisherId, profileId, adUnitId, requestParams, impressionParams)
+        if (flightKey != null && flightKey != key) {
+            completeFlight(null)
+        }
+        flightKey = key
+        POBRNRequestCoalescer.load(key, adUnitId, flight)
+    }
+
+    private fun startLoad() {
+        POBRNTracer.record(POBRNAdFormat.REWARDED, instanceId, POBRNTracer.Step.LOAD)
+        latencyTimer.markLoad()
+        // A native mediation rule needs the bid events, even without a JS bid event listener.
+        if (POBRNMediationRule.forAdUnit(adUnitId) != null) {
+            setBidEventListener()
+        }
         rewarded?.loadAd()
     }
 
@@ -65,28 +125,40 @@ class POBRNRewardedAd(
     }
 
     override fun showAd() {
+        POBRNTracer.record(POBRNAdFormat.REWARDED, instanceId, POBRNTracer.Step.SHOW)
+        latencyTimer.markShow()
         rewarded?.show()
     }
 
     override fun setRequestParameters(paramString: String) {
+        requestParams = paramString
+        POBRNTracer.record(POBRNAdFormat.REWARDED, instanceId, POBRNTracer.Step.SET_REQUEST_PARAMS)
         rewarded?.adRequest?.let {
-            POBSDKPluginUtils.setRequestParams(it, paramString)
+            POBRNSystemTrace.section("setRequestParams", instanceId, adUnitId) {
+                POBSDKPluginUtils.setRequestParams(it, paramString)
+            }
         }
     }
 
     override fun setImpressionParameters(paramString: String) {
+        impressionParams = paramString
+        POBRNTracer.record(POBRNAdFormat.REWARDED, instanceId, POBRNTracer.Step.SET_IMPRESSION_PARAMS)
         rewarded?.impression?.let {
-            POBSDKPluginUtils.setImpressionParams(it, paramString)
+            POBRNSystemTrace.section("setImpressionParams", instanceId, adUnitId) {
+                POBSDKPluginUtils.setImpressionParams(it, paramString)
+            }
         }
         // Setting the adPosition to fullScreen for Rewarded Ads.
         rewarded?.impression?.adPosition = POBRequest.AdPosition.FULL_SCREEN
     }
 
     override fun proceedToLoadAd(): Boolean {
+        POBRNTracer.record(POBRNAdFormat.REWARDED, instanceId, POBRNTracer.Step.PROCEED_TO_LOAD)
         return rewarded?.proceedToLoadAd() ?: false
     }
 
     override fun proceedOnError(error: String) {
+        POBRNTracer.record(POBRNAdFormat.REWARDED, instanceId, POBRNTracer.Step.PROCEED_ON_ERROR)
         val bidFailedError = error.toBidEventError()
         rewarded?.proceedOnError(bidFailedError)
     }
@@ -99,10 +171,54 @@ class POBRNRewardedAd(
         return rewarded?.bid?.isExpired ?: false
     }
 
+    override fun isLoading(): Boolean {
+        // A load deferred by the preload scheduler counts, it is started on the next show point.
+        return flightKey != null || POBRNPreloadScheduler.isDeferred(instanceId)
+    }
+
+    override fun getBidPrice(): Double {
+        return rewarded?.bid?.price ?: 0.0
+    }
+
     override fun destroy() {
+        POBRNTracer.record(POBRNAdFormat.REWARDED, instanceId, POBRNTracer.Step.DESTROY)
+        POBRNFullScreenArbiter.onFullScreenClosed(instanceId)
+        POBRNPreloadScheduler.cancel(instanceId)
+        completeFlight(null)
+        POBRNMediaCache.evict(instanceId)
         rewarded?.destroy()
     }
 
+    /**
+     * Completes the current load in [POBRNRequestCoalescer], so the next identical load can start.
+     * @param error the load error, null if the ad is received or the load is cancelled
+     */
+    private fun completeFlight(error: POBError?) {
+        val key = flightKey ?: return
+        flightKey = null
+        POBRNRequestCoalescer.complete(key, adUnitId, flight, error)
+    }
+
+    /**
+     * Records the outcome of the current auction into [POBRNBidLandscape].
+     */
+    private fun recordAuction(bid: POBBid?, isRendered: Boolean) {
+        pendingBid = null
+        POBRNBidLandscape.record(POBRNAdFormat.REWARDED, adUnitId, bid, isRendered)
+    }
+
+    private fun emitLoadFailed(error: POBError) {
+        POBRNTracer.record(POBRNAdFormat.REWARDED, instanceId, POBRNTracer.Step.AD_FAILED_TO_LOAD)
+        POBSDKPluginUtils.emitCallbackEvent(
+            context,
+            POBSDKPluginConstant.REWARDED_AD_EVENT,
+            POBRNEventSchema.AD_FAILED_TO_LOAD,
+            instanceId,
+            POBSDKPluginUtils.getErrorExtJSON(error),
+            adUnitId
+        )
+    }
+
     /**
      * Internal class which implement POBRewardedAd Listener and communicates callbacks to React
      */
@@ -112,14 +228,25 @@ class POBRNRewardedAd(
          * Notifies the listener that an ad has been successfully loaded and rendered.
          */
         override fun onAdReceived(ad: POBRewardedAd) {
+            POBRNTracer.record(POBRNAdFormat.REWARDED, instanceId, POBRNTracer.Step.AD_RECEIVED)
+            latencyTimer.markAdReceived()
+            recordAuction(ad.bid ?: pendingBid, isRendered = true)
+            completeFlight(null)
+            POBRNPreloadScheduler.onAdReceived(instanceId, ad.bid?.creative?.length ?: 0)
+            // Shows the ad right away if a show of its group is waiting for it.
+            POBRNShowFallback.onAdReceived(instanceId)
+            POBRNMediaCache.prefetch(context, instanceId, ad.bid?.creative)
             // Converting bid to json object
-            val bidObject = ad.bid?.toJson()
+            val bidObject = latencyTimer.attachTo(
+                POBRNSystemTrace.section("toJson", instanceId, adUnitId) { ad.bid?.toJson() }
+            )
             POBSDKPluginUtils.emitCallbackEvent(
                 context,
                 POBSDKPluginConstant.REWARDED_AD_EVENT,
-                POBSDKPluginConstant.AD_RECEIVED_EVENT,
+                POBRNEventSchema.AD_RECEIVED,
                 instanceId,
-                bidObject
+                bidObject,
+                adUnitId
             )
         }
 
@@ -127,25 +254,25 @@ class POBRNRewardedAd(
          * Notifies the listener of an error encountered while loading an ad.
          */
         override fun onAdFailedToLoad(ad: POBRewardedAd, error: POBError) {
-            POBSDKPluginUtils.emitCallbackEvent(
-                context,
-                POBSDKPluginConstant.REWARDED_AD_EVENT,
-                POBSDKPluginConstant.AD_FAILED_TO_LOAD_EVENT,
-                instanceId,
-                POBSDKPluginUtils.getErrorExtJSON(error)
-            )
+            latencyTimer.markLoadFailed()
+            recordAuction(pendingBid, isRendered = false)
+            completeFlight(error)
+            emitLoadFailed(error)
         }
 
         /**
          * Notifies the listener of an error encountered while rendering an ad.
          */
         override fun onAdFailedToShow(ad: POBRewardedAd, error: POBError) {
+            POBRNTracer.record(POBRNAdFormat.REWARDED, instanceId, POBRNTracer.Step.AD_FAILED_TO_SHOW)
+            POBRNFullScreenArbiter.onFullScreenClosed(instanceId)
             POBSDKPluginUtils.emitCallbackEvent(
                 context,
                 POBSDKPluginConstant.REWARDED_AD_EVENT,
-                POBSDKPluginConstant.AD_FAILED_TO_SHOW_EVENT,
+                POBRNEventSchema.AD_FAILED_TO_SHOW,
                 instanceId,
-                POBSDKPluginUtils.getErrorExtJSON(error)
+                POBSDKPluginUtils.getErrorExtJSON(error),
+                adUnitId
             )
         }
 
@@ -153,12 +280,14 @@ class POBRNRewardedAd(
          * Notifies that the user has clicked the ad view.
          */
         override fun onAdClicked(ad: POBRewardedAd) {
+            POBRNTracer.record(POBRNAdFormat.REWARDED, instanceId, POBRNTracer.Step.CLICK)
             POBSDKPluginUtils.emitCallbackEvent(
                 context,
                 POBSDKPluginConstant.REWARDED_AD_EVENT,
-                POBSDKPluginConstant.AD_CLICKED_EVENT,
+                POBRNEventSchema.AD_CLICKED,
                 instanceId,
-                null
+                null,
+                adUnitId
             )
         }
 
@@ -167,12 +296,17 @@ class POBRNRewardedAd(
          * view/screen, as a result of user interaction.
          */
         override fun onAdOpened(ad: POBRewardedAd) {
+            POBRNTracer.record(POBRNAdFormat.REWARDED, instanceId, POBRNTracer.Step.AD_OPENED)
+            POBRNFullScreenArbiter.onFullScreenOpened(instanceId)
+            POBRNPreloadScheduler.onAdShown(instanceId)
+            latencyTimer.markOpened()
             POBSDKPluginUtils.emitCallbackEvent(
                 context,
                 POBSDKPluginConstant.REWARDED_AD_EVENT,
-                POBSDKPluginConstant.AD_OPENED_EVENT,
+                POBRNEventSchema.AD_OPENED,
                 instanceId,
-                null
+                latencyTimer.attachTo(null),
+                adUnitId
             )
         }
 
@@ -180,12 +314,15 @@ class POBRNRewardedAd(
          * Notifies that the rewarded ad has closed the ad on top of the current view.
          */
         override fun onAdClosed(ad: POBRewardedAd) {
+            POBRNTracer.record(POBRNAdFormat.REWARDED, instanceId, POBRNTracer.Step.CLOSE)
+            POBRNFullScreenArbiter.onFullScreenClosed(instanceId)
             POBSDKPluginUtils.emitCallbackEvent(
                 context,
                 POBSDKPluginConstant.REWARDED_AD_EVENT,
-                POBSDKPluginConstant.AD_CLOSED_EVENT,
+                POBRNEventSchema.AD_CLOSED,
                 instanceId,
-                null
+                null,
+                adUnitId
             )
         }
 
@@ -193,12 +330,16 @@ class POBRNRewardedAd(
          * Notifies the listener that an ad has been expired
          */
         override fun onAdExpired(ad: POBRewardedAd) {
+            POBRNTracer.record(POBRNAdFormat.REWARDED, instanceId, POBRNTracer.Step.EXPIRED)
+            POBRNPreloadScheduler.onAdExpired(instanceId)
+            POBRNMediaCache.evict(instanceId)
             POBSDKPluginUtils.emitCallbackEvent(
                 context,
                 POBSDKPluginConstant.REWARDED_AD_EVENT,
-                POBSDKPluginConstant.AD_EXPIRED_EVENT,
+                POBRNEventSchema.AD_EXPIRED,
                 instanceId,
-                null
+                null,
+                adUnitId
             )
         }
 
@@ -209,9 +350,10 @@ class POBRNRewardedAd(
             POBSDKPluginUtils.emitCallbackEvent(
                 context,
                 POBSDKPluginConstant.REWARDED_AD_EVENT,
-                POBSDKPluginConstant.APP_LEAVE_EVENT,
+                POBRNEventSchema.APP_LEAVING,
                 instanceId,
-                null
+                null,
+                adUnitId
             )
         }
 
@@ -226,9 +368,10 @@ class POBRNRewardedAd(
             POBSDKPluginUtils.emitCallbackEvent(
                 context,
                 POBSDKPluginConstant.REWARDED_AD_EVENT,
-                POBSDKPluginConstant.RECEIVE_REWARD_EVENT,
+                POBRNEventSchema.RECEIVE_REWARD,
                 instanceId,
-                ext
+                ext,
+                adUnitId
             )
         }
     }
@@ -238,24 +381,56 @@ class POBRNRewardedAd(
      */
     inner class POBRewardedBidEventListener(val instanceId: String) : POBBidEventListener {
         override fun onBidReceived(bidEvent: POBBidEvent, bid: POBBid) {
-            val bidObject = bid.toJson()
+            POBRNTracer.record(POBRNAdFormat.REWARDED, instanceId, POBRNTracer.Step.BID_RECEIVED)
+            latencyTimer.markBidReceived()
+            pendingBid = bid
+            val rule = POBRNMediationRule.forAdUnit(adUnitId)
+            if (rule != null) {
+                // Evaluate the registered mediation rule right away and only notify its outcome.
+                val outcome = rule.apply(
+                    bidEvent, bid, latencyTimer.durationMillis(POBRNLatencyTracker.Metric.LOAD_TO_BID)
+                )
+                POBRNTracer.record(
+                    POBRNAdFormat.REWARDED, instanceId,
+                    if (outcome.isWin) POBRNTracer.Step.PROCEED_TO_LOAD else POBRNTracer.Step.PROCEED_ON_ERROR
+                )
+                POBSDKPluginUtils.emitCallbackEvent(
+                    context,
+                    POBSDKPluginConstant.REWARDED_AD_EVENT,
+                    POBRNEventSchema.MEDIATION_OUTCOME,
+                    instanceId,
+                    latencyTimer.attachTo(outcome.toJson()),
+                    adUnitId
+                )
+                return
+            }
+            val bidObject = latencyTimer.attachTo(
+                POBRNSystemTrace.section("toJson", instanceId, adUnitId) { bid.toJson() }
+            )
             POBSDKPluginUtils.emitCallbackEvent(
                 context,
                 POBSDKPluginConstant.REWARDED_AD_EVENT,
-                POBSDKPluginConstant.BID_RECEIVED_EVENT,
+                POBRNEventSchema.BID_RECEIVED,
                 instanceId,
-                bidObject
+                bidObject,
+                adUnitId
             )
         }
 
         override fun onBidFailed(bidEvent: POBBidEvent, error: POBError) {
+            POBRNTracer.record(POBRNAdFormat.REWARDED, instanceId, POBRNTracer.Step.BID_FAILED)
             POBSDKPluginUtils.emitCallbackEvent(
                 context,
                 POBSDKPluginConstant.REWARDED_AD_EVENT,
-                POBSDKPluginConstant.BID_FAILED_EVENT,
+                POBRNEventSchema.BID_FAILED,
                 instanceId,
-                POBSDKPluginUtils.getErrorExtJSON(error)
+                POBSDKPluginUtils.getErrorExtJSON(error),
+                adUnitId
             )
         }
     }
-}
\ No newline at end of file
+
+    companion object {
+        private const val TAG = "POBRNRewardedAd"
+    }
+}
@@ -0,0 +1,141 @@
+package com.pubmatic.sdk.openwrap.reactnative
+
+import android.content.Context
+import android.os.Handler
+import android.os.Looper
+import com.pubmatic.sdk.common.OpenWrapSDK
+import com.pubmatic.sdk.common.log.POBLog
+import org.json.JSONException
+import org.json.JSONObject
+import java.io.IOException
+
+/**
+ * Applies the global {@link OpenWrapSDK} configuration in one go.
+ * Remembers the last applied value of every key, so unchanged values are not applied again
+ * whether they come from the bundled config or from JS. The individual setters of the plugin
+ * invalidate the value of their key, see [invalidate].
+ */
+object POBRNSDKConfigurator {
+
+    private const val TAG = "POBRNSDKConfigurator"
+
+    private val appliedConfig = HashMap<String, String>()
+
+    /**
+     * Applies the configuration json, expects below format, every key is optional.
+     * {
+        "logLevel": 4,
+        "allowLocationAccess": true,
+        "coppa": false,
+        "sslEnabled": true,
+        "useInternalBrowser": false,
+        "allowAdvertisingId": true,
+        "applicationInfo": { "domain": "example.com", "storeUrl": "https://example.com/app" },
+        "userInfo": { "city": "Pune", "birthYear": 1990 },
+        "location": { "latitude": 1.2, "longitude": 1.5, "source": 1 },
+        "webViewPoolSize": 1
+        }
+     * @param config the configuration json
+     * @return keys which were applied, i.e. skipping the unchanged ones
+     */
+    @Synchronized
+    fun apply(config: JSONObject): List<String> {
+        val appliedKeys = ArrayList<String>()
+        for (key in config.keys()) {
+            val value = config.get(key).toString()
+            if (appliedConfig[key] == value) {
+                continue
+            }
+            try {
+                if (applyValue(config, key)) {
+                    appliedConfig[key] = value
+                    appliedKeys.add(key)
+                }
+            } catch (exception: JSONException) {
+                POBLog.warn(TAG, POBSDKPluginConstant.CONFIG_WARN_MSG + "$key: ${exception.message}")
+            }
+        }
+        return appliedKeys
+    }
+
+    /**
+     * Applies the configuration bundled in the app assets as
+     * [POBSDKPluginConstant.BUNDLED_CONFIG_FILE], if any.
+     * It can be called from Application.onCreate() to configure the SDK before React Native starts,
+     * it is anyway called when the plugin starts, see [POBRNPluginStartup].
+     * @param context the application context
+     */
+    fun applyBundledConfig(context: Context) {
+        val assets = context.assets ?: return
+        try {
+            val json = assets.open(POBSDKPluginConstant.BUNDLED_CONFIG_FILE)
+                .bufferedReader().use { it.readText() }
+            apply(JSONObject(json))
+        } catch (exception: IOException) {
+            // No bundled configuration, no action required.
+        } catch (exception: JSONException) {
+            POBLog.warn(TAG, POBSDKPluginConstant.CONFIG_WARN_MSG + "${exception.message}")
+        }
+    }
+
+    /**
+     * Forgets the applied value of a key, set since then by its individual setter, so that the next
+     * configuration applies it again.
+     * @param key the configuration key
+     */
+    @Synchronized
+    fun invalidate(key: String) {
+        appliedConfig.remove(key)
+    }
+
+    /**
+     * Forgets the applied configuration, so that the next values are applied again.
+     */
+    @Synchronized
+    internal fun reset() {
+        appliedConfig.clear()
+    }
+
+    /**
+     * Applies the value of given key on {@link OpenWrapSDK}
+     * @return true if the key is supported, false otherwise
+     */
+    @Throws(JSONException::class)
+    private fun applyValue(config: JSONObject, key: String): Boolean {
+        when (key) {
+            POBSDKPluginConstant.CONFIG_LOG_LEVEL_KEY -> {
+                val level = POBSDKPluginParserHelper.parseLogLevel(config.getInt(key)) ?: return false
+                OpenWrapSDK.setLogLevel(level)
+            }
+            POBSDKPluginConstant.CONFIG_ALLOW_LOCATION_ACCESS_KEY ->
+                OpenWrapSDK.allowLocationAccess(config.getBoolean(key))
+            POBSDKPluginConstant.CONFIG_COPPA_KEY ->
+                OpenWrapSDK.setCoppa(config.getBoolean(key))
+            POBSDKPluginConstant.CONFIG_SSL_ENABLED_KEY ->
+                OpenWrapSDK.setSSLEnabled(config.getBoolean(key))
+            POBSDKPluginConstant.CONFIG_USE_INTERNAL_BROWSER_KEY ->
+                OpenWrapSDK.setUseInternalBrowser(config.getBoolean(key))
+            POBSDKPluginConstant.CONFIG_ALLOW_ADVERTISING_ID_KEY ->
+                OpenWrapSDK.allowAdvertisingId(config.getBoolean(key))
+            POBSDKPluginConstant.CONFIG_APPLICATION_INFO_KEY ->
+                OpenWrapSDK.setApplicationInfo(
+                    POBSDKPluginParserHelper.parseJsonToApplicationInfo(config.getJSONObject(key).toString())
+                )
+            POBSDKPluginConstant.CONFIG_USER_INFO_KEY ->
+                OpenWrapSDK.setUserInfo(
+                    POBSDKPluginParserHelper.parseJsonToUserInfo(config.getJSONObject(key).toString())
+                )
+            POBSDKPluginConstant.CONFIG_LOCATION_KEY ->
+                OpenWrapSDK.setLocation(
+                    POBSDKPluginParserHelper.parseJsonToLocation(config.getJSONObject(key).toString())
+                )
+            POBSDKPluginConstant.CONFIG_WEBVIEW_POOL_SIZE_KEY -> {
+                val size = config.getInt(key)
+                // The pool is only accessed on the main thread.
+                Handler(Looper.getMainLooper()).post { POBRNWebViewPool.maxSize = size }
+            }
+            else -> return false
+        }
+        return true
+    }
+}
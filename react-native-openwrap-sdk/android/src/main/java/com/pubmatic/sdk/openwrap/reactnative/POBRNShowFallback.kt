@@ -0,0 +1,109 @@
+package com.pubmatic.sdk.openwrap.reactnative
+
+import android.os.Handler
+import android.os.Looper
+
+/**
+ * Shows the best ready full screen ad of a show group, so a show point is not lost when the ad the
+ * app picked is still loading or its bid expired.
+ *
+ * The ads are added to a group of [POBRNAdManager], interstitials and rewarded ads alike. In one
+ * pass, [showBestAvailable] checks the readiness and the bid expiry of every ad of the group and
+ * shows the ready one with the highest bid price, the first added on a tie. The ads of the group
+ * neither ready nor loading, e.g. failed or expired, load again to replace it.
+ *
+ * When no ad is ready, the loads of the group deferred by [POBRNPreloadScheduler] start right away,
+ * the show point being now. When some ads are loading, the show waits up to the latency budget for
+ * the first of them to be received, then gives up. All the methods are expected to be called on the main
+ * thread.
+ */
+object POBRNShowFallback {
+
+    /**
+     * A show waiting for an ad of its group to be received.
+     */
+    private class PendingShow(val group: String, val callback: (String?) -> Unit) : Runnable {
+        override fun run() {
+            pendingShows.remove(group)
+            callback(null)
+        }
+    }
+
+    private val handler by lazy { Handler(Looper.getMainLooper()) }
+
+    private val pendingShows = HashMap<String, PendingShow>()
+
+    /**
+     * Shows the best ready ad of the group and loads the replacements of the others.
+     *
+     * @param budgetMillis Time to wait for a loading ad when none is ready, 0 not to wait.
+     * @param callback Called with the instance id of the ad shown, null if none could be shown in
+     * the budget.
+     */
+    fun showBestAvailable(group: String, budgetMillis: Long, callback: (String?) -> Unit) {
+        // A newer show of the same group supersedes the waiting one.
+        pendingShows.remove(group)?.let {
+            handler.removeCallbacks(it)
+            it.callback(null)
+        }
+        val instanceId = showBestReady(group)
+        if (instanceId == null) {
+            POBRNAdManager.group(group).forEach { POBRNPreloadScheduler.runNow(it) }
+        }
+        if (instanceId != null || budgetMillis <= 0 || !isLoading(group)) {
+            callback(instanceId)
+            return
+        }
+        val pendingShow = PendingShow(group, callback)
+        pendingShows[group] = pendingShow
+        handler.postDelayed(pendingShow, budgetMillis)
+    }
+
+    /**
+     * Shows the given ad, once its listener returns, if a show of one of its groups is waiting.
+     */
+    fun onAdReceived(instanceId: String) {
+        if (pendingShows.isEmpty()) {
+            return
+        }
+        for (group in POBRNAdManager.groupsOf(instanceId)) {
+            val pendingShow = pendingShows.remove(group) ?: continue
+            handler.removeCallbacks(pendingShow)
+            handler.post { pendingShow.callback(showBestReady(group)) }
+            return
+        }
+    }
+
+    /**
+     * Shows the ready ad with the highest bid price and reloads the ads neither ready nor loading.
+     *
+     * @return the instance id of the ad shown, null if none is ready
+     */
+    private fun showBestReady(group: String): String? {
+        var best: POBRNFullScreenAd? = null
+        var bestInstanceId: String? = null
+        val ads = POBRNAdManager.group(group).mapNotNull { id -> POBRNAdManager.get(id)?.let { id to it } }
+        for ((instanceId, ad) in ads) {
+            if (ad.isReady() && !ad.isBidExpired() && (best == null || ad.getBidPrice() > best.getBidPrice())) {
+                best = ad
+                bestInstanceId = instanceId
+            }
+        }
+        best?.showAd()
+        for ((_, ad) in ads) {
+            if (ad !== best && !ad.isLoading() && (!ad.isReady() || ad.isBidExpired())) {
+                ad.loadAd()
+            }
+        }
+        return bestInstanceId
+    }
+
+    private fun isLoading(group: String): Boolean {
+        return POBRNAdManager.group(group).any { POBRNAdManager.get(it)?.isLoading() == true }
+    }
+
+    internal fun reset() {
+        pendingShows.values.forEach { handler.removeCallbacks(it) }
+        pendingShows.clear()
+    }
+}
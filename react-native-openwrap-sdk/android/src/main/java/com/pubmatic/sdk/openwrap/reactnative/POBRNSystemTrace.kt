@@ -0,0 +1,67 @@
+package com.pubmatic.sdk.openwrap.reactnative
+
+import android.os.Trace
+
+/**
+ * Wraps the plugin hot paths into named sections of the platform tracer, so their work shows up in
+ * Perfetto and systrace captures instead of anonymous time on the calling thread.
+ *
+ * [Trace] sections have no arguments, the instance id and ad unit id are appended to the section
+ * name: "POBRN.<name> <instanceId> <adUnitId>", "-" standing for an unknown instance id. Sections
+ * are disabled by default, in that case [section] costs a single volatile read and the name is not
+ * built.
+ */
+object POBRNSystemTrace {
+
+    /**
+     * Maximum length of a section name accepted by [Trace.beginSection].
+     */
+    private const val MAX_NAME_LENGTH = 127
+
+    private const val PREFIX = "POBRN."
+
+    @Volatile
+    @PublishedApi
+    internal var enabled = false
+
+    /**
+     * Enables or disables the trace sections.
+     */
+    fun setEnabled(enabled: Boolean) {
+        this.enabled = enabled
+    }
+
+    fun isEnabled(): Boolean = enabled
+
+    /**
+     * Runs the block inside the trace section of the given name, if enabled. The section is ended
+     * on the same thread, even if the block throws.
+     *
+     * @param instanceId Id of the ad instance, the view id for banners.
+     * @param adUnitId Ad unit id of the instance, null when not known yet.
+     */
+    inline fun <T> section(name: String, instanceId: String?, adUnitId: String?, block: () -> T): T {
+        if (!enabled) {
+            return block()
+        }
+        Trace.beginSection(sectionName(name, instanceId, adUnitId))
+        try {
+            return block()
+        } finally {
+            Trace.endSection()
+        }
+    }
+
+    @PublishedApi
+    internal fun sectionName(name: String, instanceId: String?, adUnitId: String?): String {
+        val sectionName = StringBuilder(PREFIX).append(name)
+        sectionName.append(' ').append(instanceId ?: "-")
+        adUnitId?.let { sectionName.append(' ').append(it) }
+        return if (sectionName.length > MAX_NAME_LENGTH)
+            sectionName.substring(0, MAX_NAME_LENGTH) else sectionName.toString()
+    }
+
+    internal fun reset() {
+        enabled = false
+    }
+}
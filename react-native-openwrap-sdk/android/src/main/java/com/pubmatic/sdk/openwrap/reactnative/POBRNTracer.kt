@@ -0,0 +1,185 @@
+package com.pubmatic.sdk.openwrap.reactnative
+
+import android.os.Process
+import org.json.JSONArray
+import org.json.JSONObject
+import java.util.concurrent.atomic.AtomicLong
+import java.util.concurrent.atomic.AtomicReferenceArray
+
+/**
+ * Records the lifecycle steps of every plugin ad instance into a fixed size, lock-free ring buffer.
+ * Writers claim a slot with a single atomic increment, so recording never blocks the UI thread or
+ * the SDK callback threads. Once the buffer is full, the oldest entries are overwritten.
+ *
+ * Tracing is disabled by default, in that case [record] costs a single volatile read.
+ */
+object POBRNTracer {
+
+    /**
+     * Number of entries retained by the ring buffer. Must be a power of two.
+     */
+    const val CAPACITY = 4096
+
+    private const val INDEX_MASK = (CAPACITY - 1).toLong()
+
+    /**
+     * Lifecycle steps recorded by the tracer.
+     */
+    enum class Step(val traceName: String) {
+        CREATE("create"),
+        SET_REQUEST_PARAMS("setRequestParams"),
+        SET_IMPRESSION_PARAMS("setImpressionParams"),
+        LOAD("load"),
+        BID_RECEIVED("bidReceived"),
+        BID_FAILED("bidFailed"),
+        PROCEED_TO_LOAD("proceedToLoadAd"),
+        PROCEED_ON_ERROR("proceedOnError"),
+        AD_RECEIVED("adReceived"),
+        AD_FAILED_TO_LOAD("adFailedToLoad"),
+        SHOW("show"),
+        AD_OPENED("adOpened"),
+        AD_FAILED_TO_SHOW("adFailedToShow"),
+        CLICK("click"),
+        CLOSE("close"),
+        EXPIRED("expired"),
+        DESTROY("destroy")
+    }
+
+    /**
+     * Immutable trace entry. Entries are published into the ring buffer fully constructed, so a
+     * reader never observes a partially written entry.
+     *
+     * @param sequence Position of the entry in the recording order.
+     * @param timestampNanos Monotonic timestamp from [System.nanoTime].
+     * @param threadId Linux thread id of the thread that recorded the step.
+     * @param threadName Name of the thread that recorded the step.
+     */
+    class Entry(
+        val sequence: Long,
+        val timestampNanos: Long,
+        val threadId: Int,
+        val threadName: String,
+        val format: POBRNAdFormat,
+        val instanceId: String,
+        val step: Step
+    )
+
+    @Volatile
+    private var enabled = false
+
+    private val entries = AtomicReferenceArray<Entry?>(CAPACITY)
+
+    private val cursor = AtomicLong(0)
+
+    /**
+     * Enables or disables recording. Already recorded entries are retained.
+     */
+    fun setEnabled(enabled: Boolean) {
+        this.enabled = enabled
+    }
+
+    /**
+     * @return true if lifecycle steps are currently being recorded.
+     */
+    fun isEnabled(): Boolean {
+        return enabled
+    }
+
+    /**
+     * Records a lifecycle step for the given ad instance. No-op when tracing is disabled.
+     */
+    fun record(format: POBRNAdFormat, instanceId: String, step: Step) {
+        if (!enabled) {
+            return
+        }
+        val sequence = cursor.getAndIncrement()
+        val thread = Thread.currentThread()
+        entries.set(
+            (sequence and INDEX_MASK).toInt(),
+            Entry(sequence, System.nanoTime(), Process.myTid(), thread.name, format, instanceId, step)
+        )
+    }
+
+    /**
+     * Returns the retained entries in recording order. Entries overwritten while the snapshot is
+     * taken are skipped.
+     */
+    fun snapshot(): List<Entry> {
+        val end = cursor.get()
+        val start = maxOf(0L, end - CAPACITY)
+        val result = ArrayList<Entry>((end - start).toInt())
+        for (sequence in start until end) {
+            val entry = entries.get((sequence and INDEX_MASK).toInt())
+            if (entry != null && entry.sequence == sequence) {
+                result.add(entry)
+            }
+        }
+        return result
+    }
+
+    /**
+     * Removes all the recorded entries.
+     */
+    fun clear() {
+        for (i in 0 until CAPACITY) {
+            entries.set(i, null)
+        }
+    }
+
+    /**
+     * Serializes the retained entries in the Chrome trace-event JSON format, which can be opened
+     * in chrome://tracing or https://ui.perfetto.dev
+     */
+    fun toChromeTraceJson(): String {
+        val pid = Process.myPid()
+        val traceEvents = JSONArray()
+        val threadNames = HashMap<Int, String>()
+        for (entry in snapshot()) {
+            threadNames[entry.threadId] = entry.threadName
+            val args = JSONObject()
+            args.put(POBSDKPluginConstant.INSTANCE_ID_KEY, entry.instanceId)
+            val event = JSONObject()
+            event.put(TRACE_NAME_KEY, entry.step.traceName)
+            event.put(TRACE_CATEGORY_KEY, entry.format.value)
+            event.put(TRACE_PHASE_KEY, TRACE_PHASE_INSTANT)
+            event.put(TRACE_SCOPE_KEY, TRACE_SCOPE_THREAD)
+            event.put(TRACE_TIMESTAMP_KEY, entry.timestampNanos / 1000.0)
+            event.put(TRACE_PROCESS_ID_KEY, pid)
+            event.put(TRACE_THREAD_ID_KEY, entry.threadId)
+            event.put(TRACE_ARGS_KEY, args)
+            traceEvents.put(event)
+        }
+        // Metadata events let trace viewers show the thread names instead of bare thread ids.
+        for ((threadId, threadName) in threadNames) {
+            val args = JSONObject()
+            args.put(TRACE_NAME_KEY, threadName)
+            val event = JSONObject()
+            event.put(TRACE_NAME_KEY, TRACE_THREAD_NAME_EVENT)
+            event.put(TRACE_PHASE_KEY, TRACE_PHASE_METADATA)
+            event.put(TRACE_PROCESS_ID_KEY, pid)
+            event.put(TRACE_THREAD_ID_KEY, threadId)
+            event.put(TRACE_ARGS_KEY, args)
+            traceEvents.put(event)
+        }
+        val trace = JSONObject()
+        trace.put(TRACE_EVENTS_KEY, traceEvents)
+        trace.put(TRACE_DISPLAY_TIME_UNIT_KEY, "ms")
+        return trace.toString()
+    }
+
+    // Chrome trace-event format keys
+    private const val TRACE_EVENTS_KEY = "traceEvents"
+    private const val TRACE_DISPLAY_TIME_UNIT_KEY = "displayTimeUnit"
+    private const val TRACE_NAME_KEY = "name"
+    private const val TRACE_CATEGORY_KEY = "cat"
+    private const val TRACE_PHASE_KEY = "ph"
+    private const val TRACE_SCOPE_KEY = "s"
+    private const val TRACE_TIMESTAMP_KEY = "ts"
+    private const val TRACE_PROCESS_ID_KEY = "pid"
+    private const val TRACE_THREAD_ID_KEY = "tid"
+    private const val TRACE_ARGS_KEY = "args"
+    private const val TRACE_PHASE_INSTANT = "i"
+    private const val TRACE_PHASE_METADATA = "M"
+    private const val TRACE_SCOPE_THREAD = "t"
+    private const val TRACE_THREAD_NAME_EVENT = "thread_name"
+}
@@ -0,0 +1,140 @@
+package com.pubmatic.sdk.openwrap.reactnative
+
+import android.app.ActivityManager
+import android.content.ComponentCallbacks2
+import android.content.Context
+import android.content.res.Configuration
+import android.os.Handler
+import android.os.Looper
+import android.os.MessageQueue
+import android.webkit.WebView
+import com.pubmatic.sdk.common.log.POBLog
+
+/**
+ * Keeps a small pool of idle WebViews, created while the main thread is idle after startup.
+ *
+ * The OpenWrap SDK creates the WebViews rendering the creatives itself, so pooled WebViews cannot
+ * be handed over to it. Instead, keeping them alive keeps the WebView engine loaded and its
+ * renderer process running, so the first banner or interstitial render does not pay for their
+ * start, nor does a render after all the previous ads were destroyed.
+ *
+ * The pool is disabled by default, as it costs every app a WebView whether or not it shows ads
+ * rendered in one: apps opt in with [maxSize], through setWebViewPoolSize or the configuration.
+ * It holds at most [MAX_SIZE] WebViews. It is not filled on low RAM devices and it is drained
+ * when the system reports memory pressure. All the methods are expected to be called on the main thread.
+ */
+object POBRNWebViewPool {
+
+    private val webViews = ArrayList<WebView>()
+    private val handler by lazy { Handler(Looper.getMainLooper()) }
+    private var appContext: Context? = null
+    private var isIdleHandlerAdded = false
+
+    /**
+     * Number of WebViews kept warm, from 0 to [MAX_SIZE]. 0 disables the pool and drains it.
+     */
+    var maxSize = DEFAULT_SIZE
+        set(value) {
+            field = value.coerceIn(0, MAX_SIZE)
+            trimTo(field)
+            fill()
+        }
+
+    private val idleHandler = MessageQueue.IdleHandler {
+        // One WebView per idle pass, so that filling the pool never stalls a frame for long.
+        isIdleHandlerAdded = false
+        if (webViews.size < maxSize) {
+            createWebView()?.let { webViews.add(it) }
+            fill()
+        }
+        false
+    }
+
+    private val memoryCallbacks = object : ComponentCallbacks2 {
+        override fun onTrimMemory(level: Int) {
+            if (level >= ComponentCallbacks2.TRIM_MEMORY_RUNNING_LOW) {
+                drain()
+            }
+        }
+
+        override fun onLowMemory() = drain()
+
+        override fun onConfigurationChanged(newConfig: Configuration) {
+            // No action required.
+        }
+    }
+
+    /**
+     * Fills the pool once the main thread is idle. Does nothing on low RAM devices.
+     */
+    fun prewarm(context: Context) {
+        handler.post {
+            if (appContext != null) {
+                return@post
+            }
+            val activityManager = context.getSystemService(Context.ACTIVITY_SERVICE) as? ActivityManager
+            if (activityManager?.isLowRamDevice == true) {
+                POBLog.debug(TAG, POBSDKPluginConstant.WEBVIEW_POOL_LOW_RAM_MSG)
+                return@post
+            }
+            val applicationContext = context.applicationContext
+            appContext = applicationContext
+            applicationContext.registerComponentCallbacks(memoryCallbacks)
+            fill()
+        }
+    }
+
+    /**
+     * Destroys all the pooled WebViews. The pool is filled again on the next [prewarm] or [maxSize]
+     * change.
+     */
+    fun drain() {
+        trimTo(0)
+    }
+
+    internal fun size() = webViews.size
+
+    internal fun reset() {
+        drain()
+        appContext?.unregisterComponentCallbacks(memoryCallbacks)
+        appContext = null
+        if (isIdleHandlerAdded) {
+            Looper.myQueue().removeIdleHandler(idleHandler)
+            isIdleHandlerAdded = false
+        }
+        maxSize = DEFAULT_SIZE
+    }
+
+    private fun fill() {
+        if (appContext == null || isIdleHandlerAdded || webViews.size >= maxSize) {
+            return
+        }
+        isIdleHandlerAdded = true
+        Looper.myQueue().addIdleHandler(idleHandler)
+    }
+
+    private fun trimTo(size: Int) {
+        while (webViews.size > size) {
+            webViews.removeAt(webViews.size - 1).destroy()
+        }
+    }
+
+    private fun createWebView(): WebView? {
+        val context = appContext ?: return null
+        return try {
+            WebView(context).apply {
+                // Loading a blank page starts the renderer process.
+                loadDataWithBaseURL(null, "", "text/html", "utf-8", null)
+            }
+        } catch (e: RuntimeException) {
+            // WebView may be missing or being updated on the device.
+            POBLog.warn(TAG, POBSDKPluginConstant.WEBVIEW_POOL_FAILURE_MSG + e)
+            maxSize = 0
+            null
+        }
+    }
+
+    const val DEFAULT_SIZE = 0
+    const val MAX_SIZE = 2
+    private const val TAG = "POBRNWebViewPool"
+}
@@ -9,6 +9,7 @@ internal object POBSDKPluginConstant {
     const val KEYWORDS_KEY = "keywords"
 
     const val KEY_SDK_VERSION = "ow_sdk_version"
+    const val KEY_GAM_SUPPORTED = "gam_supported"
 
     //region: AppInfo keys
     const val APP_INFO_DOMAIN_KEY = "domain"
@@ -42,6 +43,64 @@ internal object POBSDKPluginConstant {
     const val LOCATION_WARN_MSG = "Unable to set Location for value "
     const val USERINFO_WARN_MSG = "Unable to set User Info for value "
     const val INVALID_REQUEST_FAILURE_MSG = "Failed to parse ad unit config."
+    const val CONFIG_WARN_MSG = "Unable to apply SDK configuration for value "
+    //endregion
+
+    //region: Mediation rule keys
+    const val MEDIATION_FLOOR_KEY = "floor"
+    const val MEDIATION_PARTNER_FLOORS_KEY = "partnerFloors"
+    const val MEDIATION_ALLOWED_PARTNERS_KEY = "allowedPartners"
+    const val MEDIATION_MAX_WAIT_KEY = "maxWaitMs"
+    const val MEDIATION_WON_KEY = "won"
+    const val MEDIATION_REASON_KEY = "reason"
+    const val MEDIATION_RULE_WARN_MSG = "Unable to set mediation rule for value "
+    //endregion
+
+    //region: Request and impression template keys
+    const val TEMPLATE_ID_KEY = "templateId"
+    const val TEMPLATE_WARN_MSG = "Unable to register template for value "
+    const val TEMPLATE_NOT_FOUND_MSG = "No request or impression template registered with id "
+    //endregion
+
+    //region: GAM header bidding keys
+    const val GAM_CONFIG_KEY = "gam"
+    const val GAM_CUSTOM_TARGETING_KEY = "customTargeting"
+    const val GAM_OW_TIMEOUT_KEY = "owTimeoutMs"
+    const val GAM_UNAVAILABLE_WARN_MSG = "GAM event handler is not available, loading without GAM for ad unit "
+    //endregion
+
+    //region: WebView pool keys
+    const val WEBVIEW_POOL_LOW_RAM_MSG = "Low RAM device, the WebView pool is not filled."
+    const val WEBVIEW_POOL_FAILURE_MSG = "Unable to create a WebView, the WebView pool is disabled. "
+    //endregion
+
+    //region: Media cache keys
+    const val MEDIA_CACHE_DOWNLOAD_FAILURE_MSG = "Unable to prefetch the media file "
+    //endregion
+
+    //region: Notice dispatcher keys
+    const val NOTICE_INVALID_URL_MSG = "Ignoring the invalid notice URL "
+    const val NOTICE_QUEUE_FAILURE_MSG = "Unable to persist the notice queue: "
+    const val NOTICE_DROPPED_MSG = "Dropping the notice "
+    //endregion
+
+    //region: Bid landscape keys
+    const val BID_LANDSCAPE_FAILURE_MSG = "Unable to map the bid landscape log: "
+    //endregion
+
+    //region: SDK configuration keys
+    const val CONFIG_LOG_LEVEL_KEY = "logLevel"
+    const val CONFIG_ALLOW_LOCATION_ACCESS_KEY = "allowLocationAccess"
+    const val CONFIG_COPPA_KEY = "coppa"
+    const val CONFIG_SSL_ENABLED_KEY = "sslEnabled"
+    const val CONFIG_USE_INTERNAL_BROWSER_KEY = "useInternalBrowser"
+    const val CONFIG_ALLOW_ADVERTISING_ID_KEY = "allowAdvertisingId"
+    const val CONFIG_APPLICATION_INFO_KEY = "applicationInfo"
+    const val CONFIG_USER_INFO_KEY = "userInfo"
+    const val CONFIG_LOCATION_KEY = "location"
+    const val CONFIG_WEBVIEW_POOL_SIZE_KEY = "webViewPoolSize"
+    // Asset applied natively when the plugin is loaded, before the JS bundle runs.
+    const val BUNDLED_CONFIG_FILE = "openwrap_sdk_config.json"
     //endregion
 
 
@@ -49,19 +108,17 @@ internal object POBSDKPluginConstant {
     const val INTERSTITIAL_AD_EVENT = "pob_rn_interstitial_ad_event"
     const val REWARDED_AD_EVENT = "pob_rn_rewarded_ad_event"
 
-    const val AD_RECEIVED_EVENT = "onAdReceived"
-    const val AD_FAILED_TO_LOAD_EVENT = "onAdFailedToLoad"
-    const val AD_FAILED_TO_SHOW_EVENT = "onAdFailedToShow"
-    const val AD_CLICKED_EVENT = "onAdClicked"
-    const val AD_OPENED_EVENT = "onAdOpened"
-    const val AD_CLOSED_EVENT = "onAdClosed"
-    const val AD_EXPIRED_EVENT = "onAdExpired"
-    const val APP_LEAVE_EVENT = "onAppLeaving"
-    const val RECEIVE_REWARD_EVENT = "onReceiveReward"
-    const val VIDEO_PLAYBACK_COMPLETED_EVENT = "onVideoPlaybackCompleted"
+    // Names of the banner direct events, the full screen ads emit the ids of POBRNEventSchema.
+    const val AD_RECEIVED_EVENT = POBRNEventSchema.AD_RECEIVED_NAME
+    const val AD_FAILED_TO_LOAD_EVENT = POBRNEventSchema.AD_FAILED_TO_LOAD_NAME
+    const val AD_CLICKED_EVENT = POBRNEventSchema.AD_CLICKED_NAME
+    const val AD_OPENED_EVENT = POBRNEventSchema.AD_OPENED_NAME
+    const val AD_CLOSED_EVENT = POBRNEventSchema.AD_CLOSED_NAME
+    const val APP_LEAVE_EVENT = POBRNEventSchema.APP_LEAVING_NAME
     const val BANNER_FORCE_REFRESH_EVENT = "onForceRefresh"
-    const val BID_RECEIVED_EVENT = "onBidReceived"
-    const val BID_FAILED_EVENT = "onBidFailed"
+    const val BID_RECEIVED_EVENT = POBRNEventSchema.BID_RECEIVED_NAME
+    const val BID_FAILED_EVENT = POBRNEventSchema.BID_FAILED_NAME
+    const val MEDIATION_OUTCOME_EVENT = POBRNEventSchema.MEDIATION_OUTCOME_NAME
     const val BANNER_BID_EVENT = "onBidExpiryStatusEvent"
     const val BANNER_FORCE_REFRESH_STATUS = "forceRefreshStatus"
     const val BANNER_PROCEED_TO_LOAD_AD_STATUS = "proceedToLoadAdStatus"
@@ -87,13 +144,12 @@ internal object POBSDKPluginConstant {
 
 
     //Keys
-    const val EVENT_NAME_KEY = "eventName"
     const val INSTANCE_ID_KEY = "instanceId"
-    const val EXT_KEY = "ext"
     const val ERROR_CODE_KEY = "errorCode"
     const val ERROR_MESSAGE_KEY = "errorMessage"
     const val REWARD_AMOUNT_KEY = "rewardAmount"
     const val REWARD_CURRENCY_TYPE_KEY = "rewardCurrencyType"
+    const val LATENCY_KEY = "latency"
 
     // Bid Keys
     const val CR_TYPE = "crType"
@@ -7,7 +7,6 @@ import com.pubmatic.sdk.common.log.POBLog
 import com.pubmatic.sdk.openwrap.core.POBBidEvent
 import com.pubmatic.sdk.openwrap.core.POBImpression
 import com.pubmatic.sdk.openwrap.core.POBRequest
-import com.pubmatic.sdk.openwrap.core.POBRequest.AdPosition
 import org.json.JSONException
 import org.json.JSONObject
 
@@ -19,22 +18,39 @@ class POBSDKPluginUtils {
     companion object {
         /**
          * Method to emit callback events to react native
+         * @param event id of the event, see [POBRNEventSchema]
+         * @param adUnitId ad unit id of the instance, only used to label the trace section
          */
         fun emitCallbackEvent(
             reactApplicationContext: ReactApplicationContext,
             adFormatEventName : String,
-            eventName: String,
+            event: Int,
             instanceId : String,
-            ext: JSONObject?
+            ext: JSONObject?,
+            adUnitId: String? = null
         ) {
+            POBRNSystemTrace.section("emitEvent", instanceId, adUnitId) {
+                reactApplicationContext.getJSModule(DeviceEventManagerModule.RCTDeviceEventEmitter::class.java)
+                    .emit(adFormatEventName, eventPayload(event, instanceId, ext))
+            }
+        }
+
+        /**
+         * Returns the JSON payload of an event, with the compact keys of [POBRNEventSchema]: the
+         * top level keys of the ext are replaced by their codes, the unknown keys are kept as is.
+         */
+        internal fun eventPayload(event: Int, instanceId: String, ext: JSONObject?): String {
             val payload = JSONObject()
-            payload.put(POBSDKPluginConstant.INSTANCE_ID_KEY, instanceId)
-            payload.put(POBSDKPluginConstant.EVENT_NAME_KEY,eventName)
+            payload.put(POBRNEventSchema.INSTANCE_ID_KEY, instanceId)
+            payload.put(POBRNEventSchema.EVENT_KEY, event)
             ext?.let {
-                payload.put(POBSDKPluginConstant.EXT_KEY,ext)
+                val compactExt = JSONObject()
+                it.keys().forEach { key ->
+                    compactExt.put(POBRNEventSchema.KEY_CODES[key] ?: key, it.get(key))
+                }
+                payload.put(POBRNEventSchema.EXT_KEY, compactExt)
             }
-            reactApplicationContext.getJSModule(DeviceEventManagerModule.RCTDeviceEventEmitter::class.java)
-                .emit(adFormatEventName, payload.toString())
+            return payload.toString()
         }
 
 
@@ -49,42 +65,17 @@ class POBSDKPluginUtils {
         }
 
         /**
-         * Method to parse and set request parameters
+         * Method to parse and set request parameters. The template referred by "templateId", if
+         * any, is applied first, the other parameters override it.
          */
         fun setRequestParams(request : POBRequest,jsonString : String){
             try {
                 val paramJson = JSONObject(jsonString)
-
-                // Set OpenWrap Test mode
-                if (paramJson.has(POBSDKPluginConstant.POBRN_ENABLE_TEST_MODE_KEY)) {
-                    request.enableTestMode(paramJson.getBoolean(POBSDKPluginConstant.POBRN_ENABLE_TEST_MODE_KEY))
-                }
-
-                // Set OpenWrap bid summary
-                if (paramJson.has(POBSDKPluginConstant.POBRN_ENABLE_BID_SUMMARY_KEY)) {
-                    request.enableBidSummary(paramJson.getBoolean(POBSDKPluginConstant.POBRN_ENABLE_BID_SUMMARY_KEY))
-                }
-
-                // Set OpenWrap ad server url
-                if (paramJson.has(POBSDKPluginConstant.POBRN_SERVER_URL_KEY)) {
-                    request.adServerUrl = paramJson.getString(POBSDKPluginConstant.POBRN_SERVER_URL_KEY)
-                }
-
-                // Set OpenWrap profile version if available
-                if (paramJson.has(POBSDKPluginConstant.POBRN_ENABLE_RESPONSE_DEBUGGING_KEY)) {
-                    request.enableDebugState(paramJson.getBoolean(POBSDKPluginConstant.POBRN_ENABLE_RESPONSE_DEBUGGING_KEY))
-                }
-
-                // Set OpenWrap profile version if available
-                if (paramJson.has(POBSDKPluginConstant.POBRN_VERSION_ID_KEY)) {
-                    request.versionId = paramJson.getInt(POBSDKPluginConstant.POBRN_VERSION_ID_KEY)
-                }
-
-                // Set OpenWrap request network timeout if available
-                if (paramJson.has(POBSDKPluginConstant.POBRN_NETWORK_TIMEOUT_KEY)) {
-                    request.networkTimeout =
-                        paramJson.getInt(POBSDKPluginConstant.POBRN_NETWORK_TIMEOUT_KEY)
+                templateId(paramJson)?.let { templateId ->
+                    POBRNRequestTemplate.forId(templateId)?.applyTo(request)
+                        ?: POBLog.warn("POBSDKPluginUtils", POBSDKPluginConstant.TEMPLATE_NOT_FOUND_MSG + templateId)
                 }
+                POBRNRequestTemplate.build(paramJson).applyTo(request)
             }
             catch (ex : JSONException){
                 POBLog.warn("POBSDKPluginUtils", "Exception in parsing request params $ex")
@@ -92,45 +83,28 @@ class POBSDKPluginUtils {
         }
 
         /**
-         * Method to parse and set impression parameters
+         * Method to parse and set impression parameters. The template referred by "templateId", if
+         * any, is applied first, the other parameters override it.
          */
         fun setImpressionParams(impression : POBImpression,jsonString : String){
             try {
                 val paramJson = JSONObject(jsonString)
-
-                if (paramJson.has(POBSDKPluginConstant.POBRN_TEST_CREATIVE_ID_KEY)) {
-                    impression.testCreativeId = paramJson.getString(POBSDKPluginConstant.POBRN_TEST_CREATIVE_ID_KEY)
-                }
-
-                if (paramJson.has(POBSDKPluginConstant.POBRN_CUSTOM_PARAMS_KEY)) {
-                    val resultMap = convertJsonStringToMap(paramJson.getString(POBSDKPluginConstant.POBRN_CUSTOM_PARAMS_KEY))
-                    if(resultMap.isNotEmpty()) {
-                        impression.setCustomParam(resultMap)
-                    }
-                }
-
-                if (paramJson.has(POBSDKPluginConstant.POBRN_AD_POSITION_KEY)) {
-                    var adPosition : AdPosition? = null
-                    when(paramJson.getInt(POBSDKPluginConstant.POBRN_AD_POSITION_KEY)){
-                        0 -> adPosition = AdPosition.UNKNOWN
-                        1 -> adPosition = AdPosition.ABOVE_THE_FOLD
-                        3 -> adPosition = AdPosition.BELOW_THE_FOLD
-                        4 -> adPosition = AdPosition.HEADER
-                        5 -> adPosition = AdPosition.FOOTER
-                        6 -> adPosition = AdPosition.SIDEBAR
-                        7 -> adPosition = AdPosition.FULL_SCREEN
-                    }
-                    adPosition?.let {
-                        impression.adPosition = adPosition
-                    }
+                templateId(paramJson)?.let { templateId ->
+                    POBRNImpressionTemplate.forId(templateId)?.applyTo(impression)
+                        ?: POBLog.warn("POBSDKPluginUtils", POBSDKPluginConstant.TEMPLATE_NOT_FOUND_MSG + templateId)
                 }
-
+                POBRNImpressionTemplate.build(paramJson).applyTo(impression)
             }
             catch (ex : JSONException){
-                POBLog.warn("POBSDKPluginUtils", "Exception in parsing request params $ex")
+                POBLog.warn("POBSDKPluginUtils", "Exception in parsing impression params $ex")
             }
         }
 
+        private fun templateId(paramJson: JSONObject): String? {
+            return if (paramJson.has(POBSDKPluginConstant.TEMPLATE_ID_KEY))
+                paramJson.getString(POBSDKPluginConstant.TEMPLATE_ID_KEY) else null
+        }
+
         /*
          * Method to covert json object into map
          *  "{
@@ -138,7 +112,7 @@ class POBSDKPluginUtils {
          *      "key2" : ["value1", "value2", "value3"],
          *  }"
          */
-        private fun convertJsonStringToMap(jsonString : String) :Map<String, List<String>>{
+        internal fun convertJsonStringToMap(jsonString : String) :Map<String, List<String>>{
             val resultMap = mutableMapOf<String, List<String>>()
             try {
                 val customParamsJson = JSONObject(jsonString)
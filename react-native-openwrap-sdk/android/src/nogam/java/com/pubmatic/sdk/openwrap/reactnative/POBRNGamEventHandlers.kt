@@ -0,0 +1,41 @@
+package com.pubmatic.sdk.openwrap.reactnative
+
+import android.app.Activity
+import android.content.Context
+import com.pubmatic.sdk.common.POBAdSize
+import com.pubmatic.sdk.openwrap.banner.POBBannerEvent
+import com.pubmatic.sdk.openwrap.interstitial.POBInterstitialEvent
+import com.pubmatic.sdk.rewardedad.POBRewardedAdEvent
+
+/**
+ * Placeholder compiled when the GAM event handler is not included, i.e. without
+ * PubmaticOpenwrapSdk_gamEventHandlerEnabled=true. No event handler is created, so the ads with a
+ * GAM configuration are loaded from OpenWrap only. See src/gam for the GAM implementation.
+ */
+internal object POBRNGamEventHandlers {
+
+    const val isAvailable = false
+
+    fun initialize(context: Context) {
+        // GAM is not included, no action required.
+    }
+
+    fun bannerEventHandler(
+        context: Context,
+        config: POBRNGamConfig,
+        adSizes: Array<POBAdSize>,
+        latencyTimer: POBRNLatencyTimer
+    ): POBBannerEvent? = null
+
+    fun interstitialEventHandler(
+        activity: Activity,
+        config: POBRNGamConfig,
+        latencyTimer: POBRNLatencyTimer
+    ): POBInterstitialEvent? = null
+
+    fun rewardedEventHandler(
+        activity: Activity,
+        config: POBRNGamConfig,
+        latencyTimer: POBRNLatencyTimer
+    ): POBRewardedAdEvent? = null
+}
@@ -84,6 +84,12 @@ class OpenWrapSDKModuleTest {
         Assert.assertEquals(OpenWrapSDK.getVersion(), module?.constants?.get(POBSDKPluginConstant.KEY_SDK_VERSION))
     }
 
+    @Test
+    fun testGamSupported(){
+        // Unit tests are built without the GAM event handler.
+        Assert.assertEquals(false, module?.constants?.get(POBSDKPluginConstant.KEY_GAM_SUPPORTED))
+    }
+
     @Test
     fun testLocationInvalidData(){
         POBInstanceProvider.getSdkConfig().location = null
@@ -0,0 +1,37 @@
+package com.pubmatic.sdk.openwrap.reactnative
+
+import com.facebook.react.bridge.ReactApplicationContext
+import org.junit.Assert
+import org.junit.Test
+import org.junit.runner.RunWith
+import org.mockito.Mockito.mock
+import org.mockito.junit.MockitoJUnitRunner
+
+@RunWith(MockitoJUnitRunner::class)
+class OpenWrapSDKPackageTest {
+
+    private val openWrapPackage = OpenWrapSDKPackage()
+
+    @Test
+    fun testModulesInitialization() {
+        val moduleInfos = openWrapPackage.reactModuleInfoProvider.reactModuleInfos
+        Assert.assertEquals(
+            setOf(OpenWrapSDKModule.NAME, POBRNInterstitialModule.NAME, POBRNRewardedAdModule.NAME),
+            moduleInfos.keys
+        )
+        // The modules are created on first use, the plugin startup does not wait for them.
+        Assert.assertFalse(moduleInfos[OpenWrapSDKModule.NAME]!!.needsEagerInit())
+        Assert.assertFalse(moduleInfos[POBRNInterstitialModule.NAME]!!.needsEagerInit())
+        Assert.assertFalse(moduleInfos[POBRNRewardedAdModule.NAME]!!.needsEagerInit())
+        Assert.assertTrue(moduleInfos[OpenWrapSDKModule.NAME]!!.hasConstants())
+    }
+
+    @Test
+    fun testGetModule() {
+        val context = mock(ReactApplicationContext::class.java)
+        for (name in openWrapPackage.reactModuleInfoProvider.reactModuleInfos.keys) {
+            Assert.assertEquals(name, openWrapPackage.getModule(name, context)?.name)
+        }
+        Assert.assertNull(openWrapPackage.getModule("UnknownModule", context))
+    }
+}
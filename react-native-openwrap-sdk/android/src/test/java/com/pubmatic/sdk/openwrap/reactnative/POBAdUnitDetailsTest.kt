@@ -22,6 +22,17 @@ class POBAdUnitDetailsTest {
     Assert.assertEquals(POBAdSize.BANNER_SIZE_320x50.adHeight, adUnitDetails.adSizes[0].adHeight)
   }
 
+  @Test
+  fun testBuildWithGamConfig(){
+    val adUnitDetails = POBAdUnitDetails.build("{\"publisherId\": \"pub_id\"," +
+      " \"profileId\": 1234, \"adUnitId\": \"test_ad_unit\", \"adSizes\": [{\"width\": 320, \"height\": 50}]," +
+      " \"gam\": {\"adUnitId\": \"/1234/gam_ad_unit\", \"owTimeoutMs\": 800}}")
+    Assert.assertEquals("/1234/gam_ad_unit", adUnitDetails.gamConfig?.adUnitId)
+    Assert.assertEquals(800L, adUnitDetails.gamConfig?.owTimeoutMillis)
+    Assert.assertNull(POBAdUnitDetails.build("{\"publisherId\": \"pub_id\"," +
+      " \"profileId\": 1234, \"adUnitId\": \"test_ad_unit\", \"adSizes\": []}").gamConfig)
+  }
+
   @Test
   fun testBuildWithInvalidJSONString(){
     try{
@@ -0,0 +1,71 @@
+package com.pubmatic.sdk.openwrap.reactnative
+
+import com.pubmatic.sdk.openwrap.core.POBImpression
+import com.pubmatic.sdk.openwrap.core.POBRequest
+import org.json.JSONObject
+import org.junit.After
+import org.junit.Assert
+import org.junit.Test
+import org.junit.runner.RunWith
+import org.mockito.Mockito
+import org.mockito.junit.MockitoJUnitRunner
+
+@RunWith(MockitoJUnitRunner::class)
+class POBRNAdTemplateTest {
+
+    @After
+    fun tearDown() {
+        POBRNRequestTemplate.reset()
+        POBRNImpressionTemplate.reset()
+    }
+
+    @Test
+    fun testRequestTemplate() {
+        POBRNRequestTemplate.register(
+            "feed",
+            POBRNRequestTemplate.build(JSONObject("{\"testMode\": true, \"versionId\": 3, \"networkTimeout\": 5}"))
+        )
+        val request = Mockito.mock(POBRequest::class.java)
+        POBSDKPluginUtils.setRequestParams(request, "{\"templateId\": \"feed\", \"networkTimeout\": 2}")
+
+        Mockito.verify(request).enableTestMode(true)
+        Mockito.verify(request).versionId = 3
+        // The instance parameters override the template.
+        val inOrder = Mockito.inOrder(request)
+        inOrder.verify(request).networkTimeout = 5
+        inOrder.verify(request).networkTimeout = 2
+        Mockito.verify(request, Mockito.never()).enableBidSummary(Mockito.anyBoolean())
+    }
+
+    @Test
+    fun testImpressionTemplate() {
+        POBRNImpressionTemplate.register(
+            "feed",
+            POBRNImpressionTemplate.build(
+                JSONObject("{\"customParams\": \"{\\\"genre\\\": [\\\"news\\\", \\\"sports\\\"]}\", \"adPosition\": 1}")
+            )
+        )
+        val template = POBRNImpressionTemplate.forId("feed")
+        Assert.assertEquals(mapOf("genre" to listOf("news", "sports")), template?.customParams)
+        Assert.assertEquals(POBRequest.AdPosition.ABOVE_THE_FOLD, template?.adPosition)
+
+        val impression = Mockito.mock(POBImpression::class.java)
+        POBSDKPluginUtils.setImpressionParams(impression, "{\"templateId\": \"feed\", \"adPosition\": 5}")
+        Mockito.verify(impression).setCustomParam(mapOf("genre" to listOf("news", "sports")))
+        val inOrder = Mockito.inOrder(impression)
+        inOrder.verify(impression).adPosition = POBRequest.AdPosition.ABOVE_THE_FOLD
+        inOrder.verify(impression).adPosition = POBRequest.AdPosition.FOOTER
+    }
+
+    @Test
+    fun testUnknownTemplate() {
+        val request = Mockito.mock(POBRequest::class.java)
+        POBSDKPluginUtils.setRequestParams(request, "{\"templateId\": \"unknown\", \"bidSummary\": false}")
+        Mockito.verify(request).enableBidSummary(false)
+        Mockito.verify(request, Mockito.never()).enableTestMode(Mockito.anyBoolean())
+
+        POBRNRequestTemplate.register("feed", POBRNRequestTemplate.build(JSONObject("{}")))
+        POBRNRequestTemplate.unregister("feed")
+        Assert.assertNull(POBRNRequestTemplate.forId("feed"))
+    }
+}
@@ -0,0 +1,152 @@
+package com.pubmatic.sdk.openwrap.reactnative
+
+import android.content.res.Resources
+import android.graphics.Rect
+import android.os.Build
+import android.util.DisplayMetrics
+import android.view.View
+import org.junit.After
+import org.junit.Assert
+import org.junit.Before
+import org.junit.Test
+import org.junit.runner.RunWith
+import org.mockito.ArgumentMatchers
+import org.mockito.Mockito
+import org.robolectric.RobolectricTestRunner
+import org.robolectric.annotation.Config
+
+@RunWith(RobolectricTestRunner::class)
+@Config(sdk = [Build.VERSION_CODES.P])
+class POBRNBannerLoadSchedulerTest {
+
+    private val started = ArrayList<String>()
+
+    @Before
+    fun setUp() {
+        POBRNBannerLoadScheduler.reset()
+    }
+
+    @After
+    fun tearDown() {
+        POBRNBannerLoadScheduler.reset()
+    }
+
+    @Test
+    fun testConcurrencyCap() {
+        POBRNBannerLoadScheduler.maxConcurrentLoads = 2
+        val tasks = listOf("a", "b", "c").map { task(it, mockView()) }
+        tasks.forEach { POBRNBannerLoadScheduler.enqueue(it) }
+
+        POBRNBannerLoadScheduler.onFrame(FRAME_NANOS)
+        Assert.assertEquals(listOf("a", "b"), started)
+        Assert.assertEquals(1, POBRNBannerLoadScheduler.pendingCount())
+
+        POBRNBannerLoadScheduler.finish(tasks[0])
+        POBRNBannerLoadScheduler.onFrame(2 * FRAME_NANOS)
+        Assert.assertEquals(listOf("a", "b", "c"), started)
+        Assert.assertEquals(2, POBRNBannerLoadScheduler.inFlightCount())
+    }
+
+    @Test
+    fun testVisibleBannerLoadsFirst() {
+        POBRNBannerLoadScheduler.maxConcurrentLoads = 1
+        POBRNBannerLoadScheduler.enqueue(task("offscreen", mockView(top = 3000)))
+        POBRNBannerLoadScheduler.enqueue(task("near", mockView(top = 2000)))
+        POBRNBannerLoadScheduler.enqueue(task("visible", mockView(top = 100, visible = true)))
+
+        POBRNBannerLoadScheduler.onFrame(FRAME_NANOS)
+        Assert.assertEquals(listOf("visible"), started)
+    }
+
+    @Test
+    fun testNearestBannerLoadsFirst() {
+        POBRNBannerLoadScheduler.maxConcurrentLoads = 1
+        POBRNBannerLoadScheduler.enqueue(task("offscreen", mockView(top = 3000)))
+        POBRNBannerLoadScheduler.enqueue(task("near", mockView(top = 2000)))
+
+        POBRNBannerLoadScheduler.onFrame(FRAME_NANOS)
+        Assert.assertEquals(listOf("near"), started)
+    }
+
+    @Test
+    fun testLoadDeferredDuringFling() {
+        POBRNBannerLoadScheduler.maxConcurrentLoads = 1
+        val blocker = task("blocker", mockView())
+        POBRNBannerLoadScheduler.enqueue(blocker)
+        POBRNBannerLoadScheduler.onFrame(FRAME_NANOS)
+
+        // Sampled while the only slot is taken.
+        val position = intArrayOf(100)
+        POBRNBannerLoadScheduler.enqueue(task("flung", mockView(top = 100, visible = true, position = position)))
+        POBRNBannerLoadScheduler.onFrame(FRAME_NANOS + 16_000_000L)
+
+        // 100px in a 16ms frame is above the fling velocity.
+        position[0] = 200
+        POBRNBannerLoadScheduler.finish(blocker)
+        POBRNBannerLoadScheduler.onFrame(FRAME_NANOS + 32_000_000L)
+        Assert.assertEquals(listOf("blocker"), started)
+
+        // Once the view settles, the load starts.
+        POBRNBannerLoadScheduler.onFrame(FRAME_NANOS + 48_000_000L)
+        Assert.assertEquals(listOf("blocker", "flung"), started)
+    }
+
+    @Test
+    fun testFinishRemovesPendingTask() {
+        POBRNBannerLoadScheduler.maxConcurrentLoads = 1
+        val first = task("a", mockView())
+        val second = task("b", mockView())
+        POBRNBannerLoadScheduler.enqueue(first)
+        POBRNBannerLoadScheduler.enqueue(second)
+        POBRNBannerLoadScheduler.finish(second)
+
+        POBRNBannerLoadScheduler.onFrame(FRAME_NANOS)
+        POBRNBannerLoadScheduler.finish(first)
+        POBRNBannerLoadScheduler.onFrame(2 * FRAME_NANOS)
+        Assert.assertEquals(listOf("a"), started)
+        Assert.assertEquals(0, POBRNBannerLoadScheduler.pendingCount())
+    }
+
+    private fun task(name: String, view: View) = POBRNBannerLoadScheduler.Task(view) { started.add(name) }
+
+    /**
+     * Creates a 320x50 view at the given top, on a 1080x1920 screen. Without a top, the view is
+     * not attached to a window.
+     */
+    private fun mockView(
+        top: Int? = null,
+        visible: Boolean = false,
+        position: IntArray = intArrayOf(top ?: 0)
+    ): View {
+        val view = Mockito.mock(View::class.java)
+        val resources = Mockito.mock(Resources::class.java)
+        Mockito.`when`(resources.displayMetrics).thenReturn(DisplayMetrics().apply { density = 1f })
+        Mockito.`when`(view.resources).thenReturn(resources)
+        if (top == null) {
+            return view
+        }
+        Mockito.`when`(view.isAttachedToWindow).thenReturn(true)
+        Mockito.`when`(view.isShown).thenReturn(true)
+        Mockito.`when`(view.width).thenReturn(320)
+        Mockito.`when`(view.height).thenReturn(50)
+        Mockito.doAnswer {
+            val location = it.getArgument<IntArray>(0)
+            location[0] = 0
+            location[1] = position[0]
+            null
+        }.`when`(view).getLocationOnScreen(ArgumentMatchers.any())
+        Mockito.doAnswer {
+            it.getArgument<Rect>(0).set(0, 0, 1080, 1920)
+            null
+        }.`when`(view).getWindowVisibleDisplayFrame(ArgumentMatchers.any())
+        Mockito.doAnswer {
+            it.getArgument<Rect>(0).set(0, top, 320, top + 50)
+            visible
+        }.`when`(view).getGlobalVisibleRect(ArgumentMatchers.any())
+        return view
+    }
+
+    companion object {
+        private const val FRAME_NANOS = 1_000_000_000L
+    }
+}
@@ -0,0 +1,194 @@
+package com.pubmatic.sdk.openwrap.reactnative
+
+import android.os.Build
+import android.os.Looper
+import android.os.SystemClock
+import org.junit.After
+import org.junit.Assert
+import org.junit.Before
+import org.junit.Test
+import org.junit.runner.RunWith
+import org.robolectric.RobolectricTestRunner
+import org.robolectric.Shadows
+import org.robolectric.annotation.Config
+import java.util.concurrent.TimeUnit
+
+@RunWith(RobolectricTestRunner::class)
+@Config(sdk = [Build.VERSION_CODES.P])
+class POBRNBannerRefreshCoordinatorTest {
+
+    // Names of the refreshed banners, with the time of their refresh.
+    private val refreshes = ArrayList<Pair<String, Long>>()
+    private var startMillis = 0L
+
+    @Before
+    fun setUp() {
+        POBRNBannerRefreshCoordinator.reset()
+        startMillis = SystemClock.uptimeMillis()
+    }
+
+    @After
+    fun tearDown() {
+        POBRNBannerRefreshCoordinator.reset()
+    }
+
+    @Test
+    fun testNextBatchGroupsOverlappingWindows() {
+        val a = entry(dueSeconds = 0, intervalSeconds = 60)
+        val b = entry(dueSeconds = 10, intervalSeconds = 60)
+        val c = entry(dueSeconds = 20, intervalSeconds = 60)
+
+        val (fireMillis, batch) = POBRNBannerRefreshCoordinator.nextBatch(listOf(c, b, a))!!
+        // a may wait until 15s, so it joins b at 10s, c is due after a's deadline.
+        Assert.assertEquals(10_000L, fireMillis)
+        Assert.assertEquals(listOf(a, b), batch)
+        Assert.assertNull(POBRNBannerRefreshCoordinator.nextBatch(emptyList()))
+    }
+
+    @Test
+    fun testBannersAlignAfterRefreshes() {
+        POBRNBannerRefreshCoordinator.isEnabled = true
+        val banners = listOf("a", "b", "c").map { FakeBanner(it, INTERVAL_SECONDS) }
+        // Received 7 seconds apart.
+        banners.forEach {
+            it.receive()
+            advance(7_000)
+        }
+        Assert.assertTrue(banners.all { it.isPaused })
+
+        advance(2 * INTERVAL_SECONDS * 1000L)
+        val firstCycle = refreshes.take(3)
+        // a waits for b, c is due after a's deadline.
+        Assert.assertEquals(firstCycle[0].second, firstCycle[1].second)
+        Assert.assertNotEquals(firstCycle[1].second, firstCycle[2].second)
+
+        // From the second cycle on, the three banners refresh together.
+        val lastCycle = refreshes.takeLast(3)
+        Assert.assertEquals(setOf("a", "b", "c"), lastCycle.map { it.first }.toSet())
+        Assert.assertEquals(1, lastCycle.map { it.second }.toSet().size)
+    }
+
+    @Test
+    fun testRefreshNeverEarlierThanInterval() {
+        POBRNBannerRefreshCoordinator.isEnabled = true
+        FakeBanner("a", INTERVAL_SECONDS).receive()
+
+        advance(INTERVAL_SECONDS * 1000L - 1)
+        Assert.assertTrue(refreshes.isEmpty())
+        advance(1)
+        Assert.assertEquals(listOf("a"), refreshes.map { it.first })
+    }
+
+    @Test
+    fun testPausedBannerNotRefreshed() {
+        POBRNBannerRefreshCoordinator.isEnabled = true
+        val banner = FakeBanner("a", INTERVAL_SECONDS)
+        banner.receive()
+        Assert.assertTrue(POBRNBannerRefreshCoordinator.pause(banner))
+
+        advance(2 * INTERVAL_SECONDS * 1000L)
+        Assert.assertTrue(refreshes.isEmpty())
+
+        Assert.assertTrue(POBRNBannerRefreshCoordinator.resume(banner))
+        advance(INTERVAL_SECONDS * 1000L)
+        Assert.assertEquals(1, refreshes.size)
+    }
+
+    @Test
+    fun testDisabledBannersKeepAutoRefresh() {
+        val banner = FakeBanner("a", INTERVAL_SECONDS)
+        banner.receive()
+        Assert.assertFalse(banner.isPaused)
+        Assert.assertFalse(POBRNBannerRefreshCoordinator.pause(banner))
+
+        POBRNBannerRefreshCoordinator.isEnabled = true
+        banner.receive()
+        Assert.assertTrue(banner.isPaused)
+
+        // Disabling hands the refresh back to the SDK.
+        POBRNBannerRefreshCoordinator.isEnabled = false
+        Assert.assertFalse(banner.isPaused)
+        Assert.assertEquals(0, POBRNBannerRefreshCoordinator.entryCount())
+    }
+
+    @Test
+    fun testFailedRefreshRetried() {
+        POBRNBannerRefreshCoordinator.isEnabled = true
+        val banner = FakeBanner("a", INTERVAL_SECONDS, canRefresh = false)
+        banner.receive()
+
+        advance(INTERVAL_SECONDS * 1000L)
+        Assert.assertEquals(1, refreshes.size)
+        advance(INTERVAL_SECONDS * 1000L)
+        Assert.assertEquals(2, refreshes.size)
+    }
+
+    @Test
+    fun testRadioUsage() {
+        POBRNBannerRefreshCoordinator.recordRequest()
+        advance(1_000)
+        POBRNBannerRefreshCoordinator.recordRequest()
+        advance(30_000)
+        POBRNBannerRefreshCoordinator.recordRequest()
+
+        POBRNBannerRefreshCoordinator.isEnabled = true
+        advance(30_000)
+        POBRNBannerRefreshCoordinator.recordRequest()
+
+        val stats = POBRNBannerRefreshCoordinator.toJson()
+        val uncoordinated = stats.getJSONObject("uncoordinated")
+        Assert.assertEquals(3, uncoordinated.getInt("requests"))
+        Assert.assertEquals(2, uncoordinated.getInt("wakeUps"))
+        Assert.assertEquals(21_000L, uncoordinated.getLong("radioActiveMillis"))
+        Assert.assertEquals(31_000L, uncoordinated.getLong("elapsedMillis"))
+        val coordinated = stats.getJSONObject("coordinated")
+        Assert.assertEquals(1, coordinated.getInt("requests"))
+        Assert.assertEquals(1, coordinated.getInt("wakeUps"))
+        Assert.assertEquals(POBRNBannerRefreshCoordinator.RADIO_TAIL_MILLIS, coordinated.getLong("radioActiveMillis"))
+        Assert.assertEquals(30_000L, coordinated.getLong("elapsedMillis"))
+    }
+
+    private fun advance(millis: Long) {
+        Shadows.shadowOf(Looper.getMainLooper()).idleFor(millis, TimeUnit.MILLISECONDS)
+    }
+
+    private fun entry(dueSeconds: Int, intervalSeconds: Int) = POBRNBannerRefreshCoordinator.Entry(
+        FakeBanner("", intervalSeconds), intervalSeconds * 1000L, dueSeconds * 1000L
+    )
+
+    /**
+     * Banner whose refreshed ad is received right away.
+     */
+    private inner class FakeBanner(
+        val name: String,
+        val intervalSeconds: Int,
+        val canRefresh: Boolean = true
+    ) : POBRNBannerRefreshCoordinator.Banner {
+        var isPaused = false
+
+        fun receive() {
+            POBRNBannerRefreshCoordinator.recordRequest()
+            POBRNBannerRefreshCoordinator.onAdReceived(this, intervalSeconds)
+        }
+
+        override fun pauseAutoRefresh() {
+            isPaused = true
+        }
+
+        override fun resumeAutoRefresh() {
+            isPaused = false
+        }
+
+        override fun refresh(): Boolean {
+            refreshes.add(name to SystemClock.uptimeMillis() - startMillis)
+            if (canRefresh) {
+                receive()
+            }
+            return canRefresh
+        }
+    }
+
+    companion object {
+        private const val INTERVAL_SECONDS = 30
+    }
+}
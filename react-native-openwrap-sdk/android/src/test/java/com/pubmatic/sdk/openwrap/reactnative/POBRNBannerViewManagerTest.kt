@@ -36,7 +36,7 @@ class POBRNBannerViewManagerTest {
     fun testGetExportedCustomDirectEventTypeConstants() {
         val directEventMap: MutableMap<String, Any>? =
             bannerViewManager.exportedCustomDirectEventTypeConstants
-        Assert.assertEquals(11, directEventMap?.size)
+        Assert.assertEquals(12, directEventMap?.size)
         Assert.assertEquals(
             directEventMap?.get(POBSDKPluginConstant.AD_RECEIVED_EVENT),
             MapBuilder.of(
@@ -107,6 +107,13 @@ class POBRNBannerViewManagerTest {
                 POBSDKPluginConstant.BANNER_BID_EVENT
             )
         )
+        Assert.assertEquals(
+            directEventMap?.get(POBSDKPluginConstant.MEDIATION_OUTCOME_EVENT),
+            MapBuilder.of(
+                POBSDKPluginConstant.BANNER_EVENT_REGISTRATION_KEY,
+                POBSDKPluginConstant.MEDIATION_OUTCOME_EVENT
+            )
+        )
     }
 
     @Test
@@ -0,0 +1,111 @@
+package com.pubmatic.sdk.openwrap.reactnative
+
+import org.json.JSONObject
+import java.io.File
+import java.lang.management.ManagementFactory
+
+/**
+ * Minimal JMH style runner for the JVM microbenchmarks of the plugin hot paths.
+ *
+ * Every benchmark is warmed up, then measured in several rounds. The reported time is the median
+ * of the per round ns/op and the allocation rate is the bytes allocated per op by the benchmark
+ * thread, as reported by HotSpot's ThreadMXBean.
+ */
+class POBRNBenchmarkRunner(
+    private val warmupRounds: Int = 5,
+    private val measuredRounds: Int = 10,
+    private val opsPerRound: Int = 20_000
+) {
+
+    /**
+     * Result of a single benchmark.
+     */
+    data class Result(val name: String, val nsPerOp: Double, val bytesPerOp: Double) {
+        fun toJson(): JSONObject = JSONObject()
+            .put(NS_PER_OP, nsPerOp)
+            .put(BYTES_PER_OP, bytesPerOp)
+    }
+
+    private val threadBean = ManagementFactory.getThreadMXBean() as com.sun.management.ThreadMXBean
+
+    // Keeps the benchmark results reachable so that the JIT cannot eliminate the measured code.
+    @Volatile
+    private var sink: Any? = null
+
+    val results = ArrayList<Result>()
+
+    /**
+     * Runs [block] for the configured rounds and records its result under [name].
+     */
+    fun run(name: String, block: () -> Any?): Result {
+        repeat(warmupRounds) { round(block) }
+
+        val nsPerOp = DoubleArray(measuredRounds)
+        val threadId = Thread.currentThread().id
+        val allocatedBefore = threadBean.getThreadAllocatedBytes(threadId)
+        for (i in 0 until measuredRounds) {
+            nsPerOp[i] = round(block)
+        }
+        val allocated = threadBean.getThreadAllocatedBytes(threadId) - allocatedBefore
+        nsPerOp.sort()
+
+        val result = Result(
+            name,
+            nsPerOp[measuredRounds / 2],
+            allocated.toDouble() / (measuredRounds.toLong() * opsPerRound)
+        )
+        results.add(result)
+        return result
+    }
+
+    private fun round(block: () -> Any?): Double {
+        val start = System.nanoTime()
+        for (i in 0 until opsPerRound) {
+            sink = block()
+        }
+        return (System.nanoTime() - start).toDouble() / opsPerRound
+    }
+
+    fun toJson(): JSONObject {
+        val json = JSONObject()
+        results.forEach { json.put(it.name, it.toJson()) }
+        return json
+    }
+
+    companion object {
+        const val NS_PER_OP = "nsPerOp"
+        const val BYTES_PER_OP = "bytesPerOp"
+
+        /**
+         * Compares [results] with [baseline] and returns a description of every benchmark whose
+         * time or allocation rate exceeds its baseline by more than [threshold] (0.25 = 25%).
+         * A benchmark without a baseline value is reported too, so that the check cannot pass
+         * without comparing every benchmark.
+         */
+        fun regressions(results: List<Result>, baseline: JSONObject, threshold: Double): List<String> {
+            val regressions = ArrayList<String>()
+            for (result in results) {
+                val expected = baseline.optJSONObject(result.name)
+                for ((key, actual) in listOf(NS_PER_OP to result.nsPerOp, BYTES_PER_OP to result.bytesPerOp)) {
+                    if (expected == null || expected.isNull(key)) {
+                        regressions.add("${result.name}: no $key baseline, record it with ./gradlew benchmarkBaseline")
+                        continue
+                    }
+                    val limit = expected.getDouble(key) * (1 + threshold)
+                    if (actual > limit) {
+                        regressions.add(
+                            "${result.name}: $key %.1f exceeds baseline %.1f by more than %d%%"
+                                .format(actual, expected.getDouble(key), (threshold * 100).toInt())
+                        )
+                    }
+                }
+            }
+            return regressions
+        }
+
+        fun readBaseline(file: File): JSONObject {
+            return if (file.exists()) JSONObject(file.readText()).optJSONObject("benchmarks") ?: JSONObject()
+            else JSONObject()
+        }
+    }
+}
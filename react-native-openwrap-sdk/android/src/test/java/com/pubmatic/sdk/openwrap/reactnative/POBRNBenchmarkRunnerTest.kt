@@ -0,0 +1,34 @@
+package com.pubmatic.sdk.openwrap.reactnative
+
+import org.json.JSONObject
+import org.junit.Assert
+import org.junit.Test
+
+class POBRNBenchmarkRunnerTest {
+
+    private val result = POBRNBenchmarkRunner.Result("POBBid.toJson", 120.0, 64.0)
+
+    @Test
+    fun testRegressionsWithinThreshold() {
+        val baseline = JSONObject().put(result.name, JSONObject().put("nsPerOp", 100.0).put("bytesPerOp", 64.0))
+        Assert.assertTrue(POBRNBenchmarkRunner.regressions(listOf(result), baseline, 0.25).isEmpty())
+    }
+
+    @Test
+    fun testRegressionsBeyondThreshold() {
+        val baseline = JSONObject().put(result.name, JSONObject().put("nsPerOp", 90.0).put("bytesPerOp", 64.0))
+        val regressions = POBRNBenchmarkRunner.regressions(listOf(result), baseline, 0.25)
+        Assert.assertEquals(1, regressions.size)
+        Assert.assertTrue(regressions[0].startsWith("POBBid.toJson: nsPerOp"))
+    }
+
+    @Test
+    fun testRegressionsWithoutBaseline() {
+        // A missing or null baseline fails the check instead of skipping the benchmark.
+        Assert.assertEquals(2, POBRNBenchmarkRunner.regressions(listOf(result), JSONObject(), 0.25).size)
+        val baseline = JSONObject().put(result.name, JSONObject().put("nsPerOp", JSONObject.NULL).put("bytesPerOp", 64.0))
+        val regressions = POBRNBenchmarkRunner.regressions(listOf(result), baseline, 0.25)
+        Assert.assertEquals(1, regressions.size)
+        Assert.assertTrue(regressions[0].contains("no nsPerOp baseline"))
+    }
+}
@@ -0,0 +1,131 @@
+package com.pubmatic.sdk.openwrap.reactnative
+
+import org.junit.After
+import org.junit.Assert
+import org.junit.Before
+import org.junit.Rule
+import org.junit.Test
+import org.junit.rules.TemporaryFolder
+import java.io.File
+import java.nio.ByteBuffer
+import java.nio.ByteOrder
+
+class POBRNBidLandscapeTest {
+
+    @get:Rule
+    val temporaryFolder = TemporaryFolder()
+
+    private lateinit var directory: File
+
+    @Before
+    fun setUp() {
+        POBRNBidLandscape.reset()
+        directory = temporaryFolder.newFolder()
+        POBRNBidLandscape.initialize(directory)
+    }
+
+    @After
+    fun tearDown() {
+        POBRNBidLandscape.reset()
+    }
+
+    @Test
+    fun testSummary() {
+        POBRNBidLandscape.setEnabled(true)
+        for (price in 1..10) {
+            record("feed", "pubmatic", price.toDouble(), POBRNBidLandscape.Outcome.WON)
+        }
+        record("feed", "appnexus", 0.5, POBRNBidLandscape.Outcome.LOST)
+        record("feed", "appnexus", 12.0, POBRNBidLandscape.Outcome.WON)
+        record("feed", null, 0.0, POBRNBidLandscape.Outcome.NO_BID)
+
+        val summary = POBRNBidLandscape.summary()
+        Assert.assertEquals(13, summary.getInt("rows"))
+        val partners = summary.getJSONArray("partners")
+        Assert.assertEquals(2, partners.length())
+        Assert.assertEquals("pubmatic", partners.getJSONObject(0).getString("partnerName"))
+        Assert.assertEquals(1.0, partners.getJSONObject(0).getDouble("winRate"), 0.0)
+        Assert.assertEquals(2, partners.getJSONObject(1).getInt("bids"))
+        Assert.assertEquals(0.5, partners.getJSONObject(1).getDouble("winRate"), 0.0)
+
+        val adUnit = summary.getJSONArray("adUnits").getJSONObject(0)
+        Assert.assertEquals("feed", adUnit.getString("adUnitId"))
+        Assert.assertEquals(13, adUnit.getInt("auctions"))
+        Assert.assertEquals(1, adUnit.getInt("noBids"))
+        Assert.assertEquals(5.0, adUnit.getDouble("priceP50"), 0.0)
+        Assert.assertEquals(12.0, adUnit.getDouble("priceP99"), 0.0)
+    }
+
+    @Test
+    fun testRecordWhenDisabled() {
+        POBRNBidLandscape.record(POBRNAdFormat.BANNER, "feed", null, false)
+        Assert.assertEquals(0, POBRNBidLandscape.summary().getInt("rows"))
+        Assert.assertNull(POBRNBidLandscape.export())
+    }
+
+    @Test
+    fun testRollingFileRestored() {
+        POBRNBidLandscape.setEnabled(true, 3)
+        for (price in 1..5) {
+            record("feed", "pubmatic", price.toDouble(), POBRNBidLandscape.Outcome.WON)
+        }
+        Assert.assertEquals(3, POBRNBidLandscape.summary().getInt("rows"))
+
+        // Next session, the rows and strings are restored from the mapped file.
+        POBRNBidLandscape.setEnabled(false)
+        POBRNBidLandscape.reset()
+        POBRNBidLandscape.initialize(directory)
+        POBRNBidLandscape.setEnabled(true, 3)
+        val adUnit = POBRNBidLandscape.summary().getJSONArray("adUnits").getJSONObject(0)
+        Assert.assertEquals("feed", adUnit.getString("adUnitId"))
+        Assert.assertEquals(3, adUnit.getInt("auctions"))
+        Assert.assertEquals(4.0, adUnit.getDouble("priceP50"), 0.0)
+    }
+
+    @Test
+    fun testExport() {
+        POBRNBidLandscape.setEnabled(true, 2)
+        record("feed", "pubmatic", 1.0, POBRNBidLandscape.Outcome.WON)
+        record("feed", "appnexus", 2.0, POBRNBidLandscape.Outcome.LOST)
+        record("story", null, 0.0, POBRNBidLandscape.Outcome.NO_BID)
+
+        val export = POBRNBidLandscape.export()
+        Assert.assertNotNull(export)
+        val buffer = ByteBuffer.wrap(export!!.readBytes()).order(ByteOrder.LITTLE_ENDIAN)
+        // Row count and string count.
+        Assert.assertEquals(2L, buffer.getLong(16))
+        Assert.assertEquals(4, buffer.getInt(24))
+        // Oldest row first.
+        val rows = POBRNBidLandscape.HEADER_SIZE + POBRNBidLandscape.STRING_CAPACITY * POBRNBidLandscape.STRING_SLOT_SIZE
+        Assert.assertEquals(rows + 2 * POBRNBidLandscape.ROW_SIZE, export.length().toInt())
+        Assert.assertEquals(2.0, buffer.getDouble(rows + 8), 0.0)
+        Assert.assertEquals(POBRNBidLandscape.NO_STRING, buffer.getShort(rows + POBRNBidLandscape.ROW_SIZE + 18).toInt() and 0xFFFF)
+    }
+
+    @Test
+    fun testStringsOfOverwrittenRowsReclaimed() {
+        POBRNBidLandscape.setEnabled(true, 4)
+        // More deal ids than the string table holds, each row overwriting an older one.
+        for (deal in 0 until POBRNBidLandscape.STRING_CAPACITY + 10) {
+            POBRNBidLandscape.record(0, POBRNAdFormat.BANNER, "feed", "pubmatic", "deal$deal", 1.0, POBRNBidLandscape.Outcome.WON)
+        }
+        POBRNBidLandscape.record(0, POBRNAdFormat.BANNER, "story", "appnexus", "last", 2.0, POBRNBidLandscape.Outcome.WON)
+
+        val summary = POBRNBidLandscape.summary()
+        val partners = summary.getJSONArray("partners")
+        Assert.assertEquals("pubmatic", partners.getJSONObject(0).getString("partnerName"))
+        Assert.assertEquals("appnexus", partners.getJSONObject(1).getString("partnerName"))
+        Assert.assertEquals("story", summary.getJSONArray("adUnits").getJSONObject(1).getString("adUnitId"))
+
+        // The deal id of the newest row is still interned.
+        val buffer = ByteBuffer.wrap(POBRNBidLandscape.export()!!.readBytes()).order(ByteOrder.LITTLE_ENDIAN)
+        val rows = POBRNBidLandscape.HEADER_SIZE + POBRNBidLandscape.STRING_CAPACITY * POBRNBidLandscape.STRING_SLOT_SIZE
+        val deal = buffer.getShort(rows + 3 * POBRNBidLandscape.ROW_SIZE + 20).toInt() and 0xFFFF
+        Assert.assertNotEquals(POBRNBidLandscape.NO_STRING, deal)
+        Assert.assertTrue(buffer.getInt(24) <= POBRNBidLandscape.DEAL_STRING_CAPACITY)
+    }
+
+    private fun record(adUnitId: String, partnerName: String?, price: Double, outcome: POBRNBidLandscape.Outcome) {
+        POBRNBidLandscape.record(0, POBRNAdFormat.BANNER, adUnitId, partnerName, null, price, outcome)
+    }
+}
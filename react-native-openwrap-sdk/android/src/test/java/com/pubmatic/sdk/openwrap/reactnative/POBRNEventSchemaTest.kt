@@ -0,0 +1,46 @@
+package com.pubmatic.sdk.openwrap.reactnative
+
+import org.json.JSONObject
+import org.junit.Assert
+import org.junit.Test
+import org.junit.runner.RunWith
+import org.mockito.junit.MockitoJUnitRunner
+
+@RunWith(MockitoJUnitRunner::class)
+class POBRNEventSchemaTest {
+
+    @Test
+    fun testEventPayload() {
+        val ext = JSONObject()
+            .put(POBSDKPluginConstant.ERROR_CODE_KEY, 1002)
+            .put(POBSDKPluginConstant.ERROR_MESSAGE_KEY, "No ads available")
+            .put(POBSDKPluginConstant.LATENCY_KEY, JSONObject().put("loadToAdFailed", 120))
+            .put("unknownKey", true)
+
+        val payload = JSONObject(
+            POBSDKPluginUtils.eventPayload(POBRNEventSchema.AD_FAILED_TO_LOAD, "instance_1", ext)
+        )
+        Assert.assertEquals("instance_1", payload.getString(POBRNEventSchema.INSTANCE_ID_KEY))
+        Assert.assertEquals(POBRNEventSchema.AD_FAILED_TO_LOAD, payload.getInt(POBRNEventSchema.EVENT_KEY))
+        val compactExt = payload.getJSONObject(POBRNEventSchema.EXT_KEY)
+        Assert.assertEquals(1002, compactExt.getInt("c"))
+        Assert.assertEquals("No ads available", compactExt.getString("m"))
+        // Only the top level keys are compacted.
+        Assert.assertEquals(120, compactExt.getJSONObject("l").getInt("loadToAdFailed"))
+        Assert.assertTrue(compactExt.getBoolean("unknownKey"))
+    }
+
+    @Test
+    fun testEventPayloadWithoutExt() {
+        val payload = JSONObject(POBSDKPluginUtils.eventPayload(POBRNEventSchema.AD_CLICKED, "instance_1", null))
+        Assert.assertEquals(POBRNEventSchema.AD_CLICKED, payload.getInt(POBRNEventSchema.EVENT_KEY))
+        Assert.assertFalse(payload.has(POBRNEventSchema.EXT_KEY))
+    }
+
+    @Test
+    fun testKeyCodesUnique() {
+        val codes = POBRNEventSchema.KEY_CODES.values
+        Assert.assertEquals(codes.size, codes.toSet().size)
+        Assert.assertEquals(POBRNEventSchema.MEDIATION_OUTCOME + 1, POBRNEventSchema.EVENT_COUNT)
+    }
+}
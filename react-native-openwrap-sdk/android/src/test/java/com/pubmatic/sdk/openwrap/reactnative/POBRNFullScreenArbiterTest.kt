@@ -0,0 +1,179 @@
+package com.pubmatic.sdk.openwrap.reactnative
+
+import android.os.Build
+import android.os.Looper
+import android.os.SystemClock
+import android.view.View
+import org.junit.After
+import org.junit.Assert
+import org.junit.Before
+import org.junit.Test
+import org.junit.runner.RunWith
+import org.mockito.Mockito
+import org.robolectric.RobolectricTestRunner
+import org.robolectric.Shadows
+import org.robolectric.annotation.Config
+import java.util.concurrent.TimeUnit
+
+@RunWith(RobolectricTestRunner::class)
+@Config(sdk = [Build.VERSION_CODES.P])
+class POBRNFullScreenArbiterTest {
+
+    @Before
+    fun setUp() {
+        reset()
+    }
+
+    @After
+    fun tearDown() {
+        reset()
+    }
+
+    @Test
+    fun testBannersSuspendedWhileShowing() {
+        val banner = FakeBanner(INTERVAL_SECONDS)
+        POBRNFullScreenArbiter.register(banner)
+        Assert.assertFalse(banner.isSuspended)
+
+        POBRNFullScreenArbiter.onFullScreenOpened("interstitial")
+        Assert.assertTrue(POBRNFullScreenArbiter.isShowing)
+        Assert.assertTrue(banner.isSuspended)
+        Assert.assertTrue(POBRNBannerLoadScheduler.isSuspended)
+        Assert.assertTrue(POBRNBannerRefreshCoordinator.isSuspended)
+
+        // Registered during the show, suspended right away.
+        val late = FakeBanner(INTERVAL_SECONDS)
+        POBRNFullScreenArbiter.register(late)
+        Assert.assertTrue(late.isSuspended)
+
+        POBRNFullScreenArbiter.onFullScreenClosed("interstitial")
+        Assert.assertFalse(POBRNFullScreenArbiter.isShowing)
+        Assert.assertFalse(banner.isSuspended)
+        Assert.assertFalse(late.isSuspended)
+        Assert.assertFalse(POBRNBannerLoadScheduler.isSuspended)
+        Assert.assertFalse(POBRNBannerRefreshCoordinator.isSuspended)
+    }
+
+    @Test
+    fun testBannersResumedWhenLastAdCloses() {
+        val banner = FakeBanner(INTERVAL_SECONDS)
+        POBRNFullScreenArbiter.register(banner)
+
+        POBRNFullScreenArbiter.onFullScreenOpened("interstitial")
+        POBRNFullScreenArbiter.onFullScreenOpened("rewarded")
+        // An ad closed twice, e.g. closed then destroyed, is only counted once.
+        POBRNFullScreenArbiter.onFullScreenClosed("interstitial")
+        POBRNFullScreenArbiter.onFullScreenClosed("interstitial")
+        Assert.assertTrue(banner.isSuspended)
+
+        POBRNFullScreenArbiter.onFullScreenClosed("rewarded")
+        Assert.assertFalse(banner.isSuspended)
+        Assert.assertEquals(1, POBRNFullScreenArbiter.toJson().getInt("shows"))
+        Assert.assertEquals(2, banner.suspensions)
+    }
+
+    @Test
+    fun testExpiredRefreshCaughtUp() {
+        val due = FakeBanner(INTERVAL_SECONDS)
+        val notDue = FakeBanner(INTERVAL_SECONDS)
+        val static = FakeBanner(0)
+        listOf(due, notDue, static).forEach { POBRNFullScreenArbiter.register(it) }
+        advance(20_000)
+        notDue.receive()
+
+        POBRNFullScreenArbiter.onFullScreenOpened("interstitial")
+        // Shown from 20s to 45s, the first banner is due at 30s, the second one at 50s.
+        advance(25_000)
+        POBRNFullScreenArbiter.onFullScreenClosed("interstitial")
+
+        Assert.assertTrue(due.isRefreshDue)
+        Assert.assertFalse(notDue.isRefreshDue)
+        Assert.assertFalse(static.isRefreshDue)
+        val stats = POBRNFullScreenArbiter.toJson()
+        Assert.assertEquals(3, stats.getInt("suspendedBanners"))
+        Assert.assertEquals(1L, stats.getLong("suppressedRefreshes"))
+        Assert.assertEquals(1, stats.getInt("caughtUpBanners"))
+        Assert.assertEquals(25_000L, stats.getLong("showMillis"))
+    }
+
+    @Test
+    fun testBannerLoadsDeferred() {
+        val started = ArrayList<String>()
+        val view = Mockito.mock(View::class.java)
+        POBRNFullScreenArbiter.onFullScreenOpened("interstitial")
+        POBRNBannerLoadScheduler.enqueue(POBRNBannerLoadScheduler.Task(view) { started.add("banner") })
+
+        POBRNBannerLoadScheduler.onFrame(FRAME_NANOS)
+        Assert.assertTrue(started.isEmpty())
+
+        POBRNFullScreenArbiter.onFullScreenClosed("interstitial")
+        POBRNBannerLoadScheduler.onFrame(2 * FRAME_NANOS)
+        Assert.assertEquals(listOf("banner"), started)
+        Assert.assertEquals(1, POBRNFullScreenArbiter.toJson().getInt("deferredLoads"))
+    }
+
+    @Test
+    fun testEstimatedBytesFreed() {
+        POBRNFullScreenArbiter.recordBannerResponse(1_000)
+        POBRNFullScreenArbiter.recordBannerResponse(3_000)
+        POBRNFullScreenArbiter.register(FakeBanner(INTERVAL_SECONDS))
+
+        POBRNFullScreenArbiter.onFullScreenOpened("interstitial")
+        advance(INTERVAL_SECONDS * 1000L)
+        POBRNFullScreenArbiter.onFullScreenClosed("interstitial")
+
+        val stats = POBRNFullScreenArbiter.toJson()
+        Assert.assertEquals(2_000L, stats.getLong("averageResponseBytes"))
+        Assert.assertEquals(2_000L, stats.getLong("estimatedBytesFreed"))
+
+        POBRNFullScreenArbiter.resetStats()
+        Assert.assertEquals(0, POBRNFullScreenArbiter.toJson().getInt("shows"))
+    }
+
+    @Test
+    fun testSuppressedRefreshes() {
+        // Due before the show, every 10s from 5s on, within a show from 12s to 40s: 15s, 25s, 35s.
+        Assert.assertEquals(3L, POBRNFullScreenArbiter.suppressedRefreshes(5_000, 10_000, 12_000, 40_000))
+        Assert.assertEquals(1L, POBRNFullScreenArbiter.suppressedRefreshes(40_000, 10_000, 12_000, 40_000))
+        Assert.assertEquals(0L, POBRNFullScreenArbiter.suppressedRefreshes(41_000, 10_000, 12_000, 40_000))
+        Assert.assertEquals(0L, POBRNFullScreenArbiter.suppressedRefreshes(5_000, 0, 12_000, 40_000))
+    }
+
+    private fun reset() {
+        POBRNFullScreenArbiter.reset()
+        POBRNBannerLoadScheduler.reset()
+        POBRNBannerRefreshCoordinator.reset()
+    }
+
+    private fun advance(millis: Long) {
+        Shadows.shadowOf(Looper.getMainLooper()).idleFor(millis, TimeUnit.MILLISECONDS)
+    }
+
+    /**
+     * Banner whose ad is received when created.
+     */
+    private class FakeBanner(override val refreshIntervalSeconds: Int) : POBRNFullScreenArbiter.Banner {
+        var isSuspended = false
+        var isRefreshDue = false
+        var suspensions = 0
+        private var receivedMillis = SystemClock.uptimeMillis()
+
+        override val refreshDueMillis: Long
+            get() = if (refreshIntervalSeconds > 0) receivedMillis + refreshIntervalSeconds * 1000L else 0L
+
+        fun receive() {
+            receivedMillis = SystemClock.uptimeMillis()
+        }
+
+        override fun setSuspended(isSuspended: Boolean, isRefreshDue: Boolean) {
+            this.isSuspended = isSuspended
+            this.isRefreshDue = isRefreshDue
+            suspensions++
+        }
+    }
+
+    companion object {
+        private const val INTERVAL_SECONDS = 30
+        private const val FRAME_NANOS = 1_000_000_000L
+    }
+}
@@ -0,0 +1,45 @@
+package com.pubmatic.sdk.openwrap.reactnative
+
+import org.json.JSONArray
+import org.json.JSONException
+import org.json.JSONObject
+import org.junit.Assert
+import org.junit.Test
+import org.junit.runner.RunWith
+import org.mockito.junit.MockitoJUnitRunner
+
+@RunWith(MockitoJUnitRunner::class)
+class POBRNGamConfigTest {
+
+    @Test
+    fun testBuild() {
+        val config = POBRNGamConfig.build(
+            JSONObject()
+                .put(POBSDKPluginConstant.AD_UNIT_ID, "/1234/gam_ad_unit")
+                .put(
+                    POBSDKPluginConstant.GAM_CUSTOM_TARGETING_KEY, JSONObject()
+                        .put("section", "sports")
+                        .put("tags", JSONArray().put("a").put("b"))
+                        .put("level", 3)
+                )
+                .put(POBSDKPluginConstant.GAM_OW_TIMEOUT_KEY, 1500)
+        )
+        Assert.assertEquals("/1234/gam_ad_unit", config.adUnitId)
+        Assert.assertEquals(listOf("sports"), config.customTargeting["section"])
+        Assert.assertEquals(listOf("a", "b"), config.customTargeting["tags"])
+        Assert.assertEquals(listOf("3"), config.customTargeting["level"])
+        Assert.assertEquals(1500L, config.owTimeoutMillis)
+    }
+
+    @Test
+    fun testOwNetworkTimeoutSeconds() {
+        Assert.assertNull(POBRNGamConfig.build("{\"adUnitId\": \"gam\"}").owNetworkTimeoutSeconds())
+        Assert.assertEquals(1, POBRNGamConfig.build("{\"adUnitId\": \"gam\", \"owTimeoutMs\": 300}").owNetworkTimeoutSeconds())
+        Assert.assertEquals(2, POBRNGamConfig.build("{\"adUnitId\": \"gam\", \"owTimeoutMs\": 1500}").owNetworkTimeoutSeconds())
+    }
+
+    @Test(expected = JSONException::class)
+    fun testBuildWithoutAdUnitId() {
+        POBRNGamConfig.build("{\"owTimeoutMs\": 1000}")
+    }
+}
@@ -0,0 +1,275 @@
+package com.pubmatic.sdk.openwrap.reactnative
+
+import com.facebook.react.bridge.Arguments
+import com.facebook.react.bridge.JavaOnlyMap
+import com.facebook.react.bridge.ReactApplicationContext
+import com.pubmatic.sdk.openwrap.core.POBBid
+import com.pubmatic.sdk.openwrap.core.POBImpression
+import com.pubmatic.sdk.openwrap.core.POBRequest
+import org.json.JSONArray
+import org.json.JSONObject
+import org.junit.Assert
+import org.junit.Assume
+import org.junit.Before
+import org.junit.Test
+import org.mockito.Mockito
+import java.io.File
+
+/**
+ * Microbenchmarks of the plugin hot paths: parsing of the bridge payloads, bid conversion and event
+ * payload encoding, and of the plugin startup: the module registration and the OpenWrapSDKModule
+ * creation, paid when the bridge starts.
+ *
+ * Skipped by default, run from the android directory with:
+ * - ./gradlew benchmarkCheck: fails if a benchmark has no baseline or regresses beyond the threshold
+ *   (-PpobrnBenchmarkThreshold, default 0.25) of benchmark/baseline.json.
+ * - ./gradlew benchmarkBaseline: records the results as the new benchmark/baseline.json.
+ * Results are written to build/reports/pobrn-benchmark/results.json.
+ */
+class POBRNHotPathBenchmarkTest {
+
+    private val mode = System.getProperty("pobrn.benchmark") ?: MODE_OFF
+
+    private val runner = POBRNBenchmarkRunner()
+
+    @Before
+    fun setUp() {
+        Assume.assumeTrue(mode != MODE_OFF)
+    }
+
+    @Test
+    fun benchmarkHotPaths() {
+        val adUnitDetails = adUnitDetailsPayload()
+        val requestParams = requestParamsPayload()
+        val impressionParams = impressionParamsPayload()
+        val customParams = JSONObject(impressionParams).getString(POBSDKPluginConstant.POBRN_CUSTOM_PARAMS_KEY)
+        val userInfo = userInfoPayload()
+        val appInfo = appInfoPayload()
+        val impression = POBImpression("1", AD_UNIT_ID)
+        val request = POBRequest.createInstance(PUBLISHER_ID, PROFILE_ID, arrayOf(impression))
+        val bid = POBBid.build("pubmatic", bidPayload())
+        Assert.assertNotNull(bid)
+
+        runner.run("POBAdUnitDetails.build") { POBAdUnitDetails.build(adUnitDetails) }
+        runner.run("POBSDKPluginUtils.setRequestParams") {
+            POBSDKPluginUtils.setRequestParams(request!!, requestParams)
+        }
+        runner.run("POBSDKPluginUtils.setImpressionParams") {
+            POBSDKPluginUtils.setImpressionParams(impression, impressionParams)
+        }
+        // The same impression through a registered template: only the template id and the ad
+        // position cross the bridge and are parsed per ad.
+        POBRNImpressionTemplate.register(TEMPLATE_ID, POBRNImpressionTemplate.build(JSONObject(impressionParams)))
+        val templatedImpressionParams = JSONObject()
+            .put(POBSDKPluginConstant.TEMPLATE_ID_KEY, TEMPLATE_ID)
+            .put(POBSDKPluginConstant.POBRN_AD_POSITION_KEY, 1)
+            .toString()
+        runner.run("POBSDKPluginUtils.setImpressionParams.template") {
+            POBSDKPluginUtils.setImpressionParams(impression, templatedImpressionParams)
+        }
+        POBRNImpressionTemplate.reset()
+        println("POBRNHotPathBenchmark: impression params of ${impressionParams.length} chars, " +
+            "${templatedImpressionParams.length} with a template")
+        runner.run("POBSDKPluginUtils.convertJsonStringToMap") {
+            POBSDKPluginUtils.convertJsonStringToMap(customParams)
+        }
+        runner.run("POBSDKPluginParserHelper.parseJsonToUserInfo") {
+            POBSDKPluginParserHelper.parseJsonToUserInfo(userInfo)
+        }
+        runner.run("POBSDKPluginParserHelper.parseJsonToApplicationInfo") {
+            POBSDKPluginParserHelper.parseJsonToApplicationInfo(appInfo)
+        }
+        runner.run("POBBid.toJson") { bid!!.toJson() }
+        // Arguments.createMap() needs the native bridge, JavaOnlyMap is its JVM implementation.
+        Mockito.mockStatic(Arguments::class.java).use { arguments ->
+            arguments.`when`<Any> { Arguments.createMap() }.thenAnswer { JavaOnlyMap() }
+            runner.run("POBBid.toMap") { bid!!.toMap() }
+        }
+
+        report()
+    }
+
+    @Test
+    fun benchmarkStartup() {
+        val context = Mockito.mock(ReactApplicationContext::class.java)
+        val openWrapPackage = OpenWrapSDKPackage()
+        val module = OpenWrapSDKModule(context)
+
+        // Run by the bridge at launch, on the main thread.
+        runner.run("OpenWrapSDKPackage.getReactModuleInfos") {
+            openWrapPackage.reactModuleInfoProvider.reactModuleInfos
+        }
+        // Run the first time JS accesses OpenWrapSDK.
+        runner.run("OpenWrapSDKModule.init") { openWrapPackage.getModule(OpenWrapSDKModule.NAME, context) }
+        runner.run("OpenWrapSDKModule.getConstants") { module.constants }
+
+        report()
+    }
+
+    @Test
+    fun benchmarkEventPayload() {
+        val bid = POBBid.build("pubmatic", bidPayload())
+        Assert.assertNotNull(bid)
+        val ext = bid!!.toJson()
+
+        // Run for every event of a full screen ad, before the payload crosses the bridge.
+        runner.run("POBSDKPluginUtils.eventPayload") {
+            POBSDKPluginUtils.eventPayload(POBRNEventSchema.AD_RECEIVED, INSTANCE_ID, ext)
+        }
+        val payloadBytes = POBSDKPluginUtils.eventPayload(POBRNEventSchema.AD_RECEIVED, INSTANCE_ID, ext).length
+        val namedPayloadBytes = namedEventPayload(ext).length
+        println("POBRNHotPathBenchmark: onAdReceived payload of $payloadBytes chars, $namedPayloadBytes with named keys")
+        Assert.assertTrue(payloadBytes < namedPayloadBytes)
+
+        report()
+    }
+
+    private fun report() {
+        println("POBRNHotPathBenchmark: ${runner.toJson().toString(2)}")
+        // Every test reports its own benchmarks, merged with the ones of the previous tests of the run.
+        runner.results.forEach { runResults.put(it.name, it.toJson()) }
+        val results = runResults
+        val resultFile = File("build/reports/pobrn-benchmark/results.json")
+        resultFile.parentFile?.mkdirs()
+        resultFile.writeText(results.toString(2))
+
+        val baselineFile = File(System.getProperty("pobrn.benchmark.baseline") ?: "benchmark/baseline.json")
+        when (mode) {
+            MODE_RECORD -> {
+                baselineFile.parentFile?.mkdirs()
+                baselineFile.writeText(
+                    JSONObject()
+                        .put("jvm", "${System.getProperty("java.vm.name")} ${System.getProperty("java.version")}")
+                        .put("benchmarks", results)
+                        .toString(2)
+                )
+            }
+            MODE_CHECK -> {
+                val threshold = (System.getProperty("pobrn.benchmark.threshold") ?: "0.25").toDouble()
+                val regressions = POBRNBenchmarkRunner.regressions(
+                    runner.results,
+                    POBRNBenchmarkRunner.readBaseline(baselineFile),
+                    threshold
+                )
+                Assert.assertTrue(regressions.joinToString("\n"), regressions.isEmpty())
+            }
+        }
+    }
+
+    private fun adUnitDetailsPayload(): String {
+        val adSizes = JSONArray()
+        listOf(320 to 50, 300 to 250, 728 to 90).forEach { (width, height) ->
+            adSizes.put(JSONObject().put(POBSDKPluginConstant.WIDTH, width).put(POBSDKPluginConstant.HEIGHT, height))
+        }
+        return JSONObject()
+            .put(POBSDKPluginConstant.PUBLISHER_ID, PUBLISHER_ID)
+            .put(POBSDKPluginConstant.PROFILE_ID, PROFILE_ID)
+            .put(POBSDKPluginConstant.AD_UNIT_ID, AD_UNIT_ID)
+            .put(POBSDKPluginConstant.AD_SIZES, adSizes)
+            .put(POBSDKPluginConstant.REQUEST_PARAMS, requestParamsPayload())
+            .put(POBSDKPluginConstant.IMPRESSION_PARAMS, impressionParamsPayload())
+            .put(POBSDKPluginConstant.ENABLE_GET_BID_PRICE, 1)
+            .toString()
+    }
+
+    private fun requestParamsPayload(): String {
+        return JSONObject()
+            .put(POBSDKPluginConstant.POBRN_ENABLE_TEST_MODE_KEY, true)
+            .put(POBSDKPluginConstant.POBRN_ENABLE_BID_SUMMARY_KEY, true)
+            .put(POBSDKPluginConstant.POBRN_SERVER_URL_KEY, "https://ow.pubmatic.com/openrtb/2.5")
+            .put(POBSDKPluginConstant.POBRN_ENABLE_RESPONSE_DEBUGGING_KEY, false)
+            .put(POBSDKPluginConstant.POBRN_VERSION_ID_KEY, 3)
+            .put(POBSDKPluginConstant.POBRN_NETWORK_TIMEOUT_KEY, 5)
+            .toString()
+    }
+
+    // Custom params of a typical targeting setup: 20 keys with 5 values each.
+    private fun impressionParamsPayload(): String {
+        val customParams = JSONObject()
+        for (key in 0 until 20) {
+            val values = JSONArray()
+            for (value in 0 until 5) {
+                values.put("value_${key}_$value")
+            }
+            customParams.put("key_$key", values)
+        }
+        return JSONObject()
+            .put(POBSDKPluginConstant.POBRN_TEST_CREATIVE_ID_KEY, "creative_1234")
+            .put(POBSDKPluginConstant.POBRN_CUSTOM_PARAMS_KEY, customParams.toString())
+            .put(POBSDKPluginConstant.POBRN_AD_POSITION_KEY, 1)
+            .toString()
+    }
+
+    private fun userInfoPayload(): String {
+        return JSONObject()
+            .put(POBSDKPluginConstant.USER_INFO_CITY_KEY, "Pune")
+            .put(POBSDKPluginConstant.USER_INFO_BIRTH_YEAR_KEY, 1990)
+            .put(POBSDKPluginConstant.USER_INFO_METRO_KEY, "Pune")
+            .put(POBSDKPluginConstant.USER_INFO_REGION_KEY, "MH")
+            .put(POBSDKPluginConstant.LOCATOIN_ZIP_KEY, "411045")
+            .put(POBSDKPluginConstant.USER_INFO_GENDER_KEY, POBSDKPluginConstant.GENDER_MALE)
+            .put(POBSDKPluginConstant.KEYWORDS_KEY, "sports, news, weather, finance")
+            .toString()
+    }
+
+    private fun appInfoPayload(): String {
+        return JSONObject()
+            .put(POBSDKPluginConstant.APP_INFO_DOMAIN_KEY, "example.com")
+            .put(POBSDKPluginConstant.APP_INFO_STORE_URL_KEY, "https://play.google.com/store/apps/details?id=com.example/")
+            .put(POBSDKPluginConstant.APP_INFO_IS_PAID_KEY, true)
+            .put(POBSDKPluginConstant.KEYWORDS_KEY, "android, app")
+            .put(POBSDKPluginConstant.APP_INFO_CATEGORIES_KEY, "IAB1, IAB2, IAB3")
+            .toString()
+    }
+
+    // Payload of an event with the event name and the key names, as emitted before POBRNEventSchema.
+    private fun namedEventPayload(ext: JSONObject): String {
+        return JSONObject()
+            .put(POBSDKPluginConstant.INSTANCE_ID_KEY, INSTANCE_ID)
+            .put("eventName", POBRNEventSchema.AD_RECEIVED_NAME)
+            .put("ext", ext)
+            .toString()
+    }
+
+    // OpenRTB bid as returned by the OpenWrap ad server, with the usual targeting ext.
+    private fun bidPayload(): JSONObject {
+        return JSONObject()
+            .put("id", "6F9A5DA7-1C1B-4A34-9E77-B1A3E2D1B2C3")
+            .put("impid", "1")
+            .put("price", 1.5)
+            .put("adm", "<div>" + "x".repeat(2048) + "</div>")
+            .put("crid", "creative_1234")
+            .put("dealid", "deal_1")
+            .put("w", 320)
+            .put("h", 50)
+            .put("nurl", "https://t.pubmatic.com/win?price=\${AUCTION_PRICE}")
+            .put("lurl", "https://t.pubmatic.com/loss?reason=\${AUCTION_LOSS}")
+            .put(
+                "ext", JSONObject()
+                    .put("crtype", "banner")
+                    .put("refreshInterval", 30)
+                    .put("prebid", JSONObject().put("targeting", JSONObject()
+                        .put("pwtsid", "6F9A5DA7")
+                        .put("pwtbst", "1")
+                        .put("pwtecp", "1.50")
+                        .put("pwtpid", "pubmatic")
+                        .put("pwtsz", "320x50")
+                        .put("pwtplt", "display")))
+            )
+    }
+
+    companion object {
+        // Results of all the benchmark tests of the run.
+        private val runResults = JSONObject()
+
+        private const val MODE_OFF = "off"
+        private const val MODE_CHECK = "check"
+        private const val MODE_RECORD = "record"
+
+        private const val PUBLISHER_ID = "156276"
+        private const val PROFILE_ID = 1165
+        private const val AD_UNIT_ID = "/15671365/pm_sdk/PMSDK-Demo-App-Banner"
+        private const val INSTANCE_ID = "1718000000000_42"
+        private const val TEMPLATE_ID = "feed"
+    }
+}
@@ -0,0 +1,95 @@
+package com.pubmatic.sdk.openwrap.reactnative
+
+import org.junit.After
+import org.junit.Assert
+import org.junit.Test
+
+class POBRNLatencyHistogramTest {
+
+    @After
+    fun tearDown() {
+        POBRNLatencyTracker.reset()
+        POBRNLatencyTracker.isPayloadEnabled = false
+    }
+
+    @Test
+    fun testEmptyHistogram() {
+        val histogram = POBRNLatencyHistogram()
+        Assert.assertEquals(0L, histogram.count)
+        Assert.assertEquals(0L, histogram.valueAtPercentile(50.0))
+    }
+
+    @Test
+    fun testBucketBoundaries() {
+        Assert.assertEquals(127, POBRNLatencyHistogram.indexOf(127))
+        Assert.assertEquals(128, POBRNLatencyHistogram.indexOf(128))
+        Assert.assertEquals(128, POBRNLatencyHistogram.indexOf(129))
+        Assert.assertEquals(192, POBRNLatencyHistogram.indexOf(256))
+        Assert.assertEquals(
+            POBRNLatencyHistogram.BUCKET_COUNT - 1,
+            POBRNLatencyHistogram.indexOf(POBRNLatencyHistogram.MAX_VALUE)
+        )
+        Assert.assertEquals(129L, POBRNLatencyHistogram.highestValueAt(128))
+        Assert.assertEquals(POBRNLatencyHistogram.MAX_VALUE,
+            POBRNLatencyHistogram.highestValueAt(POBRNLatencyHistogram.BUCKET_COUNT - 1))
+    }
+
+    @Test
+    fun testPercentilesWithinPrecision() {
+        val histogram = POBRNLatencyHistogram()
+        for (value in 1..100_000L) {
+            histogram.record(value)
+        }
+        Assert.assertEquals(100_000L, histogram.count)
+        assertWithinPrecision(50_000L, histogram.valueAtPercentile(50.0))
+        assertWithinPrecision(90_000L, histogram.valueAtPercentile(90.0))
+        assertWithinPrecision(99_000L, histogram.valueAtPercentile(99.0))
+        Assert.assertEquals(100_000L, histogram.valueAtPercentile(100.0))
+    }
+
+    @Test
+    fun testClampAndReset() {
+        val histogram = POBRNLatencyHistogram()
+        histogram.record(-1)
+        Assert.assertEquals(0L, histogram.count)
+        histogram.record(Long.MAX_VALUE)
+        Assert.assertEquals(POBRNLatencyHistogram.MAX_VALUE, histogram.max)
+        histogram.reset()
+        Assert.assertEquals(0L, histogram.count)
+        Assert.assertEquals(0L, histogram.max)
+    }
+
+    @Test
+    fun testTrackerStats() {
+        POBRNLatencyTracker.record(
+            POBRNAdFormat.INTERSTITIAL, "unit", POBRNLatencyTracker.Metric.SHOW_TO_OPENED, 5_000_000
+        )
+        val stats = POBRNLatencyTracker.toJson()
+        Assert.assertEquals(1, stats.length())
+        val entry = stats.getJSONObject(0)
+        Assert.assertEquals("interstitial", entry.getString("adFormat"))
+        Assert.assertEquals("unit", entry.getString("adUnitId"))
+        Assert.assertEquals("showToOpened", entry.getString("metric"))
+        Assert.assertEquals(1, entry.getInt("count"))
+        Assert.assertEquals(5.0, entry.getDouble("p50"), 5.0 / 64)
+    }
+
+    @Test
+    fun testTimerAttachesLatencyOnlyWhenEnabled() {
+        val timer = POBRNLatencyTimer(POBRNAdFormat.REWARDED, "unit")
+        timer.markLoad()
+        timer.markAdReceived()
+        Assert.assertNull(timer.attachTo(null))
+
+        POBRNLatencyTracker.isPayloadEnabled = true
+        val payload = timer.attachTo(null)
+        Assert.assertNotNull(payload)
+        Assert.assertTrue(payload!!.getJSONObject("latency").has("loadToAdReceived"))
+        Assert.assertFalse(payload.getJSONObject("latency").has("loadToBid"))
+    }
+
+    private fun assertWithinPrecision(expected: Long, actual: Long) {
+        Assert.assertTrue("$actual is not within 1/64 of $expected",
+            Math.abs(actual - expected) <= expected / 64)
+    }
+}
@@ -0,0 +1,222 @@
+package com.pubmatic.sdk.openwrap.reactnative
+
+import android.app.Activity
+import android.os.Build
+import android.os.Looper
+import com.facebook.react.bridge.ReactApplicationContext
+import com.facebook.react.modules.core.DeviceEventManagerModule
+import com.facebook.react.uimanager.ThemedReactContext
+import com.facebook.react.uimanager.events.RCTEventEmitter
+import org.json.JSONArray
+import org.json.JSONObject
+import org.junit.After
+import org.junit.Assert
+import org.junit.Assume
+import org.junit.Before
+import org.junit.Test
+import org.junit.runner.RunWith
+import org.mockito.ArgumentMatchers
+import org.mockito.Mockito
+import org.robolectric.Robolectric
+import org.robolectric.RobolectricTestRunner
+import org.robolectric.RuntimeEnvironment
+import org.robolectric.Shadows
+import org.robolectric.annotation.Config
+import java.io.File
+import java.util.concurrent.TimeUnit
+
+/**
+ * End to end load harness of the bridge layer. It drives create/load/show/destroy cycles through
+ * POBRNInterstitialModule, POBRNRewardedAdModule and POBRNBannerViewManager against the local
+ * [POBRNStubAdServer], then reports throughput, latency distribution and leaked ad instances.
+ *
+ * The harness is skipped by default, run it with:
+ * ./gradlew testDebugUnitTest -PpobrnHarness=true -PpobrnHarnessCycles=1000
+ * The report is also written to build/reports/pobrn-harness/android.json.
+ */
+@RunWith(RobolectricTestRunner::class)
+@Config(sdk = [Build.VERSION_CODES.P])
+class POBRNLoadHarnessTest {
+
+    private val cycles = (System.getProperty("pobrn.harness.cycles") ?: "1000").toInt()
+
+    private lateinit var server: POBRNStubAdServer
+    private lateinit var reactContext: ReactApplicationContext
+    private lateinit var activity: Activity
+
+    // Last plugin event received for every instance id, written on the main looper only.
+    private val lastEvents = HashMap<String, Int>()
+
+    @Before
+    fun setUp() {
+        Assume.assumeTrue(System.getProperty("pobrn.harness") == "true")
+        server = POBRNStubAdServer(noFillRate = 0.1)
+        server.start()
+
+        activity = Robolectric.buildActivity(Activity::class.java).setup().get()
+        reactContext = Mockito.spy(ReactApplicationContext(RuntimeEnvironment.application))
+        Mockito.doReturn(activity).`when`(reactContext).currentActivity
+
+        val deviceEmitter = Mockito.mock(DeviceEventManagerModule.RCTDeviceEventEmitter::class.java)
+        Mockito.doAnswer { invocation ->
+            val payload = JSONObject(invocation.getArgument<Any>(1) as String)
+            lastEvents[payload.getString(POBRNEventSchema.INSTANCE_ID_KEY)] =
+                payload.getInt(POBRNEventSchema.EVENT_KEY)
+            null
+        }.`when`(deviceEmitter).emit(ArgumentMatchers.anyString(), ArgumentMatchers.any())
+        Mockito.doReturn(deviceEmitter).`when`(reactContext)
+            .getJSModule(DeviceEventManagerModule.RCTDeviceEventEmitter::class.java)
+    }
+
+    @After
+    fun tearDown() {
+        if (this::server.isInitialized) {
+            server.stop()
+        }
+    }
+
+    @Test
+    fun testInterstitialCycles() {
+        val report = runFullScreenCycles(POBRNAdFormat.INTERSTITIAL, POBRNInterstitialModule(reactContext))
+        Assert.assertEquals(cycles, report.getInt("cycles"))
+        Assert.assertEquals(0, report.getInt("leakedInstances"))
+    }
+
+    @Test
+    fun testRewardedCycles() {
+        val report = runFullScreenCycles(POBRNAdFormat.REWARDED, POBRNRewardedAdModule(reactContext))
+        Assert.assertEquals(cycles, report.getInt("cycles"))
+        Assert.assertEquals(0, report.getInt("leakedInstances"))
+    }
+
+    @Test
+    fun testBannerCycles() {
+        val themedReactContext = ThemedReactContext(reactContext, activity)
+        val bannerEvents = HashMap<Int, String>()
+        val eventEmitter = Mockito.mock(RCTEventEmitter::class.java)
+        Mockito.doAnswer { invocation ->
+            bannerEvents[invocation.getArgument(0)] = invocation.getArgument(1)
+            null
+        }.`when`(eventEmitter).receiveEvent(ArgumentMatchers.anyInt(), ArgumentMatchers.anyString(), ArgumentMatchers.any())
+        Mockito.doReturn(eventEmitter).`when`(reactContext).getJSModule(RCTEventEmitter::class.java)
+
+        val manager = POBRNBannerViewManager()
+        val histogram = POBRNLatencyHistogram()
+        var filled = 0
+        var liveViews = 0
+        val start = System.nanoTime()
+        for (i in 1..cycles) {
+            val cycleStart = System.nanoTime()
+            // The view id is the react tag, the events being dispatched to it.
+            val view: POBRNBannerView = manager.createView(i, themedReactContext, null, null, null)
+            liveViews++
+            manager.setAdUnitDetails(view, adUnitDetails())
+            val event = awaitEvent { bannerEvents.remove(i) }
+            if (event == POBSDKPluginConstant.AD_RECEIVED_EVENT) {
+                filled++
+            }
+            manager.onDropViewInstance(view)
+            if (view.childCount == 0) {
+                liveViews--
+            }
+            histogram.record(TimeUnit.NANOSECONDS.toMicros(System.nanoTime() - cycleStart))
+        }
+        val report = buildReport(POBRNAdFormat.BANNER, start, filled, histogram, liveViews)
+        Assert.assertEquals(cycles, report.getInt("cycles"))
+        Assert.assertEquals(0, report.getInt("leakedInstances"))
+    }
+
+    private fun runFullScreenCycles(format: POBRNAdFormat, module: POBRNFullScreenAdProvider): JSONObject {
+        val histogram = POBRNLatencyHistogram()
+        var filled = 0
+        val start = System.nanoTime()
+        for (i in 1..cycles) {
+            val instanceId = "${format.value}_$i"
+            val cycleStart = System.nanoTime()
+            module.createAdInstance(instanceId, PUBLISHER_ID, PROFILE_ID, AD_UNIT_ID)
+            module.setRequestParameters(requestParams(), instanceId)
+            module.loadAd(instanceId)
+            if (awaitEvent { lastEvents.remove(instanceId) } == POBRNEventSchema.AD_RECEIVED) {
+                filled++
+                module.showAd(instanceId)
+                idleMainLooper()
+            }
+            module.destroy(instanceId)
+            histogram.record(TimeUnit.NANOSECONDS.toMicros(System.nanoTime() - cycleStart))
+        }
+        return buildReport(format, start, filled, histogram, POBRNAdManager.size())
+    }
+
+    /**
+     * Idles the main looper until [poll] returns an event, or until the timeout expires.
+     */
+    private fun <T> awaitEvent(poll: () -> T?): T? {
+        val deadline = System.nanoTime() + TimeUnit.SECONDS.toNanos(EVENT_TIMEOUT_SECONDS)
+        while (System.nanoTime() < deadline) {
+            idleMainLooper()
+            poll()?.let { return it }
+            Thread.sleep(1)
+        }
+        return null
+    }
+
+    private fun idleMainLooper() {
+        // Advances by a frame, so the frame callbacks of POBRNBannerLoadScheduler run as well.
+        Shadows.shadowOf(Looper.getMainLooper()).idleFor(FRAME_MILLIS, TimeUnit.MILLISECONDS)
+    }
+
+    private fun buildReport(
+        format: POBRNAdFormat,
+        startNanos: Long,
+        filled: Int,
+        histogram: POBRNLatencyHistogram,
+        leakedInstances: Int
+    ): JSONObject {
+        val elapsedSeconds = (System.nanoTime() - startNanos) / 1e9
+        val report = JSONObject()
+            .put("adFormat", format.value)
+            .put("cycles", histogram.count)
+            .put("filled", filled)
+            .put("throughputPerSecond", Math.round(histogram.count / elapsedSeconds))
+            .put("cycleP50Ms", histogram.valueAtPercentile(50.0) / 1000.0)
+            .put("cycleP90Ms", histogram.valueAtPercentile(90.0) / 1000.0)
+            .put("cycleP99Ms", histogram.valueAtPercentile(99.0) / 1000.0)
+            .put("stubRequests", server.requests.get())
+            .put("leakedInstances", leakedInstances)
+        println("POBRNLoadHarness ${format.value}: $report")
+        writeReport(report)
+        return report
+    }
+
+    private fun writeReport(report: JSONObject) {
+        val file = File("build/reports/pobrn-harness/android.json")
+        file.parentFile?.mkdirs()
+        val reports = if (file.exists()) JSONArray(file.readText()) else JSONArray()
+        file.writeText(reports.put(report).toString(2))
+    }
+
+    private fun requestParams(): String {
+        return JSONObject().put(POBSDKPluginConstant.POBRN_SERVER_URL_KEY, server.url).toString()
+    }
+
+    private fun adUnitDetails(): String {
+        return JSONObject()
+            .put(POBSDKPluginConstant.PUBLISHER_ID, PUBLISHER_ID)
+            .put(POBSDKPluginConstant.PROFILE_ID, PROFILE_ID)
+            .put(POBSDKPluginConstant.AD_UNIT_ID, AD_UNIT_ID)
+            .put(
+                POBSDKPluginConstant.AD_SIZES,
+                JSONArray().put(JSONObject().put(POBSDKPluginConstant.WIDTH, 320).put(POBSDKPluginConstant.HEIGHT, 50))
+            )
+            .put(POBSDKPluginConstant.REQUEST_PARAMS, requestParams())
+            .toString()
+    }
+
+    companion object {
+        private const val PUBLISHER_ID = "156276"
+        private const val PROFILE_ID = 1165
+        private const val AD_UNIT_ID = "/15671365/pm_sdk/PMSDK-Demo-App-Harness"
+        private const val EVENT_TIMEOUT_SECONDS = 10L
+        private const val FRAME_MILLIS = 16L
+    }
+}
@@ -0,0 +1,142 @@
+package com.pubmatic.sdk.openwrap.reactnative
+
+import android.os.Build
+import org.junit.After
+import org.junit.Assert
+import org.junit.Before
+import org.junit.Rule
+import org.junit.Test
+import org.junit.rules.TemporaryFolder
+import org.junit.runner.RunWith
+import org.robolectric.RobolectricTestRunner
+import org.robolectric.RuntimeEnvironment
+import org.robolectric.annotation.Config
+import java.io.File
+import java.util.concurrent.Executor
+
+@RunWith(RobolectricTestRunner::class)
+@Config(sdk = [Build.VERSION_CODES.P])
+class POBRNMediaCacheTest {
+
+    @get:Rule
+    val temporaryFolder = TemporaryFolder()
+
+    private val server = POBRNStubAdServer(mediaBytes = MEDIA_BYTES)
+    private lateinit var directory: File
+
+    @Before
+    fun setUp() {
+        POBRNMediaCache.reset()
+        // Download on the calling thread.
+        POBRNMediaCache.executor = Executor { it.run() }
+        directory = temporaryFolder.newFolder()
+        server.start()
+    }
+
+    @After
+    fun tearDown() {
+        server.stop()
+        POBRNMediaCache.reset()
+    }
+
+    @Test
+    fun testParseMediaFiles() {
+        val mediaFiles = POBRNMediaCache.parseMediaFiles(server.buildVast())
+        Assert.assertEquals(POBRNStubAdServer.MEDIA_SIZES.size, mediaFiles.size)
+        Assert.assertEquals(1280, mediaFiles[1].width)
+        Assert.assertEquals(720, mediaFiles[1].height)
+        Assert.assertEquals("video/mp4", mediaFiles[1].type)
+        Assert.assertTrue(mediaFiles[1].url.endsWith("/media/1280x720.mp4"))
+    }
+
+    @Test
+    fun testSelectMediaFilePrefersLargestFitting() {
+        val mediaFiles = listOf(
+            POBRNMediaCache.MediaFile("a", "video/mp4", 480, 270, 500),
+            POBRNMediaCache.MediaFile("b", "video/mp4", 1280, 720, 2000),
+            POBRNMediaCache.MediaFile("c", "video/mp4", 1280, 720, 1200),
+            POBRNMediaCache.MediaFile("d", "video/mp4", 1920, 1080, 4000),
+            POBRNMediaCache.MediaFile("e", "video/webm", 1280, 720, 800)
+        )
+        // Portrait screen, the longest side fits the 1280x720 renditions.
+        Assert.assertEquals("c", POBRNMediaCache.selectMediaFile(mediaFiles, 720, 1520)?.url)
+        // Nothing fits, the smallest rendition is used.
+        Assert.assertEquals("a", POBRNMediaCache.selectMediaFile(mediaFiles, 240, 320)?.url)
+        Assert.assertNull(POBRNMediaCache.selectMediaFile(mediaFiles.takeLast(1), 720, 1520))
+    }
+
+    @Test
+    fun testPrefetchOfCachedFileDoesNotDownloadAgain() {
+        POBRNMediaCache.prefetchMediaFile(directory, "1", mediaUrl(480, 270))
+        Assert.assertNotNull(POBRNMediaCache.cachedFile(mediaUrl(480, 270)))
+        POBRNMediaCache.prefetchMediaFile(directory, "2", mediaUrl(480, 270))
+
+        Assert.assertEquals(1, server.mediaRequests.get())
+        val stats = POBRNMediaCache.toJson()
+        Assert.assertEquals(2, stats.getInt("prefetches"))
+        Assert.assertEquals(1, stats.getInt("alreadyCached"))
+        Assert.assertEquals(1, stats.getInt("downloads"))
+        Assert.assertEquals(MEDIA_BYTES.toLong(), stats.getLong("bytesDownloaded"))
+        // The player downloads the file again, so nothing is reported as saved.
+        Assert.assertFalse(stats.has("bytesSaved"))
+        Assert.assertEquals(MEDIA_BYTES.toLong(), stats.getLong("cachedBytes"))
+    }
+
+    @Test
+    fun testEvictKeepsFileReferencedByAnotherBid() {
+        val url = mediaUrl(480, 270)
+        POBRNMediaCache.prefetchMediaFile(directory, "1", url)
+        POBRNMediaCache.prefetchMediaFile(directory, "2", url)
+        val file = POBRNMediaCache.cachedFile(url)!!
+
+        POBRNMediaCache.evict("1")
+        Assert.assertTrue(file.exists())
+
+        POBRNMediaCache.evict("2")
+        Assert.assertFalse(file.exists())
+        Assert.assertNull(POBRNMediaCache.cachedFile(url))
+        Assert.assertEquals(0L, POBRNMediaCache.toJson().getLong("cachedBytes"))
+    }
+
+    @Test
+    fun testLeastRecentlyUsedEvictedAboveMaxBytes() {
+        POBRNMediaCache.maxBytes = 2L * MEDIA_BYTES
+        POBRNMediaCache.prefetchMediaFile(directory, "1", mediaUrl(480, 270))
+        POBRNMediaCache.prefetchMediaFile(directory, "2", mediaUrl(1280, 720))
+        // Uses the first file again, the second one becomes the least recently used.
+        POBRNMediaCache.prefetchMediaFile(directory, "3", mediaUrl(480, 270))
+        POBRNMediaCache.prefetchMediaFile(directory, "4", mediaUrl(1920, 1080))
+
+        Assert.assertNotNull(POBRNMediaCache.cachedFile(mediaUrl(480, 270)))
+        Assert.assertNull(POBRNMediaCache.cachedFile(mediaUrl(1280, 720)))
+        Assert.assertNotNull(POBRNMediaCache.cachedFile(mediaUrl(1920, 1080)))
+        Assert.assertEquals(2L * MEDIA_BYTES, POBRNMediaCache.toJson().getLong("cachedBytes"))
+    }
+
+    @Test
+    fun testFailedDownloadCounted() {
+        // Nothing listens on port 1.
+        val url = "http://127.0.0.1:1/media/480x270.mp4"
+        POBRNMediaCache.prefetchMediaFile(directory, "1", url)
+
+        Assert.assertNull(POBRNMediaCache.cachedFile(url))
+        Assert.assertEquals(1, POBRNMediaCache.toJson().getInt("failures"))
+        Assert.assertEquals(0, directory.listFiles()?.size ?: 0)
+    }
+
+    @Test
+    fun testPrefetchDisabledByDefault() {
+        POBRNMediaCache.prefetch(RuntimeEnvironment.application, "1", server.buildVast())
+        Assert.assertEquals(0, POBRNMediaCache.toJson().getInt("prefetches"))
+        Assert.assertEquals(0, server.mediaRequests.get())
+    }
+
+    private fun mediaUrl(width: Int, height: Int): String {
+        val vast = server.buildVast()
+        return POBRNMediaCache.parseMediaFiles(vast).first { it.width == width && it.height == height }.url
+    }
+
+    companion object {
+        private const val MEDIA_BYTES = 16 * 1024
+    }
+}
@@ -0,0 +1,73 @@
+package com.pubmatic.sdk.openwrap.reactnative
+
+import com.pubmatic.sdk.openwrap.core.POBBid
+import com.pubmatic.sdk.openwrap.core.POBBidEvent
+import org.junit.After
+import org.junit.Assert
+import org.junit.Test
+import org.junit.runner.RunWith
+import org.mockito.Mockito
+import org.mockito.junit.MockitoJUnitRunner
+
+@RunWith(MockitoJUnitRunner::class)
+class POBRNMediationRuleTest {
+
+    private val rule = POBRNMediationRule.build(
+        "{\"floor\": 0.5, \"partnerFloors\": {\"appnexus\": 1.0}, " +
+                "\"allowedPartners\": [\"pubmatic\", \"appnexus\"], \"maxWaitMs\": 300}"
+    )
+
+    @After
+    fun tearDown() {
+        POBRNMediationRule.unregister("adUnit")
+    }
+
+    private fun bid(price: Double, partner: String?, status: Int = 1, expired: Boolean = false): POBBid {
+        val bid = Mockito.mock(POBBid::class.java)
+        Mockito.lenient().`when`(bid.price).thenReturn(price)
+        Mockito.lenient().`when`(bid.partnerName).thenReturn(partner)
+        Mockito.lenient().`when`(bid.status).thenReturn(status)
+        Mockito.lenient().`when`(bid.isExpired).thenReturn(expired)
+        return bid
+    }
+
+    @Test
+    fun testBuild() {
+        Assert.assertEquals(0.5, rule.floor, 0.0)
+        Assert.assertEquals(1.0, rule.partnerFloors["appnexus"])
+        Assert.assertEquals(listOf("pubmatic", "appnexus"), rule.allowedPartners)
+        Assert.assertEquals(300L, rule.maxWaitMillis)
+    }
+
+    @Test
+    fun testEvaluate() {
+        Assert.assertEquals(POBRNMediationRule.REASON_WON, rule.evaluate(bid(0.6, "pubmatic"), 100.0).reason)
+        Assert.assertEquals(POBRNMediationRule.REASON_BELOW_FLOOR, rule.evaluate(bid(0.4, "pubmatic"), 100.0).reason)
+        Assert.assertEquals(POBRNMediationRule.REASON_BELOW_FLOOR, rule.evaluate(bid(0.8, "appnexus"), 100.0).reason)
+        Assert.assertEquals(POBRNMediationRule.REASON_PARTNER_NOT_ALLOWED, rule.evaluate(bid(2.0, "other"), 100.0).reason)
+        Assert.assertEquals(POBRNMediationRule.REASON_MAX_WAIT_EXCEEDED, rule.evaluate(bid(2.0, "pubmatic"), 400.0).reason)
+        Assert.assertEquals(POBRNMediationRule.REASON_BID_STATUS, rule.evaluate(bid(2.0, "pubmatic", 0), null).reason)
+
+        val expired = rule.evaluate(bid(2.0, "pubmatic", expired = true), null)
+        Assert.assertEquals(POBRNMediationRule.REASON_BID_EXPIRED, expired.reason)
+        Assert.assertEquals(POBBidEvent.BidEventError.BID_EXPIRED, expired.error)
+    }
+
+    @Test
+    fun testApply() {
+        val bidEvent = Mockito.mock(POBBidEvent::class.java)
+        Assert.assertTrue(rule.apply(bidEvent, bid(1.0, "pubmatic"), null).isWin)
+        Mockito.verify(bidEvent).proceedToLoadAd()
+
+        val outcome = rule.apply(bidEvent, bid(0.1, "pubmatic"), null)
+        Assert.assertFalse(outcome.isWin)
+        Mockito.verify(bidEvent).proceedOnError(POBBidEvent.BidEventError.CLIENT_SIDE_AUCTION_LOSS)
+    }
+
+    @Test
+    fun testRegister() {
+        Assert.assertNull(POBRNMediationRule.forAdUnit("adUnit"))
+        POBRNMediationRule.register("adUnit", rule)
+        Assert.assertSame(rule, POBRNMediationRule.forAdUnit("adUnit"))
+    }
+}
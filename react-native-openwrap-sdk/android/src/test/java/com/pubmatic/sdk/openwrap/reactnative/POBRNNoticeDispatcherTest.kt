@@ -0,0 +1,159 @@
+package com.pubmatic.sdk.openwrap.reactnative
+
+import android.os.Build
+import org.json.JSONObject
+import org.junit.After
+import org.junit.Assert
+import org.junit.Before
+import org.junit.Rule
+import org.junit.Test
+import org.junit.rules.TemporaryFolder
+import org.junit.runner.RunWith
+import org.robolectric.RobolectricTestRunner
+import org.robolectric.annotation.Config
+import java.io.File
+
+@RunWith(RobolectricTestRunner::class)
+@Config(sdk = [Build.VERSION_CODES.P])
+class POBRNNoticeDispatcherTest {
+
+    @get:Rule
+    val temporaryFolder = TemporaryFolder()
+
+    private val server = POBRNStubAdServer()
+    private lateinit var queueFile: File
+
+    @Before
+    fun setUp() {
+        POBRNNoticeDispatcher.reset()
+        POBRNNoticeDispatcher.batchDelayMillis = BATCH_DELAY_MILLIS
+        POBRNNoticeDispatcher.initialBackoffMillis = BACKOFF_MILLIS
+        queueFile = File(temporaryFolder.newFolder(), POBRNNoticeDispatcher.QUEUE_FILE_NAME)
+        POBRNNoticeDispatcher.open(queueFile)
+        server.start()
+    }
+
+    @After
+    fun tearDown() {
+        server.stop()
+        POBRNNoticeDispatcher.reset()
+    }
+
+    @Test
+    fun testNoticesDelivered() {
+        POBRNNoticeDispatcher.enqueue(server.trackerUrl("win?price=1.5"))
+        POBRNNoticeDispatcher.enqueue(server.trackerUrl("loss?reason=102"))
+
+        val stats = awaitStats { it.getInt("delivered") == 2 }
+        Assert.assertEquals(2, server.trackerRequests.get())
+        Assert.assertEquals(2, stats.getInt("enqueued"))
+        Assert.assertEquals(0, stats.getInt("queueDepth"))
+        Assert.assertTrue(stats.getLong("latencyMaxMillis") >= BATCH_DELAY_MILLIS)
+    }
+
+    @Test
+    fun testInvalidNoticeIgnored() {
+        POBRNNoticeDispatcher.enqueue("javascript:alert(1)")
+        POBRNNoticeDispatcher.enqueue(server.trackerUrl("win") + "\nE\t1\t0\thttp://example.com")
+
+        Assert.assertEquals(0, awaitStats { true }.getInt("enqueued"))
+    }
+
+    @Test
+    fun testBatchesRateLimited() {
+        POBRNNoticeDispatcher.batchDelayMillis = 500L
+        val count = POBRNNoticeDispatcher.MAX_REQUESTS_PER_BATCH + 5
+        // Queued while offline, so that they are all due for the first batch.
+        POBRNNoticeDispatcher.onConnectivityChanged(false)
+        repeat(count) { POBRNNoticeDispatcher.enqueue(server.trackerUrl("win?id=$it")) }
+        POBRNNoticeDispatcher.onConnectivityChanged(true)
+
+        // The first batch is capped, the remaining notices go with the next batch.
+        val stats = awaitStats { it.getInt("delivered") >= POBRNNoticeDispatcher.MAX_REQUESTS_PER_BATCH }
+        Assert.assertEquals(POBRNNoticeDispatcher.MAX_REQUESTS_PER_BATCH, stats.getInt("delivered"))
+        Assert.assertEquals(5, stats.getInt("queueDepth"))
+        awaitStats { it.getInt("delivered") == count }
+    }
+
+    @Test
+    fun testServerErrorRetried() {
+        server.trackerStatus = 503
+        POBRNNoticeDispatcher.enqueue(server.trackerUrl("win"))
+        awaitStats { it.getInt("retries") >= 2 }
+
+        server.trackerStatus = 200
+        val stats = awaitStats { it.getInt("delivered") == 1 }
+        Assert.assertEquals(0, stats.getInt("dropped"))
+    }
+
+    @Test
+    fun testClientErrorDropped() {
+        server.trackerStatus = 404
+        POBRNNoticeDispatcher.enqueue(server.trackerUrl("win"))
+
+        val stats = awaitStats { it.getInt("dropped") == 1 }
+        Assert.assertEquals(0, stats.getInt("retries"))
+        Assert.assertEquals(1, server.trackerRequests.get())
+    }
+
+    @Test
+    fun testNoticesHeldWhileOffline() {
+        POBRNNoticeDispatcher.onConnectivityChanged(false)
+        POBRNNoticeDispatcher.enqueue(server.trackerUrl("win"))
+        Thread.sleep(BATCH_DELAY_MILLIS * 5)
+        Assert.assertEquals(0, server.trackerRequests.get())
+        Assert.assertEquals(1, awaitStats { true }.getInt("queueDepth"))
+
+        POBRNNoticeDispatcher.onConnectivityChanged(true)
+        awaitStats { it.getInt("delivered") == 1 }
+    }
+
+    @Test
+    fun testNoticesRestoredFromDisk() {
+        POBRNNoticeDispatcher.onConnectivityChanged(false)
+        POBRNNoticeDispatcher.enqueue(server.trackerUrl("win"))
+        POBRNNoticeDispatcher.enqueue(server.trackerUrl("loss"))
+        awaitStats { it.getInt("queueDepth") == 2 }
+        // Killed while writing a notice.
+        queueFile.appendText("E\t3\t")
+
+        // Restart.
+        POBRNNoticeDispatcher.reset()
+        POBRNNoticeDispatcher.batchDelayMillis = BATCH_DELAY_MILLIS
+        POBRNNoticeDispatcher.open(queueFile)
+
+        val stats = awaitStats { it.getInt("delivered") == 2 }
+        Assert.assertEquals(2, stats.getInt("restored"))
+        Assert.assertEquals(2, server.trackerRequests.get())
+    }
+
+    @Test
+    fun testBackoff() {
+        POBRNNoticeDispatcher.initialBackoffMillis = 1_000L
+        Assert.assertTrue(POBRNNoticeDispatcher.backoffMillis(1) in 1_000L..1_200L)
+        Assert.assertTrue(POBRNNoticeDispatcher.backoffMillis(3) in 4_000L..4_800L)
+        Assert.assertTrue(POBRNNoticeDispatcher.backoffMillis(40) <= POBRNNoticeDispatcher.MAX_BACKOFF_MILLIS * 6 / 5)
+    }
+
+    /**
+     * Waits for the dispatcher stats to match the given condition, once the queued tasks are done.
+     */
+    private fun awaitStats(condition: (JSONObject) -> Boolean): JSONObject {
+        val deadline = System.currentTimeMillis() + TIMEOUT_MILLIS
+        while (true) {
+            POBRNNoticeDispatcher.executor.submit {}.get()
+            val stats = POBRNNoticeDispatcher.toJson()
+            if (condition(stats)) {
+                return stats
+            }
+            Assert.assertTrue("Timed out with stats $stats", System.currentTimeMillis() < deadline)
+            Thread.sleep(10)
+        }
+    }
+
+    companion object {
+        private const val BATCH_DELAY_MILLIS = 20L
+        private const val BACKOFF_MILLIS = 20L
+        private const val TIMEOUT_MILLIS = 5_000L
+    }
+}
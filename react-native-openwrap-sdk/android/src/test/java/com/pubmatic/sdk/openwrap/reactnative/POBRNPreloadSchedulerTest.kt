@@ -0,0 +1,172 @@
+package com.pubmatic.sdk.openwrap.reactnative
+
+import android.os.Build
+import android.os.Looper
+import org.junit.After
+import org.junit.Assert
+import org.junit.Before
+import org.junit.Test
+import org.junit.runner.RunWith
+import org.robolectric.RobolectricTestRunner
+import org.robolectric.Shadows
+import org.robolectric.annotation.Config
+import java.util.concurrent.TimeUnit
+
+@RunWith(RobolectricTestRunner::class)
+@Config(sdk = [Build.VERSION_CODES.P])
+class POBRNPreloadSchedulerTest {
+
+    private val loads = ArrayList<String>()
+
+    @Before
+    fun setUp() {
+        POBRNPreloadScheduler.reset()
+    }
+
+    @After
+    fun tearDown() {
+        POBRNPreloadScheduler.reset()
+    }
+
+    @Test
+    fun testDeferral() {
+        Assert.assertEquals(0L, POBRNPreloadScheduler.deferral(60_000.0, 600_000.0))
+        // Shown 20 min after the load call with bids valid for 10 min, the load waits 12 min.
+        Assert.assertEquals(720_000L, POBRNPreloadScheduler.deferral(1_200_000.0, 600_000.0))
+    }
+
+    @Test
+    fun testLoadsRightAwayWhenDisabled() {
+        learnLoadToShow(LOAD_TO_SHOW_MILLIS)
+        schedule("next")
+        Assert.assertEquals(listOf("first", "next"), loads)
+    }
+
+    @Test
+    fun testLoadDeferredUntilValidityWindow() {
+        learnLoadToShow(LOAD_TO_SHOW_MILLIS)
+        POBRNPreloadScheduler.setEnabled(true)
+
+        schedule("next")
+        Assert.assertEquals(listOf("first"), loads)
+        val deferralMillis = POBRNPreloadScheduler.deferral(
+            LOAD_TO_SHOW_MILLIS.toDouble(), POBRNPreloadScheduler.DEFAULT_VALIDITY_MILLIS.toDouble()
+        )
+        idleFor(deferralMillis - 1)
+        Assert.assertEquals(listOf("first"), loads)
+        idleFor(1)
+        Assert.assertEquals(listOf("first", "next"), loads)
+
+        val stats = POBRNPreloadScheduler.toJson().getJSONArray("adUnits").getJSONObject(0)
+        Assert.assertEquals(AD_UNIT_ID, stats.getString("adUnitId"))
+        Assert.assertEquals(2, stats.getInt("loads"))
+        Assert.assertEquals(1, stats.getInt("deferredLoads"))
+        Assert.assertEquals(LOAD_TO_SHOW_MILLIS, stats.getLong("loadToShowMillis"))
+    }
+
+    @Test
+    fun testCancelledLoadDoesNotRun() {
+        learnLoadToShow(LOAD_TO_SHOW_MILLIS)
+        POBRNPreloadScheduler.setEnabled(true)
+
+        schedule("next")
+        POBRNPreloadScheduler.cancel("next")
+        idleFor(LOAD_TO_SHOW_MILLIS)
+        Assert.assertEquals(listOf("first"), loads)
+    }
+
+    @Test
+    fun testRunNow() {
+        learnLoadToShow(LOAD_TO_SHOW_MILLIS)
+        POBRNPreloadScheduler.setEnabled(true)
+
+        schedule("next")
+        Assert.assertTrue(POBRNPreloadScheduler.isDeferred("next"))
+        Assert.assertTrue(POBRNPreloadScheduler.runNow("next"))
+        Assert.assertEquals(listOf("first", "next"), loads)
+        Assert.assertFalse(POBRNPreloadScheduler.isDeferred("next"))
+
+        // Started once only, and counted as one load.
+        Assert.assertFalse(POBRNPreloadScheduler.runNow("next"))
+        idleFor(LOAD_TO_SHOW_MILLIS)
+        Assert.assertEquals(listOf("first", "next"), loads)
+        val stats = POBRNPreloadScheduler.toJson().getJSONArray("adUnits").getJSONObject(0)
+        Assert.assertEquals(2, stats.getInt("loads"))
+    }
+
+    @Test
+    fun testWastedAuctions() {
+        schedule("expired")
+        POBRNPreloadScheduler.onAdReceived("expired", 2048)
+        idleFor(VALIDITY_MILLIS)
+        POBRNPreloadScheduler.onAdExpired("expired")
+
+        schedule("shown")
+        POBRNPreloadScheduler.onAdReceived("shown", 1024)
+        POBRNPreloadScheduler.onAdShown("shown")
+
+        val stats = POBRNPreloadScheduler.toJson().getJSONArray("adUnits").getJSONObject(0)
+        Assert.assertEquals(2, stats.getInt("received"))
+        Assert.assertEquals(1, stats.getInt("shown"))
+        Assert.assertEquals(1, stats.getInt("wastedAuctions"))
+        Assert.assertEquals(2048, stats.getLong("wastedBytes"))
+        Assert.assertEquals(0.5, stats.getDouble("showRate"), 0.0)
+        Assert.assertEquals(VALIDITY_MILLIS, stats.getLong("validityMillis"))
+
+        POBRNPreloadScheduler.resetStats()
+        val reset = POBRNPreloadScheduler.toJson().getJSONArray("adUnits").getJSONObject(0)
+        Assert.assertEquals(0, reset.getInt("wastedAuctions"))
+        // What is learned is kept.
+        Assert.assertEquals(VALIDITY_MILLIS, reset.getLong("validityMillis"))
+    }
+
+    @Test
+    fun testThrottledWhileAnAdWaitsForShow() {
+        POBRNPreloadScheduler.setEnabled(true)
+        repeat(POBRNPreloadScheduler.MIN_SAMPLES) {
+            schedule("expired$it")
+            POBRNPreloadScheduler.onAdReceived("expired$it", 0)
+            POBRNPreloadScheduler.onAdExpired("expired$it")
+        }
+        val stats = POBRNPreloadScheduler.toJson().getJSONArray("adUnits").getJSONObject(0)
+        Assert.assertTrue(stats.getBoolean("throttled"))
+
+        schedule("idle")
+        POBRNPreloadScheduler.onAdReceived("idle", 0)
+        loads.clear()
+        schedule("throttled")
+        Assert.assertTrue(loads.isEmpty())
+        Assert.assertTrue(POBRNPreloadScheduler.isDeferred("throttled"))
+
+        // Starts once the received ad is shown.
+        POBRNPreloadScheduler.onAdShown("idle")
+        Assert.assertEquals(listOf("throttled"), loads)
+    }
+
+    /**
+     * Loads an ad and shows it after the given time, disabled so the load is not deferred.
+     */
+    private fun learnLoadToShow(loadToShowMillis: Long) {
+        val enabled = POBRNPreloadScheduler.isEnabled()
+        POBRNPreloadScheduler.setEnabled(false)
+        schedule("first")
+        POBRNPreloadScheduler.onAdReceived("first", 0)
+        idleFor(loadToShowMillis)
+        POBRNPreloadScheduler.onAdShown("first")
+        POBRNPreloadScheduler.setEnabled(enabled)
+    }
+
+    private fun schedule(instanceId: String) {
+        POBRNPreloadScheduler.schedule(AD_UNIT_ID, instanceId, Runnable { loads.add(instanceId) })
+    }
+
+    private fun idleFor(millis: Long) {
+        Shadows.shadowOf(Looper.getMainLooper()).idleFor(millis, TimeUnit.MILLISECONDS)
+    }
+
+    companion object {
+        private const val AD_UNIT_ID = "interstitial"
+        private const val LOAD_TO_SHOW_MILLIS = 40 * 60 * 1000L
+        private const val VALIDITY_MILLIS = 10 * 60 * 1000L
+    }
+}
@@ -0,0 +1,143 @@
+package com.pubmatic.sdk.openwrap.reactnative
+
+import android.os.Build
+import android.os.Looper
+import com.pubmatic.sdk.common.POBError
+import org.junit.After
+import org.junit.Assert
+import org.junit.Before
+import org.junit.Test
+import org.junit.runner.RunWith
+import org.robolectric.RobolectricTestRunner
+import org.robolectric.Shadows
+import org.robolectric.annotation.Config
+import java.util.concurrent.TimeUnit
+
+@RunWith(RobolectricTestRunner::class)
+@Config(sdk = [Build.VERSION_CODES.P])
+class POBRNRequestCoalescerTest {
+
+    private val events = ArrayList<String>()
+
+    @Before
+    fun setUp() {
+        POBRNRequestCoalescer.reset()
+    }
+
+    @After
+    fun tearDown() {
+        POBRNRequestCoalescer.reset()
+    }
+
+    @Test
+    fun testKey() {
+        val key = POBRNRequestCoalescer.key("156276", 1165, AD_UNIT_ID, "{\"debug\":true}", null)
+        Assert.assertEquals(key, POBRNRequestCoalescer.key("156276", 1165, AD_UNIT_ID, "{\"debug\":true}", null))
+        Assert.assertNotEquals(key, POBRNRequestCoalescer.key("156276", 1165, AD_UNIT_ID, "{\"debug\":false}", null))
+        Assert.assertNotEquals(key, POBRNRequestCoalescer.key("156276", 1302, AD_UNIT_ID, "{\"debug\":true}", null))
+    }
+
+    @Test
+    fun testDuplicateLoadIgnored() {
+        val flight = flight("a")
+        POBRNRequestCoalescer.load(KEY, AD_UNIT_ID, flight)
+        POBRNRequestCoalescer.load(KEY, AD_UNIT_ID, flight)
+
+        Assert.assertEquals(listOf("a:start"), events)
+        assertStats(auctions = 1, queued = 0, duplicate = 1)
+    }
+
+    @Test
+    fun testQueuedLoadStartsAfterLeader() {
+        val leader = flight("a")
+        POBRNRequestCoalescer.load(KEY, AD_UNIT_ID, leader)
+        POBRNRequestCoalescer.load(KEY, AD_UNIT_ID, flight("b"))
+        Assert.assertEquals(listOf("a:start"), events)
+
+        POBRNRequestCoalescer.complete(KEY, AD_UNIT_ID, leader)
+        Assert.assertEquals(listOf("a:start", "b:start"), events)
+        assertStats(auctions = 2, queued = 1)
+    }
+
+    @Test
+    fun testNoFillSharedWithQueuedLoads() {
+        val leader = flight("a")
+        POBRNRequestCoalescer.load(KEY, AD_UNIT_ID, leader)
+        POBRNRequestCoalescer.load(KEY, AD_UNIT_ID, flight("b"))
+        POBRNRequestCoalescer.load(KEY, AD_UNIT_ID, flight("c"))
+
+        POBRNRequestCoalescer.complete(KEY, AD_UNIT_ID, leader, POBError(POBError.NO_ADS_AVAILABLE, "No ads"))
+        Assert.assertEquals(listOf("a:start", "b:fail", "c:fail"), events)
+        assertStats(auctions = 1, queued = 2, sharedNoFill = 2)
+
+        // The key is free again.
+        POBRNRequestCoalescer.load(KEY, AD_UNIT_ID, flight("d"))
+        Assert.assertEquals("d:start", events.last())
+    }
+
+    @Test
+    fun testCancelledQueuedLoadNotStarted() {
+        val leader = flight("a")
+        val queued = flight("b")
+        POBRNRequestCoalescer.load(KEY, AD_UNIT_ID, leader)
+        POBRNRequestCoalescer.load(KEY, AD_UNIT_ID, queued)
+        POBRNRequestCoalescer.complete(KEY, AD_UNIT_ID, queued)
+
+        POBRNRequestCoalescer.complete(KEY, AD_UNIT_ID, leader)
+        Assert.assertEquals(listOf("a:start"), events)
+    }
+
+    @Test
+    fun testParkedValueAdopted() {
+        val value = Any()
+        POBRNRequestCoalescer.park(KEY, value) { events.add("expired") }
+
+        Assert.assertSame(value, POBRNRequestCoalescer.adopt(KEY, AD_UNIT_ID))
+        Assert.assertNull(POBRNRequestCoalescer.adopt(KEY, AD_UNIT_ID))
+        idleFor(POBRNRequestCoalescer.PARK_TIMEOUT_MILLIS)
+        Assert.assertTrue(events.isEmpty())
+        assertStats(auctions = 0, queued = 0, adopted = 1)
+    }
+
+    @Test
+    fun testParkedValueExpires() {
+        POBRNRequestCoalescer.park(KEY, Any()) { events.add("expired") }
+        idleFor(POBRNRequestCoalescer.PARK_TIMEOUT_MILLIS)
+
+        Assert.assertEquals(listOf("expired"), events)
+        Assert.assertNull(POBRNRequestCoalescer.adopt(KEY, AD_UNIT_ID))
+    }
+
+    private fun flight(name: String) = object : POBRNRequestCoalescer.Flight {
+        override fun start() {
+            events.add("$name:start")
+        }
+
+        override fun fail(error: POBError) {
+            events.add("$name:fail")
+        }
+    }
+
+    private fun idleFor(millis: Long) {
+        Shadows.shadowOf(Looper.getMainLooper()).idleFor(millis, TimeUnit.MILLISECONDS)
+    }
+
+    private fun assertStats(
+        auctions: Int, queued: Int, duplicate: Int = 0, sharedNoFill: Int = 0, adopted: Int = 0
+    ) {
+        val stats = POBRNRequestCoalescer.toJson().getJSONObject(0)
+        Assert.assertEquals(AD_UNIT_ID, stats.getString(POBSDKPluginConstant.AD_UNIT_ID))
+        Assert.assertEquals(auctions, stats.getInt("auctions"))
+        Assert.assertEquals(queued, stats.getInt("queued"))
+        Assert.assertEquals(duplicate + sharedNoFill + adopted, stats.getInt("avoided"))
+        val avoided = stats.getJSONObject("avoidedByReason")
+        Assert.assertEquals(duplicate, avoided.getInt("duplicate"))
+        Assert.assertEquals(sharedNoFill, avoided.getInt("sharedNoFill"))
+        Assert.assertEquals(adopted, avoided.getInt("adopted"))
+    }
+
+    companion object {
+        private const val AD_UNIT_ID = "OpenWrapInterstitialAdUnit"
+        private const val KEY = "156276:1165:$AD_UNIT_ID:0"
+    }
+}
@@ -0,0 +1,80 @@
+package com.pubmatic.sdk.openwrap.reactnative
+
+import com.pubmatic.sdk.common.OpenWrapSDK
+import com.pubmatic.sdk.common.POBInstanceProvider
+import com.pubmatic.sdk.common.log.POBLog
+import org.json.JSONObject
+import org.junit.Assert
+import org.junit.Before
+import org.junit.Test
+import org.junit.runner.RunWith
+import org.mockito.junit.MockitoJUnitRunner
+
+@RunWith(MockitoJUnitRunner::class)
+class POBRNSDKConfiguratorTest {
+
+    @Before
+    fun setUp() {
+        POBRNSDKConfigurator.reset()
+    }
+
+    @Test
+    fun testApplyConfig() {
+        val config = JSONObject()
+            .put(POBSDKPluginConstant.CONFIG_LOG_LEVEL_KEY, OpenWrapSDK.LogLevel.Debug.level)
+            .put(POBSDKPluginConstant.CONFIG_COPPA_KEY, true)
+            .put(POBSDKPluginConstant.CONFIG_USE_INTERNAL_BROWSER_KEY, true)
+            .put(POBSDKPluginConstant.CONFIG_USER_INFO_KEY, JSONObject().put("city", "Pune"))
+
+        val appliedKeys = POBRNSDKConfigurator.apply(config)
+
+        Assert.assertEquals(4, appliedKeys.size)
+        Assert.assertEquals(OpenWrapSDK.LogLevel.Debug, POBLog.getLogLevel())
+        POBInstanceProvider.getSdkConfig().isCoppa?.let { Assert.assertTrue(it) }
+        Assert.assertTrue(POBInstanceProvider.getSdkConfig().isUseInternalBrowser)
+        Assert.assertEquals("Pune", POBInstanceProvider.getSdkConfig().userInfo?.city)
+    }
+
+    @Test
+    fun testApplyConfigSkipsUnchangedValues() {
+        POBRNSDKConfigurator.apply(
+            JSONObject()
+                .put(POBSDKPluginConstant.CONFIG_SSL_ENABLED_KEY, true)
+                .put(POBSDKPluginConstant.CONFIG_ALLOW_ADVERTISING_ID_KEY, true)
+        )
+
+        val appliedKeys = POBRNSDKConfigurator.apply(
+            JSONObject()
+                .put(POBSDKPluginConstant.CONFIG_SSL_ENABLED_KEY, true)
+                .put(POBSDKPluginConstant.CONFIG_ALLOW_ADVERTISING_ID_KEY, false)
+        )
+
+        Assert.assertEquals(listOf(POBSDKPluginConstant.CONFIG_ALLOW_ADVERTISING_ID_KEY), appliedKeys)
+        Assert.assertFalse(POBInstanceProvider.getSdkConfig().isAllowAdvertisingId)
+    }
+
+    @Test
+    fun testApplyConfigAfterIndividualSetter() {
+        val config = JSONObject().put(POBSDKPluginConstant.CONFIG_USE_INTERNAL_BROWSER_KEY, true)
+        POBRNSDKConfigurator.apply(config)
+
+        // Set by its individual setter, the value is applied again by the next configuration.
+        OpenWrapSDK.setUseInternalBrowser(false)
+        POBRNSDKConfigurator.invalidate(POBSDKPluginConstant.CONFIG_USE_INTERNAL_BROWSER_KEY)
+        val appliedKeys = POBRNSDKConfigurator.apply(config)
+
+        Assert.assertEquals(listOf(POBSDKPluginConstant.CONFIG_USE_INTERNAL_BROWSER_KEY), appliedKeys)
+        Assert.assertTrue(POBInstanceProvider.getSdkConfig().isUseInternalBrowser)
+    }
+
+    @Test
+    fun testApplyConfigIgnoresInvalidValues() {
+        val appliedKeys = POBRNSDKConfigurator.apply(
+            JSONObject()
+                .put(POBSDKPluginConstant.CONFIG_LOG_LEVEL_KEY, -1)
+                .put(POBSDKPluginConstant.CONFIG_LOCATION_KEY, "invalid")
+                .put("unknownKey", true)
+        )
+        Assert.assertTrue(appliedKeys.isEmpty())
+    }
+}
@@ -0,0 +1,153 @@
+package com.pubmatic.sdk.openwrap.reactnative
+
+import android.os.Build
+import android.os.Looper
+import org.junit.After
+import org.junit.Assert
+import org.junit.Test
+import org.junit.runner.RunWith
+import org.robolectric.RobolectricTestRunner
+import org.robolectric.Shadows
+import org.robolectric.annotation.Config
+import java.util.concurrent.TimeUnit
+
+@RunWith(RobolectricTestRunner::class)
+@Config(sdk = [Build.VERSION_CODES.P])
+class POBRNShowFallbackTest {
+
+    private val instanceIds = ArrayList<String>()
+
+    @After
+    fun tearDown() {
+        POBRNShowFallback.reset()
+        instanceIds.forEach { POBRNAdManager.remove(it) }
+    }
+
+    @Test
+    fun testShowsHighestReadyBid() {
+        val low = add("low", FakeAd(ready = true, price = 1.0))
+        val high = add("high", FakeAd(ready = true, price = 2.5))
+        val expired = add("expired", FakeAd(ready = true, bidExpired = true, price = 9.0))
+        val failed = add("failed", FakeAd())
+        val loading = add("loading", FakeAd(loading = true))
+
+        var shown: String? = "none"
+        POBRNShowFallback.showBestAvailable(GROUP, 0) { shown = it }
+        Assert.assertEquals("high", shown)
+        Assert.assertEquals(1, high.shows)
+        Assert.assertEquals(0, low.shows)
+        Assert.assertEquals(0, expired.shows)
+
+        // The ads neither ready nor loading load their replacement, the ready ones are kept.
+        Assert.assertEquals(1, expired.loads)
+        Assert.assertEquals(1, failed.loads)
+        Assert.assertEquals(0, loading.loads)
+        Assert.assertEquals(0, low.loads)
+        Assert.assertEquals(0, high.loads)
+    }
+
+    @Test
+    fun testWaitsForLoadingAdWithinBudget() {
+        val loading = add("loading", FakeAd(loading = true))
+
+        var shown: String? = "none"
+        POBRNShowFallback.showBestAvailable(GROUP, BUDGET_MILLIS) { shown = it }
+        Assert.assertEquals("none", shown)
+
+        loading.loading = false
+        loading.ready = true
+        POBRNShowFallback.onAdReceived("loading")
+        idleFor(0)
+        Assert.assertEquals("loading", shown)
+        Assert.assertEquals(1, loading.shows)
+    }
+
+    @Test
+    fun testGivesUpAfterBudget() {
+        val loading = add("loading", FakeAd(loading = true))
+
+        var shown: String? = "none"
+        POBRNShowFallback.showBestAvailable(GROUP, BUDGET_MILLIS) { shown = it }
+        idleFor(BUDGET_MILLIS)
+        Assert.assertNull(shown)
+
+        // Received after the budget, the ad is not shown.
+        loading.ready = true
+        POBRNShowFallback.onAdReceived("loading")
+        idleFor(0)
+        Assert.assertEquals(0, loading.shows)
+    }
+
+    @Test
+    fun testNothingToWaitFor() {
+        add("failed", FakeAd())
+
+        var shown: String? = "none"
+        POBRNShowFallback.showBestAvailable(GROUP, BUDGET_MILLIS) { shown = it }
+        Assert.assertNull(shown)
+        POBRNShowFallback.showBestAvailable("unknown", BUDGET_MILLIS) { shown = it }
+        Assert.assertNull(shown)
+    }
+
+    @Test
+    fun testRemovedAdLeavesGroup() {
+        add("ad", FakeAd(ready = true))
+        POBRNAdManager.remove("ad")
+        Assert.assertTrue(POBRNAdManager.group(GROUP).isEmpty())
+        Assert.assertTrue(POBRNAdManager.groupsOf("ad").isEmpty())
+    }
+
+    private fun add(instanceId: String, ad: FakeAd): FakeAd {
+        instanceIds.add(instanceId)
+        POBRNAdManager.put(instanceId, ad)
+        POBRNAdManager.addToGroup(GROUP, instanceId)
+        return ad
+    }
+
+    private fun idleFor(millis: Long) {
+        Shadows.shadowOf(Looper.getMainLooper()).idleFor(millis, TimeUnit.MILLISECONDS)
+    }
+
+    private class FakeAd(
+        var ready: Boolean = false,
+        var bidExpired: Boolean = false,
+        var loading: Boolean = false,
+        val price: Double = 0.0
+    ) : POBRNFullScreenAd {
+        var shows = 0
+        var loads = 0
+
+        override fun loadAd() {
+            loads++
+        }
+
+        override fun showAd() {
+            shows++
+        }
+
+        override fun destroy() {}
+
+        override fun isReady(): Boolean = ready
+
+        override fun setRequestParameters(paramString: String) {}
+
+        override fun setImpressionParameters(paramString: String) {}
+
+        override fun proceedToLoadAd(): Boolean = false
+
+        override fun proceedOnError(error: String) {}
+
+        override fun setBidEventListener() {}
+
+        override fun isBidExpired(): Boolean = bidExpired
+
+        override fun isLoading(): Boolean = loading
+
+        override fun getBidPrice(): Double = price
+    }
+
+    companion object {
+        private const val GROUP = "level_end"
+        private const val BUDGET_MILLIS = 500L
+    }
+}
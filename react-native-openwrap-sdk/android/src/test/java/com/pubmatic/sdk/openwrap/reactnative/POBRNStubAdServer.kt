@@ -0,0 +1,166 @@
+package com.pubmatic.sdk.openwrap.reactnative
+
+import com.sun.net.httpserver.HttpExchange
+import com.sun.net.httpserver.HttpServer
+import org.json.JSONArray
+import org.json.JSONObject
+import java.net.InetSocketAddress
+import java.util.concurrent.Executors
+import java.util.concurrent.ThreadLocalRandom
+import java.util.concurrent.atomic.AtomicInteger
+
+/**
+ * Local stub of the OpenWrap ad server used by the load harness. It mirrors scripts/stub-ad-server.js
+ * and answers every ad request with a canned OpenRTB bid response. Video impressions get a VAST
+ * creative whose media files, one per size of [MEDIA_SIZES], are served from /media/. The bids
+ * carry win and loss notice URLs served from [TRACKER_PATH], answered with [trackerStatus].
+ *
+ * @param latencyMs fixed delay applied to every response
+ * @param jitterMs random delay in [0, jitterMs) added on top of [latencyMs]
+ * @param noFillRate ratio in [0, 1] of requests answered with HTTP 204 (no bid)
+ * @param width creative width, the requested impression size is used when 0
+ * @param height creative height, the requested impression size is used when 0
+ * @param mediaBytes size in bytes of the served media files
+ */
+class POBRNStubAdServer(
+    private val latencyMs: Long = 0,
+    private val jitterMs: Long = 0,
+    private val noFillRate: Double = 0.0,
+    private val width: Int = 0,
+    private val height: Int = 0,
+    private val price: Double = 1.5,
+    private val mediaBytes: Int = 64 * 1024
+) {
+
+    val requests = AtomicInteger()
+    val bids = AtomicInteger()
+    val noFills = AtomicInteger()
+    val mediaRequests = AtomicInteger()
+    val trackerRequests = AtomicInteger()
+
+    /**
+     * HTTP status answered to the notice requests.
+     */
+    @Volatile
+    var trackerStatus = 200
+
+    private val server: HttpServer = HttpServer.create(InetSocketAddress("127.0.0.1", 0), 0)
+
+    /**
+     * Base url of the running server, to be set as POBRequest's ad server url.
+     */
+    val url: String
+        get() = "$baseUrl/openrtb/2.5"
+
+    private val baseUrl: String
+        get() = "http://127.0.0.1:${server.address.port}"
+
+    /**
+     * Returns the url of a notice served by the running server.
+     */
+    fun trackerUrl(name: String) = "$baseUrl$TRACKER_PATH$name"
+
+    init {
+        server.executor = Executors.newCachedThreadPool()
+        server.createContext("/") { exchange -> handle(exchange) }
+        server.createContext(MEDIA_PATH) { exchange -> handleMedia(exchange) }
+        server.createContext(TRACKER_PATH) { exchange -> handleTracker(exchange) }
+    }
+
+    fun start() {
+        server.start()
+    }
+
+    fun stop() {
+        server.stop(0)
+    }
+
+    private fun handle(exchange: HttpExchange) {
+        requests.incrementAndGet()
+        val body = exchange.requestBody.bufferedReader().use { it.readText() }
+        val request = if (body.isEmpty()) JSONObject() else JSONObject(body)
+
+        val delay = latencyMs + if (jitterMs > 0) ThreadLocalRandom.current().nextLong(jitterMs) else 0
+        if (delay > 0) {
+            Thread.sleep(delay)
+        }
+
+        if (ThreadLocalRandom.current().nextDouble() < noFillRate) {
+            noFills.incrementAndGet()
+            exchange.sendResponseHeaders(204, -1)
+            exchange.close()
+            return
+        }
+        bids.incrementAndGet()
+        val response = buildBidResponse(request).toString().toByteArray()
+        exchange.responseHeaders.add("Content-Type", "application/json")
+        exchange.sendResponseHeaders(200, response.size.toLong())
+        exchange.responseBody.use { it.write(response) }
+    }
+
+    private fun handleMedia(exchange: HttpExchange) {
+        mediaRequests.incrementAndGet()
+        exchange.responseHeaders.add("Content-Type", "video/mp4")
+        exchange.sendResponseHeaders(200, mediaBytes.toLong())
+        exchange.responseBody.use { it.write(ByteArray(mediaBytes)) }
+    }
+
+    private fun handleTracker(exchange: HttpExchange) {
+        trackerRequests.incrementAndGet()
+        exchange.sendResponseHeaders(trackerStatus, -1)
+        exchange.close()
+    }
+
+    /**
+     * Returns a VAST 3.0 inline creative with one progressive MP4 media file per size of [MEDIA_SIZES].
+     */
+    fun buildVast(): String {
+        val mediaFiles = MEDIA_SIZES.joinToString("") { (w, h) ->
+            "<MediaFile delivery=\"progressive\" type=\"video/mp4\" width=\"$w\" height=\"$h\" bitrate=\"${h * 2}\">" +
+                "<![CDATA[$baseUrl$MEDIA_PATH${w}x$h.mp4]]></MediaFile>"
+        }
+        return "<VAST version=\"3.0\"><Ad id=\"stub-video\"><InLine><AdSystem>OpenWrap stub</AdSystem>" +
+            "<AdTitle>OpenWrap stub video</AdTitle><Creatives><Creative><Linear><Duration>00:00:15</Duration>" +
+            "<MediaFiles>$mediaFiles</MediaFiles></Linear></Creative></Creatives></InLine></Ad></VAST>"
+    }
+
+    /**
+     * Builds an OpenRTB 2.5 bid response with one bid for every impression of the request.
+     */
+    fun buildBidResponse(request: JSONObject): JSONObject {
+        val imps = request.optJSONArray("imp") ?: JSONArray().put(JSONObject().put("id", "1"))
+        val bidArray = JSONArray()
+        for (i in 0 until imps.length()) {
+            val imp = imps.getJSONObject(i)
+            val video = imp.optJSONObject("video")
+            val banner = imp.optJSONObject("banner")
+            val format = banner?.optJSONArray("format")?.optJSONObject(0) ?: banner
+            val w = if (width > 0) width else video?.optInt("w", 320) ?: format?.optInt("w", 320) ?: 320
+            val h = if (height > 0) height else video?.optInt("h", 480) ?: format?.optInt("h", 50) ?: 50
+            val adm = if (video != null) buildVast() else "<div style=\"width:${w}px;height:${h}px\">OpenWrap stub ${w}x${h}</div>"
+            bidArray.put(
+                JSONObject()
+                    .put("id", "stub-bid-${System.nanoTime()}-$i")
+                    .put("impid", imp.optString("id", "1"))
+                    .put("price", price)
+                    .put("adm", adm)
+                    .put("crid", "stub-creative")
+                    .put("nurl", trackerUrl("win?price=\${AUCTION_PRICE}"))
+                    .put("lurl", trackerUrl("loss?reason=\${AUCTION_LOSS}"))
+                    .put("w", w)
+                    .put("h", h)
+                    .put("ext", JSONObject().put("crtype", if (video != null) "video" else "banner"))
+            )
+        }
+        return JSONObject()
+            .put("id", request.optString("id", "stub-response"))
+            .put("cur", "USD")
+            .put("seatbid", JSONArray().put(JSONObject().put("seat", "pubmatic").put("bid", bidArray)))
+    }
+
+    companion object {
+        const val MEDIA_PATH = "/media/"
+        const val TRACKER_PATH = "/track/"
+        val MEDIA_SIZES = listOf(480 to 270, 1280 to 720, 1920 to 1080)
+    }
+}
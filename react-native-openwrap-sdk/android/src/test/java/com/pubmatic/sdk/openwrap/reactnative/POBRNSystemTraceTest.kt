@@ -0,0 +1,39 @@
+package com.pubmatic.sdk.openwrap.reactnative
+
+import org.junit.After
+import org.junit.Assert
+import org.junit.Test
+
+class POBRNSystemTraceTest {
+
+    @After
+    fun tearDown() {
+        POBRNSystemTrace.reset()
+    }
+
+    @Test
+    fun testSectionName() {
+        Assert.assertEquals("POBRN.toJson 1 ad_unit", POBRNSystemTrace.sectionName("toJson", "1", "ad_unit"))
+        Assert.assertEquals("POBRN.parseAdUnit 2", POBRNSystemTrace.sectionName("parseAdUnit", "2", null))
+        Assert.assertEquals("POBRN.emitEvent - ad_unit", POBRNSystemTrace.sectionName("emitEvent", null, "ad_unit"))
+
+        // Long ad unit ids are truncated to the length accepted by the platform tracer.
+        val sectionName = POBRNSystemTrace.sectionName("emitEvent", "1", "a".repeat(200))
+        Assert.assertEquals(127, sectionName.length)
+    }
+
+    @Test
+    fun testSectionReturnsBlockResult() {
+        Assert.assertFalse(POBRNSystemTrace.isEnabled())
+        Assert.assertEquals(1, POBRNSystemTrace.section("toJson", "1", "ad_unit") { 1 })
+
+        POBRNSystemTrace.setEnabled(true)
+        Assert.assertEquals(2, POBRNSystemTrace.section("toJson", "1", "ad_unit") { 2 })
+        try {
+            POBRNSystemTrace.section("toJson", "1", "ad_unit") { throw IllegalStateException() }
+            Assert.fail()
+        } catch (expected: IllegalStateException) {
+            // The section is ended and the exception is rethrown.
+        }
+    }
+}
@@ -0,0 +1,73 @@
+package com.pubmatic.sdk.openwrap.reactnative
+
+import org.json.JSONObject
+import org.junit.After
+import org.junit.Assert
+import org.junit.Before
+import org.junit.Test
+
+class POBRNTracerTest {
+
+    @Before
+    fun setUp() {
+        POBRNTracer.clear()
+    }
+
+    @After
+    fun tearDown() {
+        POBRNTracer.setEnabled(false)
+        POBRNTracer.clear()
+    }
+
+    @Test
+    fun testRecordWhenDisabled() {
+        POBRNTracer.setEnabled(false)
+        POBRNTracer.record(POBRNAdFormat.INTERSTITIAL, "1", POBRNTracer.Step.LOAD)
+        Assert.assertTrue(POBRNTracer.snapshot().isEmpty())
+    }
+
+    @Test
+    fun testRecordWhenEnabled() {
+        POBRNTracer.setEnabled(true)
+        POBRNTracer.record(POBRNAdFormat.INTERSTITIAL, "1", POBRNTracer.Step.CREATE)
+        POBRNTracer.record(POBRNAdFormat.REWARDED, "2", POBRNTracer.Step.LOAD)
+
+        val entries = POBRNTracer.snapshot()
+        Assert.assertEquals(2, entries.size)
+        Assert.assertEquals(POBRNAdFormat.INTERSTITIAL, entries[0].format)
+        Assert.assertEquals("1", entries[0].instanceId)
+        Assert.assertEquals(POBRNTracer.Step.CREATE, entries[0].step)
+        Assert.assertEquals(POBRNAdFormat.REWARDED, entries[1].format)
+        Assert.assertEquals("2", entries[1].instanceId)
+        Assert.assertEquals(POBRNTracer.Step.LOAD, entries[1].step)
+        Assert.assertTrue(entries[0].sequence < entries[1].sequence)
+    }
+
+    @Test
+    fun testWrapAroundRetainsLatestEntries() {
+        POBRNTracer.setEnabled(true)
+        val total = POBRNTracer.CAPACITY + 10
+        for (i in 0 until total) {
+            POBRNTracer.record(POBRNAdFormat.BANNER, i.toString(), POBRNTracer.Step.LOAD)
+        }
+
+        val entries = POBRNTracer.snapshot()
+        Assert.assertEquals(POBRNTracer.CAPACITY, entries.size)
+        Assert.assertEquals("10", entries.first().instanceId)
+        Assert.assertEquals((total - 1).toString(), entries.last().instanceId)
+    }
+
+    @Test
+    fun testChromeTraceJson() {
+        POBRNTracer.setEnabled(true)
+        POBRNTracer.record(POBRNAdFormat.BANNER, "7", POBRNTracer.Step.AD_RECEIVED)
+
+        val trace = JSONObject(POBRNTracer.toChromeTraceJson())
+        val events = trace.getJSONArray("traceEvents")
+        val event = events.getJSONObject(0)
+        Assert.assertEquals("adReceived", event.getString("name"))
+        Assert.assertEquals("banner", event.getString("cat"))
+        Assert.assertEquals("i", event.getString("ph"))
+        Assert.assertEquals("7", event.getJSONObject("args").getString("instanceId"))
+    }
+}
@@ -0,0 +1,98 @@
+package com.pubmatic.sdk.openwrap.reactnative
+
+import android.app.ActivityManager
+import android.content.ComponentCallbacks2
+import android.os.Build
+import android.os.Looper
+import org.junit.After
+import org.junit.Assert
+import org.junit.Before
+import org.junit.Test
+import org.junit.runner.RunWith
+import org.robolectric.RobolectricTestRunner
+import org.robolectric.RuntimeEnvironment
+import org.robolectric.Shadows
+import org.robolectric.annotation.Config
+import org.robolectric.annotation.LooperMode
+
+@RunWith(RobolectricTestRunner::class)
+@Config(sdk = [Build.VERSION_CODES.P])
+// The idle handlers filling the pool only run with the paused looper.
+@LooperMode(LooperMode.Mode.PAUSED)
+class POBRNWebViewPoolTest {
+
+    @Before
+    fun setUp() {
+        POBRNWebViewPool.reset()
+    }
+
+    @After
+    fun tearDown() {
+        POBRNWebViewPool.reset()
+    }
+
+    @Test
+    fun testPrewarmFillsPoolWhenIdle() {
+        POBRNWebViewPool.maxSize = 2
+        POBRNWebViewPool.prewarm(RuntimeEnvironment.application)
+        Assert.assertEquals(0, POBRNWebViewPool.size())
+
+        idleMainLooper()
+        Assert.assertEquals(2, POBRNWebViewPool.size())
+    }
+
+    @Test
+    fun testNotFilledByDefault() {
+        POBRNWebViewPool.prewarm(RuntimeEnvironment.application)
+        idleMainLooper()
+        Assert.assertEquals(0, POBRNWebViewPool.size())
+    }
+
+    @Test
+    fun testMaxSizeBounded() {
+        POBRNWebViewPool.maxSize = 10
+        Assert.assertEquals(POBRNWebViewPool.MAX_SIZE, POBRNWebViewPool.maxSize)
+        POBRNWebViewPool.maxSize = -1
+        Assert.assertEquals(0, POBRNWebViewPool.maxSize)
+    }
+
+    @Test
+    fun testMaxSizeZeroDrainsPool() {
+        POBRNWebViewPool.maxSize = 1
+        POBRNWebViewPool.prewarm(RuntimeEnvironment.application)
+        idleMainLooper()
+        Assert.assertEquals(1, POBRNWebViewPool.size())
+
+        POBRNWebViewPool.maxSize = 0
+        idleMainLooper()
+        Assert.assertEquals(0, POBRNWebViewPool.size())
+    }
+
+    @Test
+    fun testMemoryPressureDrainsPool() {
+        POBRNWebViewPool.maxSize = 1
+        POBRNWebViewPool.prewarm(RuntimeEnvironment.application)
+        idleMainLooper()
+        Assert.assertEquals(1, POBRNWebViewPool.size())
+
+        RuntimeEnvironment.application.onTrimMemory(ComponentCallbacks2.TRIM_MEMORY_RUNNING_LOW)
+        Assert.assertEquals(0, POBRNWebViewPool.size())
+    }
+
+    @Test
+    fun testNotFilledOnLowRamDevice() {
+        POBRNWebViewPool.maxSize = 1
+        val activityManager = RuntimeEnvironment.application.getSystemService(ActivityManager::class.java)
+        Shadows.shadowOf(activityManager).setIsLowRamDevice(true)
+        POBRNWebViewPool.prewarm(RuntimeEnvironment.application)
+        idleMainLooper()
+        Assert.assertEquals(0, POBRNWebViewPool.size())
+    }
+
+    private fun idleMainLooper() {
+        // Runs the posted tasks, then the idle handlers, until the pool stops adding work.
+        repeat(POBRNWebViewPool.MAX_SIZE + 1) {
+            Shadows.shadowOf(Looper.getMainLooper()).idle()
+        }
+    }
+}
@@ -25,6 +25,7 @@ import Constants from './Constants';
 import InHouseMediationBannerScreen from './screens/in-house-mediation/InHouseMediationBannerScreen';
 import InHouseMediationInterstitialScreen from './screens/in-house-mediation/InHouseMediationInterstitialScreen';
 import InHouseMediationRewardedScreen from './screens/in-house-mediation/InHouseMediationRewardedScreen';
+import RenderBenchmarkScreen from './screens/benchmark/RenderBenchmarkScreen';
 import { Platform } from 'react-native';
 
 // Creating navigation stack.
@@ -199,6 +200,10 @@ const MainScreen = () => {
             name="In House Mediation Rewarded"
             component={InHouseMediationRewardedScreen}
           />
+          <Stack.Screen
+            name="Benchmark Render"
+            component={RenderBenchmarkScreen}
+          />
         </Stack.Navigator>
       </NavigationContainer>
     </>
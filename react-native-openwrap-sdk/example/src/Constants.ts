@@ -33,8 +33,10 @@ export default {
   ],
   // Ad formats for in house mediation i.e. Get Bid Price feature integration.
   IN_HOUSE_MEDIATION_AD_FORMATS: ['Banner', 'Interstitial', 'Rewarded'],
+  // Benchmarks of the plugin.
+  BENCHMARKS: ['Render'],
   // Integration types supported.
-  INTERGRATION_TYPE: ['Primary Ad SDK', 'In House Mediation'],
+  INTERGRATION_TYPE: ['Primary Ad SDK', 'In House Mediation', 'Benchmark'],
   BID_LOST_ERROR_MESSAGE: "Bid lost client side auction. Hence proceeding with error.",
   BID_EXPIRED_ERROR_MESSAGE: "Bid has expired.",
   BID_EXPIRY_CHECK_UNKNOWN_ERROR: "Unknown error occurred while checking bid expiry.",
@@ -25,6 +25,11 @@ const HomeScreen = () => {
     (i) => Constants.INTERGRATION_TYPE[1] + ':' + i
   );
 
+  // Creating the list of rows which benchmark the plugin.
+  const BENCHMARK_ROWS = Constants.BENCHMARKS.map(
+    (i) => Constants.INTERGRATION_TYPE[2] + ':' + i
+  );
+
   // Combined data to render the list of screens.
   const DATA = [
     {
@@ -33,6 +38,8 @@ const HomeScreen = () => {
         ...PRIMARY_ROWS,
         Constants.INTERGRATION_TYPE[1],
         ...IN_HOUSE_MEDIATION_ROWS,
+        Constants.INTERGRATION_TYPE[2],
+        ...BENCHMARK_ROWS,
       ],
     },
   ];
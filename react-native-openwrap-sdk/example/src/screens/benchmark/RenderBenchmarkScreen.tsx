@@ -0,0 +1,133 @@
+import React, { useEffect, useRef, useState } from 'react';
+import { StyleSheet, Text, View } from 'react-native';
+import { OpenWrapSDK, POBAdSize, POBBannerView } from 'react-native-openwrap-sdk';
+import Constants from '../../Constants';
+
+// Number of banners rendered in each phase.
+const CYCLES = 10;
+// Time given to the first frame after the ad is received, and to the teardown after unmount.
+const SETTLE_MS = 500;
+// Time given to the WebView pool to fill after its size is changed.
+const POOL_FILL_MS = 1000;
+// Each phase renders the banners sequentially, with the given WebView pool size.
+const PHASES = [
+  { label: 'Without WebView pool', poolSize: 0 },
+  { label: 'With WebView pool', poolSize: 1 },
+];
+
+const wait = (ms: number) => new Promise((resolve) => setTimeout(resolve, ms));
+
+/**
+ * Screen benchmarking the time to first render of a banner, i.e. the loadToFirstFrame latency,
+ * without and with the WebView pool. Every banner is unmounted before the next one loads, so
+ * each render starts without any other ad WebView alive.
+ */
+const RenderBenchmarkScreen = () => {
+  const [bannerKey, setBannerKey] = useState<number | null>(null);
+  const [status, setStatus] = useState('Starting');
+  const [results, setResults] = useState<string[]>([]);
+  // Resolves the load of the mounted banner, on ad received or failed.
+  const loadResolver = useRef<(() => void) | null>(null);
+
+  useEffect(() => {
+    let cancelled = false;
+    const run = async () => {
+      OpenWrapSDK.setLatencyInEventPayloadEnabled(false);
+      for (const phase of PHASES) {
+        OpenWrapSDK.setWebViewPoolSize(phase.poolSize);
+        OpenWrapSDK.resetLatencyStats();
+        await wait(POOL_FILL_MS);
+        for (let cycle = 1; cycle <= CYCLES && !cancelled; cycle++) {
+          setStatus(`${phase.label}: banner ${cycle}/${CYCLES}`);
+          const loaded = new Promise<void>((resolve) => {
+            loadResolver.current = resolve;
+          });
+          setBannerKey(cycle);
+          await loaded;
+          await wait(SETTLE_MS);
+          setBannerKey(null);
+          await wait(SETTLE_MS);
+        }
+        if (cancelled) {
+          return;
+        }
+        const stats = await OpenWrapSDK.getLatencyStats();
+        const firstFrame = stats.find(
+          (entry) =>
+            entry.adFormat === 'banner' &&
+            entry.adUnitId === Constants.BANNER_AD_UNIT_ID &&
+            entry.metric === 'loadToFirstFrame'
+        );
+        const result = firstFrame
+          ? `${phase.label}: p50 ${firstFrame.p50} ms, p90 ${firstFrame.p90} ms (${firstFrame.count} renders)`
+          : `${phase.label}: no render`;
+        console.log(`Render benchmark : ${result}`);
+        setResults((previous) => [...previous, result]);
+      }
+      // Restore the default pool size, i.e. the pool disabled.
+      OpenWrapSDK.setWebViewPoolSize(0);
+      setStatus('Done');
+    };
+    run();
+    return () => {
+      cancelled = true;
+      loadResolver.current?.();
+    };
+  }, []);
+
+  // Callback method notifies the end of the banner load, successful or not.
+  const _onLoadFinished = () => {
+    loadResolver.current?.();
+    loadResolver.current = null;
+  };
+
+  return (
+    <View testID="render_benchmark" style={styles.container}>
+      <Text style={styles.status}>{status}</Text>
+      {results.map((result) => (
+        <Text key={result} style={styles.result}>
+          {result}
+        </Text>
+      ))}
+      <View style={styles.slot}>
+        {bannerKey !== null && (
+          <POBBannerView
+            key={bannerKey}
+            adUnitDetails={{
+              publisherId: Constants.PUBLISHER_ID,
+              profileId: Constants.DISPLAY_PROFILE_ID,
+              adUnitId: Constants.BANNER_AD_UNIT_ID,
+              adSizes: [POBAdSize.BANNER_SIZE_320x50],
+            }}
+            onAdReceived={_onLoadFinished}
+            onAdFailed={_onLoadFinished}
+          />
+        )}
+      </View>
+    </View>
+  );
+};
+
+const styles = StyleSheet.create({
+  container: {
+    height: '100%',
+    padding: 15,
+  },
+  status: {
+    color: '#404040',
+    fontSize: 16,
+    marginBottom: 10,
+  },
+  result: {
+    color: '#404040',
+    fontSize: 15,
+    marginVertical: 2,
+  },
+  slot: {
+    marginTop: 20,
+    height: 50,
+    alignItems: 'center',
+  },
+});
+
+export default RenderBenchmarkScreen;
@@ -0,0 +1,63 @@
+#import <UIKit/UIKit.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/** A banner load waiting for its turn in @c POBRNBannerLoadScheduler. */
+@interface POBRNBannerLoadTask : NSObject
+
+/** The banner view, used to measure its visibility and velocity. */
+@property (nonatomic, readonly, weak) UIView *view;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/**
+ * @param view The banner view.
+ * @param startBlock Starts the load.
+ */
+- (instancetype)initWithView:(UIView *)view startBlock:(dispatch_block_t)startBlock;
+
+@end
+
+/**
+ * Schedules the banner loads, so that a screen mounting many banners does not start all their
+ * auctions and renderings at once.
+ *
+ * - At most @c maxConcurrentLoads loads are in flight, a load is in flight until its ad is received,
+ *   failed or the banner is destroyed, or at most 10 seconds.
+ * - Pending loads start in the order of their visibility: visible banners first, the most visible
+ *   one first, then the banners closest to the viewport, then in the order they were requested.
+ * - While the pending banners move faster than 1000 points per second, i.e. during a fast scroll or
+ *   a fling, no load is started.
+ * - While @c suspended, e.g. during a full screen ad, no load is started.
+ *
+ * The pending banners are checked on every display refresh until a load can start, so the views have
+ * been laid out and their velocity is known. All the methods are expected to be called on the main thread.
+ */
+@interface POBRNBannerLoadScheduler : NSObject
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/** Maximum number of banner loads in flight, 0 for no limit. Defaults to 2. */
+@property (class, nonatomic) NSUInteger maxConcurrentLoads;
+
+/** Defers the pending loads until set back to NO, see @c POBRNFullScreenArbiter. */
+@property (class, nonatomic, getter=isSuspended) BOOL suspended;
+
+/** Number of loads waiting for their turn. */
+@property (class, nonatomic, readonly) NSUInteger pendingTaskCount;
+
+/** Queues the load of a banner. A task already queued or in flight is not queued again. */
++ (void)enqueueTask:(POBRNBannerLoadTask *)task;
+
+/**
+ * Marks the load of the task as finished, or removes it from the queue, which frees its slot for the
+ * next pending load.
+ */
++ (void)finishTask:(POBRNBannerLoadTask *)task;
+
+/** Returns the fraction of the view visible in its window, from 0 to 1. */
++ (CGFloat)visibleFractionOfView:(UIView *)view;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,201 @@
+#import "POBRNBannerLoadScheduler.h"
+#import <QuartzCore/QuartzCore.h>
+
+static const NSUInteger POBRNDefaultMaxConcurrentLoads = 2;
+static const CGFloat POBRNFlingVelocityPointsPerSecond = 1000.0;
+static const NSTimeInterval POBRNMaxInFlightInterval = 10.0;
+
+@interface POBRNBannerLoadTask ()
+@property (nonatomic, copy) dispatch_block_t startBlock;
+@property (nonatomic) NSUInteger sequence;
+@property (nonatomic) CGPoint lastOrigin;
+@property (nonatomic) CFTimeInterval lastTimestamp;
+@end
+
+@implementation POBRNBannerLoadTask
+
+- (instancetype)initWithView:(UIView *)view startBlock:(dispatch_block_t)startBlock {
+    self = [super init];
+    if (self) {
+        _view = view;
+        _startBlock = [startBlock copy];
+    }
+    return self;
+}
+
+@end
+
+static NSUInteger maxConcurrentLoads = POBRNDefaultMaxConcurrentLoads;
+static NSMutableArray<POBRNBannerLoadTask *> *pendingTasks;
+static NSMutableSet<POBRNBannerLoadTask *> *inFlightTasks;
+static NSUInteger nextSequence = 0;
+static BOOL suspended = NO;
+static CADisplayLink *displayLink;
+
+@implementation POBRNBannerLoadScheduler
+
++ (void)initialize {
+    if (self == [POBRNBannerLoadScheduler class]) {
+        pendingTasks = [NSMutableArray new];
+        inFlightTasks = [NSMutableSet new];
+    }
+}
+
++ (NSUInteger)maxConcurrentLoads {
+    return maxConcurrentLoads;
+}
+
++ (void)setMaxConcurrentLoads:(NSUInteger)count {
+    maxConcurrentLoads = count;
+    [self updateDisplayLink];
+}
+
++ (BOOL)isSuspended {
+    return suspended;
+}
+
++ (void)setSuspended:(BOOL)isSuspended {
+    suspended = isSuspended;
+    // The velocity is measured again from the first frame once resumed.
+    for (POBRNBannerLoadTask *task in pendingTasks) {
+        task.lastTimestamp = 0;
+    }
+    [self updateDisplayLink];
+}
+
++ (NSUInteger)pendingTaskCount {
+    return pendingTasks.count;
+}
+
++ (void)enqueueTask:(POBRNBannerLoadTask *)task {
+    if ([pendingTasks containsObject:task] || [inFlightTasks containsObject:task]) {
+        return;
+    }
+    task.sequence = nextSequence++;
+    task.lastTimestamp = 0;
+    [pendingTasks addObject:task];
+    [self updateDisplayLink];
+}
+
++ (void)finishTask:(POBRNBannerLoadTask *)task {
+    [pendingTasks removeObject:task];
+    if ([inFlightTasks containsObject:task]) {
+        [inFlightTasks removeObject:task];
+        [NSObject cancelPreviousPerformRequestsWithTarget:self selector:@selector(finishTask:) object:task];
+    }
+    [self updateDisplayLink];
+}
+
++ (CGFloat)visibleFractionOfView:(UIView *)view {
+    CGFloat area = view.bounds.size.width * view.bounds.size.height;
+    if (area == 0 || view.window == nil || view.hidden || view.alpha == 0) {
+        return 0;
+    }
+    // Clip the view by its scrolling ancestors, then by the window.
+    CGRect visibleRect = [view convertRect:view.bounds toView:nil];
+    for (UIView *ancestor = view.superview; ancestor != nil; ancestor = ancestor.superview) {
+        if (ancestor.clipsToBounds || [ancestor isKindOfClass:[UIScrollView class]]) {
+            visibleRect = CGRectIntersection(visibleRect, [ancestor convertRect:ancestor.bounds toView:nil]);
+        }
+    }
+    visibleRect = CGRectIntersection(visibleRect, view.window.bounds);
+    if (CGRectIsNull(visibleRect)) {
+        return 0;
+    }
+    return (visibleRect.size.width * visibleRect.size.height) / area;
+}
+
+#pragma mark - Private methods
+
++ (BOOL)hasFreeSlot {
+    return maxConcurrentLoads == 0 || inFlightTasks.count < maxConcurrentLoads;
+}
+
+/** Runs the display link only while a pending load could start. */
++ (void)updateDisplayLink {
+    BOOL isNeeded = !suspended && pendingTasks.count > 0 && [self hasFreeSlot];
+    if (isNeeded && displayLink == nil) {
+        displayLink = [CADisplayLink displayLinkWithTarget:self selector:@selector(onFrame:)];
+        [displayLink addToRunLoop:[NSRunLoop mainRunLoop] forMode:NSRunLoopCommonModes];
+    } else if (!isNeeded && displayLink != nil) {
+        [displayLink invalidate];
+        displayLink = nil;
+    }
+}
+
++ (void)onFrame:(CADisplayLink *)link {
+    // Every pending view is sampled on each frame, so that the velocity is always measured against
+    // the previous frame.
+    BOOL isFlinging = NO;
+    for (POBRNBannerLoadTask *task in pendingTasks) {
+        isFlinging = [self sampleVelocityOfTask:task timestamp:link.timestamp] || isFlinging;
+    }
+    if (!isFlinging) {
+        [self dispatch];
+    }
+    [self updateDisplayLink];
+}
+
++ (void)dispatch {
+    while (pendingTasks.count > 0 && [self hasFreeSlot]) {
+        POBRNBannerLoadTask *task = [self nextTask];
+        [pendingTasks removeObject:task];
+        [inFlightTasks addObject:task];
+        [self performSelector:@selector(finishTask:) withObject:task afterDelay:POBRNMaxInFlightInterval];
+        task.startBlock();
+    }
+}
+
+/** Returns YES if the view of the task moved faster than the fling velocity since the last frame. */
++ (BOOL)sampleVelocityOfTask:(POBRNBannerLoadTask *)task timestamp:(CFTimeInterval)timestamp {
+    UIView *view = task.view;
+    if (view.window == nil) {
+        task.lastTimestamp = 0;
+        return NO;
+    }
+    CGPoint origin = [view convertPoint:CGPointZero toView:nil];
+    CFTimeInterval elapsed = timestamp - task.lastTimestamp;
+    BOOL isFlinging = NO;
+    if (task.lastTimestamp > 0 && elapsed > 0) {
+        CGFloat distance = hypot(origin.x - task.lastOrigin.x, origin.y - task.lastOrigin.y);
+        isFlinging = distance / elapsed > POBRNFlingVelocityPointsPerSecond;
+    }
+    task.lastOrigin = origin;
+    task.lastTimestamp = timestamp;
+    return isFlinging;
+}
+
++ (POBRNBannerLoadTask *)nextTask {
+    POBRNBannerLoadTask *bestTask = nil;
+    CGFloat bestFraction = 0;
+    CGFloat bestDistance = 0;
+    for (POBRNBannerLoadTask *task in pendingTasks) {
+        CGFloat fraction = task.view ? [self visibleFractionOfView:task.view] : 0;
+        CGFloat distance = task.view ? [self distanceToViewportOfView:task.view] : CGFLOAT_MAX;
+        // Pending tasks are in the request order, so ties keep the earliest request.
+        if (bestTask == nil || fraction > bestFraction ||
+            (fraction == bestFraction && distance < bestDistance)) {
+            bestTask = task;
+            bestFraction = fraction;
+            bestDistance = distance;
+        }
+    }
+    return bestTask;
+}
+
+/**
+ * Returns the distance in points from the view to its window bounds, or CGFLOAT_MAX if it is not in a
+ * window or not laid out yet.
+ */
++ (CGFloat)distanceToViewportOfView:(UIView *)view {
+    if (view.window == nil || CGRectIsEmpty(view.bounds)) {
+        return CGFLOAT_MAX;
+    }
+    CGRect frame = [view convertRect:view.bounds toView:nil];
+    CGRect viewport = view.window.bounds;
+    CGFloat dx = MAX(MAX(CGRectGetMinX(viewport) - CGRectGetMaxX(frame), CGRectGetMinX(frame) - CGRectGetMaxX(viewport)), 0);
+    CGFloat dy = MAX(MAX(CGRectGetMinY(viewport) - CGRectGetMaxY(frame), CGRectGetMinY(frame) - CGRectGetMaxY(viewport)), 0);
+    return dx + dy;
+}
+
+@end
@@ -0,0 +1,90 @@
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/** A banner whose refresh is coordinated by @c POBRNBannerRefreshCoordinator. */
+@protocol POBRNCoordinatedBanner <NSObject>
+
+- (void)pauseAutoRefresh;
+
+- (void)resumeAutoRefresh;
+
+/**
+ * Refreshes the banner now.
+ * @return NO if the banner could not refresh, e.g. while the user interacts with it.
+ */
+- (BOOL)refreshCoordinatedBanner;
+
+@end
+
+/**
+ * Aligns the auto refreshes of the banners on screen, so that they hit the network together instead
+ * of waking the cellular radio up once per banner and per cycle. Disabled by default.
+ *
+ * Once enabled, the SDK auto refresh of every received banner with a refresh interval is paused, and
+ * the banners are refreshed through force refresh in batches instead:
+ * - A banner is due one refresh interval after its ad was received, and may be delayed by up to a
+ *   quarter of its interval. It is never refreshed earlier than its bid allows.
+ * - A batch fires at the earliest time every banner of the batch is due, grouping the banners whose
+ *   allowed windows overlap. Banners refreshed together stay aligned.
+ *
+ * Every banner response is also recorded against a radio model, counting the requests, the radio
+ * wake ups and the radio active time, separately for the uncoordinated and coordinated modes, so that
+ * both can be compared. All the methods are expected to be called on the main thread, except the
+ * stats ones.
+ */
+@interface POBRNBannerRefreshCoordinator : NSObject
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/** Enables the coordinated refreshes. Disabling it resumes the SDK auto refresh of the coordinated banners. */
+@property (class, nonatomic, getter=isEnabled) BOOL enabled;
+
+/**
+ * Holds the batches until set back to NO, see @c POBRNFullScreenArbiter. The batches due meanwhile
+ * fire right away once resumed.
+ */
+@property (class, nonatomic, getter=isSuspended) BOOL suspended;
+
+/**
+ * Takes over the refresh of a banner whose ad was received, if enabled and the bid has a refresh interval.
+ * @param refreshInterval Refresh interval of the received bid in seconds.
+ */
++ (void)bannerDidReceiveAd:(id<POBRNCoordinatedBanner>)banner refreshInterval:(NSTimeInterval)refreshInterval;
+
+/** Retries a coordinated banner whose refresh failed, e.g. with no fill, one refresh interval later. */
++ (void)bannerDidFailToReceiveAd:(id<POBRNCoordinatedBanner>)banner;
+
+/**
+ * Pauses the refresh of a coordinated banner on the app request.
+ * @return NO if the banner is not coordinated.
+ */
++ (BOOL)pauseBanner:(id<POBRNCoordinatedBanner>)banner;
+
+/**
+ * Resumes the refresh of a coordinated banner on the app request, one refresh interval later.
+ * @return NO if the banner is not coordinated.
+ */
++ (BOOL)resumeBanner:(id<POBRNCoordinatedBanner>)banner;
+
+/** Returns YES if the refresh of the banner is coordinated. */
++ (BOOL)isCoordinatingBanner:(id<POBRNCoordinatedBanner>)banner;
+
+/** Stops coordinating the refresh of a banner. */
++ (void)removeBanner:(id<POBRNCoordinatedBanner>)banner;
+
+/** Records a banner ad response, i.e. a network request, against the radio model. */
++ (void)recordRequest;
+
+/**
+ * Returns the requests, radio wake ups, estimated radio active time and elapsed time, for the
+ * uncoordinated and coordinated modes.
+ */
++ (NSDictionary *)stats;
+
+/** Removes all the stats. */
++ (void)resetStats;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,284 @@
+#import "POBRNBannerRefreshCoordinator.h"
+#import <QuartzCore/QuartzCore.h>
+
+// Share of its refresh interval by which the refresh of a banner may be delayed.
+static const double POBRNMaxDelayFraction = 0.25;
+// Time the cellular radio stays in its high power state after a transfer, typical of LTE.
+static const NSTimeInterval POBRNRadioTailTime = 10.0;
+
+@interface POBRNRefreshEntry : NSObject
+// Weak, so that a deallocated banner is dropped on the next schedule.
+@property (nonatomic, weak) id<POBRNCoordinatedBanner> banner;
+@property (nonatomic) NSTimeInterval interval;
+@property (nonatomic) NSTimeInterval dueTime;
+@property (nonatomic) BOOL pausedByUser;
+@property (nonatomic) BOOL refreshing;
+@end
+
+@implementation POBRNRefreshEntry
+
+/** Latest time the banner may refresh. */
+- (NSTimeInterval)deadline {
+    return self.dueTime + self.interval * POBRNMaxDelayFraction;
+}
+
+@end
+
+/** Radio usage counters of one mode. */
+@interface POBRNRadioUsage : NSObject
+@property (nonatomic) NSUInteger requests;
+@property (nonatomic) NSUInteger wakeUps;
+@property (nonatomic) NSTimeInterval radioActiveTime;
+@property (nonatomic) NSTimeInterval elapsedTime;
+@end
+
+@implementation POBRNRadioUsage
+
+- (NSDictionary *)dictionary {
+    return @{
+        @"requests": @(self.requests),
+        @"wakeUps": @(self.wakeUps),
+        @"radioActiveMillis": @((long long)(self.radioActiveTime * 1000)),
+        @"elapsedMillis": @((long long)(self.elapsedTime * 1000))
+    };
+}
+
+@end
+
+static BOOL enabled = NO;
+static BOOL suspended = NO;
+static NSMutableArray<POBRNRefreshEntry *> *entries;
+static NSTimer *batchTimer;
+static POBRNRadioUsage *uncoordinated;
+static POBRNRadioUsage *coordinated;
+static NSTimeInterval radioActiveUntil = 0;
+static NSTimeInterval modeStartTime = 0;
+
+@implementation POBRNBannerRefreshCoordinator
+
++ (void)initialize {
+    if (self == [POBRNBannerRefreshCoordinator class]) {
+        entries = [NSMutableArray new];
+        uncoordinated = [POBRNRadioUsage new];
+        coordinated = [POBRNRadioUsage new];
+        modeStartTime = CACurrentMediaTime();
+    }
+}
+
++ (BOOL)isEnabled {
+    return enabled;
+}
+
++ (void)setEnabled:(BOOL)isEnabled {
+    if (enabled == isEnabled) {
+        return;
+    }
+    @synchronized (self) {
+        [self accumulateElapsedTime];
+        enabled = isEnabled;
+    }
+    if (!isEnabled) {
+        for (POBRNRefreshEntry *entry in entries) {
+            if (!entry.pausedByUser) {
+                [entry.banner resumeAutoRefresh];
+            }
+        }
+        [entries removeAllObjects];
+        [self schedule];
+    }
+}
+
++ (BOOL)isSuspended {
+    return suspended;
+}
+
++ (void)setSuspended:(BOOL)isSuspended {
+    suspended = isSuspended;
+    [self schedule];
+}
+
++ (void)bannerDidReceiveAd:(id<POBRNCoordinatedBanner>)banner refreshInterval:(NSTimeInterval)refreshInterval {
+    POBRNRefreshEntry *previous = [self entryForBanner:banner];
+    if (previous) {
+        [entries removeObject:previous];
+    }
+    if (!enabled || refreshInterval <= 0) {
+        [self schedule];
+        return;
+    }
+    POBRNRefreshEntry *entry = [POBRNRefreshEntry new];
+    entry.banner = banner;
+    entry.interval = refreshInterval;
+    entry.dueTime = CACurrentMediaTime() + refreshInterval;
+    entry.pausedByUser = previous.pausedByUser;
+    [entries addObject:entry];
+    [banner pauseAutoRefresh];
+    [self schedule];
+}
+
++ (void)bannerDidFailToReceiveAd:(id<POBRNCoordinatedBanner>)banner {
+    POBRNRefreshEntry *entry = [self entryForBanner:banner];
+    if (!entry) {
+        return;
+    }
+    entry.refreshing = NO;
+    entry.dueTime = CACurrentMediaTime() + entry.interval;
+    [self schedule];
+}
+
++ (BOOL)pauseBanner:(id<POBRNCoordinatedBanner>)banner {
+    POBRNRefreshEntry *entry = [self entryForBanner:banner];
+    if (!entry) {
+        return NO;
+    }
+    entry.pausedByUser = YES;
+    [self schedule];
+    return YES;
+}
+
++ (BOOL)resumeBanner:(id<POBRNCoordinatedBanner>)banner {
+    POBRNRefreshEntry *entry = [self entryForBanner:banner];
+    if (!entry) {
+        return NO;
+    }
+    if (entry.pausedByUser) {
+        entry.pausedByUser = NO;
+        entry.dueTime = CACurrentMediaTime() + entry.interval;
+        [self schedule];
+    }
+    return YES;
+}
+
++ (BOOL)isCoordinatingBanner:(id<POBRNCoordinatedBanner>)banner {
+    return [self entryForBanner:banner] != nil;
+}
+
++ (void)removeBanner:(id<POBRNCoordinatedBanner>)banner {
+    POBRNRefreshEntry *entry = [self entryForBanner:banner];
+    if (entry) {
+        [entries removeObject:entry];
+        [self schedule];
+    }
+}
+
++ (void)recordRequest {
+    NSTimeInterval now = CACurrentMediaTime();
+    @synchronized (self) {
+        POBRNRadioUsage *usage = enabled ? coordinated : uncoordinated;
+        usage.requests++;
+        if (now >= radioActiveUntil) {
+            // The radio was idle, it wakes up and stays active for the tail time.
+            usage.wakeUps++;
+            usage.radioActiveTime += POBRNRadioTailTime;
+        } else {
+            // The request extends the tail of the active radio.
+            usage.radioActiveTime += now + POBRNRadioTailTime - radioActiveUntil;
+        }
+        radioActiveUntil = now + POBRNRadioTailTime;
+    }
+}
+
++ (NSDictionary *)stats {
+    @synchronized (self) {
+        [self accumulateElapsedTime];
+        return @{
+            @"uncoordinated": [uncoordinated dictionary],
+            @"coordinated": [coordinated dictionary]
+        };
+    }
+}
+
++ (void)resetStats {
+    @synchronized (self) {
+        uncoordinated = [POBRNRadioUsage new];
+        coordinated = [POBRNRadioUsage new];
+        radioActiveUntil = 0;
+        modeStartTime = CACurrentMediaTime();
+    }
+}
+
+#pragma mark - Private methods
+
++ (nullable POBRNRefreshEntry *)entryForBanner:(id<POBRNCoordinatedBanner>)banner {
+    for (POBRNRefreshEntry *entry in entries) {
+        if (entry.banner == banner) {
+            return entry;
+        }
+    }
+    return nil;
+}
+
+/**
+ * Returns the banners of the next batch: starting from the banner due first, the banners are added
+ * while their allowed windows, from due time to deadline, overlap. The batch fires at the latest due
+ * time of its banners, returned through fireTime.
+ */
++ (NSArray<POBRNRefreshEntry *> *)nextBatchWithFireTime:(NSTimeInterval *)fireTime {
+    NSMutableArray<POBRNRefreshEntry *> *candidates = [NSMutableArray new];
+    for (POBRNRefreshEntry *entry in [entries copy]) {
+        if (!entry.banner) {
+            [entries removeObject:entry];
+        } else if (!entry.pausedByUser && !entry.refreshing) {
+            [candidates addObject:entry];
+        }
+    }
+    [candidates sortUsingComparator:^NSComparisonResult(POBRNRefreshEntry *entry1, POBRNRefreshEntry *entry2) {
+        return [@(entry1.dueTime) compare:@(entry2.dueTime)];
+    }];
+    NSMutableArray<POBRNRefreshEntry *> *batch = [NSMutableArray new];
+    NSTimeInterval deadline = DBL_MAX;
+    for (POBRNRefreshEntry *entry in candidates) {
+        if (entry.dueTime > deadline) {
+            break;
+        }
+        [batch addObject:entry];
+        *fireTime = entry.dueTime;
+        deadline = MIN(deadline, entry.deadline);
+    }
+    return batch;
+}
+
++ (void)schedule {
+    [batchTimer invalidate];
+    batchTimer = nil;
+    if (suspended) {
+        return;
+    }
+    NSTimeInterval fireTime = 0;
+    if ([self nextBatchWithFireTime:&fireTime].count == 0) {
+        return;
+    }
+    NSTimeInterval delay = MAX(fireTime - CACurrentMediaTime(), 0);
+    batchTimer = [NSTimer scheduledTimerWithTimeInterval:delay
+                                                  target:self
+                                                selector:@selector(fireBatch)
+                                                userInfo:nil
+                                                 repeats:NO];
+}
+
++ (void)fireBatch {
+    batchTimer = nil;
+    NSTimeInterval fireTime = 0;
+    NSTimeInterval now = CACurrentMediaTime();
+    for (POBRNRefreshEntry *entry in [self nextBatchWithFireTime:&fireTime]) {
+        if (entry.dueTime > now) {
+            continue;
+        }
+        if ([entry.banner refreshCoordinatedBanner]) {
+            // Rescheduled once the refreshed ad is received or failed.
+            entry.refreshing = YES;
+        } else {
+            entry.dueTime = now + entry.interval;
+        }
+    }
+    [self schedule];
+}
+
+/** Expected to be called while holding the lock. */
++ (void)accumulateElapsedTime {
+    NSTimeInterval now = CACurrentMediaTime();
+    (enabled ? coordinated : uncoordinated).elapsedTime += now - modeStartTime;
+    modeStartTime = now;
+}
+
+@end
@@ -21,6 +21,9 @@ NS_ASSUME_NONNULL_BEGIN
 /** An event block invoked when an error encountered while fetching the bid. */
 @property (nonatomic, copy) RCTDirectEventBlock onBidFailed;
 
+/** An event block invoked with the outcome of the native mediation rule evaluated on bid received. */
+@property (nonatomic, copy) RCTDirectEventBlock onMediationOutcome;
+
 /** An event block invoked when proceeds with bid flow is trigged. */
 @property (nonatomic, copy) RCTDirectEventBlock onProceedToLoadAd;
 
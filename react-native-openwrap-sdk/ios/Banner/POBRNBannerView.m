@@ -1,8 +1,19 @@
 #import "POBRNBannerView.h"
 #import "POBRNAdHelper.h"
+#import "POBRNBannerLoadScheduler.h"
+#import "POBRNBannerRefreshCoordinator.h"
+#import "POBRNBidLandscape.h"
 #import "POBRNConstants.h"
+#import "POBRNFullScreenArbiter.h"
+#import "POBRNGamEventHandlers.h"
+#import "POBRNLatencyTimer.h"
+#import "POBRNMediationRule.h"
+#import "POBRNRequestCoalescer.h"
+#import "POBRNSystemTrace.h"
+#import "POBRNTracer.h"
 
 #import <OpenWrapSDK/OpenWrapSDK.h>
+#import <React/RCTLog.h>
 #import <UIKit/UIKit.h>
 
 /** An enum to represent the banner auto refresh states. */
@@ -12,8 +23,54 @@ typedef NS_ENUM(NSInteger, POBRNAutoRefreshState) {
     POBRNAutoRefreshStateResume = 2,
 };
 
-@interface POBRNBannerView () <POBBannerViewDelegate, POBBidEventDelegate>
+/**
+ * A banner whose view was destroyed while its load was in flight, parked in POBRNRequestCoalescer
+ * until adopted. Records the load result meanwhile.
+ */
+@interface POBRNParkedBanner : NSObject <POBBannerViewDelegate>
 @property (nonatomic, strong) POBBannerView *bannerView;
+@property (nonatomic, strong) POBRNLatencyTimer *latencyTimer;
+@property (nonatomic, assign) BOOL received;
+@property (nonatomic, strong, nullable) NSError *error;
+@end
+
+@implementation POBRNParkedBanner
+
+- (UIViewController *)bannerViewPresentationController {
+    return [POBRNAdHelper topViewController];
+}
+
+- (void)bannerViewDidReceiveAd:(POBBannerView *)bannerView {
+    self.received = YES;
+}
+
+- (void)bannerView:(POBBannerView *)bannerView didFailToReceiveAdWithError:(NSError *)error {
+    self.error = error;
+}
+
+- (void)replayToDelegate:(id<POBBannerViewDelegate>)delegate {
+    if (self.received) {
+        [delegate bannerViewDidReceiveAd:self.bannerView];
+    } else if (self.error) {
+        [delegate bannerView:self.bannerView didFailToReceiveAdWithError:self.error];
+    }
+}
+
+@end
+
+@interface POBRNBannerView () <POBBannerViewDelegate, POBBidEventDelegate, POBRNCoordinatedBanner, POBRNArbitratedBanner>
+@property (nonatomic, strong) POBBannerView *bannerView;
+@property (nonatomic, strong) POBRNLatencyTimer *latencyTimer;
+@property (nonatomic, copy) NSString *adUnitId;
+@property (nonatomic, strong, nullable) POBRNBannerLoadTask *loadTask;
+@property (nonatomic, strong, nullable) CADisplayLink *firstVisibleLink;
+@property (nonatomic, copy, nullable) NSString *loadKey;
+@property (nonatomic, assign) BOOL loadInFlight;
+@property (nonatomic, assign) BOOL hasBidEventDelegate;
+@property (nonatomic, assign) BOOL autoRefreshPausedByApp;
+@property (nonatomic, assign) NSTimeInterval receivedTime;
+// Bid of the current auction, received through the bid event delegate.
+@property (nonatomic, strong, nullable) POBBid *pendingBid;
 @end
 
 @implementation POBRNBannerView
@@ -21,27 +78,71 @@ typedef NS_ENUM(NSInteger, POBRNAutoRefreshState) {
 - (void)loadAdWithAdUnitDetailsJSON:(NSString *)json {
     // Convert JSON string into `POBAdUnitDetails` instance.
     NSError *jsonParsingError = nil;
+    POBRN_SYSTEM_TRACE_BEGIN(parseAdUnit, self.reactTag.stringValue, nil);
     POBAdUnitDetails *bannerAdUnitDetails =
         [POBAdUnitDetails buildFromJSONString:json error:&jsonParsingError];
+    POBRN_SYSTEM_TRACE_END(parseAdUnit);
     if (jsonParsingError && bannerAdUnitDetails == nil) {
         [self sendAdUnitDetailsParsingFailedEvent:jsonParsingError];
         return;
     }
+    NSString *loadKey = [POBRNRequestCoalescer keyWithPublisherId:bannerAdUnitDetails.publisherId
+                                                        profileId:bannerAdUnitDetails.profileId
+                                                         adUnitId:bannerAdUnitDetails.adUnitId
+                                                requestParameters:json
+                                             impressionParameters:nil];
+    if ([loadKey isEqualToString:self.loadKey] && (self.loadInFlight || self.loadTask)) {
+        // The same ad is already loading in this banner.
+        [POBRNRequestCoalescer recordAvoidedAuction:POBRNAvoidedAuctionDuplicate
+                                        forAdUnitId:bannerAdUnitDetails.adUnitId];
+        return;
+    }
 
     // If the JS app undergoes a hot reload, the POBRNBannerView instance remains the same,
     // however a new POBBannerView instance get created when `loadAdWithAdUnitDetailsJSON` method is called.
     // This can lead to multiple ad views overlapping. To prevent this overlap, it is required to clear the
     // previous POBBannerView instance and remove it from the view hierarchy.
     [self cleanUpPreviousBannerView];
+    self.loadKey = loadKey;
+    self.adUnitId = bannerAdUnitDetails.adUnitId;
+    POBRNParkedBanner *parkedBanner = [POBRNRequestCoalescer adoptObjectForKey:loadKey
+                                                                      adUnitId:bannerAdUnitDetails.adUnitId];
+    if (parkedBanner) {
+        [self adoptParkedBanner:parkedBanner];
+        return;
+    }
 
     // Create banner instance.
-    self.bannerView = [[POBBannerView alloc] initWithPublisherId:bannerAdUnitDetails.publisherId
-                                                       profileId:bannerAdUnitDetails.profileId
-                                                        adUnitId:bannerAdUnitDetails.adUnitId
-                                                         adSizes:bannerAdUnitDetails.bannerSizes];
+    self.latencyTimer = [[POBRNLatencyTimer alloc] initWithAdFormat:POBRNAdFormatBanner
+                                                           adUnitId:bannerAdUnitDetails.adUnitId];
+    [self traceStep:POBRNTraceStepCreate];
+    POBRNGamConfig *gamConfig = bannerAdUnitDetails.gamConfig;
+    id<POBBannerEvent> eventHandler = nil;
+    if (gamConfig) {
+        eventHandler = [POBRNGamEventHandlers bannerEventHandlerWithConfig:gamConfig
+                                                                   adSizes:bannerAdUnitDetails.bannerSizes
+                                                              latencyTimer:self.latencyTimer];
+        if (!eventHandler) {
+            RCTLogWarn(POBRN_GAM_UNAVAILABLE_MSG, bannerAdUnitDetails.adUnitId);
+        }
+    }
+    if (eventHandler) {
+        self.bannerView = [[POBBannerView alloc] initWithPublisherId:bannerAdUnitDetails.publisherId
+                                                           profileId:bannerAdUnitDetails.profileId
+                                                            adUnitId:bannerAdUnitDetails.adUnitId
+                                                        eventHandler:eventHandler];
+    } else {
+        self.bannerView = [[POBBannerView alloc] initWithPublisherId:bannerAdUnitDetails.publisherId
+                                                           profileId:bannerAdUnitDetails.profileId
+                                                            adUnitId:bannerAdUnitDetails.adUnitId
+                                                             adSizes:bannerAdUnitDetails.bannerSizes];
+    }
 
-    // check if 'get bid price' feature is enabled then only set bid event listener.
-    if (bannerAdUnitDetails.enableGetBidPrice) {
+    // check if 'get bid price' feature is enabled or a native mediation rule is registered,
+    // then only set bid event listener.
+    self.hasBidEventDelegate = bannerAdUnitDetails.enableGetBidPrice ||
+        [POBRNMediationRule ruleForAdUnitId:bannerAdUnitDetails.adUnitId] != nil;
+    if (self.hasBidEventDelegate) {
         self.bannerView.bidEventDelegate = self;
     }
 
@@ -49,32 +150,75 @@ typedef NS_ENUM(NSInteger, POBRNAutoRefreshState) {
     self.bannerView.delegate = self;
 
     // Parse and set request and impression parameters
+    [self traceStep:POBRNTraceStepSetRequestParams];
+    // Bound the wait on OpenWrap before the GAM request, an explicit network timeout of the
+    // request parameters takes precedence.
+    if (gamConfig.owNetworkTimeout > 0) {
+        self.bannerView.request.networkTimeout = gamConfig.owNetworkTimeout;
+    }
+    POBRN_SYSTEM_TRACE_BEGIN(setRequestParams, self.reactTag.stringValue, self.adUnitId);
     [POBRNAdHelper setUpRequest:self.bannerView.request
                  withParameters:json
                andNestedParsing:YES];
+    POBRN_SYSTEM_TRACE_END(setRequestParams);
+    [self traceStep:POBRNTraceStepSetImpressionParams];
+    POBRN_SYSTEM_TRACE_BEGIN(setImpressionParams, self.reactTag.stringValue, self.adUnitId);
     [POBRNAdHelper setUpImpression:self.bannerView.impression
                     withParameters:json
                   andNestedParsing:YES];
+    POBRN_SYSTEM_TRACE_END(setImpressionParams);
+
+    // Load Ad, once the scheduler gives this banner its turn.
+    POBRNLatencyTimer *latencyTimer = self.latencyTimer;
+    POBBannerView *bannerView = self.bannerView;
+    NSString *adUnitId = bannerAdUnitDetails.adUnitId;
+    __weak typeof(self) weakSelf = self;
+    [latencyTimer markLoadRequested];
+    self.loadTask = [[POBRNBannerLoadTask alloc] initWithView:self startBlock:^{
+        [weakSelf traceStep:POBRNTraceStepLoad];
+        [latencyTimer markLoad];
+        weakSelf.loadInFlight = YES;
+        [POBRNRequestCoalescer recordAuctionForAdUnitId:adUnitId];
+        [bannerView loadAd];
+    }];
+    [POBRNBannerLoadScheduler enqueueTask:self.loadTask];
+    [self addBannerView];
+    [POBRNFullScreenArbiter registerBanner:self];
+}
 
-    // Load Ad
-    [self.bannerView loadAd];
-    self.bannerView.translatesAutoresizingMaskIntoConstraints = NO;
-    [self addSubview: self.bannerView];
-    [NSLayoutConstraint activateConstraints: @[
-        [self.bannerView.widthAnchor constraintEqualToAnchor: self.widthAnchor],
-        [self.bannerView.heightAnchor constraintEqualToAnchor: self.heightAnchor],
-        [self.bannerView.centerXAnchor constraintEqualToAnchor: self.centerXAnchor],
-        [self.bannerView.centerYAnchor constraintEqualToAnchor: self.centerYAnchor]
-    ]];
+- (void)didMoveToWindow {
+    [super didMoveToWindow];
+    // Only check the first visibility while in a window, so the display link does not keep a
+    // removed banner alive.
+    if (self.window) {
+        if (self.bannerView.bid) {
+            [self awaitFirstVisible];
+        }
+    } else {
+        [self stopFirstVisibleCheck];
+    }
+}
+
+- (void)dealloc {
+    [self finishLoadTask];
+    [self parkBannerView];
 }
 
 - (void)setAutoRefreshState:(NSNumber *)state {
     switch(state.intValue) {
+        // The coordinated banners keep the SDK auto refresh paused, the coordinator handles the state.
         case POBRNAutoRefreshStatePause:
-            [self.bannerView pauseAutoRefresh];
+            self.autoRefreshPausedByApp = YES;
+            if (![POBRNBannerRefreshCoordinator pauseBanner:self]) {
+                [self.bannerView pauseAutoRefresh];
+            }
             break;
         case POBRNAutoRefreshStateResume:
-            [self.bannerView resumeAutoRefresh];
+            self.autoRefreshPausedByApp = NO;
+            // While a full screen ad is showing, the arbiter resumes the banner once dismissed.
+            if (![POBRNBannerRefreshCoordinator resumeBanner:self] && !POBRNFullScreenArbiter.isShowing) {
+                [self.bannerView resumeAutoRefresh];
+            }
             break;
         case POBRNAutoRefreshStateDefault:
             // No action, banner stays in the last / initial default state.
@@ -86,7 +230,11 @@ typedef NS_ENUM(NSInteger, POBRNAutoRefreshState) {
     // Trigger the banner force refresh only if value is non-zero.
     // This check is added to avoid automatic first force refresh call during banner ad rendering.
     if (value.intValue != 0 && self.onForceRefresh) {
+        [self.latencyTimer markLoad];
         BOOL status = [self.bannerView forceRefresh];
+        if (!status) {
+            [self.latencyTimer markLoadFailed];
+        }
         self.onForceRefresh(@{
             POBRN_BANNER_FORCE_REFRESH_STATUS: [NSNumber numberWithBool:status]
         });
@@ -97,6 +245,7 @@ typedef NS_ENUM(NSInteger, POBRNAutoRefreshState) {
     // Trigger the proceed to load ad only if value is non-zero.
     // This check is added to avoid automatic proceed to load ad call during banner ad rendering.
     if (value.intValue != 0 && self.onProceedToLoadAd) {
+        [self traceStep:POBRNTraceStepProceedToLoad];
         BOOL proceedToLoadAdStatus = [self.bannerView proceedToLoadAd];
         self.onProceedToLoadAd(@{
             POBRN_BANNER_PROCEED_TO_LOAD_AD_STATUS: [NSNumber numberWithBool:proceedToLoadAdStatus]
@@ -116,6 +265,7 @@ typedef NS_ENUM(NSInteger, POBRNAutoRefreshState) {
             // Error code is available in the errorDetails
             bidEventErrorCode = [POBRNAdHelper bidEventErrorCodeForCode:errCode.integerValue];
         }
+        [self traceStep:POBRNTraceStepProceedOnError];
         [self.bannerView proceedOnError:bidEventErrorCode andDescription:errMsg];
     }
 }
@@ -132,14 +282,34 @@ typedef NS_ENUM(NSInteger, POBRNAutoRefreshState) {
 #pragma mark - POBBidEventDelegate
 
 - (void)bidEvent:(id<POBBidEvent>)bidEventObject didReceiveBid:(POBBid *)bid {
+    [self traceStep:POBRNTraceStepBidReceived];
+    [self.latencyTimer markBidReceived];
+    self.pendingBid = bid;
+    POBRNMediationRule *rule = [POBRNMediationRule ruleForAdUnitId:self.adUnitId];
+    if (rule) {
+        // Evaluate the registered mediation rule right away and only notify its outcome.
+        POBRNMediationOutcome *outcome = [rule applyToBidEvent:bidEventObject
+                                                           bid:bid
+                                                    waitMillis:[self.latencyTimer durationForMetric:POBRNLatencyMetricLoadToBid]];
+        [self traceStep:outcome.won ? POBRNTraceStepProceedToLoad : POBRNTraceStepProceedOnError];
+        if (self.onMediationOutcome) {
+            self.onMediationOutcome([self.latencyTimer attachToPayload:[outcome dictionaryWithBid:bid]]);
+        }
+        return;
+    }
     // Create writable map and add width, height and other bid data.
     if (self.onBidReceived) {
-        NSDictionary *bidDetails = [POBRNAdHelper bidDictionaryFromBid:self.bannerView.bid];
+        POBRN_SYSTEM_TRACE_BEGIN(bidDictionary, self.reactTag.stringValue, self.adUnitId);
+        NSDictionary *bidDetails = [self.latencyTimer attachToPayload:[POBRNAdHelper bidDictionaryFromBid:self.bannerView.bid]];
+        POBRN_SYSTEM_TRACE_END(bidDictionary);
+        POBRN_SYSTEM_TRACE_BEGIN(emitEvent, self.reactTag.stringValue, self.adUnitId);
         self.onBidReceived(bidDetails);
+        POBRN_SYSTEM_TRACE_END(emitEvent);
     }
 }
 
 - (void)bidEvent:(id<POBBidEvent>)bidEventObject didFailToReceiveBidWithError:(NSError *)error {
+    [self traceStep:POBRNTraceStepBidFailed];
     if (self.onBidFailed) {
         self.onBidFailed([POBRNAdHelper errorDictionaryFromError:error]);
     }
@@ -152,35 +322,66 @@ typedef NS_ENUM(NSInteger, POBRNAutoRefreshState) {
 }
 
 - (void)bannerViewDidReceiveAd:(POBBannerView *)bannerView {
+    [self traceStep:POBRNTraceStepAdReceived];
+    self.loadInFlight = NO;
+    [self finishLoadTask];
+    [self recordAuctionWithBid:(bannerView.bid ?: self.pendingBid) rendered:YES];
+    [self.latencyTimer markAdReceived];
+    self.receivedTime = CACurrentMediaTime();
+    [POBRNBannerRefreshCoordinator recordRequest];
+    [POBRNBannerRefreshCoordinator bannerDidReceiveAd:self refreshInterval:bannerView.bid.refreshInterval];
+    [POBRNFullScreenArbiter recordBannerResponseBytes:bannerView.bid.creativeTag.length];
+    if (POBRNFullScreenArbiter.isShowing) {
+        // Received while a full screen ad is showing, the next refresh waits until it is dismissed.
+        [self setArbitrationSuspended:YES refreshDue:NO];
+    }
+    [self awaitFirstFrame];
+    [self awaitFirstVisible];
+    POBRN_SYSTEM_TRACE_BEGIN(updateLayout, self.reactTag.stringValue, self.adUnitId);
     CGRect rect = bannerView.frame;
     CGSize size = bannerView.creativeSize.cgSize;
     rect.size = size;
     bannerView.frame = rect;
+    POBRN_SYSTEM_TRACE_END(updateLayout);
 
     if (self.onAdReceived) {
         // Create extra data dictionary
-        NSDictionary *extraData = [POBRNAdHelper bidDictionaryFromBid:bannerView.bid];
+        POBRN_SYSTEM_TRACE_BEGIN(bidDictionary, self.reactTag.stringValue, self.adUnitId);
+        NSDictionary *extraData = [self.latencyTimer attachToPayload:[POBRNAdHelper bidDictionaryFromBid:bannerView.bid]];
+        POBRN_SYSTEM_TRACE_END(bidDictionary);
+        POBRN_SYSTEM_TRACE_BEGIN(emitEvent, self.reactTag.stringValue, self.adUnitId);
         self.onAdReceived(extraData);
+        POBRN_SYSTEM_TRACE_END(emitEvent);
     }
 }
 
 - (void)bannerView:(POBBannerView *)bannerView didFailToReceiveAdWithError:(NSError *)error {
+    [self traceStep:POBRNTraceStepAdFailedToLoad];
+    self.loadInFlight = NO;
+    [self finishLoadTask];
+    [self recordAuctionWithBid:self.pendingBid rendered:NO];
+    [self.latencyTimer markLoadFailed];
+    [POBRNBannerRefreshCoordinator recordRequest];
+    [POBRNBannerRefreshCoordinator bannerDidFailToReceiveAd:self];
     [self sendFailedToReceivedAdEventWithError:error];
 }
 
 - (void)bannerViewDidClickAd:(POBBannerView *)bannerView {
+    [self traceStep:POBRNTraceStepClick];
     if (self.onAdClicked) {
         self.onAdClicked(@{});
     }
 }
 
 - (void)bannerViewWillPresentModal:(POBBannerView *)bannerView {
+    [self traceStep:POBRNTraceStepAdOpened];
     if (self.onAdOpened) {
         self.onAdOpened(@{});
     }
 }
 
 - (void)bannerViewDidDismissModal:(POBBannerView *)bannerView {
+    [self traceStep:POBRNTraceStepClose];
     if (self.onAdClosed) {
         self.onAdClosed(@{});
     }
@@ -192,14 +393,191 @@ typedef NS_ENUM(NSInteger, POBRNAutoRefreshState) {
     }
 }
 
+#pragma mark - POBRNCoordinatedBanner
+
+- (void)pauseAutoRefresh {
+    [self.bannerView pauseAutoRefresh];
+}
+
+- (void)resumeAutoRefresh {
+    [self.bannerView resumeAutoRefresh];
+}
+
+- (BOOL)refreshCoordinatedBanner {
+    if (!self.bannerView) {
+        return NO;
+    }
+    // Resumed so that the paused state does not hold the refresh back, paused again by the
+    // coordinator once the ad is received.
+    [self.bannerView resumeAutoRefresh];
+    [self.latencyTimer markLoad];
+    BOOL refreshing = [self.bannerView forceRefresh];
+    if (!refreshing) {
+        [self.bannerView pauseAutoRefresh];
+        [self.latencyTimer markLoadFailed];
+    }
+    return refreshing;
+}
+
+#pragma mark - POBRNArbitratedBanner
+
+- (NSTimeInterval)arbitratedRefreshInterval {
+    return self.bannerView.bid.refreshInterval;
+}
+
+- (NSTimeInterval)arbitratedRefreshDueTime {
+    NSTimeInterval refreshInterval = self.arbitratedRefreshInterval;
+    return refreshInterval > 0 ? self.receivedTime + refreshInterval : 0;
+}
+
+- (void)setArbitrationSuspended:(BOOL)suspended refreshDue:(BOOL)refreshDue {
+    // The banners paused by the app stay paused, the coordinator holds the coordinated ones.
+    if (!self.bannerView || self.autoRefreshPausedByApp ||
+        [POBRNBannerRefreshCoordinator isCoordinatingBanner:self]) {
+        return;
+    }
+    if (suspended) {
+        [self.bannerView pauseAutoRefresh];
+        return;
+    }
+    [self.bannerView resumeAutoRefresh];
+    if (refreshDue) {
+        [self.latencyTimer markLoad];
+        if (![self.bannerView forceRefresh]) {
+            [self.latencyTimer markLoadFailed];
+        }
+    }
+}
+
 #pragma mark - Private methods
 
+// Records the outcome of the current auction in the bid landscape log.
+- (void)recordAuctionWithBid:(nullable POBBid *)bid rendered:(BOOL)rendered {
+    self.pendingBid = nil;
+    [POBRNBidLandscape recordAdFormat:POBRNAdFormatBanner adUnitId:self.adUnitId bid:bid rendered:rendered];
+}
+
+- (void)traceStep:(POBRNTraceStep)step {
+    // The react tag is used as the trace instance id of the banner.
+    if ([POBRNTracer isEnabled]) {
+        [POBRNTracer recordStep:step adFormat:POBRNAdFormatBanner instanceId:self.reactTag.stringValue];
+    }
+}
+
+/**
+ * Measures the load to first frame latency on the next display refresh, i.e. once the layout
+ * triggered by the received ad has been committed.
+ */
+- (void)awaitFirstFrame {
+    CADisplayLink *displayLink = [CADisplayLink displayLinkWithTarget:self selector:@selector(firstFrameDisplayed:)];
+    [displayLink addToRunLoop:[NSRunLoop mainRunLoop] forMode:NSRunLoopCommonModes];
+}
+
+- (void)firstFrameDisplayed:(CADisplayLink *)displayLink {
+    // The display link retains its target, invalidate it so it fires only once.
+    [displayLink invalidate];
+    [self.latencyTimer markFirstFrame];
+}
+
+/**
+ * Measures the load request to first visible latency once the banner is visible, checking on the
+ * display refreshes until then.
+ */
+- (void)awaitFirstVisible {
+    if (!self.latencyTimer.isFirstVisiblePending || self.firstVisibleLink) {
+        return;
+    }
+    if ([POBRNBannerLoadScheduler visibleFractionOfView:self] > 0) {
+        [self.latencyTimer markFirstVisible];
+        return;
+    }
+    self.firstVisibleLink = [CADisplayLink displayLinkWithTarget:self selector:@selector(checkFirstVisible:)];
+    self.firstVisibleLink.preferredFramesPerSecond = 10;
+    [self.firstVisibleLink addToRunLoop:[NSRunLoop mainRunLoop] forMode:NSRunLoopCommonModes];
+}
+
+- (void)checkFirstVisible:(CADisplayLink *)displayLink {
+    if ([POBRNBannerLoadScheduler visibleFractionOfView:self] > 0) {
+        [self stopFirstVisibleCheck];
+        [self.latencyTimer markFirstVisible];
+    }
+}
+
+- (void)stopFirstVisibleCheck {
+    // The display link retains its target, invalidate it to release the banner.
+    [self.firstVisibleLink invalidate];
+    self.firstVisibleLink = nil;
+}
+
+/** Releases the slot of the current load in POBRNBannerLoadScheduler, or removes it from its queue. */
+- (void)finishLoadTask {
+    if (self.loadTask) {
+        [POBRNBannerLoadScheduler finishTask:self.loadTask];
+        self.loadTask = nil;
+    }
+}
+
+/** Adds the banner view, filling this view. */
+- (void)addBannerView {
+    self.bannerView.translatesAutoresizingMaskIntoConstraints = NO;
+    [self addSubview: self.bannerView];
+    [NSLayoutConstraint activateConstraints: @[
+        [self.bannerView.widthAnchor constraintEqualToAnchor: self.widthAnchor],
+        [self.bannerView.heightAnchor constraintEqualToAnchor: self.heightAnchor],
+        [self.bannerView.centerXAnchor constraintEqualToAnchor: self.centerXAnchor],
+        [self.bannerView.centerYAnchor constraintEqualToAnchor: self.centerYAnchor]
+    ]];
+}
+
+/**
+ * Takes over the banner parked by a destroyed view with the same request, replaying its load result
+ * if already received.
+ */
+- (void)adoptParkedBanner:(POBRNParkedBanner *)parkedBanner {
+    self.latencyTimer = parkedBanner.latencyTimer;
+    self.bannerView = parkedBanner.bannerView;
+    self.hasBidEventDelegate = NO;
+    self.loadInFlight = YES;
+    self.bannerView.delegate = self;
+    [self addBannerView];
+    [POBRNFullScreenArbiter registerBanner:self];
+    [parkedBanner replayToDelegate:self];
+}
+
+/**
+ * Parks the load in flight, so that a banner with the same request, e.g. after a remount, adopts it
+ * instead of starting another auction. The bid event flow waits on the JS side, so such banners are
+ * not parked.
+ */
+- (void)parkBannerView {
+    POBBannerView *bannerView = self.bannerView;
+    if (!bannerView || !self.loadKey || !self.loadInFlight || self.hasBidEventDelegate) {
+        return;
+    }
+    [bannerView removeFromSuperview];
+    POBRNParkedBanner *parkedBanner = [POBRNParkedBanner new];
+    parkedBanner.bannerView = bannerView;
+    parkedBanner.latencyTimer = self.latencyTimer;
+    bannerView.delegate = parkedBanner;
+    [POBRNRequestCoalescer parkObject:parkedBanner forKey:self.loadKey expiryBlock:^{
+        bannerView.delegate = nil;
+    }];
+}
+
 - (void)cleanUpPreviousBannerView {
+    [self finishLoadTask];
+    [self stopFirstVisibleCheck];
+    [POBRNBannerRefreshCoordinator removeBanner:self];
+    [POBRNFullScreenArbiter unregisterBanner:self];
     if (self.bannerView) {
+        [self traceStep:POBRNTraceStepDestroy];
         self.bannerView.delegate = nil;
         [self.bannerView removeFromSuperview];
         self.bannerView = nil;
     }
+    self.loadInFlight = NO;
+    self.loadKey = nil;
+    self.receivedTime = 0;
 }
 
 - (void)sendAdUnitDetailsParsingFailedEvent:(NSError *)jsonParsingError {
@@ -14,8 +14,12 @@ RCT_EXPORT_MODULE(POBRNBannerView)
     return dispatch_get_main_queue();
 }
 
+/**
+ * Returns @c NO, the manager has no custom initializer nor constants. The banner views themselves are still created
+ * on the main thread.
+ */
 + (BOOL)requiresMainQueueSetup {
-    return YES;
+    return NO;
 }
 
 - (UIView *)view {
@@ -28,6 +32,7 @@ RCT_EXPORT_VIEW_PROPERTY(onAdReceived, RCTDirectEventBlock)
 RCT_EXPORT_VIEW_PROPERTY(onAdFailedToLoad, RCTDirectEventBlock)
 RCT_EXPORT_VIEW_PROPERTY(onBidReceived, RCTDirectEventBlock)
 RCT_EXPORT_VIEW_PROPERTY(onBidFailed, RCTDirectEventBlock)
+RCT_EXPORT_VIEW_PROPERTY(onMediationOutcome, RCTDirectEventBlock)
 RCT_EXPORT_VIEW_PROPERTY(onProceedToLoadAd, RCTDirectEventBlock)
 RCT_EXPORT_VIEW_PROPERTY(onAdOpened, RCTDirectEventBlock)
 RCT_EXPORT_VIEW_PROPERTY(onAdClicked, RCTDirectEventBlock)
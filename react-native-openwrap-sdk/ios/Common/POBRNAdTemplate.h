@@ -0,0 +1,75 @@
+#import <Foundation/Foundation.h>
+#import <OpenWrapSDK/OpenWrapSDK.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/*!
+ Parsed, immutable request parameters. Registered once by id as a template, it is applied to the
+ requests of every ad referring to it by "templateId", without resending and parsing the
+ parameters per ad. Missing parameters are not applied.
+ */
+@interface POBRNRequestTemplate : NSObject
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/*!
+ @abstract Creates the template from the request parameters dictionary, every key is optional.
+ Example = {"testMode": true, "bidSummary": true, "serverUrl": "https://...", "debugEnabled": false,
+ "versionId": 3, "networkTimeout": 5}
+ */
+- (instancetype)initWithDictionary:(nullable NSDictionary *)dictionary;
+
+/*!
+ @abstract Sets the parameters of this template on the request.
+ */
+- (void)applyToRequest:(POBRequest *)request;
+
+/*!
+ @abstract Registers the template of the given id, replacing the previous one. The ads already
+ created keep the parameters they were set up with.
+ */
++ (void)registerTemplate:(POBRNRequestTemplate *)requestTemplate withId:(NSString *)templateId;
+
++ (void)unregisterTemplateWithId:(NSString *)templateId;
+
+/*!
+ @abstract Returns the template registered with the given id, if any.
+ */
++ (nullable POBRNRequestTemplate *)templateWithId:(nullable NSString *)templateId;
+
+@end
+
+/*!
+ Parsed, immutable impression parameters, see POBRNRequestTemplate. The custom params, usually the
+ largest part of the parameters, are converted once at registration.
+ */
+@interface POBRNImpressionTemplate : NSObject
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/*!
+ @abstract Creates the template from the impression parameters dictionary, every key is optional.
+ Example = {"testCreativeId": "id", "customParams": "{\"key\": [\"value\"]}", "adPosition": 1}
+ */
+- (instancetype)initWithDictionary:(nullable NSDictionary *)dictionary;
+
+/*!
+ @abstract Sets the parameters of this template on the impression.
+ */
+- (void)applyToImpression:(POBImpression *)impression;
+
+/*!
+ @abstract Registers the template of the given id, replacing the previous one.
+ */
++ (void)registerTemplate:(POBRNImpressionTemplate *)impressionTemplate withId:(NSString *)templateId;
+
++ (void)unregisterTemplateWithId:(NSString *)templateId;
+
+/*!
+ @abstract Returns the template registered with the given id, if any.
+ */
++ (nullable POBRNImpressionTemplate *)templateWithId:(nullable NSString *)templateId;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,172 @@
+#import "POBRNAdTemplate.h"
+#import "POBRNAdHelper.h"
+#import "POBRNConstants.h"
+#import <React/RCTLog.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+// Returns the value of the key if it has the given class, nil otherwise.
+static id _Nullable POBRNValueOfClass(NSDictionary *_Nullable dictionary, NSString *key, Class valueClass) {
+    id value = dictionary[key];
+    return [value isKindOfClass:valueClass] ? value : nil;
+}
+
+@interface POBRNRequestTemplate ()
+
+@property (nonatomic, nullable, strong) NSNumber *testModeEnabled;
+@property (nonatomic, nullable, strong) NSNumber *bidSummaryEnabled;
+@property (nonatomic, nullable, copy) NSString *adServerURL;
+@property (nonatomic, nullable, strong) NSNumber *debugEnabled;
+@property (nonatomic, nullable, strong) NSNumber *versionId;
+@property (nonatomic, nullable, strong) NSNumber *networkTimeout;
+
+@end
+
+@implementation POBRNRequestTemplate
+
+static NSMutableDictionary<NSString *, POBRNRequestTemplate *> *requestTemplates;
+
++ (void)initialize {
+    if (self == [POBRNRequestTemplate class]) {
+        requestTemplates = [NSMutableDictionary new];
+    }
+}
+
+- (instancetype)initWithDictionary:(nullable NSDictionary *)dictionary {
+    self = [super init];
+    if (self) {
+        _testModeEnabled = POBRNValueOfClass(dictionary, POBRN_IS_TEST_MODE_ENABLED, [NSNumber class]);
+        _bidSummaryEnabled = POBRNValueOfClass(dictionary, POBRN_IS_BID_SUMMARY_ENABLED, [NSNumber class]);
+        _adServerURL = POBRNValueOfClass(dictionary, POBRN_AD_SERVER_URL, [NSString class]);
+        _debugEnabled = POBRNValueOfClass(dictionary, POBRN_IS_DEBUG_ENABLED, [NSNumber class]);
+        _versionId = POBRNValueOfClass(dictionary, POBRN_PROFILE_VERSION_ID, [NSNumber class]);
+        _networkTimeout = POBRNValueOfClass(dictionary, POBRN_NETWORK_TIMEOUT, [NSNumber class]);
+    }
+    return self;
+}
+
+- (void)applyToRequest:(POBRequest *)request {
+    if (self.testModeEnabled != nil) {
+        request.testModeEnabled = [self.testModeEnabled boolValue];
+    }
+    if (self.bidSummaryEnabled != nil) {
+        request.bidSummaryEnabled = [self.bidSummaryEnabled boolValue];
+    }
+    if (self.adServerURL != nil) {
+        request.adServerURL = self.adServerURL;
+    }
+    if (self.debugEnabled != nil) {
+        request.debug = [self.debugEnabled boolValue];
+    }
+    if (self.versionId != nil) {
+        request.versionId = self.versionId;
+    }
+    if (self.networkTimeout != nil) {
+        request.networkTimeout = [self.networkTimeout doubleValue];
+    }
+}
+
+#pragma mark - Registry
+
++ (void)registerTemplate:(POBRNRequestTemplate *)requestTemplate withId:(NSString *)templateId {
+    @synchronized (self) {
+        requestTemplates[templateId] = requestTemplate;
+    }
+}
+
++ (void)unregisterTemplateWithId:(NSString *)templateId {
+    @synchronized (self) {
+        [requestTemplates removeObjectForKey:templateId];
+    }
+}
+
++ (nullable POBRNRequestTemplate *)templateWithId:(nullable NSString *)templateId {
+    if (templateId == nil) {
+        return nil;
+    }
+    @synchronized (self) {
+        return requestTemplates[templateId];
+    }
+}
+
+@end
+
+@interface POBRNImpressionTemplate ()
+
+@property (nonatomic, nullable, copy) NSString *testCreativeId;
+@property (nonatomic, nullable, copy) NSDictionary *customParams;
+@property (nonatomic, nullable, strong) NSNumber *adPosition;
+
+@end
+
+@implementation POBRNImpressionTemplate
+
+static NSMutableDictionary<NSString *, POBRNImpressionTemplate *> *impressionTemplates;
+
++ (void)initialize {
+    if (self == [POBRNImpressionTemplate class]) {
+        impressionTemplates = [NSMutableDictionary new];
+    }
+}
+
+- (instancetype)initWithDictionary:(nullable NSDictionary *)dictionary {
+    self = [super init];
+    if (self) {
+        _testCreativeId = POBRNValueOfClass(dictionary, POBRN_TEST_CREATIVE_ID, [NSString class]);
+        _adPosition = POBRNValueOfClass(dictionary, POBRN_AD_POSITION, [NSNumber class]);
+
+        // Convert custom parameter string into dictionary.
+        NSString *customParamsJSON = POBRNValueOfClass(dictionary, POBRN_CUSTOM_PARAMS, [NSString class]);
+        if (customParamsJSON.length > 0) {
+            NSError *parsingError = nil;
+            NSDictionary *customParams = [POBRNAdHelper convertJsonStringToJSON:customParamsJSON
+                                                                          error:&parsingError];
+            if (parsingError != nil || ![customParams isKindOfClass:[NSDictionary class]] || customParams.count == 0) {
+                RCTLogInfo(@"Ad impression custom parameters parsing failed, error: %@",
+                           parsingError.localizedDescription);
+            } else {
+                _customParams = customParams;
+            }
+        }
+    }
+    return self;
+}
+
+- (void)applyToImpression:(POBImpression *)impression {
+    if (self.testCreativeId != nil) {
+        impression.testCreativeId = self.testCreativeId;
+    }
+    if (self.customParams != nil) {
+        impression.customParams = self.customParams;
+    }
+    if (self.adPosition != nil) {
+        impression.adPosition = [self.adPosition integerValue];
+    }
+}
+
+#pragma mark - Registry
+
++ (void)registerTemplate:(POBRNImpressionTemplate *)impressionTemplate withId:(NSString *)templateId {
+    @synchronized (self) {
+        impressionTemplates[templateId] = impressionTemplate;
+    }
+}
+
++ (void)unregisterTemplateWithId:(NSString *)templateId {
+    @synchronized (self) {
+        [impressionTemplates removeObjectForKey:templateId];
+    }
+}
+
++ (nullable POBRNImpressionTemplate *)templateWithId:(nullable NSString *)templateId {
+    if (templateId == nil) {
+        return nil;
+    }
+    @synchronized (self) {
+        return impressionTemplates[templateId];
+    }
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,78 @@
+#import <Foundation/Foundation.h>
+#import <OpenWrapSDK/OpenWrapSDK.h>
+#import "POBRNConstants.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/** An enum to represent the outcome of an auction, as seen by the plugin. */
+typedef NS_ENUM(uint8_t, POBRNAuctionOutcome) {
+    /** No bid was received. */
+    POBRNAuctionOutcomeNoBid = 0,
+    /** A bid was received but not rendered, e.g. the app proceeded on error. */
+    POBRNAuctionOutcomeLost,
+    /** The bid was rendered. */
+    POBRNAuctionOutcomeWon,
+};
+
+/**
+ * Opt-in on-device log of the auction outcomes, i.e. the bid landscape, used to tune the floors.
+ * Disabled by default.
+ *
+ * Every outcome is appended as a fixed width binary row to a memory-mapped rolling file, so
+ * recording neither allocates JS objects nor performs I/O per auction. Once the file holds
+ * capacity rows, the oldest rows are overwritten. The ad unit ids, partner names and deal ids are
+ * interned in a string table of the same file. Once the table is full, it is rebuilt with the strings
+ * of the retained rows only, the strings of the overwritten rows being reclaimed. The deal ids,
+ * unbounded, may only fill 768 slots, so the ad unit ids and partner names always find room. The
+ * layout is the one of the Android plugin:
+ * - header of 32 bytes: magic "PBL1", version, row size, row capacity, string capacity, number of
+ *   rows ever written (the row of index n being at n % capacity), number of strings.
+ * - string table of 1024 slots of 64 bytes: length, UTF-8 bytes.
+ * - rows of 24 bytes: timestamp in ms, price, ad unit id, partner name and deal id string indexes
+ *   (0xFFFF if none), POBRNAdFormat, POBRNAuctionOutcome.
+ *
+ * The methods may be called from any thread.
+ */
+@interface POBRNBidLandscape : NSObject
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/**
+ * Enables or disables the recording. The rows recorded by the previous sessions are kept, unless
+ * the capacity changed.
+ * @param capacity number of rows retained by the rolling file
+ */
++ (void)setEnabled:(BOOL)enabled capacity:(NSUInteger)capacity;
+
++ (BOOL)isEnabled;
+
+/**
+ * Records the outcome of an auction of the given ad unit, once its ad is received or failed.
+ * @param bid the received bid, nil if no bid was received
+ * @param rendered whether the ad of the bid was received
+ */
++ (void)recordAdFormat:(POBRNAdFormat)adFormat
+              adUnitId:(NSString *)adUnitId
+                   bid:(nullable POBBid *)bid
+              rendered:(BOOL)rendered;
+
+/**
+ * Returns the summary of the retained rows: per partner, the number of bids and wins and the win
+ * rate; per ad unit, the number of auctions and of auctions without bid, and the bid price
+ * percentiles.
+ */
++ (NSDictionary *)summary;
+
+/**
+ * Writes the retained rows, oldest first, into a file of the same layout sized to the rows, e.g.
+ * to be uploaded.
+ * @return the path of the exported file, nil if the recording was never enabled or the export failed
+ */
++ (nullable NSString *)exportToFile;
+
+/** Removes all the recorded rows and strings. */
++ (void)clear;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,422 @@
+#import "POBRNBidLandscape.h"
+#import <React/RCTLog.h>
+#import <fcntl.h>
+#import <stdatomic.h>
+#import <string.h>
+#import <sys/mman.h>
+#import <unistd.h>
+
+static NSString *const POBRNBidLandscapeFileName = @"pobrn_bid_landscape.bin";
+static NSString *const POBRNBidLandscapeExportFileName = @"pobrn_bid_landscape_export.bin";
+// "PBL1" in little endian.
+static const uint32_t POBRNBidLandscapeMagic = 0x314C4250;
+static const uint16_t POBRNBidLandscapeVersion = 1;
+static const size_t POBRNBidLandscapeHeaderSize = 32;
+static const size_t POBRNBidLandscapeRowSize = 24;
+static const uint32_t POBRNBidLandscapeStringCapacity = 1024;
+static const size_t POBRNBidLandscapeStringSlotSize = 64;
+static const size_t POBRNBidLandscapeMaxStringBytes = POBRNBidLandscapeStringSlotSize - 1;
+// Slots the deal ids, unbounded, may fill, so the ad unit ids and partner names always find room.
+static const uint32_t POBRNBidLandscapeDealStringCapacity = 768;
+static const uint16_t POBRNBidLandscapeNoString = 0xFFFF;
+
+/** The file header, every field being little endian like the rows. */
+typedef struct {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t rowSize;
+    uint32_t capacity;
+    uint32_t stringCapacity;
+    uint64_t rowCount;
+    uint32_t stringCount;
+    uint32_t reserved;
+} POBRNBidLandscapeHeader;
+
+/** A row, packed into POBRNBidLandscapeRowSize bytes. */
+typedef struct __attribute__((packed)) {
+    int64_t timestampMillis;
+    double price;
+    uint16_t adUnit;
+    uint16_t partner;
+    uint16_t deal;
+    uint8_t adFormat;
+    uint8_t outcome;
+} POBRNBidLandscapeRow;
+
+_Static_assert(sizeof(POBRNBidLandscapeHeader) == POBRNBidLandscapeHeaderSize, "Unexpected header size");
+_Static_assert(sizeof(POBRNBidLandscapeRow) == POBRNBidLandscapeRowSize, "Unexpected row size");
+
+// The state is only accessed under the class lock, except the enabled flag.
+static atomic_bool enabled = false;
+static uint8_t *mapping = NULL;
+static size_t mappingSize = 0;
+static uint32_t capacity = 0;
+static NSMutableArray<NSString *> *strings;
+static NSMutableDictionary<NSString *, NSNumber *> *stringIndexes;
+// Row count from which the string table may be rebuilt again, see compactStrings.
+static uint64_t nextCompactionRowCount = 0;
+static NSUInteger compactionCount = 0;
+
+@implementation POBRNBidLandscape
+
++ (void)initialize {
+    if (self == [POBRNBidLandscape class]) {
+        strings = [NSMutableArray new];
+        stringIndexes = [NSMutableDictionary new];
+    }
+}
+
++ (void)setEnabled:(BOOL)isEnabled capacity:(NSUInteger)rowCapacity {
+    @synchronized (self) {
+        if (!isEnabled) {
+            atomic_store_explicit(&enabled, false, memory_order_relaxed);
+            if (mapping != NULL) {
+                msync(mapping, mappingSize, MS_ASYNC);
+            }
+            return;
+        }
+        uint32_t newCapacity = (uint32_t)MIN(MAX(rowCapacity, 1), UINT32_MAX);
+        if (mapping == NULL || capacity != newCapacity) {
+            [self openWithCapacity:newCapacity];
+        }
+        atomic_store_explicit(&enabled, mapping != NULL, memory_order_relaxed);
+    }
+}
+
++ (BOOL)isEnabled {
+    return atomic_load_explicit(&enabled, memory_order_relaxed);
+}
+
++ (void)recordAdFormat:(POBRNAdFormat)adFormat
+              adUnitId:(NSString *)adUnitId
+                   bid:(nullable POBBid *)bid
+              rendered:(BOOL)rendered {
+    if (!atomic_load_explicit(&enabled, memory_order_relaxed)) {
+        return;
+    }
+    POBRNAuctionOutcome outcome = bid == nil ? POBRNAuctionOutcomeNoBid
+                                             : (rendered ? POBRNAuctionOutcomeWon : POBRNAuctionOutcomeLost);
+    @synchronized (self) {
+        if (mapping == NULL) {
+            return;
+        }
+        POBRNBidLandscapeHeader *header = (POBRNBidLandscapeHeader *)mapping;
+        NSUInteger compactions = compactionCount;
+        uint16_t adUnit = [self intern:adUnitId limit:POBRNBidLandscapeStringCapacity];
+        uint16_t partner = [self intern:bid.partner limit:POBRNBidLandscapeStringCapacity];
+        uint16_t deal = [self intern:bid.dealId limit:POBRNBidLandscapeDealStringCapacity];
+        if (compactionCount != compactions) {
+            // The table was rebuilt, at most once per row, the first strings may have moved.
+            adUnit = [self intern:adUnitId limit:POBRNBidLandscapeStringCapacity];
+            partner = [self intern:bid.partner limit:POBRNBidLandscapeStringCapacity];
+        }
+        POBRNBidLandscapeRow *row = [self rowAtIndex:header->rowCount % capacity];
+        row->timestampMillis = (int64_t)([[NSDate date] timeIntervalSince1970] * 1000);
+        row->price = bid.price.doubleValue;
+        row->adUnit = adUnit;
+        row->partner = partner;
+        row->deal = deal;
+        row->adFormat = (uint8_t)adFormat;
+        row->outcome = outcome;
+        // The row count is published once the row is complete.
+        header->rowCount++;
+    }
+}
+
++ (NSDictionary *)summary {
+    @synchronized (self) {
+        NSMutableDictionary<NSNumber *, NSMutableArray<NSNumber *> *> *prices = [NSMutableDictionary new];
+        NSMutableArray<NSNumber *> *adUnitOrder = [NSMutableArray new];
+        NSMutableDictionary<NSNumber *, NSNumber *> *noBids = [NSMutableDictionary new];
+        NSMutableDictionary<NSNumber *, NSNumber *> *bids = [NSMutableDictionary new];
+        NSMutableDictionary<NSNumber *, NSNumber *> *wins = [NSMutableDictionary new];
+        NSMutableArray<NSNumber *> *partnerOrder = [NSMutableArray new];
+        uint64_t retained = [self retainedRowCount];
+        uint64_t rowCount = retained > 0 ? ((POBRNBidLandscapeHeader *)mapping)->rowCount : 0;
+        for (uint64_t index = rowCount - retained; index < rowCount; index++) {
+            POBRNBidLandscapeRow *row = [self rowAtIndex:index % capacity];
+            NSNumber *adUnit = @(row->adUnit);
+            if (prices[adUnit] == nil) {
+                prices[adUnit] = [NSMutableArray new];
+                [adUnitOrder addObject:adUnit];
+            }
+            if (row->outcome == POBRNAuctionOutcomeNoBid) {
+                noBids[adUnit] = @(noBids[adUnit].integerValue + 1);
+                continue;
+            }
+            [prices[adUnit] addObject:@(row->price)];
+            NSNumber *partner = @(row->partner);
+            if (bids[partner] == nil) {
+                [partnerOrder addObject:partner];
+            }
+            bids[partner] = @(bids[partner].integerValue + 1);
+            if (row->outcome == POBRNAuctionOutcomeWon) {
+                wins[partner] = @(wins[partner].integerValue + 1);
+            }
+        }
+        NSMutableArray *partners = [NSMutableArray arrayWithCapacity:partnerOrder.count];
+        for (NSNumber *partner in partnerOrder) {
+            NSInteger bidCount = bids[partner].integerValue;
+            NSInteger winCount = wins[partner].integerValue;
+            [partners addObject:@{
+                @"partnerName": [self stringAtIndex:partner.unsignedShortValue] ?: [NSNull null],
+                @"bids": @(bidCount),
+                @"wins": @(winCount),
+                @"winRate": @((double)winCount / bidCount)
+            }];
+        }
+        NSMutableArray *adUnits = [NSMutableArray arrayWithCapacity:adUnitOrder.count];
+        for (NSNumber *adUnit in adUnitOrder) {
+            NSArray<NSNumber *> *sortedPrices = [prices[adUnit] sortedArrayUsingSelector:@selector(compare:)];
+            NSInteger noBidCount = noBids[adUnit].integerValue;
+            [adUnits addObject:@{
+                @"adUnitId": [self stringAtIndex:adUnit.unsignedShortValue] ?: [NSNull null],
+                @"auctions": @(sortedPrices.count + noBidCount),
+                @"noBids": @(noBidCount),
+                @"priceP50": @([self percentile:50 ofSortedValues:sortedPrices]),
+                @"priceP90": @([self percentile:90 ofSortedValues:sortedPrices]),
+                @"priceP99": @([self percentile:99 ofSortedValues:sortedPrices])
+            }];
+        }
+        return @{ @"rows": @(retained), @"partners": partners, @"adUnits": adUnits };
+    }
+}
+
++ (nullable NSString *)exportToFile {
+    @synchronized (self) {
+        if (mapping == NULL) {
+            return nil;
+        }
+        POBRNBidLandscapeHeader *header = (POBRNBidLandscapeHeader *)mapping;
+        uint64_t retained = [self retainedRowCount];
+        size_t rowsOffset = POBRNBidLandscapeHeaderSize + POBRNBidLandscapeStringCapacity * POBRNBidLandscapeStringSlotSize;
+        NSMutableData *data = [NSMutableData dataWithLength:rowsOffset + MAX(retained, 1) * POBRNBidLandscapeRowSize];
+        uint8_t *bytes = data.mutableBytes;
+        memcpy(bytes, mapping, rowsOffset);
+        POBRNBidLandscapeHeader *exportHeader = (POBRNBidLandscapeHeader *)bytes;
+        exportHeader->capacity = (uint32_t)MAX(retained, 1);
+        exportHeader->rowCount = retained;
+        for (uint64_t index = header->rowCount - retained, row = 0; index < header->rowCount; index++, row++) {
+            memcpy(bytes + rowsOffset + row * POBRNBidLandscapeRowSize, [self rowAtIndex:index % capacity], POBRNBidLandscapeRowSize);
+        }
+        NSString *path = [[self directory] stringByAppendingPathComponent:POBRNBidLandscapeExportFileName];
+        NSError *error = nil;
+        if (![data writeToFile:path options:NSDataWritingAtomic error:&error]) {
+            RCTLogWarn(@"Unable to export the bid landscape log: %@", error.localizedDescription);
+            return nil;
+        }
+        return path;
+    }
+}
+
++ (void)clear {
+    @synchronized (self) {
+        if (mapping == NULL) {
+            return;
+        }
+        POBRNBidLandscapeHeader *header = (POBRNBidLandscapeHeader *)mapping;
+        header->rowCount = 0;
+        header->stringCount = 0;
+        nextCompactionRowCount = 0;
+        [strings removeAllObjects];
+        [stringIndexes removeAllObjects];
+    }
+}
+
+#pragma mark - Private methods
+
++ (NSString *)directory {
+    NSURL *directory = [[NSFileManager defaultManager] URLsForDirectory:NSApplicationSupportDirectory
+                                                               inDomains:NSUserDomainMask].firstObject;
+    [[NSFileManager defaultManager] createDirectoryAtURL:directory
+                             withIntermediateDirectories:YES
+                                              attributes:nil
+                                                   error:nil];
+    return directory.path;
+}
+
+/**
+ * Maps the log file, restoring its strings if it has the expected layout, otherwise the file is
+ * recreated.
+ */
++ (void)openWithCapacity:(uint32_t)newCapacity {
+    if (mapping != NULL) {
+        munmap(mapping, mappingSize);
+        mapping = NULL;
+    }
+    [strings removeAllObjects];
+    [stringIndexes removeAllObjects];
+    nextCompactionRowCount = 0;
+    capacity = newCapacity;
+    size_t size = POBRNBidLandscapeHeaderSize + POBRNBidLandscapeStringCapacity * POBRNBidLandscapeStringSlotSize
+        + (size_t)newCapacity * POBRNBidLandscapeRowSize;
+    NSString *path = [[self directory] stringByAppendingPathComponent:POBRNBidLandscapeFileName];
+    int fd = open(path.fileSystemRepresentation, O_RDWR | O_CREAT, 0600);
+    if (fd < 0) {
+        RCTLogWarn(@"Unable to map the bid landscape log: %s", strerror(errno));
+        return;
+    }
+    off_t length = lseek(fd, 0, SEEK_END);
+    if (length != (off_t)size && (ftruncate(fd, 0) != 0 || ftruncate(fd, (off_t)size) != 0)) {
+        RCTLogWarn(@"Unable to map the bid landscape log: %s", strerror(errno));
+        close(fd);
+        return;
+    }
+    void *address = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    // The mapping stays valid once the file is closed.
+    close(fd);
+    if (address == MAP_FAILED) {
+        RCTLogWarn(@"Unable to map the bid landscape log: %s", strerror(errno));
+        return;
+    }
+    mapping = address;
+    mappingSize = size;
+    POBRNBidLandscapeHeader *header = (POBRNBidLandscapeHeader *)mapping;
+    if (header->magic == POBRNBidLandscapeMagic && header->version == POBRNBidLandscapeVersion
+        && header->capacity == newCapacity) {
+        uint32_t stringCount = MIN(header->stringCount, POBRNBidLandscapeStringCapacity);
+        for (uint32_t index = 0; index < stringCount; index++) {
+            NSString *string = [self readStringAtIndex:index] ?: @"";
+            stringIndexes[string] = @(index);
+            [strings addObject:string];
+        }
+    } else {
+        memset(header, 0, POBRNBidLandscapeHeaderSize);
+        header->magic = POBRNBidLandscapeMagic;
+        header->version = POBRNBidLandscapeVersion;
+        header->rowSize = POBRNBidLandscapeRowSize;
+        header->capacity = newCapacity;
+        header->stringCapacity = POBRNBidLandscapeStringCapacity;
+    }
+}
+
++ (POBRNBidLandscapeRow *)rowAtIndex:(uint64_t)index {
+    size_t offset = POBRNBidLandscapeHeaderSize + POBRNBidLandscapeStringCapacity * POBRNBidLandscapeStringSlotSize
+        + (size_t)index * POBRNBidLandscapeRowSize;
+    return (POBRNBidLandscapeRow *)(mapping + offset);
+}
+
++ (uint64_t)retainedRowCount {
+    if (mapping == NULL) {
+        return 0;
+    }
+    return MIN(((POBRNBidLandscapeHeader *)mapping)->rowCount, (uint64_t)capacity);
+}
+
+/**
+ * Returns the index of the given string in the string table, adding it if needed. The strings
+ * longer than the slot are truncated. Returns 0xFFFF for nil, or if the table stays full once rebuilt.
+ * @param limit Number of slots the string may be added within.
+ */
++ (uint16_t)intern:(nullable NSString *)value limit:(uint32_t)limit {
+    if (value == nil) {
+        return POBRNBidLandscapeNoString;
+    }
+    NSData *data = [value dataUsingEncoding:NSUTF8StringEncoding];
+    NSUInteger length = data.length;
+    const uint8_t *bytes = data.bytes;
+    if (length > POBRNBidLandscapeMaxStringBytes) {
+        // Truncate without splitting a character.
+        length = POBRNBidLandscapeMaxStringBytes;
+        while (length > 0 && (bytes[length] & 0xC0) == 0x80) {
+            length--;
+        }
+    }
+    NSString *string = [[NSString alloc] initWithBytes:bytes length:length encoding:NSUTF8StringEncoding] ?: @"";
+    NSNumber *index = stringIndexes[string];
+    if (index != nil) {
+        return index.unsignedShortValue;
+    }
+    if (strings.count >= limit) {
+        [self compactStrings];
+        if (strings.count >= limit) {
+            return POBRNBidLandscapeNoString;
+        }
+    }
+    uint16_t newIndex = (uint16_t)strings.count;
+    [self writeBytes:bytes length:length atIndex:newIndex];
+    [strings addObject:string];
+    stringIndexes[string] = @(newIndex);
+    ((POBRNBidLandscapeHeader *)mapping)->stringCount = (uint32_t)strings.count;
+    return newIndex;
+}
+
+/**
+ * Rebuilds the string table with the strings of the retained rows, but the row about to be overwritten,
+ * and updates the rows with their new indexes. Runs at most once every capacity / 16 rows, as it scans
+ * all of them.
+ */
++ (void)compactStrings {
+    POBRNBidLandscapeHeader *header = (POBRNBidLandscapeHeader *)mapping;
+    uint64_t rowCount = header->rowCount;
+    if (rowCount < nextCompactionRowCount) {
+        return;
+    }
+    nextCompactionRowCount = rowCount + MAX(capacity / 16, 1);
+    compactionCount++;
+    uint64_t retained = [self retainedRowCount];
+    if (rowCount >= capacity) {
+        // The oldest row, overwritten by the row being recorded.
+        POBRNBidLandscapeRow *row = [self rowAtIndex:rowCount % capacity];
+        row->adUnit = POBRNBidLandscapeNoString;
+        row->partner = POBRNBidLandscapeNoString;
+        row->deal = POBRNBidLandscapeNoString;
+    }
+    NSMutableArray<NSString *> *kept = [NSMutableArray new];
+    NSMutableDictionary<NSNumber *, NSNumber *> *newIndexes = [NSMutableDictionary new];
+    uint16_t (^remap)(uint16_t) = ^uint16_t(uint16_t index) {
+        if (index >= strings.count) {
+            return POBRNBidLandscapeNoString;
+        }
+        NSNumber *newIndex = newIndexes[@(index)];
+        if (newIndex == nil) {
+            newIndex = @(kept.count);
+            newIndexes[@(index)] = newIndex;
+            [kept addObject:strings[index]];
+        }
+        return newIndex.unsignedShortValue;
+    };
+    for (uint64_t index = rowCount - retained; index < rowCount; index++) {
+        POBRNBidLandscapeRow *row = [self rowAtIndex:index % capacity];
+        row->adUnit = remap(row->adUnit);
+        row->partner = remap(row->partner);
+        row->deal = remap(row->deal);
+    }
+    [strings removeAllObjects];
+    [stringIndexes removeAllObjects];
+    [kept enumerateObjectsUsingBlock:^(NSString *string, NSUInteger index, BOOL *stop) {
+        NSData *data = [string dataUsingEncoding:NSUTF8StringEncoding];
+        [self writeBytes:data.bytes length:data.length atIndex:(uint16_t)index];
+        [strings addObject:string];
+        stringIndexes[string] = @(index);
+    }];
+    header->stringCount = (uint32_t)strings.count;
+}
+
++ (void)writeBytes:(const void *)bytes length:(NSUInteger)length atIndex:(uint16_t)index {
+    uint8_t *slot = mapping + POBRNBidLandscapeHeaderSize + index * POBRNBidLandscapeStringSlotSize;
+    slot[0] = (uint8_t)length;
+    memcpy(slot + 1, bytes, length);
+}
+
++ (nullable NSString *)readStringAtIndex:(uint32_t)index {
+    const uint8_t *slot = mapping + POBRNBidLandscapeHeaderSize + index * POBRNBidLandscapeStringSlotSize;
+    NSUInteger length = MIN(slot[0], POBRNBidLandscapeMaxStringBytes);
+    return [[NSString alloc] initWithBytes:slot + 1 length:length encoding:NSUTF8StringEncoding];
+}
+
++ (nullable NSString *)stringAtIndex:(uint16_t)index {
+    return index < strings.count ? strings[index] : nil;
+}
+
+/** Nearest rank percentile of the sorted values, 0 if empty. */
++ (double)percentile:(double)percentile ofSortedValues:(NSArray<NSNumber *> *)sortedValues {
+    if (sortedValues.count == 0) {
+        return 0;
+    }
+    NSUInteger rank = (NSUInteger)ceil(percentile / 100.0 * sortedValues.count);
+    rank = MIN(MAX(rank, 1), sortedValues.count);
+    return sortedValues[rank - 1].doubleValue;
+}
+
+@end
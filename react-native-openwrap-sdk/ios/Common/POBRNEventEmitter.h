@@ -2,6 +2,7 @@
 #import <React/RCTEventEmitter.h>
 #import <OpenWrapSDK/OpenWrapSDK.h>
 #import "POBRNConstants.h"
+#import "POBRNEventSchema.h"
 
 NS_ASSUME_NONNULL_BEGIN
 
@@ -26,24 +27,25 @@ NS_ASSUME_NONNULL_BEGIN
 /**
  * Emits a global event with given event payload details.
  *
- * @param embeddedEventName The event name should be included in the global event's payload data.
+ * @param event The id of the event to be included in the global event's payload data.
  * @param instanceId The unique identifier of the instance for which event will be emitted.
  * @param error The optional error details to be added in the eveny payload.
  */
-- (void)emitEventWithEmbeddedEventName:(NSString *)embeddedEventName
-                            instanceId:(NSString *)instanceId
-                                 error:(nullable NSError *)error;
+- (void)emitEvent:(POBRNEvent)event
+       instanceId:(NSString *)instanceId
+            error:(nullable NSError *)error;
 
 /**
- * Emits a global event with given event payload details.
+ * Emits a global event with given event payload details. The payload is sent with the compact keys of
+ * POBRNEventSchema.h, the top level keys of the given payload being replaced by their codes.
  *
- * @param eventName The event name should be included in the global event's payload data.
+ * @param event The id of the event to be included in the global event's payload data.
  * @param instanceId The unique identifier of the instance for which event will be emitted.
  * @param payload Generic payload as NSDictionary
  */
-- (void)emitEventWithEmbeddedEventName:(NSString *)eventName
-                            instanceId:(NSString *)instanceId
-                            andPayload:(nullable NSDictionary *)payload;
+- (void)emitEvent:(POBRNEvent)event
+       instanceId:(NSString *)instanceId
+       andPayload:(nullable NSDictionary *)payload;
 
 @end
 
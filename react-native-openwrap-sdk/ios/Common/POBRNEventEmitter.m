@@ -1,6 +1,7 @@
 #import "POBRNEventEmitter.h"
 #import "POBRNConstants.h"
 #import "POBRNAdHelper.h"
+#import "POBRNSystemTrace.h"
 #import <React/RCTLog.h>
 
 @implementation POBRNEventEmitter {
@@ -37,11 +38,12 @@
 }
 
 /**
- * Returns @c YES if the RCTBridge module has custom initializers or exported constants, otherwise @c NO.
- * NOTE: The subclass should override this property incase of setting a different value.
+ * Returns @c NO, the initializer only keeps the event name and no constants are exported. The module is then
+ * created lazily off the main thread, the first time JS uses it, instead of on the main thread at launch.
+ * NOTE: The subclass should override this property if it adds an initializer or constants needing UIKit.
  */
 + (BOOL)requiresMainQueueSetup {
-    return YES;
+    return NO;
 }
 
 /** Returns a list of events this module can emit. */
@@ -61,26 +63,30 @@
 
 #pragma mark - Public methods
 
-- (void)emitEventWithEmbeddedEventName:(NSString *)eventName
-                            instanceId:(NSString *)instanceId
-                                 error:(nullable NSError *)error {
+- (void)emitEvent:(POBRNEvent)event
+       instanceId:(NSString *)instanceId
+            error:(nullable NSError *)error {
     NSDictionary *errorDetails = [POBRNAdHelper errorDictionaryFromError:error];
-    [self emitEventWithEmbeddedEventName:eventName
-                              instanceId:instanceId
-                              andPayload:errorDetails];
+    [self emitEvent:event
+         instanceId:instanceId
+         andPayload:errorDetails];
 }
 
-- (void)emitEventWithEmbeddedEventName:(NSString *)eventName
-                            instanceId:(NSString *)instanceId
-                            andPayload:(NSDictionary *)payload {
+- (void)emitEvent:(POBRNEvent)event
+       instanceId:(NSString *)instanceId
+       andPayload:(NSDictionary *)payload {
+    // The emitter is shared by the ad instances, the ad unit id is not known here.
+    POBRN_SYSTEM_TRACE_BEGIN(emitEvent, instanceId, nil);
     NSMutableDictionary *dict = [NSMutableDictionary dictionary];
 
-    // 1. Add event name
-    dict[POBRN_EVENT_NAME_KEY] = eventName;
+    // 1. Add event id
+    dict[POBRN_EVENT_KEY_EVENT] = @(event);
     // 2. Add instance id
-    dict[POBRN_AD_INSTANCE_ID] = instanceId;
-    // 3. Add extra data if available
-    [POBRNAdHelper setObjectSafely:payload forKey:POBRN_EVENT_PAYLOAD_EXTRA_KEY intoDictionary:dict];
+    dict[POBRN_EVENT_KEY_INSTANCE_ID] = instanceId;
+    // 3. Add extra data if available, with the compact keys
+    [POBRNAdHelper setObjectSafely:[POBRNEventEmitter compactPayload:payload]
+                            forKey:POBRN_EVENT_KEY_EXT
+                    intoDictionary:dict];
 
     // Convert payload to JSON string.
     NSError *error = nil;
@@ -92,6 +98,7 @@
 
     // Emit event with the payload as a string
     [self emitEventWithEventBody:extraParams];
+    POBRN_SYSTEM_TRACE_END(emitEvent);
 }
 
 #pragma mark - Private methods
@@ -107,6 +114,23 @@
     }
 }
 
+/** Returns the payload with its top level keys replaced by their codes, the unknown keys are kept as is. */
++ (nullable NSDictionary *)compactPayload:(nullable NSDictionary *)payload {
+    if (!payload) {
+        return nil;
+    }
+    static NSDictionary<NSString *, NSString *> *keyCodes;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        keyCodes = POBRN_EVENT_KEY_CODES;
+    });
+    NSMutableDictionary *compactPayload = [NSMutableDictionary dictionaryWithCapacity:payload.count];
+    [payload enumerateKeysAndObjectsUsingBlock:^(id key, id value, BOOL *stop) {
+        compactPayload[keyCodes[key] ?: key] = value;
+    }];
+    return compactPayload;
+}
+
 - (NSArray<NSString *> *)eventNames {
     // Keep the supported full screen ad event names mapped with ad type.
     // When adding a new ad type, make sure to add its equivalent string entry here.
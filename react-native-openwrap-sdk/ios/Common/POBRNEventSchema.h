@@ -0,0 +1,75 @@
+// Generated by scripts/generate-event-schema.js from scripts/event-schema.json, do not edit.
+#ifndef POBRNEventSchema_h
+#define POBRNEventSchema_h
+
+#import <Foundation/Foundation.h>
+
+/**
+ * Ids of the full screen ad events, shared with the Android and JS layers. An event is emitted as
+ * {"i": instanceId, "e": event id, "x": ext}, the top level keys of the ext being replaced by their codes.
+ */
+typedef NS_ENUM(NSInteger, POBRNEvent) {
+    /** The ad is received. */
+    POBRNEventAdReceived = 0,
+    /** The ad failed to load. */
+    POBRNEventAdFailedToLoad = 1,
+    /** The ad failed to show. */
+    POBRNEventAdFailedToShow = 2,
+    /** The ad is clicked. */
+    POBRNEventAdClicked = 3,
+    /** The ad is presented in full screen. */
+    POBRNEventAdOpened = 4,
+    /** The ad is dismissed. */
+    POBRNEventAdClosed = 5,
+    /** The received ad expired. */
+    POBRNEventAdExpired = 6,
+    /** The app goes to the background after a click. */
+    POBRNEventAppLeaving = 7,
+    /** The user earned the reward of a rewarded ad. */
+    POBRNEventReceiveReward = 8,
+    /** The video of the ad played until its end. */
+    POBRNEventVideoPlaybackCompleted = 9,
+    /** The OpenWrap bid is received, waiting for proceedToLoadAd or proceedOnError. */
+    POBRNEventBidReceived = 10,
+    /** No OpenWrap bid is received. */
+    POBRNEventBidFailed = 11,
+    /** The native mediation rule decided on the OpenWrap bid. */
+    POBRNEventMediationOutcome = 12,
+};
+
+#define POBRN_EVENT_COUNT 13
+
+// Event payload envelope keys
+#define POBRN_EVENT_KEY_INSTANCE_ID @"i"
+#define POBRN_EVENT_KEY_EVENT @"e"
+#define POBRN_EVENT_KEY_EXT @"x"
+
+// Codes of the ext keys, by key name
+#define POBRN_EVENT_KEY_CODES @{ \
+    @"errorCode": @"c", \
+    @"errorMessage": @"m", \
+    @"price": @"p", \
+    @"grossPrice": @"g", \
+    @"targeting": @"t", \
+    @"width": @"w", \
+    @"height": @"h", \
+    @"crType": @"ct", \
+    @"partnerName": @"pn", \
+    @"bidId": @"b", \
+    @"impressionId": @"im", \
+    @"bundle": @"bu", \
+    @"status": @"s", \
+    @"creativeId": @"ci", \
+    @"nurl": @"nu", \
+    @"lurl": @"lu", \
+    @"creative": @"cr", \
+    @"dealId": @"d", \
+    @"refreshInterval": @"ri", \
+    @"rewardAmount": @"ra", \
+    @"rewardCurrencyType": @"rc", \
+    @"latency": @"l", \
+    @"won": @"wo", \
+    @"reason": @"r" \
+}
+
+#endif /* POBRNEventSchema_h */
@@ -20,6 +20,18 @@ NS_ASSUME_NONNULL_BEGIN
 /** Returns a boolean value which indicates if ad instance if present in map for the given instance id. */
 + (BOOL)contains:(NSString *)instanceId;
 
+/** Adds the given instance id to a show group, see @c POBRNShowFallback. */
++ (void)addInstanceId:(NSString *)instanceId toGroup:(NSString *)group;
+
+/** Removes the given instance id from a show group. */
++ (void)removeInstanceId:(NSString *)instanceId fromGroup:(NSString *)group;
+
+/** Returns the instance ids of a show group, in the order they were added. */
++ (NSArray<NSString *> *)instanceIdsInGroup:(NSString *)group;
+
+/** Returns the show groups containing the given instance id. */
++ (NSArray<NSString *> *)groupsOfInstanceId:(NSString *)instanceId;
+
 @end
 
 NS_ASSUME_NONNULL_END
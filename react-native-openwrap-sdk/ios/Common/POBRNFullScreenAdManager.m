@@ -13,6 +13,9 @@
 + (void)removeForInstanceId:(NSString *)instanceId {
     if (instanceId.length > 0) {
         [[self adInstanceDict] removeObjectForKey:instanceId];
+        for (NSString *group in [self groupsOfInstanceId:instanceId]) {
+            [self removeInstanceId:instanceId fromGroup:group];
+        }
     }
 }
 
@@ -27,6 +30,39 @@
     return [self adForInstanceId:instanceId] != nil;
 }
 
++ (void)addInstanceId:(NSString *)instanceId toGroup:(NSString *)group {
+    if (instanceId.length > 0 && group.length > 0) {
+        NSMutableOrderedSet<NSString *> *instanceIds = [self groupDict][group];
+        if (!instanceIds) {
+            instanceIds = [NSMutableOrderedSet orderedSet];
+            [self groupDict][group] = instanceIds;
+        }
+        [instanceIds addObject:instanceId];
+    }
+}
+
++ (void)removeInstanceId:(NSString *)instanceId fromGroup:(NSString *)group {
+    NSMutableOrderedSet<NSString *> *instanceIds = [self groupDict][group];
+    [instanceIds removeObject:instanceId];
+    if (instanceIds && instanceIds.count == 0) {
+        [[self groupDict] removeObjectForKey:group];
+    }
+}
+
++ (NSArray<NSString *> *)instanceIdsInGroup:(NSString *)group {
+    return [self groupDict][group].array ?: @[];
+}
+
++ (NSArray<NSString *> *)groupsOfInstanceId:(NSString *)instanceId {
+    NSMutableArray<NSString *> *groups = [NSMutableArray array];
+    [[self groupDict] enumerateKeysAndObjectsUsingBlock:^(NSString *group, NSMutableOrderedSet<NSString *> *instanceIds, BOOL *stop) {
+        if ([instanceIds containsObject:instanceId]) {
+            [groups addObject:group];
+        }
+    }];
+    return groups;
+}
+
 #pragma mark - Private methods
 
 + (NSMutableDictionary<NSString *, id<POBRNFullScreenAd>> *)adInstanceDict {
@@ -39,4 +75,14 @@
     return _adInstanceDict;
 }
 
+// Instance ids of the ads of each show group, in the order they were added.
++ (NSMutableDictionary<NSString *, NSMutableOrderedSet<NSString *> *> *)groupDict {
+    static NSMutableDictionary<NSString *, NSMutableOrderedSet<NSString *> *> *_groupDict = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        _groupDict = [NSMutableDictionary dictionary];
+    });
+    return _groupDict;
+}
+
 @end
@@ -0,0 +1,76 @@
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/** A banner paused by @c POBRNFullScreenArbiter while a full screen ad is showing. */
+@protocol POBRNArbitratedBanner <NSObject>
+
+/** Refresh interval of the current bid in seconds, 0 if the banner does not refresh. */
+@property (nonatomic, readonly) NSTimeInterval arbitratedRefreshInterval;
+
+/** Media time at which the current bid is due for refresh, 0 if the banner does not refresh. */
+@property (nonatomic, readonly) NSTimeInterval arbitratedRefreshDueTime;
+
+/**
+ * Pauses or resumes the banner.
+ * @param suspended NO once the full screen ads are closed.
+ * @param refreshDue YES if the refresh of the banner fell due during the show.
+ */
+- (void)setArbitrationSuspended:(BOOL)suspended refreshDue:(BOOL)refreshDue;
+
+@end
+
+/**
+ * Gives the full screen ads priority over the banners: from the first interstitial or rewarded ad
+ * presented until the last one is dismissed or destroyed, the banners do not compete with it for the
+ * bandwidth and the CPU.
+ *
+ * - The auto refresh of every banner is paused, including the coordinated refreshes of
+ *   @c POBRNBannerRefreshCoordinator, and the banner loads queued in @c POBRNBannerLoadScheduler
+ *   are deferred.
+ * - Once dismissed, the refreshes and the loads resume. The banners whose refresh fell due during the
+ *   show refresh right away.
+ *
+ * The stats estimate the bandwidth freed: the refreshes suppressed and the loads deferred during the
+ * shows, times the average size of the banner responses. The creative assets are not counted, so it
+ * is a lower bound. All the methods are expected to be called on the main thread, except the stats ones.
+ */
+@interface POBRNFullScreenArbiter : NSObject
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/** YES while a full screen ad is showing. */
+@property (class, nonatomic, readonly, getter=isShowing) BOOL showing;
+
+/** Registers a banner, paused right away if a full screen ad is showing. The banner is held weakly. */
++ (void)registerBanner:(id<POBRNArbitratedBanner>)banner;
+
++ (void)unregisterBanner:(id<POBRNArbitratedBanner>)banner;
+
+/**
+ * Pauses the banners when the first full screen ad is presented.
+ * @param instanceId The full screen ad instance.
+ */
++ (void)fullScreenAdDidPresent:(NSString *)instanceId;
+
+/**
+ * Resumes the banners when the last full screen ad is dismissed, failed to show or destroyed.
+ * @param instanceId The full screen ad instance.
+ */
++ (void)fullScreenAdDidDismiss:(NSString *)instanceId;
+
+/** Records the size of a banner response, averaged to estimate the bandwidth freed. */
++ (void)recordBannerResponseBytes:(NSUInteger)bytes;
+
+/**
+ * Returns the number of shows, their duration, the banners paused, the refreshes suppressed, the loads
+ * deferred, the banners refreshed on dismiss and the estimated bytes freed.
+ */
++ (NSDictionary *)stats;
+
+/** Removes all the stats. */
++ (void)resetStats;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,144 @@
+#import "POBRNFullScreenArbiter.h"
+#import "POBRNBannerLoadScheduler.h"
+#import "POBRNBannerRefreshCoordinator.h"
+#import <QuartzCore/QuartzCore.h>
+
+static NSHashTable<id<POBRNArbitratedBanner>> *banners;
+static NSMutableSet<NSString *> *showingAds;
+static NSTimeInterval showStartTime = 0;
+static NSMutableDictionary<NSString *, NSNumber *> *counters;
+
+@implementation POBRNFullScreenArbiter
+
++ (void)initialize {
+    if (self == [POBRNFullScreenArbiter class]) {
+        banners = [NSHashTable weakObjectsHashTable];
+        showingAds = [NSMutableSet new];
+        counters = [NSMutableDictionary new];
+    }
+}
+
++ (BOOL)isShowing {
+    return showingAds.count > 0;
+}
+
++ (void)registerBanner:(id<POBRNArbitratedBanner>)banner {
+    if ([banners containsObject:banner]) {
+        return;
+    }
+    [banners addObject:banner];
+    if ([self isShowing]) {
+        [banner setArbitrationSuspended:YES refreshDue:NO];
+    }
+}
+
++ (void)unregisterBanner:(id<POBRNArbitratedBanner>)banner {
+    [banners removeObject:banner];
+}
+
++ (void)fullScreenAdDidPresent:(NSString *)instanceId {
+    if ([showingAds containsObject:instanceId]) {
+        return;
+    }
+    [showingAds addObject:instanceId];
+    if (showingAds.count > 1) {
+        return;
+    }
+    showStartTime = CACurrentMediaTime();
+    POBRNBannerLoadScheduler.suspended = YES;
+    POBRNBannerRefreshCoordinator.suspended = YES;
+    NSArray<id<POBRNArbitratedBanner>> *suspendedBanners = banners.allObjects;
+    for (id<POBRNArbitratedBanner> banner in suspendedBanners) {
+        [banner setArbitrationSuspended:YES refreshDue:NO];
+    }
+    [self addCounts:@{ @"shows": @1, @"suspendedBanners": @(suspendedBanners.count) }];
+}
+
++ (void)fullScreenAdDidDismiss:(NSString *)instanceId {
+    if (![showingAds containsObject:instanceId]) {
+        return;
+    }
+    [showingAds removeObject:instanceId];
+    if (showingAds.count > 0) {
+        return;
+    }
+    NSTimeInterval now = CACurrentMediaTime();
+    unsigned long long suppressedRefreshes = 0;
+    NSUInteger caughtUpBanners = 0;
+    // Copied, resuming may refresh a banner which registers again.
+    for (id<POBRNArbitratedBanner> banner in banners.allObjects) {
+        NSTimeInterval dueTime = banner.arbitratedRefreshDueTime;
+        BOOL refreshDue = dueTime > 0 && dueTime <= now;
+        if (refreshDue) {
+            suppressedRefreshes += [self suppressedRefreshesWithDueTime:dueTime
+                                                               interval:banner.arbitratedRefreshInterval
+                                                                endTime:now];
+            caughtUpBanners++;
+        }
+        [banner setArbitrationSuspended:NO refreshDue:refreshDue];
+    }
+    NSUInteger deferredLoads = POBRNBannerLoadScheduler.pendingTaskCount;
+    POBRNBannerRefreshCoordinator.suspended = NO;
+    POBRNBannerLoadScheduler.suspended = NO;
+    [self addCounts:@{
+        @"showMillis": @((long long)((now - showStartTime) * 1000)),
+        @"suppressedRefreshes": @(suppressedRefreshes),
+        @"caughtUpBanners": @(caughtUpBanners),
+        @"deferredLoads": @(deferredLoads)
+    }];
+}
+
++ (void)recordBannerResponseBytes:(NSUInteger)bytes {
+    [self addCounts:@{ @"responses": @1, @"responseBytes": @(bytes) }];
+}
+
++ (NSDictionary *)stats {
+    @synchronized (self) {
+        unsigned long long responses = counters[@"responses"].unsignedLongLongValue;
+        unsigned long long averageResponseBytes = responses == 0 ? 0 : counters[@"responseBytes"].unsignedLongLongValue / responses;
+        unsigned long long heldBack = counters[@"suppressedRefreshes"].unsignedLongLongValue +
+            counters[@"deferredLoads"].unsignedLongLongValue;
+        return @{
+            @"shows": counters[@"shows"] ?: @0,
+            @"showMillis": counters[@"showMillis"] ?: @0,
+            @"suspendedBanners": counters[@"suspendedBanners"] ?: @0,
+            @"suppressedRefreshes": counters[@"suppressedRefreshes"] ?: @0,
+            @"deferredLoads": counters[@"deferredLoads"] ?: @0,
+            @"caughtUpBanners": counters[@"caughtUpBanners"] ?: @0,
+            @"averageResponseBytes": @(averageResponseBytes),
+            @"estimatedBytesFreed": @(heldBack * averageResponseBytes)
+        };
+    }
+}
+
++ (void)resetStats {
+    @synchronized (self) {
+        [counters removeAllObjects];
+    }
+}
+
+#pragma mark - Private methods
+
+/** Returns the number of refreshes, every interval from the due time on, which fell within the show. */
++ (unsigned long long)suppressedRefreshesWithDueTime:(NSTimeInterval)dueTime
+                                            interval:(NSTimeInterval)interval
+                                             endTime:(NSTimeInterval)endTime {
+    if (interval <= 0 || dueTime > endTime) {
+        return 0;
+    }
+    NSTimeInterval firstTime = dueTime;
+    if (dueTime < showStartTime) {
+        firstTime += ceil((showStartTime - dueTime) / interval) * interval;
+    }
+    return firstTime > endTime ? 0 : 1 + (unsigned long long)floor((endTime - firstTime) / interval);
+}
+
++ (void)addCounts:(NSDictionary<NSString *, NSNumber *> *)counts {
+    @synchronized (self) {
+        [counts enumerateKeysAndObjectsUsingBlock:^(NSString *key, NSNumber *count, BOOL *stop) {
+            counters[key] = @(counters[key].unsignedLongLongValue + count.unsignedLongLongValue);
+        }];
+    }
+}
+
+@end
@@ -0,0 +1,36 @@
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * Log-linear latency histogram in the spirit of HdrHistogram. Values are recorded in microseconds,
+ * values below 128 are counted exactly and every power of two range above it is split into 64
+ * linear sub buckets, which bounds the relative error of any reported value to 1/64 (~1.6%) while
+ * keeping the footprint fixed regardless of the recorded values.
+ *
+ * The class is not thread safe, callers are expected to synchronize access.
+ */
+@interface POBRNLatencyHistogram : NSObject
+
+/** Total number of recorded values. */
+@property (nonatomic, readonly) uint64_t count;
+
+/** Highest recorded value in microseconds. */
+@property (nonatomic, readonly) uint64_t max;
+
+/** Records a single value in microseconds. Values above ~35 minutes are clamped. */
+- (void)recordValue:(uint64_t)valueMicros;
+
+/**
+ * Returns the value at the given percentile in microseconds, i.e. the highest value equivalent to
+ * the bucket holding the requested rank, capped by the highest recorded value.
+ * Returns 0 if nothing has been recorded.
+ */
+- (uint64_t)valueAtPercentile:(double)percentile;
+
+/** Removes all the recorded values. */
+- (void)reset;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,64 @@
+#import "POBRNLatencyHistogram.h"
+
+#define POBRN_SUB_BUCKET_BITS   7
+#define POBRN_SUB_BUCKET_COUNT  (1 << POBRN_SUB_BUCKET_BITS)
+#define POBRN_SUB_BUCKET_HALF   (POBRN_SUB_BUCKET_COUNT >> 1)
+#define POBRN_MAX_VALUE         ((uint64_t)INT32_MAX)
+#define POBRN_BUCKET_COUNT      (POBRN_SUB_BUCKET_COUNT + (31 - POBRN_SUB_BUCKET_BITS) * POBRN_SUB_BUCKET_HALF)
+
+static NSUInteger POBRNBucketIndex(uint64_t value) {
+    if (value < POBRN_SUB_BUCKET_COUNT) {
+        return (NSUInteger)value;
+    }
+    // Shift that brings the value into the [POBRN_SUB_BUCKET_HALF, POBRN_SUB_BUCKET_COUNT) range.
+    int shift = (63 - __builtin_clzll(value)) - (POBRN_SUB_BUCKET_BITS - 1);
+    return POBRN_SUB_BUCKET_COUNT + (shift - 1) * POBRN_SUB_BUCKET_HALF
+        + (NSUInteger)((value >> shift) - POBRN_SUB_BUCKET_HALF);
+}
+
+static uint64_t POBRNHighestValueAtIndex(NSUInteger index) {
+    if (index < POBRN_SUB_BUCKET_COUNT) {
+        return index;
+    }
+    NSUInteger offset = index - POBRN_SUB_BUCKET_COUNT;
+    NSUInteger shift = offset / POBRN_SUB_BUCKET_HALF + 1;
+    NSUInteger subBucket = offset % POBRN_SUB_BUCKET_HALF + POBRN_SUB_BUCKET_HALF;
+    return ((uint64_t)(subBucket + 1) << shift) - 1;
+}
+
+@implementation POBRNLatencyHistogram {
+    uint32_t _counts[POBRN_BUCKET_COUNT];
+}
+
+- (void)recordValue:(uint64_t)valueMicros {
+    uint64_t value = MIN(valueMicros, POBRN_MAX_VALUE);
+    _counts[POBRNBucketIndex(value)]++;
+    _count++;
+    if (value > _max) {
+        _max = value;
+    }
+}
+
+- (uint64_t)valueAtPercentile:(double)percentile {
+    if (_count == 0) {
+        return 0;
+    }
+    double clamped = MIN(MAX(percentile, 0.0), 100.0);
+    uint64_t rank = MAX((uint64_t)1, (uint64_t)ceil(clamped / 100.0 * _count));
+    uint64_t cumulative = 0;
+    for (NSUInteger index = 0; index < POBRN_BUCKET_COUNT; index++) {
+        cumulative += _counts[index];
+        if (cumulative >= rank) {
+            return MIN(POBRNHighestValueAtIndex(index), _max);
+        }
+    }
+    return _max;
+}
+
+- (void)reset {
+    memset(_counts, 0, sizeof(_counts));
+    _count = 0;
+    _max = 0;
+}
+
+@end
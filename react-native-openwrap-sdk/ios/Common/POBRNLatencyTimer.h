@@ -0,0 +1,70 @@
+#import <Foundation/Foundation.h>
+#import "POBRNConstants.h"
+#import "POBRNLatencyTracker.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * Measures the latency metrics of a single ad instance and reports them to @c POBRNLatencyTracker.
+ * Every load starts a new measurement, the durations of the latest load and show are retained so
+ * they can be attached to the event payloads.
+ *
+ * All the methods are expected to be called on the main thread, like the SDK delegate callbacks.
+ */
+@interface POBRNLatencyTimer : NSObject
+
+- (instancetype)init NS_UNAVAILABLE;
+
+- (instancetype)initWithAdFormat:(POBRNAdFormat)adFormat adUnitId:(NSString *)adUnitId;
+
+/** Marks the request of a banner load, queued by POBRNBannerLoadScheduler until markLoad. */
+- (void)markLoadRequested;
+
+/** Marks the start of a load, including banner force refreshes. */
+- (void)markLoad;
+
+- (void)markBidReceived;
+
+/**
+ * Marks the request to the ad server, made by the GAM event handler once the OpenWrap auction is
+ * over.
+ */
+- (void)markAdServerRequest;
+
+/**
+ * Marks the ad received callback. Consumes the load start, so the auto refreshes of a banner,
+ * which are not preceded by a loadAd call, are not measured.
+ */
+- (void)markAdReceived;
+
+/** Marks the first frame displayed after the ad has been received. */
+- (void)markFirstFrame;
+
+/** YES from the banner load request until the received ad is visible or the load failed. */
+@property (nonatomic, readonly) BOOL isFirstVisiblePending;
+
+/** Marks the received ad visible on screen for the first time since the load request. */
+- (void)markFirstVisible;
+
+/** Marks a failed load, so the next ad received callback is not measured against it. */
+- (void)markLoadFailed;
+
+- (void)markShow;
+
+- (void)markOpened;
+
+/** Returns the durations measured so far keyed by metric, in milliseconds. */
+- (NSDictionary<NSString *, NSNumber *> *)durations;
+
+/** Returns the duration of the given metric in milliseconds, nil if it was not measured. */
+- (nullable NSNumber *)durationForMetric:(POBRNLatencyMetric)metric;
+
+/**
+ * Returns the given payload with the measured durations added under the @c latency key if
+ * the payload is enabled on @c POBRNLatencyTracker, otherwise returns the payload as is.
+ */
+- (nullable NSDictionary *)attachToPayload:(nullable NSDictionary *)payload;
+
+@end
+
+NS_ASSUME_NONNULL_END
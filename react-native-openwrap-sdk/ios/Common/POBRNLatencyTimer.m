@@ -0,0 +1,158 @@
+#import "POBRNLatencyTimer.h"
+#import "POBRNLatencyTracker.h"
+
+#import <time.h>
+
+// Marker for a start timestamp or a duration which is not available.
+static const uint64_t POBRNNotStarted = UINT64_MAX;
+
+@implementation POBRNLatencyTimer {
+    POBRNAdFormat _adFormat;
+    NSString *_adUnitId;
+    uint64_t _loadRequestNanos;
+    uint64_t _firstVisibleStartNanos;
+    uint64_t _loadStartNanos;
+    uint64_t _bidReceivedNanos;
+    uint64_t _adServerRequestNanos;
+    uint64_t _renderStartNanos;
+    uint64_t _showStartNanos;
+    uint64_t _durations[POBRNLatencyMetricCount];
+}
+
+- (instancetype)initWithAdFormat:(POBRNAdFormat)adFormat adUnitId:(NSString *)adUnitId {
+    self = [super init];
+    if (self) {
+        _adFormat = adFormat;
+        _adUnitId = [adUnitId copy] ?: @"";
+        _loadRequestNanos = POBRNNotStarted;
+        _firstVisibleStartNanos = POBRNNotStarted;
+        _loadStartNanos = POBRNNotStarted;
+        _bidReceivedNanos = POBRNNotStarted;
+        _adServerRequestNanos = POBRNNotStarted;
+        _renderStartNanos = POBRNNotStarted;
+        _showStartNanos = POBRNNotStarted;
+        [self clearDurations];
+    }
+    return self;
+}
+
+- (void)markLoadRequested {
+    _loadRequestNanos = [self now];
+    _firstVisibleStartNanos = _loadRequestNanos;
+}
+
+- (void)markLoad {
+    _loadStartNanos = [self now];
+    _bidReceivedNanos = POBRNNotStarted;
+    _adServerRequestNanos = POBRNNotStarted;
+    _renderStartNanos = POBRNNotStarted;
+    [self clearDurations];
+    [self measure:POBRNLatencyMetricQueueWait from:_loadRequestNanos to:_loadStartNanos];
+    _loadRequestNanos = POBRNNotStarted;
+}
+
+- (void)markBidReceived {
+    uint64_t now = [self now];
+    [self measure:POBRNLatencyMetricLoadToBid from:_loadStartNanos to:now];
+    _bidReceivedNanos = now;
+}
+
+- (void)markAdServerRequest {
+    uint64_t now = [self now];
+    [self measure:POBRNLatencyMetricLoadToAdServerRequest from:_loadStartNanos to:now];
+    _adServerRequestNanos = now;
+}
+
+- (void)markAdReceived {
+    uint64_t now = [self now];
+    [self measure:POBRNLatencyMetricBidToAdReceived from:_bidReceivedNanos to:now];
+    [self measure:POBRNLatencyMetricLoadToAdReceived from:_loadStartNanos to:now];
+    [self measure:POBRNLatencyMetricAdServerRequestToAdReceived from:_adServerRequestNanos to:now];
+    _renderStartNanos = _loadStartNanos;
+    _loadStartNanos = POBRNNotStarted;
+    _bidReceivedNanos = POBRNNotStarted;
+    _adServerRequestNanos = POBRNNotStarted;
+}
+
+- (void)markFirstFrame {
+    [self measure:POBRNLatencyMetricLoadToFirstFrame from:_renderStartNanos to:[self now]];
+    _renderStartNanos = POBRNNotStarted;
+}
+
+- (BOOL)isFirstVisiblePending {
+    return _firstVisibleStartNanos != POBRNNotStarted;
+}
+
+- (void)markFirstVisible {
+    [self measure:POBRNLatencyMetricRequestToFirstVisible from:_firstVisibleStartNanos to:[self now]];
+    _firstVisibleStartNanos = POBRNNotStarted;
+}
+
+- (void)markLoadFailed {
+    _firstVisibleStartNanos = POBRNNotStarted;
+    _loadStartNanos = POBRNNotStarted;
+    _bidReceivedNanos = POBRNNotStarted;
+    _adServerRequestNanos = POBRNNotStarted;
+}
+
+- (void)markShow {
+    _showStartNanos = [self now];
+}
+
+- (void)markOpened {
+    [self measure:POBRNLatencyMetricShowToOpened from:_showStartNanos to:[self now]];
+    _showStartNanos = POBRNNotStarted;
+}
+
+- (nullable NSNumber *)durationForMetric:(POBRNLatencyMetric)metric {
+    if (metric < 0 || metric >= POBRNLatencyMetricCount || _durations[metric] == POBRNNotStarted) {
+        return nil;
+    }
+    return @(_durations[metric] / (double)NSEC_PER_MSEC);
+}
+
+- (NSDictionary<NSString *, NSNumber *> *)durations {
+    NSMutableDictionary<NSString *, NSNumber *> *durations = [NSMutableDictionary new];
+    for (NSInteger metric = 0; metric < POBRNLatencyMetricCount; metric++) {
+        if (_durations[metric] != POBRNNotStarted) {
+            durations[[POBRNLatencyTracker keyForMetric:metric]] = @(_durations[metric] / (double)NSEC_PER_MSEC);
+        }
+    }
+    return durations;
+}
+
+- (nullable NSDictionary *)attachToPayload:(nullable NSDictionary *)payload {
+    if (!POBRNLatencyTracker.isPayloadEnabled) {
+        return payload;
+    }
+    NSDictionary *durations = [self durations];
+    if (durations.count == 0) {
+        return payload;
+    }
+    NSMutableDictionary *result = payload ? [payload mutableCopy] : [NSMutableDictionary new];
+    result[POBRN_LATENCY] = durations;
+    return result;
+}
+
+#pragma mark - Private methods
+
+- (uint64_t)now {
+    return clock_gettime_nsec_np(CLOCK_UPTIME_RAW);
+}
+
+- (void)clearDurations {
+    for (NSInteger metric = 0; metric < POBRNLatencyMetricCount; metric++) {
+        _durations[metric] = POBRNNotStarted;
+    }
+}
+
+- (void)measure:(POBRNLatencyMetric)metric from:(uint64_t)start to:(uint64_t)end {
+    if (start == POBRNNotStarted || end < start) {
+        return;
+    }
+    uint64_t duration = end - start;
+    _durations[metric] = duration;
+    [POBRNLatencyTracker recordDuration:duration forMetric:metric adFormat:_adFormat adUnitId:_adUnitId];
+}
+
+@end
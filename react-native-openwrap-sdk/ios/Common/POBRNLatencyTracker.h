@@ -0,0 +1,60 @@
+#import <Foundation/Foundation.h>
+#import "POBRNConstants.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/** An enum to represent the latency metrics measured by the plugin. */
+typedef NS_ENUM(NSInteger, POBRNLatencyMetric) {
+    /** From loadAd to the bid received callback. Requires the bid event delegate. */
+    POBRNLatencyMetricLoadToBid = 0,
+    /** From the bid received callback to the ad received callback. Requires the bid event delegate. */
+    POBRNLatencyMetricBidToAdReceived,
+    /** From loadAd to the ad received callback. */
+    POBRNLatencyMetricLoadToAdReceived,
+    /** From show to the ad opened callback. Full screen ads only. */
+    POBRNLatencyMetricShowToOpened,
+    /** From loadAd to the first frame displayed with the rendered ad. Banner ads only. */
+    POBRNLatencyMetricLoadToFirstFrame,
+    /** From loadAd to the GAM request, i.e. the wait on the OpenWrap auction. GAM header bidding only. */
+    POBRNLatencyMetricLoadToAdServerRequest,
+    /** From the GAM request to the ad received callback, i.e. the wait on GAM. GAM header bidding only. */
+    POBRNLatencyMetricAdServerRequestToAdReceived,
+    /** From the banner load request to the start of its load by POBRNBannerLoadScheduler. Banner ads only. */
+    POBRNLatencyMetricQueueWait,
+    /** From the banner load request to the received ad being visible on screen. Banner ads only. */
+    POBRNLatencyMetricRequestToFirstVisible,
+    POBRNLatencyMetricCount
+};
+
+/**
+ * Accumulates the ad latency histograms per ad format, ad unit id and metric. Ad instances
+ * measure their own durations through @c POBRNLatencyTimer and report them here.
+ */
+@interface POBRNLatencyTracker : NSObject
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/** Controls whether the durations measured for an ad instance are attached to its event payloads. */
+@property (class, nonatomic, assign, getter=isPayloadEnabled) BOOL payloadEnabled;
+
+/** Returns the key used for the given metric in the stats and event payloads. */
++ (NSString *)keyForMetric:(POBRNLatencyMetric)metric;
+
+/** Records a measured duration in nanoseconds. */
++ (void)recordDuration:(uint64_t)durationNanos
+             forMetric:(POBRNLatencyMetric)metric
+              adFormat:(POBRNAdFormat)adFormat
+              adUnitId:(NSString *)adUnitId;
+
+/** Removes all the recorded durations. */
++ (void)reset;
+
+/**
+ * Returns the latency summary of every recorded placement and metric. Each entry contains
+ * adFormat, adUnitId, metric, count and the p50, p90, p99 and max values in milliseconds.
+ */
++ (NSArray<NSDictionary *> *)stats;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,116 @@
+#import "POBRNLatencyTracker.h"
+#import "POBRNLatencyHistogram.h"
+
+static BOOL pobrn_latency_payload_enabled = NO;
+
+@interface POBRNLatencyPlacement : NSObject
+@property (nonatomic, assign) POBRNAdFormat adFormat;
+@property (nonatomic, strong) NSString *adUnitId;
+@property (nonatomic, strong) NSMutableDictionary<NSNumber *, POBRNLatencyHistogram *> *histograms;
+@end
+
+@implementation POBRNLatencyPlacement
+@end
+
+@implementation POBRNLatencyTracker
+
++ (BOOL)isPayloadEnabled {
+    return pobrn_latency_payload_enabled;
+}
+
++ (void)setPayloadEnabled:(BOOL)payloadEnabled {
+    pobrn_latency_payload_enabled = payloadEnabled;
+}
+
++ (NSString *)keyForMetric:(POBRNLatencyMetric)metric {
+    switch (metric) {
+        case POBRNLatencyMetricLoadToBid:           return @"loadToBid";
+        case POBRNLatencyMetricBidToAdReceived:     return @"bidToAdReceived";
+        case POBRNLatencyMetricLoadToAdReceived:    return @"loadToAdReceived";
+        case POBRNLatencyMetricShowToOpened:        return @"showToOpened";
+        case POBRNLatencyMetricLoadToFirstFrame:    return @"loadToFirstFrame";
+        case POBRNLatencyMetricLoadToAdServerRequest:       return @"loadToAdServerRequest";
+        case POBRNLatencyMetricAdServerRequestToAdReceived: return @"adServerRequestToAdReceived";
+        case POBRNLatencyMetricQueueWait:                   return @"queueWait";
+        case POBRNLatencyMetricRequestToFirstVisible:       return @"requestToFirstVisible";
+        case POBRNLatencyMetricCount:               break;
+    }
+    return @"unknown";
+}
+
++ (NSString *)nameForAdFormat:(POBRNAdFormat)adFormat {
+    switch (adFormat) {
+        case POBRNAdFormatBanner:       return @"banner";
+        case POBRNAdFormatInterstitial: return @"interstitial";
+        case POBRNAdFormatRewarded:     return @"rewarded";
+    }
+    return @"unknown";
+}
+
++ (NSMutableDictionary<NSString *, POBRNLatencyPlacement *> *)placements {
+    static NSMutableDictionary *placements = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        placements = [NSMutableDictionary new];
+    });
+    return placements;
+}
+
++ (void)recordDuration:(uint64_t)durationNanos
+             forMetric:(POBRNLatencyMetric)metric
+              adFormat:(POBRNAdFormat)adFormat
+              adUnitId:(NSString *)adUnitId {
+    NSMutableDictionary<NSString *, POBRNLatencyPlacement *> *placements = [self placements];
+    @synchronized (placements) {
+        NSString *key = [NSString stringWithFormat:@"%ld:%@", (long)adFormat, adUnitId];
+        POBRNLatencyPlacement *placement = placements[key];
+        if (placement == nil) {
+            placement = [POBRNLatencyPlacement new];
+            placement.adFormat = adFormat;
+            placement.adUnitId = adUnitId;
+            placement.histograms = [NSMutableDictionary new];
+            placements[key] = placement;
+        }
+        POBRNLatencyHistogram *histogram = placement.histograms[@(metric)];
+        if (histogram == nil) {
+            histogram = [POBRNLatencyHistogram new];
+            placement.histograms[@(metric)] = histogram;
+        }
+        [histogram recordValue:durationNanos / NSEC_PER_USEC];
+    }
+}
+
++ (void)reset {
+    NSMutableDictionary *placements = [self placements];
+    @synchronized (placements) {
+        [placements removeAllObjects];
+    }
+}
+
++ (NSArray<NSDictionary *> *)stats {
+    NSMutableArray<NSDictionary *> *stats = [NSMutableArray new];
+    NSMutableDictionary<NSString *, POBRNLatencyPlacement *> *placements = [self placements];
+    @synchronized (placements) {
+        for (POBRNLatencyPlacement *placement in placements.allValues) {
+            for (NSInteger metric = 0; metric < POBRNLatencyMetricCount; metric++) {
+                POBRNLatencyHistogram *histogram = placement.histograms[@(metric)];
+                if (histogram == nil) {
+                    continue;
+                }
+                [stats addObject:@{
+                    @"adFormat": [self nameForAdFormat:placement.adFormat],
+                    POBRN_AD_UNIT_ID: placement.adUnitId,
+                    @"metric": [self keyForMetric:metric],
+                    @"count": @(histogram.count),
+                    @"p50": @([histogram valueAtPercentile:50.0] / 1000.0),
+                    @"p90": @([histogram valueAtPercentile:90.0] / 1000.0),
+                    @"p99": @([histogram valueAtPercentile:99.0] / 1000.0),
+                    @"max": @(histogram.max / 1000.0)
+                }];
+            }
+        }
+    }
+    return stats;
+}
+
+@end
@@ -0,0 +1,55 @@
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * Size bounded LRU disk cache of the video media files referenced by the VAST creatives of the
+ * received bids. Disabled by default.
+ *
+ * - Once a video ad is received, on an unmetered network, the media file of the rendition fitting
+ *   the screen best is downloaded.
+ * - The files of a bid are evicted when the bid expires or its ad is destroyed, unless another
+ *   received bid references them, and the least recently used files are evicted above maxBytes.
+ * - A prefetch of a media file already cached, e.g. by an earlier bid of the same creative, does
+ *   not download it again.
+ *
+ * The OpenWrap SDK player does not read the cached files, it downloads the media file again when
+ * the ad plays. The stats therefore only describe the prefetch traffic, which adds to the one of
+ * the playback: no bytes are reported as saved.
+ */
+@interface POBRNMediaCache : NSObject
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/** Enables the prefetch of the video media files. Defaults to NO. */
+@property (class, atomic, getter=isEnabled) BOOL enabled;
+
+/** Maximum size of the cached files in bytes. Defaults to 50 MB. */
+@property (class, atomic) unsigned long long maxBytes;
+
+/**
+ * Prefetches the media file of the given bid creative, if it is a VAST video and the network is
+ * unmetered. The previous bid of the same key is evicted first. Expected to be called on the main thread.
+ * @param key the ad instance the bid belongs to
+ */
++ (void)prefetchCreative:(nullable NSString *)creative forKey:(NSString *)key;
+
+/** Evicts the media file of the bid of the given key, unless another bid references it. */
++ (void)evictKey:(NSString *)key;
+
+/** Returns the cached file of the given media URL, nil if not cached. */
++ (nullable NSURL *)cachedFileForURL:(NSString *)url;
+
+/**
+ * Returns the prefetch stats: number of prefetches, of prefetches of an already cached file, of
+ * downloads, of prefetches skipped on metered networks and of failed downloads, the bytes
+ * downloaded and the size of the cached files.
+ */
++ (NSDictionary *)stats;
+
+/** Removes all the stats. */
++ (void)resetStats;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,310 @@
+#import "POBRNMediaCache.h"
+#import <CommonCrypto/CommonDigest.h>
+#import <SystemConfiguration/SystemConfiguration.h>
+#import <UIKit/UIKit.h>
+#import <netinet/in.h>
+#import <React/RCTLog.h>
+
+static const unsigned long long POBRNMediaCacheDefaultMaxBytes = 50ULL * 1024 * 1024;
+static NSString *const POBRNMediaCacheDirectoryName = @"pobrn_media";
+
+/** A media file of a VAST creative. */
+@interface POBRNMediaFile : NSObject
+@property (nonatomic, copy) NSString *url;
+@property (nonatomic, nullable, copy) NSString *type;
+@property (nonatomic) NSInteger width;
+@property (nonatomic) NSInteger height;
+@property (nonatomic) NSInteger bitrate;
+@end
+
+@implementation POBRNMediaFile
+@end
+
+static BOOL enabled = NO;
+static unsigned long long maxBytes = POBRNMediaCacheDefaultMaxBytes;
+// Cached file sizes by media URL, and the media URLs from the least to the most recently used.
+static NSMutableDictionary<NSString *, NSNumber *> *fileSizes;
+static NSMutableArray<NSString *> *usageOrder;
+// Media URLs referenced by every bid still alive, keyed by the ad instance.
+static NSMutableDictionary<NSString *, NSString *> *references;
+static NSMutableDictionary<NSString *, NSNumber *> *counters;
+static unsigned long long cachedBytes = 0;
+static NSURLSession *session;
+static NSURL *directory;
+
+@implementation POBRNMediaCache
+
++ (void)initialize {
+    if (self == [POBRNMediaCache class]) {
+        fileSizes = [NSMutableDictionary new];
+        usageOrder = [NSMutableArray new];
+        references = [NSMutableDictionary new];
+        counters = [NSMutableDictionary new];
+        session = [NSURLSession sessionWithConfiguration:[NSURLSessionConfiguration ephemeralSessionConfiguration]];
+        NSURL *caches = [[NSFileManager defaultManager] URLsForDirectory:NSCachesDirectory
+                                                                inDomains:NSUserDomainMask].firstObject;
+        directory = [caches URLByAppendingPathComponent:POBRNMediaCacheDirectoryName isDirectory:YES];
+        // The bids do not outlive the process, so the files of the previous runs are stale.
+        [[NSFileManager defaultManager] removeItemAtURL:directory error:nil];
+        [[NSFileManager defaultManager] createDirectoryAtURL:directory
+                                 withIntermediateDirectories:YES
+                                                  attributes:nil
+                                                       error:nil];
+    }
+}
+
++ (BOOL)isEnabled {
+    return enabled;
+}
+
++ (void)setEnabled:(BOOL)isEnabled {
+    enabled = isEnabled;
+}
+
++ (unsigned long long)maxBytes {
+    return maxBytes;
+}
+
++ (void)setMaxBytes:(unsigned long long)bytes {
+    @synchronized (fileSizes) {
+        maxBytes = bytes;
+        [self trim];
+    }
+}
+
++ (void)prefetchCreative:(nullable NSString *)creative forKey:(NSString *)key {
+    [self evictKey:key];
+    if (!enabled || ![creative containsString:@"<VAST"]) {
+        return;
+    }
+    if ([self isNetworkMetered]) {
+        [self incrementCounter:@"skippedMetered" by:1];
+        return;
+    }
+    CGSize screen = [UIScreen mainScreen].nativeBounds.size;
+    POBRNMediaFile *mediaFile = [self selectMediaFile:[self parseMediaFiles:creative]
+                                          screenWidth:screen.width
+                                         screenHeight:screen.height];
+    if (!mediaFile) {
+        return;
+    }
+    NSString *url = mediaFile.url;
+    @synchronized (fileSizes) {
+        references[key] = url;
+        [self incrementCounter:@"prefetches" by:1];
+        if (fileSizes[url]) {
+            [usageOrder removeObject:url];
+            [usageOrder addObject:url];
+            [self incrementCounter:@"alreadyCached" by:1];
+            return;
+        }
+        [self incrementCounter:@"downloads" by:1];
+    }
+    [self downloadURL:url];
+}
+
++ (void)evictKey:(NSString *)key {
+    @synchronized (fileSizes) {
+        NSString *url = references[key];
+        if (!url) {
+            return;
+        }
+        [references removeObjectForKey:key];
+        if (fileSizes[url] && ![references.allValues containsObject:url]) {
+            [self removeFileForURL:url];
+        }
+    }
+}
+
++ (nullable NSURL *)cachedFileForURL:(NSString *)url {
+    @synchronized (fileSizes) {
+        return fileSizes[url] ? [self fileURLForURL:url] : nil;
+    }
+}
+
++ (NSDictionary *)stats {
+    @synchronized (fileSizes) {
+        return @{
+            @"prefetches": counters[@"prefetches"] ?: @0,
+            @"alreadyCached": counters[@"alreadyCached"] ?: @0,
+            @"downloads": counters[@"downloads"] ?: @0,
+            @"skippedMetered": counters[@"skippedMetered"] ?: @0,
+            @"failures": counters[@"failures"] ?: @0,
+            @"bytesDownloaded": counters[@"bytesDownloaded"] ?: @0,
+            @"cachedBytes": @(cachedBytes)
+        };
+    }
+}
+
++ (void)resetStats {
+    @synchronized (fileSizes) {
+        [counters removeAllObjects];
+    }
+}
+
+#pragma mark - Private methods
+
+/** Returns the media files of the given VAST creative. */
++ (NSArray<POBRNMediaFile *> *)parseMediaFiles:(NSString *)vast {
+    static NSRegularExpression *mediaFileRegex;
+    static NSRegularExpression *attributeRegex;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        mediaFileRegex = [NSRegularExpression regularExpressionWithPattern:@"<MediaFile\\b([^>]*)>(.*?)</MediaFile>"
+                                                                   options:NSRegularExpressionDotMatchesLineSeparators
+                                                                     error:nil];
+        attributeRegex = [NSRegularExpression regularExpressionWithPattern:@"(\\w+)\\s*=\\s*\"([^\"]*)\""
+                                                                   options:0
+                                                                     error:nil];
+    });
+    NSMutableArray<POBRNMediaFile *> *mediaFiles = [NSMutableArray new];
+    NSCharacterSet *whitespaces = [NSCharacterSet whitespaceAndNewlineCharacterSet];
+    for (NSTextCheckingResult *match in [mediaFileRegex matchesInString:vast options:0 range:NSMakeRange(0, vast.length)]) {
+        NSString *url = [[vast substringWithRange:[match rangeAtIndex:2]] stringByTrimmingCharactersInSet:whitespaces];
+        if ([url hasPrefix:@"<![CDATA["] && [url hasSuffix:@"]]>"]) {
+            url = [[url substringWithRange:NSMakeRange(9, url.length - 12)] stringByTrimmingCharactersInSet:whitespaces];
+        }
+        if (url.length == 0) {
+            continue;
+        }
+        NSString *attributes = [vast substringWithRange:[match rangeAtIndex:1]];
+        NSMutableDictionary<NSString *, NSString *> *attributeValues = [NSMutableDictionary new];
+        for (NSTextCheckingResult *attribute in [attributeRegex matchesInString:attributes options:0 range:NSMakeRange(0, attributes.length)]) {
+            attributeValues[[attributes substringWithRange:[attribute rangeAtIndex:1]].lowercaseString] =
+                [attributes substringWithRange:[attribute rangeAtIndex:2]];
+        }
+        POBRNMediaFile *mediaFile = [POBRNMediaFile new];
+        mediaFile.url = url;
+        mediaFile.type = attributeValues[@"type"];
+        mediaFile.width = attributeValues[@"width"].integerValue;
+        mediaFile.height = attributeValues[@"height"].integerValue;
+        mediaFile.bitrate = attributeValues[@"bitrate"].integerValue;
+        [mediaFiles addObject:mediaFile];
+    }
+    return mediaFiles;
+}
+
+/**
+ * Returns the rendition fitting the screen best: a progressive MP4 or QuickTime file, the largest
+ * one fitting the screen, else the smallest one. Equal sizes are ordered by lowest bitrate.
+ */
++ (nullable POBRNMediaFile *)selectMediaFile:(NSArray<POBRNMediaFile *> *)mediaFiles
+                                 screenWidth:(CGFloat)screenWidth
+                                screenHeight:(CGFloat)screenHeight {
+    NSArray<NSString *> *playableTypes = @[@"video/mp4", @"video/quicktime", @"video/x-m4v"];
+    // Compare the longest sides, the ad may play in either orientation.
+    CGFloat screen = MAX(screenWidth, screenHeight);
+    POBRNMediaFile *fitting = nil;
+    POBRNMediaFile *smallest = nil;
+    for (POBRNMediaFile *mediaFile in mediaFiles) {
+        if (mediaFile.type && ![playableTypes containsObject:mediaFile.type]) {
+            continue;
+        }
+        NSInteger area = mediaFile.width * mediaFile.height;
+        if (MAX(mediaFile.width, mediaFile.height) <= screen) {
+            NSInteger fittingArea = fitting.width * fitting.height;
+            if (!fitting || area > fittingArea || (area == fittingArea && mediaFile.bitrate < fitting.bitrate)) {
+                fitting = mediaFile;
+            }
+        }
+        NSInteger smallestArea = smallest.width * smallest.height;
+        if (!smallest || area < smallestArea || (area == smallestArea && mediaFile.bitrate < smallest.bitrate)) {
+            smallest = mediaFile;
+        }
+    }
+    return fitting ?: smallest;
+}
+
++ (BOOL)isNetworkMetered {
+    struct sockaddr_in address = {0};
+    address.sin_len = sizeof(address);
+    address.sin_family = AF_INET;
+    SCNetworkReachabilityRef reachability = SCNetworkReachabilityCreateWithAddress(kCFAllocatorDefault,
+                                                                                    (const struct sockaddr *)&address);
+    if (!reachability) {
+        return YES;
+    }
+    SCNetworkReachabilityFlags flags = 0;
+    BOOL hasFlags = SCNetworkReachabilityGetFlags(reachability, &flags);
+    CFRelease(reachability);
+    // Cellular, or not reachable at all, is treated as metered.
+    return !hasFlags || !(flags & kSCNetworkReachabilityFlagsReachable) || (flags & kSCNetworkReachabilityFlagsIsWWAN);
+}
+
++ (void)downloadURL:(NSString *)url {
+    NSURL *remoteURL = [NSURL URLWithString:url];
+    if (!remoteURL) {
+        [self incrementCounter:@"failures" by:1];
+        return;
+    }
+    NSURLSessionDownloadTask *task = [session downloadTaskWithURL:remoteURL
+                                                completionHandler:^(NSURL *location, NSURLResponse *response, NSError *error) {
+        NSInteger statusCode = [response isKindOfClass:[NSHTTPURLResponse class]] ? ((NSHTTPURLResponse *)response).statusCode : 0;
+        NSURL *file = [self fileURLForURL:url];
+        NSError *moveError = nil;
+        if (error || statusCode != 200) {
+            moveError = error ?: [NSError errorWithDomain:NSURLErrorDomain code:statusCode userInfo:nil];
+        } else {
+            [[NSFileManager defaultManager] removeItemAtURL:file error:nil];
+            [[NSFileManager defaultManager] moveItemAtURL:location toURL:file error:&moveError];
+        }
+        if (moveError) {
+            [self incrementCounter:@"failures" by:1];
+            RCTLogWarn(@"Unable to prefetch the media file %@ with %@", url, moveError.localizedDescription);
+            return;
+        }
+        unsigned long long size = [[[NSFileManager defaultManager] attributesOfItemAtPath:file.path error:nil] fileSize];
+        @synchronized (fileSizes) {
+            [self incrementCounter:@"bytesDownloaded" by:size];
+            if (fileSizes[url]) {
+                return;
+            }
+            if (![references.allValues containsObject:url]) {
+                // The bid was evicted meanwhile.
+                [[NSFileManager defaultManager] removeItemAtURL:file error:nil];
+                return;
+            }
+            fileSizes[url] = @(size);
+            [usageOrder addObject:url];
+            cachedBytes += size;
+            [self trim];
+        }
+    }];
+    [task resume];
+}
+
+/** Evicts the least recently used files above maxBytes. Expected to be called while holding the lock. */
++ (void)trim {
+    while (cachedBytes > maxBytes && usageOrder.count > 0) {
+        [self removeFileForURL:usageOrder.firstObject];
+    }
+}
+
+/** Expected to be called while holding the lock. */
++ (void)removeFileForURL:(NSString *)url {
+    cachedBytes -= fileSizes[url].unsignedLongLongValue;
+    [fileSizes removeObjectForKey:url];
+    [usageOrder removeObject:url];
+    [[NSFileManager defaultManager] removeItemAtURL:[self fileURLForURL:url] error:nil];
+}
+
++ (NSURL *)fileURLForURL:(NSString *)url {
+    NSData *data = [url dataUsingEncoding:NSUTF8StringEncoding];
+    unsigned char digest[CC_SHA256_DIGEST_LENGTH];
+    CC_SHA256(data.bytes, (CC_LONG)data.length, digest);
+    NSMutableString *name = [NSMutableString stringWithCapacity:CC_SHA256_DIGEST_LENGTH * 2];
+    for (int i = 0; i < CC_SHA256_DIGEST_LENGTH; i++) {
+        [name appendFormat:@"%02x", digest[i]];
+    }
+    // AVFoundation relies on the extension to detect the container.
+    NSString *extension = [NSURL URLWithString:url].pathExtension;
+    return [directory URLByAppendingPathComponent:extension.length > 0 ? [name stringByAppendingPathExtension:extension] : name];
+}
+
++ (void)incrementCounter:(NSString *)counter by:(unsigned long long)value {
+    @synchronized (fileSizes) {
+        counters[counter] = @(counters[counter].unsignedLongLongValue + value);
+    }
+}
+
+@end
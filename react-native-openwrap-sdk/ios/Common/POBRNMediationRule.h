@@ -0,0 +1,79 @@
+#import <Foundation/Foundation.h>
+#import <OpenWrapSDK/OpenWrapSDK.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/*!
+ Result of a mediation rule evaluation.
+ */
+@interface POBRNMediationOutcome : NSObject
+
+/*! @abstract Evaluation reason, one of won, bidExpired, bidStatus, maxWaitExceeded, partnerNotAllowed, belowFloor */
+@property (nonatomic, readonly) NSString *reason;
+
+/*! @abstract YES if the OpenWrap bid won and the ad proceeds to load */
+@property (nonatomic, readonly) BOOL won;
+
+/*! @abstract Plugin bid error code to proceed with, see POBBidError, ignored if the bid won */
+@property (nonatomic, readonly) NSInteger errorCode;
+
+/*!
+ @abstract Returns the outcome as event payload, having won, reason, errorCode, price and partnerName.
+ */
+- (NSDictionary *)dictionaryWithBid:(POBBid *)bid;
+
+@end
+
+/*!
+ Declarative in-house mediation rule of a placement. When a rule is registered for an ad unit id,
+ the received OpenWrap bid is evaluated natively in the bid event delegate and the ad proceeds to
+ load, or to error, without waiting for JS. JS is only notified of the outcome.
+ */
+@interface POBRNMediationRule : NSObject
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/*!
+ @abstract Creates the rule from the rule dictionary, every key is optional.
+ @param ruleDictionary rule dictionary
+ Example = {
+    "floor": 0.5,
+    "partnerFloors": { "pubmatic": 0.8 },
+    "allowedPartners": ["pubmatic", "appnexus"],
+    "maxWaitMs": 500
+    }
+ */
+- (instancetype)initWithDictionary:(NSDictionary *)ruleDictionary;
+
+/*!
+ @abstract Evaluates the bid against this rule, in below order: bid expiry and status, max wait,
+ allowed partners and floors. The max wait only makes a late bid lose, it does not time out a bid
+ still awaited.
+ @param bid the received OpenWrap bid
+ @param waitMillis time from loadAd to the bid, nil if unknown
+ */
+- (POBRNMediationOutcome *)evaluateBid:(POBBid *)bid waitMillis:(nullable NSNumber *)waitMillis;
+
+/*!
+ @abstract Evaluates the bid and proceeds the bid flow of the ad accordingly.
+ @return the outcome, to be notified to JS
+ */
+- (POBRNMediationOutcome *)applyToBidEvent:(id<POBBidEvent>)bidEvent
+                                       bid:(POBBid *)bid
+                                waitMillis:(nullable NSNumber *)waitMillis;
+
+/*!
+ @abstract Registers the rule of the given ad unit id, replacing the previous one.
+ */
++ (void)registerRule:(POBRNMediationRule *)rule forAdUnitId:(NSString *)adUnitId;
+
++ (void)unregisterRuleForAdUnitId:(NSString *)adUnitId;
+
+/*!
+ @abstract Returns the rule registered for the given ad unit id, if any.
+ */
++ (nullable POBRNMediationRule *)ruleForAdUnitId:(nullable NSString *)adUnitId;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,156 @@
+#import "POBRNMediationRule.h"
+#import "POBRNAdHelper.h"
+#import "POBRNConstants.h"
+
+// Plugin bid error codes, as per POBBidError of the JS layer.
+static const NSInteger POBRNBidErrorClientSideAuctionLoss = 0;
+static const NSInteger POBRNBidErrorBidExpired = 1;
+
+static const NSInteger POBRNBidStatusOk = 1;
+
+@interface POBRNMediationOutcome ()
+
+- (instancetype)initWithReason:(NSString *)reason won:(BOOL)won errorCode:(NSInteger)errorCode;
+
+@end
+
+@implementation POBRNMediationOutcome
+
+- (instancetype)initWithReason:(NSString *)reason won:(BOOL)won errorCode:(NSInteger)errorCode {
+    self = [super init];
+    if (self) {
+        _reason = [reason copy];
+        _won = won;
+        _errorCode = errorCode;
+    }
+    return self;
+}
+
+- (NSDictionary *)dictionaryWithBid:(POBBid *)bid {
+    NSMutableDictionary *outcome = [NSMutableDictionary new];
+    outcome[POBRN_MEDIATION_WON] = @(self.won);
+    outcome[POBRN_MEDIATION_REASON] = self.reason;
+    if (!self.won) {
+        outcome[POBRN_ERROR_CODE] = @(self.errorCode);
+    }
+    outcome[POBRN_BID_PRICE] = bid.price ?: @0;
+    if (bid.partner) {
+        outcome[POBRN_BID_PARTNER_NAME] = bid.partner;
+    }
+    return outcome;
+}
+
+@end
+
+@implementation POBRNMediationRule {
+    double _floor;
+    NSDictionary<NSString *, NSNumber *> *_partnerFloors;
+    NSArray<NSString *> *_allowedPartners;
+    double _maxWaitMillis;
+}
+
+static NSMutableDictionary<NSString *, POBRNMediationRule *> *rules;
+
++ (void)initialize {
+    if (self == [POBRNMediationRule class]) {
+        rules = [NSMutableDictionary new];
+    }
+}
+
+- (instancetype)initWithDictionary:(NSDictionary *)ruleDictionary {
+    self = [super init];
+    if (self) {
+        id floor = ruleDictionary[POBRN_MEDIATION_FLOOR];
+        _floor = [floor isKindOfClass:[NSNumber class]] ? [floor doubleValue] : 0;
+
+        NSMutableDictionary<NSString *, NSNumber *> *partnerFloors = [NSMutableDictionary new];
+        id floors = ruleDictionary[POBRN_MEDIATION_PARTNER_FLOORS];
+        if ([floors isKindOfClass:[NSDictionary class]]) {
+            [floors enumerateKeysAndObjectsUsingBlock:^(id partner, id partnerFloor, BOOL *stop) {
+                if ([partnerFloor isKindOfClass:[NSNumber class]]) {
+                    partnerFloors[partner] = partnerFloor;
+                }
+            }];
+        }
+        _partnerFloors = partnerFloors;
+
+        NSMutableArray<NSString *> *allowedPartners = [NSMutableArray new];
+        id partners = ruleDictionary[POBRN_MEDIATION_ALLOWED_PARTNERS];
+        if ([partners isKindOfClass:[NSArray class]]) {
+            for (id partner in partners) {
+                if ([partner isKindOfClass:[NSString class]]) {
+                    [allowedPartners addObject:partner];
+                }
+            }
+        }
+        _allowedPartners = allowedPartners;
+
+        id maxWait = ruleDictionary[POBRN_MEDIATION_MAX_WAIT];
+        _maxWaitMillis = [maxWait isKindOfClass:[NSNumber class]] ? [maxWait doubleValue] : 0;
+    }
+    return self;
+}
+
+- (POBRNMediationOutcome *)evaluateBid:(POBBid *)bid waitMillis:(nullable NSNumber *)waitMillis {
+    if ([bid isExpired]) {
+        return [self lossWithReason:@"bidExpired" errorCode:POBRNBidErrorBidExpired];
+    }
+    if (bid.status.integerValue != POBRNBidStatusOk) {
+        return [self lossWithReason:@"bidStatus" errorCode:POBRNBidErrorClientSideAuctionLoss];
+    }
+    if (_maxWaitMillis > 0 && waitMillis != nil && waitMillis.doubleValue > _maxWaitMillis) {
+        return [self lossWithReason:@"maxWaitExceeded" errorCode:POBRNBidErrorClientSideAuctionLoss];
+    }
+    NSString *partner = bid.partner;
+    if (_allowedPartners.count > 0 && (partner == nil || ![_allowedPartners containsObject:partner])) {
+        return [self lossWithReason:@"partnerNotAllowed" errorCode:POBRNBidErrorClientSideAuctionLoss];
+    }
+    NSNumber *partnerFloor = partner ? _partnerFloors[partner] : nil;
+    double floor = partnerFloor ? partnerFloor.doubleValue : _floor;
+    if (bid.price.doubleValue < floor) {
+        return [self lossWithReason:@"belowFloor" errorCode:POBRNBidErrorClientSideAuctionLoss];
+    }
+    return [[POBRNMediationOutcome alloc] initWithReason:@"won" won:YES errorCode:0];
+}
+
+- (POBRNMediationOutcome *)applyToBidEvent:(id<POBBidEvent>)bidEvent
+                                       bid:(POBBid *)bid
+                                waitMillis:(nullable NSNumber *)waitMillis {
+    POBRNMediationOutcome *outcome = [self evaluateBid:bid waitMillis:waitMillis];
+    if (outcome.won) {
+        [bidEvent proceedToLoadAd];
+    } else {
+        [bidEvent proceedOnError:[POBRNAdHelper bidEventErrorCodeForCode:outcome.errorCode]
+                  andDescription:outcome.reason];
+    }
+    return outcome;
+}
+
+- (POBRNMediationOutcome *)lossWithReason:(NSString *)reason errorCode:(NSInteger)errorCode {
+    return [[POBRNMediationOutcome alloc] initWithReason:reason won:NO errorCode:errorCode];
+}
+
+#pragma mark - Registry
+
++ (void)registerRule:(POBRNMediationRule *)rule forAdUnitId:(NSString *)adUnitId {
+    @synchronized (self) {
+        rules[adUnitId] = rule;
+    }
+}
+
++ (void)unregisterRuleForAdUnitId:(NSString *)adUnitId {
+    @synchronized (self) {
+        [rules removeObjectForKey:adUnitId];
+    }
+}
+
++ (nullable POBRNMediationRule *)ruleForAdUnitId:(nullable NSString *)adUnitId {
+    if (adUnitId == nil) {
+        return nil;
+    }
+    @synchronized (self) {
+        return rules[adUnitId];
+    }
+}
+
+@end
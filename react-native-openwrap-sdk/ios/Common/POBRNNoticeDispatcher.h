@@ -0,0 +1,49 @@
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * Delivers the win and loss notices, i.e. the nurl and lurl of the bids, of the client side
+ * auctions run by the app.
+ *
+ * - Every notice is appended to a small on-disk queue before being sent, so that it survives the
+ *   app being offline or killed. The delivered and dropped notices are appended as done records,
+ *   and the file is rewritten once mostly made of done records.
+ * - The notices are sent in batches, so that the notices of an auction share a single radio wake
+ *   up. A batch starts one second after the first queued notice and sends at most 10 notices, the
+ *   batches being at least one second apart.
+ * - A failed notice is retried with an exponential backoff from 5 seconds up to 30 minutes. It is
+ *   dropped after 8 attempts, on a client error or once older than a day. While offline, the
+ *   notices are held and sent once the network is back.
+ *
+ * The queue is only accessed from a serial background queue, the methods may be called from any
+ * thread.
+ */
+@interface POBRNNoticeDispatcher : NSObject
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/**
+ * Restores the notices queued by the previous sessions and starts sending them once online.
+ * Only the first call has an effect.
+ */
++ (void)start;
+
+/**
+ * Queues a notice, persisted until it is delivered or dropped.
+ * @param url notice URL, its macros already replaced
+ */
++ (void)enqueueURL:(NSString *)url;
+
+/**
+ * Returns the queue depth, the number of notices queued, delivered, retried, dropped and restored
+ * from disk, and the delivery latency percentiles in milliseconds.
+ */
++ (NSDictionary *)stats;
+
+/** Removes all the stats. */
++ (void)resetStats;
+
+@end
+
+NS_ASSUME_NONNULL_END
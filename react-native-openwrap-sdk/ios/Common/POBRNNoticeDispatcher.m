@@ -0,0 +1,400 @@
+#import "POBRNNoticeDispatcher.h"
+#import "POBRNLatencyHistogram.h"
+#import <Network/Network.h>
+#import <React/RCTLog.h>
+
+static NSString *const POBRNNoticeQueueFileName = @"pobrn_notices.log";
+static NSString *const POBRNNoticeEnqueuedRecord = @"E";
+static NSString *const POBRNNoticeDoneRecord = @"D";
+static const NSUInteger POBRNNoticeMaxQueueSize = 500;
+static const NSUInteger POBRNNoticeMaxRequestsPerBatch = 10;
+static const NSUInteger POBRNNoticeMaxAttempts = 8;
+static const NSUInteger POBRNNoticeCompactThreshold = 100;
+static const int64_t POBRNNoticeBatchDelayMillis = 1000;
+static const int64_t POBRNNoticeInitialBackoffMillis = 5000;
+static const int64_t POBRNNoticeMaxBackoffMillis = 30 * 60 * 1000;
+static const int64_t POBRNNoticeMaxAgeMillis = 24 * 60 * 60 * 1000;
+static const NSTimeInterval POBRNNoticeTimeout = 10;
+
+typedef NS_ENUM(NSInteger, POBRNNoticeResult) {
+    POBRNNoticeResultDelivered,
+    POBRNNoticeResultRejected,
+    POBRNNoticeResultFailed
+};
+
+/** A queued notice. */
+@interface POBRNNotice : NSObject
+@property (nonatomic) int64_t noticeId;
+@property (nonatomic, copy) NSString *url;
+@property (nonatomic) int64_t enqueuedMillis;
+@property (nonatomic) NSUInteger attempts;
+@property (nonatomic) int64_t nextAttemptMillis;
+@end
+
+@implementation POBRNNotice
+@end
+
+// The queue state is only accessed on the serial queue, the stats under the counters lock.
+static dispatch_queue_t queue;
+static NSMutableArray<POBRNNotice *> *notices;
+static NSURL *queueFile;
+static NSURLSession *session;
+static int64_t nextId = 1;
+static NSUInteger doneRecords = 0;
+static int64_t flushMillis = 0;
+static int64_t lastBatchMillis = 0;
+static NSUInteger flushGeneration = 0;
+static BOOL flushScheduled = NO;
+static BOOL flushing = NO;
+static BOOL offline = NO;
+static BOOL started = NO;
+static NSMutableDictionary<NSString *, NSNumber *> *counters;
+static POBRNLatencyHistogram *latency;
+static NSUInteger queueDepth = 0;
+static nw_path_monitor_t pathMonitor API_AVAILABLE(ios(12.0));
+
+@implementation POBRNNoticeDispatcher
+
++ (void)initialize {
+    if (self == [POBRNNoticeDispatcher class]) {
+        queue = dispatch_queue_create("com.pubmatic.openwrap.reactnative.notices", DISPATCH_QUEUE_SERIAL);
+        notices = [NSMutableArray new];
+        counters = [NSMutableDictionary new];
+        latency = [POBRNLatencyHistogram new];
+        NSURLSessionConfiguration *configuration = [NSURLSessionConfiguration ephemeralSessionConfiguration];
+        configuration.timeoutIntervalForRequest = POBRNNoticeTimeout;
+        configuration.HTTPMaximumConnectionsPerHost = POBRNNoticeMaxRequestsPerBatch;
+        session = [NSURLSession sessionWithConfiguration:configuration];
+    }
+}
+
++ (void)start {
+    @synchronized (self) {
+        if (started) {
+            return;
+        }
+        started = YES;
+    }
+    NSURL *directory = [[NSFileManager defaultManager] URLsForDirectory:NSApplicationSupportDirectory
+                                                               inDomains:NSUserDomainMask].firstObject;
+    dispatch_async(queue, ^{
+        [[NSFileManager defaultManager] createDirectoryAtURL:directory
+                                 withIntermediateDirectories:YES
+                                                  attributes:nil
+                                                       error:nil];
+        queueFile = [directory URLByAppendingPathComponent:POBRNNoticeQueueFileName];
+        [self restoreQueue];
+        [self scheduleFlushAfter:0];
+    });
+    if (@available(iOS 12.0, *)) {
+        pathMonitor = nw_path_monitor_create();
+        nw_path_monitor_set_queue(pathMonitor, queue);
+        nw_path_monitor_set_update_handler(pathMonitor, ^(nw_path_t path) {
+            [self connectivityChanged:nw_path_get_status(path) == nw_path_status_satisfied];
+        });
+        nw_path_monitor_start(pathMonitor);
+    }
+}
+
++ (void)enqueueURL:(NSString *)url {
+    NSCharacterSet *separators = [NSCharacterSet characterSetWithCharactersInString:@"\t\r\n"];
+    if (![url hasPrefix:@"http"] || [url rangeOfCharacterFromSet:separators].location != NSNotFound || ![NSURL URLWithString:url]) {
+        RCTLogWarn(@"Ignoring the invalid notice URL %@", url);
+        return;
+    }
+    int64_t enqueuedMillis = [self currentMillis];
+    dispatch_async(queue, ^{
+        POBRNNotice *notice = [POBRNNotice new];
+        notice.noticeId = nextId++;
+        notice.url = url;
+        notice.enqueuedMillis = enqueuedMillis;
+        [notices addObject:notice];
+        [self appendRecords:@[[self enqueuedRecord:notice]]];
+        [self incrementCounter:@"enqueued"];
+        // Drop the oldest notices above the queue capacity.
+        while (notices.count > POBRNNoticeMaxQueueSize) {
+            POBRNNotice *oldest = notices.firstObject;
+            [notices removeObjectAtIndex:0];
+            [self appendRecords:@[[self doneRecord:oldest]]];
+            [self incrementCounter:@"dropped"];
+        }
+        [self updateQueueDepth];
+        [self scheduleFlushAfter:POBRNNoticeBatchDelayMillis];
+    });
+}
+
++ (NSDictionary *)stats {
+    @synchronized (counters) {
+        return @{
+            @"queueDepth": @(queueDepth),
+            @"enqueued": counters[@"enqueued"] ?: @0,
+            @"delivered": counters[@"delivered"] ?: @0,
+            @"retries": counters[@"retries"] ?: @0,
+            @"dropped": counters[@"dropped"] ?: @0,
+            @"restored": counters[@"restored"] ?: @0,
+            @"latencyP50Millis": @([latency valueAtPercentile:50]),
+            @"latencyP95Millis": @([latency valueAtPercentile:95]),
+            @"latencyMaxMillis": @(latency.max)
+        };
+    }
+}
+
++ (void)resetStats {
+    @synchronized (counters) {
+        [counters removeAllObjects];
+        [latency reset];
+    }
+}
+
+#pragma mark - Private methods
+
++ (void)restoreQueue {
+    NSString *text = [NSString stringWithContentsOfURL:queueFile encoding:NSUTF8StringEncoding error:nil] ?: @"";
+    NSArray<NSString *> *lines = [text componentsSeparatedByString:@"\n"];
+    NSMutableDictionary<NSNumber *, POBRNNotice *> *restored = [NSMutableDictionary new];
+    // The last record is incomplete, i.e. without separator, if the app was killed while writing it.
+    for (NSUInteger index = 0; index + 1 < lines.count; index++) {
+        NSArray<NSString *> *fields = [lines[index] componentsSeparatedByString:@"\t"];
+        if (fields.count < 2) {
+            continue;
+        }
+        NSNumber *noticeId = @(fields[1].longLongValue);
+        if ([fields[0] isEqualToString:POBRNNoticeEnqueuedRecord] && fields.count == 4) {
+            POBRNNotice *notice = [POBRNNotice new];
+            notice.noticeId = noticeId.longLongValue;
+            notice.enqueuedMillis = fields[2].longLongValue;
+            notice.url = fields[3];
+            restored[noticeId] = notice;
+            nextId = MAX(nextId, notice.noticeId + 1);
+        } else if ([fields[0] isEqualToString:POBRNNoticeDoneRecord]) {
+            [restored removeObjectForKey:noticeId];
+        }
+    }
+    int64_t now = [self currentMillis];
+    NSUInteger expired = 0;
+    NSArray *ids = [restored.allKeys sortedArrayUsingSelector:@selector(compare:)];
+    for (NSNumber *noticeId in ids) {
+        POBRNNotice *notice = restored[noticeId];
+        if (now - notice.enqueuedMillis > POBRNNoticeMaxAgeMillis) {
+            expired++;
+        } else {
+            [notices addObject:notice];
+        }
+    }
+    [self incrementCounter:@"restored" by:notices.count];
+    [self incrementCounter:@"dropped" by:expired];
+    [self updateQueueDepth];
+    // Start from a file holding the restored notices only.
+    [self compact];
+}
+
+/** Schedules a batch in the given delay, unless one is scheduled earlier. The batches are kept one batch delay apart. */
++ (void)scheduleFlushAfter:(int64_t)delayMillis {
+    if (offline || flushing || notices.count == 0) {
+        return;
+    }
+    int64_t now = [self currentMillis];
+    int64_t millis = MAX(now + delayMillis, lastBatchMillis + POBRNNoticeBatchDelayMillis);
+    if (flushScheduled && flushMillis <= millis) {
+        return;
+    }
+    flushScheduled = YES;
+    flushMillis = millis;
+    NSUInteger generation = ++flushGeneration;
+    dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (millis - now) * NSEC_PER_MSEC), queue, ^{
+        if (generation == flushGeneration) {
+            [self flush];
+        }
+    });
+}
+
++ (void)flush {
+    flushScheduled = NO;
+    if (offline) {
+        return;
+    }
+    int64_t now = [self currentMillis];
+    lastBatchMillis = now;
+    NSMutableArray<POBRNNotice *> *batch = [NSMutableArray new];
+    for (POBRNNotice *notice in notices) {
+        if (notice.nextAttemptMillis <= now) {
+            [batch addObject:notice];
+            if (batch.count == POBRNNoticeMaxRequestsPerBatch) {
+                break;
+            }
+        }
+    }
+    if (batch.count == 0) {
+        [self scheduleNextFlush];
+        return;
+    }
+    flushing = YES;
+    dispatch_group_t group = dispatch_group_create();
+    NSMutableDictionary<NSNumber *, NSNumber *> *results = [NSMutableDictionary new];
+    for (POBRNNotice *notice in batch) {
+        if (now - notice.enqueuedMillis > POBRNNoticeMaxAgeMillis) {
+            results[@(notice.noticeId)] = @(POBRNNoticeResultRejected);
+            continue;
+        }
+        dispatch_group_enter(group);
+        [[session dataTaskWithURL:[NSURL URLWithString:notice.url]
+                completionHandler:^(NSData *data, NSURLResponse *response, NSError *error) {
+            POBRNNoticeResult result = [self resultForResponse:response error:error];
+            dispatch_async(queue, ^{
+                results[@(notice.noticeId)] = @(result);
+                dispatch_group_leave(group);
+            });
+        }] resume];
+    }
+    dispatch_group_notify(group, queue, ^{
+        flushing = NO;
+        [self completeBatch:batch withResults:results];
+    });
+}
+
++ (void)completeBatch:(NSArray<POBRNNotice *> *)batch withResults:(NSDictionary<NSNumber *, NSNumber *> *)results {
+    NSMutableArray<NSString *> *records = [NSMutableArray new];
+    for (POBRNNotice *notice in batch) {
+        POBRNNoticeResult result = results[@(notice.noticeId)].integerValue;
+        if (result == POBRNNoticeResultFailed) {
+            notice.attempts++;
+            if (notice.attempts < POBRNNoticeMaxAttempts) {
+                notice.nextAttemptMillis = [self currentMillis] + [self backoffMillisForAttempts:notice.attempts];
+                [self incrementCounter:@"retries"];
+                continue;
+            }
+        }
+        [notices removeObject:notice];
+        [records addObject:[self doneRecord:notice]];
+        if (result == POBRNNoticeResultDelivered) {
+            @synchronized (counters) {
+                [self incrementCounter:@"delivered"];
+                [latency recordValue:(uint64_t)MAX([self currentMillis] - notice.enqueuedMillis, 0)];
+            }
+        } else {
+            [self incrementCounter:@"dropped"];
+            RCTLogInfo(@"Dropping the notice %@", notice.url);
+        }
+    }
+    [self appendRecords:records];
+    doneRecords += records.count;
+    if (doneRecords >= POBRNNoticeCompactThreshold && doneRecords > notices.count) {
+        [self compact];
+    }
+    [self updateQueueDepth];
+    [self scheduleNextFlush];
+}
+
++ (void)scheduleNextFlush {
+    if (notices.count == 0) {
+        return;
+    }
+    int64_t nextAttemptMillis = INT64_MAX;
+    for (POBRNNotice *notice in notices) {
+        nextAttemptMillis = MIN(nextAttemptMillis, notice.nextAttemptMillis);
+    }
+    [self scheduleFlushAfter:MAX(nextAttemptMillis - [self currentMillis], 0)];
+}
+
+/** Returns the result of a notice request: a client error is not retried. */
++ (POBRNNoticeResult)resultForResponse:(nullable NSURLResponse *)response error:(nullable NSError *)error {
+    if (error || ![response isKindOfClass:[NSHTTPURLResponse class]]) {
+        return POBRNNoticeResultFailed;
+    }
+    NSInteger statusCode = ((NSHTTPURLResponse *)response).statusCode;
+    if (statusCode < 400) {
+        return POBRNNoticeResultDelivered;
+    }
+    return (statusCode == 408 || statusCode == 429 || statusCode >= 500) ? POBRNNoticeResultFailed : POBRNNoticeResultRejected;
+}
+
+/**
+ * Returns the delay before the given retry: exponential, capped, with up to 20% of random jitter
+ * so that the clients do not retry in sync.
+ */
++ (int64_t)backoffMillisForAttempts:(NSUInteger)attempts {
+    int64_t backoff = MIN(POBRNNoticeInitialBackoffMillis << MIN(attempts - 1, 20), POBRNNoticeMaxBackoffMillis);
+    return backoff + arc4random_uniform((uint32_t)(backoff / 5 + 1));
+}
+
++ (void)connectivityChanged:(BOOL)connected {
+    BOOL wasOffline = offline;
+    offline = !connected;
+    if (wasOffline && connected) {
+        for (POBRNNotice *notice in notices) {
+            notice.nextAttemptMillis = 0;
+        }
+        [self scheduleFlushAfter:0];
+    }
+}
+
++ (void)appendRecords:(NSArray<NSString *> *)records {
+    if (!queueFile || records.count == 0) {
+        return;
+    }
+    NSMutableString *text = [NSMutableString new];
+    for (NSString *record in records) {
+        [text appendFormat:@"%@\n", record];
+    }
+    NSData *data = [text dataUsingEncoding:NSUTF8StringEncoding];
+    if (![[NSFileManager defaultManager] fileExistsAtPath:queueFile.path]) {
+        [data writeToURL:queueFile atomically:NO];
+        return;
+    }
+    NSError *error = nil;
+    NSFileHandle *handle = [NSFileHandle fileHandleForWritingToURL:queueFile error:&error];
+    if (!handle) {
+        RCTLogWarn(@"Unable to persist the notice queue: %@", error.localizedDescription);
+        return;
+    }
+    [handle seekToEndOfFile];
+    [handle writeData:data];
+    [handle closeFile];
+}
+
+/** Rewrites the queue file with the queued notices only. */
++ (void)compact {
+    if (!queueFile) {
+        return;
+    }
+    NSMutableString *text = [NSMutableString new];
+    for (POBRNNotice *notice in notices) {
+        [text appendFormat:@"%@\n", [self enqueuedRecord:notice]];
+    }
+    NSError *error = nil;
+    if ([text writeToURL:queueFile atomically:YES encoding:NSUTF8StringEncoding error:&error]) {
+        doneRecords = 0;
+    } else {
+        RCTLogWarn(@"Unable to persist the notice queue: %@", error.localizedDescription);
+    }
+}
+
++ (NSString *)enqueuedRecord:(POBRNNotice *)notice {
+    return [NSString stringWithFormat:@"%@\t%lld\t%lld\t%@", POBRNNoticeEnqueuedRecord, notice.noticeId, notice.enqueuedMillis, notice.url];
+}
+
++ (NSString *)doneRecord:(POBRNNotice *)notice {
+    return [NSString stringWithFormat:@"%@\t%lld", POBRNNoticeDoneRecord, notice.noticeId];
+}
+
++ (void)updateQueueDepth {
+    @synchronized (counters) {
+        queueDepth = notices.count;
+    }
+}
+
++ (void)incrementCounter:(NSString *)key {
+    [self incrementCounter:key by:1];
+}
+
++ (void)incrementCounter:(NSString *)key by:(NSUInteger)value {
+    @synchronized (counters) {
+        counters[key] = @(counters[key].unsignedLongLongValue + value);
+    }
+}
+
++ (int64_t)currentMillis {
+    return (int64_t)([NSDate date].timeIntervalSince1970 * 1000);
+}
+
+@end
@@ -0,0 +1,28 @@
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * Runs the plugin startup once: the bundled configuration, the GAM start, the resume of the notices
+ * queued by the previous sessions and the web view prewarm.
+ *
+ * It starts once the app did finish launching, so that apps which only use the banner or full screen
+ * ads, or load an ad before their first OpenWrapSDK call, get it too, while OpenWrapSDKModule is still
+ * created lazily. The work runs on a background queue, only the prewarm being left to the main queue.
+ */
+@interface POBRNPluginStartup : NSObject
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/** Starts the plugin, if not started yet. It may be called from any thread. */
++ (void)start;
+
+/**
+ * Blocks until the bundled configuration is applied, so that it never overrides a value set by JS.
+ * Starts the plugin if not started yet.
+ */
++ (void)waitUntilConfigured;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,56 @@
+#import "POBRNPluginStartup.h"
+#import <UIKit/UIKit.h>
+#import "POBRNGamEventHandlers.h"
+#import "POBRNNoticeDispatcher.h"
+#import "POBRNSDKConfigurator.h"
+#import "POBRNWebViewPool.h"
+
+static dispatch_group_t configGroup;
+
+@implementation POBRNPluginStartup
+
++ (void)initialize {
+    if (self == [POBRNPluginStartup class]) {
+        configGroup = dispatch_group_create();
+    }
+}
+
+// Not an exported module, so it may define +load, unlike OpenWrapSDKModule whose +load is RCT_EXPORT_MODULE's.
++ (void)load {
+    [[NSNotificationCenter defaultCenter] addObserver:self
+                                             selector:@selector(applicationDidFinishLaunching:)
+                                                 name:UIApplicationDidFinishLaunchingNotification
+                                               object:nil];
+}
+
++ (void)applicationDidFinishLaunching:(NSNotification *)notification {
+    [[NSNotificationCenter defaultCenter] removeObserver:self
+                                                    name:UIApplicationDidFinishLaunchingNotification
+                                                  object:nil];
+    [self start];
+}
+
++ (void)start {
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        dispatch_group_async(configGroup, dispatch_get_global_queue(QOS_CLASS_UTILITY, 0), ^{
+            // Apply the bundled configuration, if any, before the JS bundle uses the SDK.
+            [POBRNSDKConfigurator applyBundledConfig];
+            // Start GAM, if included, in parallel with the first auction.
+            [POBRNGamEventHandlers start];
+            // Resume the delivery of the notices queued by the previous sessions.
+            [POBRNNoticeDispatcher start];
+        });
+        // Warm WebKit once the app is idle, ahead of the first creative render.
+        dispatch_async(dispatch_get_main_queue(), ^{
+            [POBRNWebViewPool prewarm];
+        });
+    });
+}
+
++ (void)waitUntilConfigured {
+    [self start];
+    dispatch_group_wait(configGroup, DISPATCH_TIME_FOREVER);
+}
+
+@end
@@ -0,0 +1,74 @@
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * Schedules the loads of the full screen ads, so the ads preloaded ahead of their show do not expire
+ * unseen, each expiry being a wasted auction, creative download and render.
+ *
+ * Per ad unit, it learns from the ads of the session:
+ * - the time from the load call to the show of the ad, and the validity of a bid, from the receipt
+ *   to the expiry of the ad, as moving averages;
+ * - the expiry rate of the ads received, as a moving average of the received ads expired unseen.
+ *
+ * When enabled, a load is deferred until the predicted show falls within the bid validity window,
+ * with a margin: by the predicted load to show time, minus 80% of the validity. An ad unit whose
+ * expiry rate exceeds 50% is throttled: its loads wait while one of its ads is received and not
+ * shown yet. The wasted auctions, the received ads expired unseen, and their creative bytes are
+ * accounted for even if disabled.
+ *
+ * All the methods are expected to be called on the main thread, except the stats ones.
+ */
+@interface POBRNPreloadScheduler : NSObject
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/** Enables or disables the deferral of the loads. Disabling starts the deferred loads right away. */
+@property (class, nonatomic, getter=isEnabled) BOOL enabled;
+
+/**
+ * Runs the load of an ad now, or once its predicted show falls within the bid validity window.
+ * A load scheduled earlier for the same ad is replaced.
+ * @param load Starts the load, run on the main thread.
+ */
++ (void)scheduleLoadForAdUnitId:(NSString *)adUnitId
+                     instanceId:(NSString *)instanceId
+                           load:(dispatch_block_t)load;
+
+/** Returns YES if the load of an ad is deferred or throttled, i.e. scheduled and not started yet. */
++ (BOOL)isDeferred:(NSString *)instanceId;
+
+/**
+ * Starts the deferred or throttled load of an ad right away, e.g. when a show point cannot wait for it.
+ * The time from the load call is still learned from the original call.
+ * @return YES if a load was started, NO if none was deferred.
+ */
++ (BOOL)runNow:(NSString *)instanceId;
+
+/**
+ * Records the receipt of an ad.
+ * @param bytes Size of the creative, counted as wasted if the ad expires unseen.
+ */
++ (void)adDidReceive:(NSString *)instanceId bytes:(NSUInteger)bytes;
+
+/** Records the show of an ad, learning the time from its load call. */
++ (void)adDidShow:(NSString *)instanceId;
+
+/** Records the expiry of an ad, learning the bid validity, and accounts for the wasted auction. */
++ (void)adDidExpire:(NSString *)instanceId;
+
+/** Cancels the deferred load of an ad and forgets it, e.g. when the ad is destroyed. */
++ (void)cancelInstanceId:(NSString *)instanceId;
+
+/**
+ * Returns per ad unit the loads, the loads deferred, the ads received, shown and expired, the wasted
+ * bytes, and what is learned: the show and expiry rates, the load to show time and the bid validity.
+ */
++ (NSDictionary *)stats;
+
+/** Removes the stats, keeping what is learned of the ad units. */
++ (void)resetStats;
+
+@end
+
+NS_ASSUME_NONNULL_END
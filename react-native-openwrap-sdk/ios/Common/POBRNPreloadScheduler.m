@@ -0,0 +1,347 @@
+#import "POBRNPreloadScheduler.h"
+#import <QuartzCore/QuartzCore.h>
+
+// Validity of a bid until one expired on the ad unit, in seconds.
+static const NSTimeInterval POBRNDefaultValidity = 30 * 60;
+// Share of the bid validity within which the predicted show must fall.
+static const double POBRNValidityMargin = 0.8;
+// Expiry rate above which the loads of an ad unit are throttled.
+static const double POBRNMaxExpiryRate = 0.5;
+// Number of received ads shown or expired before an ad unit can be throttled.
+static const NSUInteger POBRNMinSamples = 5;
+// Weight of the latest sample in the moving averages.
+static const double POBRNSmoothing = 0.2;
+
+/** What is learned of an ad unit, with its stats. */
+@interface POBRNPreloadPlacement : NSObject
+
+@property (nonatomic, assign) NSTimeInterval loadToShowTime;
+@property (nonatomic, assign) NSTimeInterval validity;
+@property (nonatomic, assign) double expiryRate;
+@property (nonatomic, assign) NSUInteger samples;
+@property (nonatomic, assign) BOOL hasShown;
+@property (nonatomic, assign) BOOL hasExpired;
+// Ads received and neither shown nor expired yet.
+@property (nonatomic, assign) NSInteger idleAds;
+@property (nonatomic, strong) NSMutableDictionary<NSString *, dispatch_block_t> *throttledLoads;
+
+@property (nonatomic, assign) NSUInteger loads;
+@property (nonatomic, assign) NSUInteger deferredLoads;
+@property (nonatomic, assign) NSUInteger received;
+@property (nonatomic, assign) NSUInteger shown;
+@property (nonatomic, assign) NSUInteger expired;
+@property (nonatomic, assign) unsigned long long wastedBytes;
+
+@property (nonatomic, readonly, getter=isThrottled) BOOL throttled;
+
+@end
+
+@implementation POBRNPreloadPlacement
+
+- (instancetype)init {
+    self = [super init];
+    if (self) {
+        _validity = POBRNDefaultValidity;
+        _throttledLoads = [NSMutableDictionary dictionary];
+    }
+    return self;
+}
+
+- (BOOL)isThrottled {
+    return self.samples >= POBRNMinSamples && self.expiryRate > POBRNMaxExpiryRate;
+}
+
+@end
+
+/** An ad between its load call and its show or expiry. */
+@interface POBRNPreloadAd : NSObject
+
+@property (nonatomic, copy) NSString *adUnitId;
+@property (nonatomic, assign) NSTimeInterval loadTime;
+@property (nonatomic, assign) NSTimeInterval receivedTime;
+@property (nonatomic, assign) NSUInteger bytes;
+// Load deferred by the scheduler, with its cancellable wrapper dispatched on the main queue.
+@property (nonatomic, copy, nullable) dispatch_block_t load;
+@property (nonatomic, copy, nullable) dispatch_block_t deferredLoad;
+
+@end
+
+@implementation POBRNPreloadAd
+@end
+
+static BOOL enabled;
+static NSMutableDictionary<NSString *, POBRNPreloadPlacement *> *placements;
+static NSMutableDictionary<NSString *, POBRNPreloadAd *> *ads;
+
+@implementation POBRNPreloadScheduler
+
++ (void)initialize {
+    if (self == [POBRNPreloadScheduler class]) {
+        placements = [NSMutableDictionary dictionary];
+        ads = [NSMutableDictionary dictionary];
+    }
+}
+
+#pragma mark - Public methods
+
++ (BOOL)isEnabled {
+    return enabled;
+}
+
++ (void)setEnabled:(BOOL)isEnabled {
+    enabled = isEnabled;
+    if (isEnabled) {
+        return;
+    }
+    NSMutableArray<dispatch_block_t> *loads = [NSMutableArray array];
+    @synchronized (self) {
+        for (POBRNPreloadAd *ad in ads.allValues) {
+            if (ad.deferredLoad) {
+                // A cancelled block no longer runs, the load itself is started.
+                dispatch_block_cancel(ad.deferredLoad);
+                [loads addObject:ad.load];
+                ad.load = nil;
+                ad.deferredLoad = nil;
+            }
+        }
+        for (POBRNPreloadPlacement *placement in placements.allValues) {
+            [loads addObjectsFromArray:placement.throttledLoads.allValues];
+            [placement.throttledLoads removeAllObjects];
+        }
+    }
+    [self runLoads:loads];
+}
+
++ (void)scheduleLoadForAdUnitId:(NSString *)adUnitId
+                     instanceId:(NSString *)instanceId
+                           load:(dispatch_block_t)load {
+    [self cancelInstanceId:instanceId];
+    NSTimeInterval delay = 0;
+    dispatch_block_t deferredLoad = nil;
+    @synchronized (self) {
+        POBRNPreloadPlacement *placement = placements[adUnitId];
+        if (!placement) {
+            placement = [POBRNPreloadPlacement new];
+            placements[adUnitId] = placement;
+        }
+        POBRNPreloadAd *ad = [POBRNPreloadAd new];
+        ad.adUnitId = adUnitId;
+        ad.loadTime = CACurrentMediaTime();
+        ads[instanceId] = ad;
+        placement.loads++;
+        if (enabled && placement.isThrottled && placement.idleAds > 0) {
+            placement.deferredLoads++;
+            placement.throttledLoads[instanceId] = [load copy];
+            return;
+        }
+        if (enabled && placement.hasShown) {
+            delay = MAX(0, placement.loadToShowTime - POBRNValidityMargin * placement.validity);
+        }
+        if (delay > 0) {
+            placement.deferredLoads++;
+            // Cancellable, the ad may be destroyed or loaded again meanwhile.
+            deferredLoad = dispatch_block_create(0, ^{
+                @synchronized (self) {
+                    ad.load = nil;
+                    ad.deferredLoad = nil;
+                }
+                load();
+            });
+            ad.load = load;
+            ad.deferredLoad = deferredLoad;
+        }
+    }
+    if (deferredLoad) {
+        dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)(delay * NSEC_PER_SEC)), dispatch_get_main_queue(), deferredLoad);
+    } else {
+        load();
+    }
+}
+
++ (BOOL)isDeferred:(NSString *)instanceId {
+    @synchronized (self) {
+        POBRNPreloadAd *ad = ads[instanceId];
+        if (!ad) {
+            return NO;
+        }
+        return ad.deferredLoad != nil || placements[ad.adUnitId].throttledLoads[instanceId] != nil;
+    }
+}
+
++ (BOOL)runNow:(NSString *)instanceId {
+    dispatch_block_t load = nil;
+    @synchronized (self) {
+        POBRNPreloadAd *ad = ads[instanceId];
+        if (!ad) {
+            return NO;
+        }
+        if (ad.deferredLoad) {
+            // A cancelled block no longer runs, the load itself is started.
+            dispatch_block_cancel(ad.deferredLoad);
+            load = ad.load;
+            ad.load = nil;
+            ad.deferredLoad = nil;
+        } else {
+            POBRNPreloadPlacement *placement = placements[ad.adUnitId];
+            load = placement.throttledLoads[instanceId];
+            [placement.throttledLoads removeObjectForKey:instanceId];
+        }
+    }
+    if (!load) {
+        return NO;
+    }
+    load();
+    return YES;
+}
+
++ (void)adDidReceive:(NSString *)instanceId bytes:(NSUInteger)bytes {
+    @synchronized (self) {
+        POBRNPreloadAd *ad = ads[instanceId];
+        POBRNPreloadPlacement *placement = placements[ad.adUnitId ?: @""];
+        if (!placement) {
+            return;
+        }
+        if (ad.receivedTime == 0) {
+            placement.idleAds++;
+        }
+        ad.receivedTime = CACurrentMediaTime();
+        ad.bytes = bytes;
+        placement.received++;
+    }
+}
+
++ (void)adDidShow:(NSString *)instanceId {
+    NSArray<dispatch_block_t> *loads = nil;
+    @synchronized (self) {
+        POBRNPreloadAd *ad = ads[instanceId];
+        POBRNPreloadPlacement *placement = placements[ad.adUnitId ?: @""];
+        if (!placement) {
+            return;
+        }
+        [ads removeObjectForKey:instanceId];
+        NSTimeInterval loadToShowTime = CACurrentMediaTime() - ad.loadTime;
+        placement.loadToShowTime = placement.hasShown
+            ? placement.loadToShowTime + POBRNSmoothing * (loadToShowTime - placement.loadToShowTime)
+            : loadToShowTime;
+        placement.hasShown = YES;
+        placement.shown++;
+        loads = [self settleAd:ad placement:placement expired:NO];
+    }
+    [self runLoads:loads];
+}
+
++ (void)adDidExpire:(NSString *)instanceId {
+    NSArray<dispatch_block_t> *loads = nil;
+    @synchronized (self) {
+        POBRNPreloadAd *ad = ads[instanceId];
+        POBRNPreloadPlacement *placement = placements[ad.adUnitId ?: @""];
+        if (!placement) {
+            return;
+        }
+        [ads removeObjectForKey:instanceId];
+        if (ad.receivedTime > 0) {
+            NSTimeInterval validity = CACurrentMediaTime() - ad.receivedTime;
+            placement.validity = placement.hasExpired
+                ? placement.validity + POBRNSmoothing * (validity - placement.validity)
+                : validity;
+            placement.hasExpired = YES;
+        }
+        placement.expired++;
+        placement.wastedBytes += ad.bytes;
+        loads = [self settleAd:ad placement:placement expired:YES];
+    }
+    [self runLoads:loads];
+}
+
++ (void)cancelInstanceId:(NSString *)instanceId {
+    NSArray<dispatch_block_t> *loads = nil;
+    @synchronized (self) {
+        POBRNPreloadAd *ad = ads[instanceId];
+        POBRNPreloadPlacement *placement = placements[ad.adUnitId ?: @""];
+        if (!placement) {
+            return;
+        }
+        [ads removeObjectForKey:instanceId];
+        if (ad.deferredLoad) {
+            dispatch_block_cancel(ad.deferredLoad);
+        }
+        [placement.throttledLoads removeObjectForKey:instanceId];
+        if (ad.receivedTime > 0) {
+            placement.idleAds--;
+            loads = [self releaseThrottledLoadsOfPlacement:placement];
+        }
+    }
+    [self runLoads:loads];
+}
+
++ (NSDictionary *)stats {
+    @synchronized (self) {
+        NSMutableArray<NSDictionary *> *adUnits = [NSMutableArray array];
+        [placements enumerateKeysAndObjectsUsingBlock:^(NSString *adUnitId, POBRNPreloadPlacement *placement, BOOL *stop) {
+            [adUnits addObject:@{
+                @"adUnitId": adUnitId,
+                @"loads": @(placement.loads),
+                @"deferredLoads": @(placement.deferredLoads),
+                @"received": @(placement.received),
+                @"shown": @(placement.shown),
+                @"wastedAuctions": @(placement.expired),
+                @"wastedBytes": @(placement.wastedBytes),
+                @"showRate": @(placement.received == 0 ? 0 : (double)placement.shown / placement.received),
+                @"expiryRate": @(placement.expiryRate),
+                @"loadToShowMillis": @((long long)(placement.loadToShowTime * 1000)),
+                @"validityMillis": @((long long)(placement.validity * 1000)),
+                @"throttled": @(placement.isThrottled)
+            }];
+        }];
+        return @{ @"adUnits": adUnits };
+    }
+}
+
++ (void)resetStats {
+    @synchronized (self) {
+        for (POBRNPreloadPlacement *placement in placements.allValues) {
+            placement.loads = 0;
+            placement.deferredLoads = 0;
+            placement.received = 0;
+            placement.shown = 0;
+            placement.expired = 0;
+            placement.wastedBytes = 0;
+        }
+    }
+}
+
+#pragma mark - Private methods
+
+// Updates the expiry rate with a received ad shown or expired, returns the throttled loads to start.
++ (nullable NSArray<dispatch_block_t> *)settleAd:(POBRNPreloadAd *)ad
+                                       placement:(POBRNPreloadPlacement *)placement
+                                         expired:(BOOL)expired {
+    if (ad.deferredLoad) {
+        dispatch_block_cancel(ad.deferredLoad);
+    }
+    if (ad.receivedTime == 0) {
+        return nil;
+    }
+    placement.expiryRate += POBRNSmoothing * ((expired ? 1.0 : 0.0) - placement.expiryRate);
+    placement.samples++;
+    placement.idleAds--;
+    return [self releaseThrottledLoadsOfPlacement:placement];
+}
+
+// Returns the throttled loads of an ad unit, once none of its ads is waiting for a show.
++ (nullable NSArray<dispatch_block_t> *)releaseThrottledLoadsOfPlacement:(POBRNPreloadPlacement *)placement {
+    if (placement.idleAds > 0 && placement.isThrottled) {
+        return nil;
+    }
+    NSArray<dispatch_block_t> *loads = placement.throttledLoads.allValues;
+    [placement.throttledLoads removeAllObjects];
+    return loads;
+}
+
++ (void)runLoads:(nullable NSArray<dispatch_block_t> *)loads {
+    for (dispatch_block_t load in loads) {
+        load();
+    }
+}
+
+@end
@@ -0,0 +1,92 @@
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/** A coalesced load of a full screen ad. */
+@protocol POBRNCoalescedFlight <NSObject>
+
+/** Starts the auction. */
+- (void)startFlight;
+
+/** Fails the load with the error of the leader, without an auction. */
+- (void)failFlightWithError:(NSError *)error;
+
+@end
+
+/** An enum to represent the reasons an auction was avoided, reported in the stats. */
+typedef NS_ENUM(NSInteger, POBRNAvoidedAuction) {
+    /** Load of an ad which is already loading. */
+    POBRNAvoidedAuctionDuplicate = 0,
+    /** Queued full screen load failed with the no fill of its leader. */
+    POBRNAvoidedAuctionSharedNoFill,
+    /** Banner load adopted from a parked banner. */
+    POBRNAvoidedAuctionAdopted,
+    POBRNAvoidedAuctionCount
+};
+
+/**
+ * Coalesces identical concurrent ad requests, keyed by publisher id, profile id, ad unit id and the
+ * hash of the request and impression parameters. A bid is rendered once only, so a request cannot
+ * share the ad of another one, instead:
+ * - A load of an ad already loading is ignored.
+ * - Full screen loads of the same key run one at a time, a load queued behind the running one, the
+ *   leader, starts once the leader completes. If the leader has no fill, the queued loads fail with
+ *   the same error without an auction.
+ * - A banner destroyed while its load is in flight is parked for 3 seconds, so that a banner created
+ *   with the same key, e.g. on a remount, adopts the load instead of starting another.
+ *
+ * All the methods are expected to be called on the main thread, except the stats ones.
+ */
+@interface POBRNRequestCoalescer : NSObject
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/** Returns the coalescing key of a request. */
++ (NSString *)keyWithPublisherId:(NSString *)publisherId
+                       profileId:(NSNumber *)profileId
+                        adUnitId:(NSString *)adUnitId
+               requestParameters:(nullable NSString *)requestParameters
+            impressionParameters:(nullable NSString *)impressionParameters;
+
+/**
+ * Loads the given full screen ad, now if no other load of the key is running, otherwise once the
+ * running one completes.
+ */
++ (void)loadFlight:(id<POBRNCoalescedFlight>)flight forKey:(NSString *)key adUnitId:(NSString *)adUnitId;
+
+/**
+ * Completes the load of the given full screen ad, or removes it from the queue, and starts the next
+ * queued load of the key.
+ *
+ * @param error The load error, nil if the ad is received or the load is cancelled.
+ */
++ (void)completeFlight:(id<POBRNCoalescedFlight>)flight
+                forKey:(NSString *)key
+              adUnitId:(NSString *)adUnitId
+                 error:(nullable NSError *)error;
+
+/**
+ * Parks a banner whose load is in flight, until it is adopted or the expiry block is called after
+ * 3 seconds. A banner already parked with the same key expires right away.
+ */
++ (void)parkObject:(id)object forKey:(NSString *)key expiryBlock:(dispatch_block_t)expiryBlock;
+
+/** Returns the banner parked with the given key, if any, which is then no longer parked. */
++ (nullable id)adoptObjectForKey:(NSString *)key adUnitId:(NSString *)adUnitId;
+
++ (void)recordAuctionForAdUnitId:(NSString *)adUnitId;
+
++ (void)recordAvoidedAuction:(POBRNAvoidedAuction)reason forAdUnitId:(NSString *)adUnitId;
+
+/**
+ * Returns the stats of every ad unit. Each entry contains adUnitId, the number of auctions started,
+ * of loads queued and of auctions avoided, in total and per reason.
+ */
++ (NSArray<NSDictionary *> *)stats;
+
+/** Removes all the stats. */
++ (void)resetStats;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,195 @@
+#import "POBRNRequestCoalescer.h"
+#import <OpenWrapSDK/OpenWrapSDK.h>
+
+static const NSTimeInterval POBRNParkTimeout = 3.0;
+
+@interface POBRNParkedEntry : NSObject
+@property (nonatomic, strong) id object;
+@property (nonatomic, copy) dispatch_block_t expiryBlock;
+@end
+
+@implementation POBRNParkedEntry
+@end
+
+@interface POBRNCoalescingCounters : NSObject {
+@public
+    NSUInteger avoided[POBRNAvoidedAuctionCount];
+}
+@property (nonatomic) NSUInteger auctions;
+@property (nonatomic) NSUInteger queued;
+@end
+
+@implementation POBRNCoalescingCounters
+@end
+
+static NSMutableDictionary<NSString *, NSMutableArray<id<POBRNCoalescedFlight>> *> *flights;
+static NSMutableDictionary<NSString *, POBRNParkedEntry *> *parkedEntries;
+static NSMutableDictionary<NSString *, POBRNCoalescingCounters *> *counters;
+static NSMutableArray<NSString *> *counterOrder;
+
+@implementation POBRNRequestCoalescer
+
++ (void)initialize {
+    if (self == [POBRNRequestCoalescer class]) {
+        flights = [NSMutableDictionary new];
+        parkedEntries = [NSMutableDictionary new];
+        counters = [NSMutableDictionary new];
+        counterOrder = [NSMutableArray new];
+    }
+}
+
++ (NSString *)keyWithPublisherId:(NSString *)publisherId
+                       profileId:(NSNumber *)profileId
+                        adUnitId:(NSString *)adUnitId
+               requestParameters:(nullable NSString *)requestParameters
+            impressionParameters:(nullable NSString *)impressionParameters {
+    NSString *parameters = [NSString stringWithFormat:@"%@|%@", requestParameters ?: @"", impressionParameters ?: @""];
+    return [NSString stringWithFormat:@"%@:%@:%@:%lu", publisherId, profileId, adUnitId, (unsigned long)parameters.hash];
+}
+
++ (void)loadFlight:(id<POBRNCoalescedFlight>)flight forKey:(NSString *)key adUnitId:(NSString *)adUnitId {
+    NSMutableArray<id<POBRNCoalescedFlight>> *queue = flights[key];
+    if (!queue) {
+        queue = [NSMutableArray new];
+        flights[key] = queue;
+    }
+    if ([queue indexOfObjectIdenticalTo:flight] != NSNotFound) {
+        [self recordAvoidedAuction:POBRNAvoidedAuctionDuplicate forAdUnitId:adUnitId];
+        return;
+    }
+    [queue addObject:flight];
+    if (queue.count == 1) {
+        [self recordAuctionForAdUnitId:adUnitId];
+        [flight startFlight];
+    } else {
+        @synchronized (counters) {
+            [self countersForAdUnitId:adUnitId].queued++;
+        }
+    }
+}
+
++ (void)completeFlight:(id<POBRNCoalescedFlight>)flight
+                forKey:(NSString *)key
+              adUnitId:(NSString *)adUnitId
+                 error:(nullable NSError *)error {
+    NSMutableArray<id<POBRNCoalescedFlight>> *queue = flights[key];
+    if (!queue) {
+        return;
+    }
+    if (queue.firstObject != flight) {
+        [queue removeObjectIdenticalTo:flight];
+        return;
+    }
+    [queue removeObjectAtIndex:0];
+    if (error.code == POBErrorNoAds) {
+        while (queue.count > 0) {
+            id<POBRNCoalescedFlight> follower = queue.firstObject;
+            [queue removeObjectAtIndex:0];
+            [self recordAvoidedAuction:POBRNAvoidedAuctionSharedNoFill forAdUnitId:adUnitId];
+            [follower failFlightWithError:error];
+        }
+    }
+    id<POBRNCoalescedFlight> next = queue.firstObject;
+    if (next) {
+        [self recordAuctionForAdUnitId:adUnitId];
+        [next startFlight];
+    } else {
+        [flights removeObjectForKey:key];
+    }
+}
+
++ (void)parkObject:(id)object forKey:(NSString *)key expiryBlock:(dispatch_block_t)expiryBlock {
+    POBRNParkedEntry *entry = [POBRNParkedEntry new];
+    entry.object = object;
+    entry.expiryBlock = expiryBlock;
+    POBRNParkedEntry *previous = parkedEntries[key];
+    parkedEntries[key] = entry;
+    if (previous) {
+        previous.expiryBlock();
+    }
+    dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)(POBRNParkTimeout * NSEC_PER_SEC)),
+                   dispatch_get_main_queue(), ^{
+        // Adopted or replaced entries are no longer in the dictionary.
+        if (parkedEntries[key] == entry) {
+            [parkedEntries removeObjectForKey:key];
+            entry.expiryBlock();
+        }
+    });
+}
+
++ (nullable id)adoptObjectForKey:(NSString *)key adUnitId:(NSString *)adUnitId {
+    POBRNParkedEntry *entry = parkedEntries[key];
+    if (!entry) {
+        return nil;
+    }
+    [parkedEntries removeObjectForKey:key];
+    [self recordAvoidedAuction:POBRNAvoidedAuctionAdopted forAdUnitId:adUnitId];
+    return entry.object;
+}
+
++ (void)recordAuctionForAdUnitId:(NSString *)adUnitId {
+    @synchronized (counters) {
+        [self countersForAdUnitId:adUnitId].auctions++;
+    }
+}
+
++ (void)recordAvoidedAuction:(POBRNAvoidedAuction)reason forAdUnitId:(NSString *)adUnitId {
+    @synchronized (counters) {
+        [self countersForAdUnitId:adUnitId]->avoided[reason]++;
+    }
+}
+
++ (NSString *)keyForAvoidedAuction:(POBRNAvoidedAuction)reason {
+    switch (reason) {
+        case POBRNAvoidedAuctionDuplicate:      return @"duplicate";
+        case POBRNAvoidedAuctionSharedNoFill:   return @"sharedNoFill";
+        case POBRNAvoidedAuctionAdopted:        return @"adopted";
+        case POBRNAvoidedAuctionCount:          break;
+    }
+    return @"unknown";
+}
+
++ (NSArray<NSDictionary *> *)stats {
+    NSMutableArray<NSDictionary *> *stats = [NSMutableArray new];
+    @synchronized (counters) {
+        for (NSString *adUnitId in counterOrder) {
+            POBRNCoalescingCounters *entry = counters[adUnitId];
+            NSMutableDictionary *avoidedByReason = [NSMutableDictionary new];
+            NSUInteger avoided = 0;
+            for (NSInteger reason = 0; reason < POBRNAvoidedAuctionCount; reason++) {
+                avoidedByReason[[self keyForAvoidedAuction:reason]] = @(entry->avoided[reason]);
+                avoided += entry->avoided[reason];
+            }
+            [stats addObject:@{
+                @"adUnitId": adUnitId,
+                @"auctions": @(entry.auctions),
+                @"queued": @(entry.queued),
+                @"avoided": @(avoided),
+                @"avoidedByReason": avoidedByReason
+            }];
+        }
+    }
+    return stats;
+}
+
++ (void)resetStats {
+    @synchronized (counters) {
+        [counters removeAllObjects];
+        [counterOrder removeAllObjects];
+    }
+}
+
+#pragma mark - Private methods
+
+/** Expected to be called while holding the counters lock. */
++ (POBRNCoalescingCounters *)countersForAdUnitId:(NSString *)adUnitId {
+    POBRNCoalescingCounters *entry = counters[adUnitId];
+    if (!entry) {
+        entry = [POBRNCoalescingCounters new];
+        counters[adUnitId] = entry;
+        [counterOrder addObject:adUnitId];
+    }
+    return entry;
+}
+
+@end
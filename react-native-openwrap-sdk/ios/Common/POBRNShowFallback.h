@@ -0,0 +1,37 @@
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * Shows the best ready full screen ad of a show group, so a show point is not lost when the ad the
+ * app picked is still loading or its bid expired.
+ *
+ * The ads are added to a group of @c POBRNFullScreenAdManager, interstitials and rewarded ads alike.
+ * In one pass, @c showBestAvailableInGroup:budgetMillis:completion: checks the readiness and the bid
+ * expiry of every ad of the group and shows the ready one with the highest bid price, the first added
+ * on a tie. The ads of the group neither ready nor loading, e.g. failed or expired, load again to
+ * replace it.
+ *
+ * When no ad is ready, the loads of the group deferred by POBRNPreloadScheduler start right away, the show
+ * point being now. When some ads are loading, the show waits up to the latency budget for the first of
+ * them to be received, then gives up. All the methods are expected to be called on the main thread.
+ */
+@interface POBRNShowFallback : NSObject
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/**
+ * Shows the best ready ad of the group and loads the replacements of the others.
+ * @param budgetMillis Time to wait for a loading ad when none is ready, 0 not to wait.
+ * @param completion Called with the instance id of the ad shown, nil if none could be shown in the budget.
+ */
++ (void)showBestAvailableInGroup:(NSString *)group
+                    budgetMillis:(NSTimeInterval)budgetMillis
+                      completion:(void (^)(NSString *_Nullable instanceId))completion;
+
+/** Shows the given ad, once its delegate returns, if a show of one of its groups is waiting. */
++ (void)adDidReceive:(NSString *)instanceId;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,100 @@
+#import "POBRNShowFallback.h"
+#import "POBRNFullScreenAdManager.h"
+#import "POBRNPreloadScheduler.h"
+
+typedef void (^POBRNShowCompletion)(NSString *_Nullable instanceId);
+
+// Completions of the shows waiting for an ad of their group to be received, by group.
+static NSMutableDictionary<NSString *, POBRNShowCompletion> *pendingShows;
+
+@implementation POBRNShowFallback
+
++ (void)initialize {
+    if (self == [POBRNShowFallback class]) {
+        pendingShows = [NSMutableDictionary dictionary];
+    }
+}
+
+#pragma mark - Public methods
+
++ (void)showBestAvailableInGroup:(NSString *)group
+                    budgetMillis:(NSTimeInterval)budgetMillis
+                      completion:(POBRNShowCompletion)completion {
+    // A newer show of the same group supersedes the waiting one.
+    POBRNShowCompletion pendingCompletion = pendingShows[group];
+    if (pendingCompletion) {
+        [pendingShows removeObjectForKey:group];
+        pendingCompletion(nil);
+    }
+    NSString *instanceId = [self showBestReadyInGroup:group];
+    if (!instanceId) {
+        // The show point is now, the loads deferred by the preload scheduler start right away.
+        for (NSString *groupInstanceId in [POBRNFullScreenAdManager instanceIdsInGroup:group]) {
+            [POBRNPreloadScheduler runNow:groupInstanceId];
+        }
+    }
+    if (instanceId || budgetMillis <= 0 || ![self isLoadingGroup:group]) {
+        completion(instanceId);
+        return;
+    }
+    // Copied, the timeout only fires the completion it was scheduled for.
+    POBRNShowCompletion pendingShow = [completion copy];
+    pendingShows[group] = pendingShow;
+    dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)(budgetMillis * NSEC_PER_MSEC)), dispatch_get_main_queue(), ^{
+        if (pendingShows[group] == pendingShow) {
+            [pendingShows removeObjectForKey:group];
+            pendingShow(nil);
+        }
+    });
+}
+
++ (void)adDidReceive:(NSString *)instanceId {
+    if (pendingShows.count == 0) {
+        return;
+    }
+    for (NSString *group in [POBRNFullScreenAdManager groupsOfInstanceId:instanceId]) {
+        POBRNShowCompletion pendingShow = pendingShows[group];
+        if (pendingShow) {
+            [pendingShows removeObjectForKey:group];
+            dispatch_async(dispatch_get_main_queue(), ^{
+                pendingShow([self showBestReadyInGroup:group]);
+            });
+            return;
+        }
+    }
+}
+
+#pragma mark - Private methods
+
+// Shows the ready ad with the highest bid price and reloads the ads neither ready nor loading.
++ (nullable NSString *)showBestReadyInGroup:(NSString *)group {
+    NSArray<NSString *> *instanceIds = [POBRNFullScreenAdManager instanceIdsInGroup:group];
+    id<POBRNFullScreenAd> bestAd = nil;
+    NSString *bestInstanceId = nil;
+    for (NSString *instanceId in instanceIds) {
+        id<POBRNFullScreenAd> ad = [POBRNFullScreenAdManager adForInstanceId:instanceId];
+        if (ad.isReady && !ad.isBidExpired && (!bestAd || ad.bidPrice > bestAd.bidPrice)) {
+            bestAd = ad;
+            bestInstanceId = instanceId;
+        }
+    }
+    [bestAd showAd];
+    for (NSString *instanceId in instanceIds) {
+        id<POBRNFullScreenAd> ad = [POBRNFullScreenAdManager adForInstanceId:instanceId];
+        if (ad && ad != bestAd && !ad.isLoading && (!ad.isReady || ad.isBidExpired)) {
+            [ad loadAd];
+        }
+    }
+    return bestInstanceId;
+}
+
++ (BOOL)isLoadingGroup:(NSString *)group {
+    for (NSString *instanceId in [POBRNFullScreenAdManager instanceIdsInGroup:group]) {
+        if ([POBRNFullScreenAdManager adForInstanceId:instanceId].isLoading) {
+            return YES;
+        }
+    }
+    return NO;
+}
+
+@end
@@ -0,0 +1,55 @@
+#import <Foundation/Foundation.h>
+#import <os/log.h>
+#import <os/signpost.h>
+#import <stdatomic.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/** Whether the signpost intervals are emitted, see POBRNSystemTrace. */
+FOUNDATION_EXPORT atomic_bool pobrn_system_trace_enabled;
+
+/** Returns the log of the plugin signposts, shown under the "PointsOfInterest" category in Instruments. */
+FOUNDATION_EXPORT os_log_t POBRNSystemTraceLog(void);
+
+/**
+ * Begins the signpost interval of the given name, an identifier, around a plugin hot path. The interval
+ * carries the instance id and the ad unit id, nil when not known, as arguments. Must be balanced by
+ * POBRN_SYSTEM_TRACE_END in the same scope. When disabled, it costs a single atomic read.
+ */
+#define POBRN_SYSTEM_TRACE_BEGIN(name, instanceId, adUnitId) \
+    os_signpost_id_t name##SignpostId = OS_SIGNPOST_ID_INVALID; \
+    if (atomic_load_explicit(&pobrn_system_trace_enabled, memory_order_relaxed)) { \
+        if (@available(iOS 12.0, *)) { \
+            name##SignpostId = os_signpost_id_generate(POBRNSystemTraceLog()); \
+            os_signpost_interval_begin(POBRNSystemTraceLog(), name##SignpostId, #name, \
+                                       "instanceId=%{public}@ adUnitId=%{public}@", (instanceId), (adUnitId)); \
+        } \
+    }
+
+/** Ends the signpost interval of the given name begun by POBRN_SYSTEM_TRACE_BEGIN. */
+#define POBRN_SYSTEM_TRACE_END(name) \
+    if (name##SignpostId != OS_SIGNPOST_ID_INVALID) { \
+        if (@available(iOS 12.0, *)) { \
+            os_signpost_interval_end(POBRNSystemTraceLog(), name##SignpostId, #name); \
+        } \
+    }
+
+/**
+ * Wraps the plugin hot paths into os_signpost intervals, so their work shows up in the Instruments
+ * "Points of Interest" and os_signpost instruments instead of anonymous time on the calling thread.
+ * The intervals need iOS 12, nothing is emitted on older versions.
+ *
+ * Disabled by default.
+ */
+@interface POBRNSystemTrace : NSObject
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/** Enables or disables the signpost intervals. */
++ (void)setEnabled:(BOOL)enabled;
+
++ (BOOL)isEnabled;
+
+@end
+
+NS_ASSUME_NONNULL_END
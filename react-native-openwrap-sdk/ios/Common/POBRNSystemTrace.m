@@ -0,0 +1,24 @@
+#import "POBRNSystemTrace.h"
+
+atomic_bool pobrn_system_trace_enabled = false;
+
+os_log_t POBRNSystemTraceLog(void) {
+    static os_log_t log;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        log = os_log_create("com.pubmatic.openwrap.reactnative", "PointsOfInterest");
+    });
+    return log;
+}
+
+@implementation POBRNSystemTrace
+
++ (void)setEnabled:(BOOL)enabled {
+    atomic_store_explicit(&pobrn_system_trace_enabled, enabled, memory_order_relaxed);
+}
+
++ (BOOL)isEnabled {
+    return atomic_load_explicit(&pobrn_system_trace_enabled, memory_order_relaxed);
+}
+
+@end
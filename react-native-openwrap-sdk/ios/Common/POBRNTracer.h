@@ -0,0 +1,61 @@
+#import <Foundation/Foundation.h>
+#import "POBRNConstants.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/** An enum to represent the lifecycle steps recorded by the tracer. */
+typedef NS_ENUM(NSInteger, POBRNTraceStep) {
+    POBRNTraceStepCreate = 0,
+    POBRNTraceStepSetRequestParams,
+    POBRNTraceStepSetImpressionParams,
+    POBRNTraceStepLoad,
+    POBRNTraceStepBidReceived,
+    POBRNTraceStepBidFailed,
+    POBRNTraceStepProceedToLoad,
+    POBRNTraceStepProceedOnError,
+    POBRNTraceStepAdReceived,
+    POBRNTraceStepAdFailedToLoad,
+    POBRNTraceStepShow,
+    POBRNTraceStepAdOpened,
+    POBRNTraceStepAdFailedToShow,
+    POBRNTraceStepClick,
+    POBRNTraceStepClose,
+    POBRNTraceStepExpired,
+    POBRNTraceStepDestroy,
+};
+
+/**
+ * Records the lifecycle steps of every plugin ad instance into a fixed size, lock-free ring buffer.
+ * Writers claim a slot with a single atomic increment and publish it through a per slot sequence
+ * number, so recording never blocks the main thread or the SDK callback threads.
+ * Once the buffer is full, the oldest entries are overwritten.
+ *
+ * Tracing is disabled by default, in that case recording costs a single atomic read.
+ */
+@interface POBRNTracer : NSObject
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/** Enables or disables recording. Already recorded entries are retained. */
++ (void)setEnabled:(BOOL)enabled;
+
+/** Returns YES if lifecycle steps are currently being recorded. */
++ (BOOL)isEnabled;
+
+/** Records a lifecycle step for the given ad instance. No-op when tracing is disabled. */
++ (void)recordStep:(POBRNTraceStep)step
+          adFormat:(POBRNAdFormat)adFormat
+        instanceId:(NSString *)instanceId;
+
+/** Removes all the recorded entries. */
++ (void)clear;
+
+/**
+ * Returns the recorded entries in the Chrome trace-event JSON format, which can be opened
+ * in chrome://tracing or https://ui.perfetto.dev
+ */
++ (NSString *)chromeTraceJSON;
+
+@end
+
+NS_ASSUME_NONNULL_END
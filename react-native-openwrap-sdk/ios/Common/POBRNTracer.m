@@ -0,0 +1,169 @@
+#import "POBRNTracer.h"
+
+#import <pthread.h>
+#import <stdatomic.h>
+#import <string.h>
+#import <time.h>
+#import <unistd.h>
+
+// Number of entries retained by the ring buffer. Must be a power of two.
+#define POBRN_TRACE_CAPACITY        4096
+#define POBRN_TRACE_INDEX_MASK      (POBRN_TRACE_CAPACITY - 1)
+#define POBRN_TRACE_STRING_LENGTH   64
+
+/**
+ * A ring buffer slot. The @c sequence is odd while the slot is being written and equal to
+ * @c 2 * (recording order + 1) once published, so readers can detect torn or overwritten slots
+ * without taking a lock.
+ */
+typedef struct {
+    _Atomic uint64_t sequence;
+    uint64_t timestampNanos;
+    uint64_t threadId;
+    POBRNAdFormat adFormat;
+    POBRNTraceStep step;
+    char instanceId[POBRN_TRACE_STRING_LENGTH];
+    char threadName[POBRN_TRACE_STRING_LENGTH];
+} POBRNTraceSlot;
+
+static POBRNTraceSlot pobrn_trace_slots[POBRN_TRACE_CAPACITY];
+static _Atomic uint64_t pobrn_trace_cursor = 0;
+static atomic_bool pobrn_trace_enabled = false;
+
+static NSString *POBRNTraceStepName(POBRNTraceStep step) {
+    switch (step) {
+        case POBRNTraceStepCreate:              return @"create";
+        case POBRNTraceStepSetRequestParams:    return @"setRequestParams";
+        case POBRNTraceStepSetImpressionParams: return @"setImpressionParams";
+        case POBRNTraceStepLoad:                return @"load";
+        case POBRNTraceStepBidReceived:         return @"bidReceived";
+        case POBRNTraceStepBidFailed:           return @"bidFailed";
+        case POBRNTraceStepProceedToLoad:       return @"proceedToLoadAd";
+        case POBRNTraceStepProceedOnError:      return @"proceedOnError";
+        case POBRNTraceStepAdReceived:          return @"adReceived";
+        case POBRNTraceStepAdFailedToLoad:      return @"adFailedToLoad";
+        case POBRNTraceStepShow:                return @"show";
+        case POBRNTraceStepAdOpened:            return @"adOpened";
+        case POBRNTraceStepAdFailedToShow:      return @"adFailedToShow";
+        case POBRNTraceStepClick:               return @"click";
+        case POBRNTraceStepClose:               return @"close";
+        case POBRNTraceStepExpired:             return @"expired";
+        case POBRNTraceStepDestroy:             return @"destroy";
+    }
+    return @"unknown";
+}
+
+static NSString *POBRNAdFormatName(POBRNAdFormat adFormat) {
+    switch (adFormat) {
+        case POBRNAdFormatBanner:       return @"banner";
+        case POBRNAdFormatInterstitial: return @"interstitial";
+        case POBRNAdFormatRewarded:     return @"rewarded";
+    }
+    return @"unknown";
+}
+
+@implementation POBRNTracer
+
++ (void)setEnabled:(BOOL)enabled {
+    atomic_store_explicit(&pobrn_trace_enabled, enabled, memory_order_relaxed);
+}
+
++ (BOOL)isEnabled {
+    return atomic_load_explicit(&pobrn_trace_enabled, memory_order_relaxed);
+}
+
++ (void)recordStep:(POBRNTraceStep)step
+          adFormat:(POBRNAdFormat)adFormat
+        instanceId:(NSString *)instanceId {
+    if (!atomic_load_explicit(&pobrn_trace_enabled, memory_order_relaxed)) {
+        return;
+    }
+    uint64_t order = atomic_fetch_add_explicit(&pobrn_trace_cursor, 1, memory_order_relaxed);
+    POBRNTraceSlot *slot = &pobrn_trace_slots[order & POBRN_TRACE_INDEX_MASK];
+
+    // Mark the slot as being written before touching the payload.
+    atomic_store_explicit(&slot->sequence, 2 * order + 1, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+
+    slot->timestampNanos = clock_gettime_nsec_np(CLOCK_UPTIME_RAW);
+    pthread_threadid_np(NULL, &slot->threadId);
+    slot->adFormat = adFormat;
+    slot->step = step;
+    strlcpy(slot->instanceId, instanceId.UTF8String ?: "", POBRN_TRACE_STRING_LENGTH);
+    if (pthread_main_np()) {
+        strlcpy(slot->threadName, "main", POBRN_TRACE_STRING_LENGTH);
+    } else if (pthread_getname_np(pthread_self(), slot->threadName, POBRN_TRACE_STRING_LENGTH) != 0) {
+        slot->threadName[0] = '\0';
+    }
+
+    // Publish the slot.
+    atomic_store_explicit(&slot->sequence, 2 * order + 2, memory_order_release);
+}
+
++ (void)clear {
+    for (NSUInteger i = 0; i < POBRN_TRACE_CAPACITY; i++) {
+        atomic_store_explicit(&pobrn_trace_slots[i].sequence, 0, memory_order_release);
+    }
+}
+
++ (NSString *)chromeTraceJSON {
+    NSNumber *pid = @(getpid());
+    NSMutableArray *traceEvents = [NSMutableArray new];
+    NSMutableDictionary<NSNumber *, NSString *> *threadNames = [NSMutableDictionary new];
+
+    uint64_t end = atomic_load_explicit(&pobrn_trace_cursor, memory_order_acquire);
+    uint64_t start = end > POBRN_TRACE_CAPACITY ? end - POBRN_TRACE_CAPACITY : 0;
+    for (uint64_t order = start; order < end; order++) {
+        POBRNTraceSlot *slot = &pobrn_trace_slots[order & POBRN_TRACE_INDEX_MASK];
+        uint64_t published = 2 * order + 2;
+        if (atomic_load_explicit(&slot->sequence, memory_order_acquire) != published) {
+            // Slot is empty, being written or already overwritten.
+            continue;
+        }
+        POBRNTraceSlot copy;
+        copy.timestampNanos = slot->timestampNanos;
+        copy.threadId = slot->threadId;
+        copy.adFormat = slot->adFormat;
+        copy.step = slot->step;
+        memcpy(copy.instanceId, slot->instanceId, POBRN_TRACE_STRING_LENGTH);
+        memcpy(copy.threadName, slot->threadName, POBRN_TRACE_STRING_LENGTH);
+        copy.instanceId[POBRN_TRACE_STRING_LENGTH - 1] = '\0';
+        copy.threadName[POBRN_TRACE_STRING_LENGTH - 1] = '\0';
+        atomic_thread_fence(memory_order_acquire);
+        if (atomic_load_explicit(&slot->sequence, memory_order_relaxed) != published) {
+            // Slot was overwritten while it was copied.
+            continue;
+        }
+
+        NSNumber *tid = @(copy.threadId);
+        threadNames[tid] = [NSString stringWithUTF8String:copy.threadName] ?: @"";
+        [traceEvents addObject:@{
+            @"name": POBRNTraceStepName(copy.step),
+            @"cat": POBRNAdFormatName(copy.adFormat),
+            @"ph": @"i",
+            @"s": @"t",
+            @"ts": @(copy.timestampNanos / 1000.0),
+            @"pid": pid,
+            @"tid": tid,
+            @"args": @{ POBRN_AD_INSTANCE_ID: [NSString stringWithUTF8String:copy.instanceId] ?: @"" }
+        }];
+    }
+
+    [threadNames enumerateKeysAndObjectsUsingBlock:^(NSNumber *tid, NSString *name, BOOL *stop) {
+        [traceEvents addObject:@{
+            @"name": @"thread_name",
+            @"ph": @"M",
+            @"pid": pid,
+            @"tid": tid,
+            @"args": @{ @"name": name }
+        }];
+    }];
+
+    NSData *data = [NSJSONSerialization dataWithJSONObject:@{
+        @"traceEvents": traceEvents,
+        @"displayTimeUnit": @"ms"
+    } options:0 error:nil];
+    return data ? [[NSString alloc] initWithData:data encoding:NSUTF8StringEncoding] : @"{}";
+}
+
+@end
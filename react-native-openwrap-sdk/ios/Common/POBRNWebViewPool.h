@@ -0,0 +1,32 @@
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * Keeps a small pool of idle web views, created while the main run loop is idle after startup.
+ *
+ * The OpenWrap SDK creates the web views rendering the creatives itself, so pooled web views cannot
+ * be handed over to it. Instead, keeping them alive keeps WebKit loaded and its web content process
+ * running, so the first banner or interstitial render does not pay for their start.
+ *
+ * The pool is disabled by default, as it costs every app a web view whether or not it shows ads rendered
+ * in one: apps opt in with maxSize, through setWebViewPoolSize or the configuration. It holds at most 2
+ * web views and is drained on memory warnings. All the methods are expected
+ * to be called on the main thread.
+ */
+@interface POBRNWebViewPool : NSObject
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/** Number of web views kept warm, from 0 to 2. 0 disables the pool and drains it. Defaults to 0. */
+@property (class, nonatomic) NSUInteger maxSize;
+
+/** Fills the pool once the main run loop is idle. */
++ (void)prewarm;
+
+/** Destroys all the pooled web views. The pool is filled again on the next maxSize change. */
++ (void)drain;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,83 @@
+#import "POBRNWebViewPool.h"
+#import <UIKit/UIKit.h>
+#import <WebKit/WebKit.h>
+
+static const NSUInteger POBRNWebViewPoolDefaultSize = 0;
+static const NSUInteger POBRNWebViewPoolMaxSize = 2;
+
+static NSUInteger maxSize = POBRNWebViewPoolDefaultSize;
+static NSMutableArray<WKWebView *> *webViews;
+static BOOL prewarmed = NO;
+static CFRunLoopObserverRef idleObserver = NULL;
+
+@implementation POBRNWebViewPool
+
++ (void)initialize {
+    if (self == [POBRNWebViewPool class]) {
+        webViews = [NSMutableArray new];
+    }
+}
+
++ (NSUInteger)maxSize {
+    return maxSize;
+}
+
++ (void)setMaxSize:(NSUInteger)size {
+    maxSize = MIN(size, POBRNWebViewPoolMaxSize);
+    [self trimToSize:maxSize];
+    [self fill];
+}
+
++ (void)prewarm {
+    if (prewarmed) {
+        return;
+    }
+    prewarmed = YES;
+    [[NSNotificationCenter defaultCenter] addObserver:self
+                                             selector:@selector(drain)
+                                                 name:UIApplicationDidReceiveMemoryWarningNotification
+                                               object:nil];
+    [self fill];
+}
+
++ (void)drain {
+    [self trimToSize:0];
+}
+
+#pragma mark - Private methods
+
+/** Creates the missing web views, one per idle pass of the main run loop so no frame stalls for long. */
++ (void)fill {
+    if (!prewarmed || idleObserver || webViews.count >= maxSize) {
+        return;
+    }
+    idleObserver = CFRunLoopObserverCreateWithHandler(kCFAllocatorDefault, kCFRunLoopBeforeWaiting, NO, 0,
+                                                      ^(CFRunLoopObserverRef observer, CFRunLoopActivity activity) {
+        CFRunLoopRemoveObserver(CFRunLoopGetMain(), observer, kCFRunLoopCommonModes);
+        CFRelease(observer);
+        idleObserver = NULL;
+        if (webViews.count < maxSize) {
+            [webViews addObject:[self createWebView]];
+            [self fill];
+        }
+    });
+    CFRunLoopAddObserver(CFRunLoopGetMain(), idleObserver, kCFRunLoopCommonModes);
+}
+
++ (void)trimToSize:(NSUInteger)size {
+    while (webViews.count > size) {
+        WKWebView *webView = webViews.lastObject;
+        [webView stopLoading];
+        [webViews removeLastObject];
+    }
+}
+
++ (WKWebView *)createWebView {
+    WKWebView *webView = [[WKWebView alloc] initWithFrame:CGRectZero
+                                            configuration:[WKWebViewConfiguration new]];
+    // Loading a blank page starts the web content process.
+    [webView loadHTMLString:@"" baseURL:nil];
+    return webView;
+}
+
+@end
@@ -58,6 +58,16 @@ NS_ASSUME_NONNULL_BEGIN
  */
 - (BOOL)isBidExpired;
 
+/**
+ * Returns YES while a load of the full screen ad is in progress.
+ */
+- (BOOL)isLoading;
+
+/**
+ * Returns the price of the bid of the full screen ad, 0 if it has no bid.
+ */
+- (double)bidPrice;
+
 @optional
 /**
  * Sets title, message & button texts to be used while showing the skip alert.
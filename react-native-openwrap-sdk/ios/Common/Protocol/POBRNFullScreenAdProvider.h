@@ -19,6 +19,22 @@ NS_ASSUME_NONNULL_BEGIN
                profileId:(NSNumber *)profileId
                 adUnitId:(NSString *)adUnitId;
 
+/**
+ * Creates the full screen ad with given unique ad instance id, which loads through the GAM event
+ * handler for header bidding.
+ *
+ * @param instanceId A string identifier passed to uniquely identify each ad instance.
+ * @param publisherId Unique identifier assigned at the time of publisher onboarding.
+ * @param profileId Profile id of the ad tag.
+ * @param adUnitId An unit id used to identify unique placement on screen.
+ * @param gamConfig GAM details JSON string of the ad unit.
+ */
+- (void)createGamAdInstance:(NSString *)instanceId
+                publisherId:(NSString *)publisherId
+                  profileId:(NSNumber *)profileId
+                   adUnitId:(NSString *)adUnitId
+                  gamConfig:(NSString *)gamConfig;
+
 /**
  * Load the full screen ad with given unique ad instance id.
  *
@@ -70,6 +86,36 @@ NS_ASSUME_NONNULL_BEGIN
 - (void)setImpressionParameters:(NSString *)parameterString
                   forInstanceId:(NSString *)instanceId;
 
+/**
+ * Adds the full screen ad to a show group, see @c POBRNShowFallback.
+ *
+ * @param group Name of the show group.
+ * @param instanceId A string identifier passed to uniquely identify each ad instance.
+ */
+- (void)addToGroup:(NSString *)group instanceId:(NSString *)instanceId;
+
+/**
+ * Removes the full screen ad from a show group.
+ *
+ * @param group Name of the show group.
+ * @param instanceId A string identifier passed to uniquely identify each ad instance.
+ */
+- (void)removeFromGroup:(NSString *)group instanceId:(NSString *)instanceId;
+
+/**
+ * Shows the best ready full screen ad of a show group, see @c POBRNShowFallback.
+ * It returns the instance id of the ad shown, nil if none was shown, in the resolve promise block.
+ *
+ * @param group Name of the show group.
+ * @param budgetMillis Time to wait for a loading ad when none of the group is ready.
+ * @param resolve A promise resolve block to return the instance id of the ad shown.
+ * @param reject A promise reject block which can be used for returning any failures.
+ */
+- (void)showBestAvailable:(NSString *)group
+             budgetMillis:(double)budgetMillis
+                  resolve:(RCTPromiseResolveBlock)resolve
+                   reject:(RCTPromiseRejectBlock)reject;
+
 @optional
 /**
  * Sets title, message & button texts to be used while showing the skip alert.
@@ -0,0 +1,42 @@
+#import <Foundation/Foundation.h>
+#import <OpenWrapSDK/OpenWrapSDK.h>
+#import "POBRNGamConfig.h"
+#import "POBRNLatencyTimer.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * Creates the GAM event handlers used for header bidding. The handlers are available when the app
+ * includes the GAM subspec, i.e. pod 'react-native-openwrap-sdk/GAM', which brings the
+ * OpenWrapHandlerDFP pod. Otherwise no handler is created and the ads are loaded from OpenWrap only.
+ *
+ * The config block of every handler is invoked once the OpenWrap auction is over, right before the
+ * GAM request. It applies the custom targeting natively and marks the switch from waiting on
+ * OpenWrap to waiting on GAM in the latency timer.
+ */
+@interface POBRNGamEventHandlers : NSObject
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/** Returns YES if the GAM event handler is included. */
++ (BOOL)isAvailable;
+
+/**
+ * Starts the GAM SDK when the plugin is loaded, so that its initialization runs in parallel with
+ * the first OpenWrap auction instead of delaying the first GAM request.
+ */
++ (void)start;
+
++ (nullable id<POBBannerEvent>)bannerEventHandlerWithConfig:(POBRNGamConfig *)config
+                                                    adSizes:(NSArray<POBAdSize *> *)adSizes
+                                               latencyTimer:(POBRNLatencyTimer *)latencyTimer;
+
++ (nullable id<POBInterstitialEvent>)interstitialEventHandlerWithConfig:(POBRNGamConfig *)config
+                                                           latencyTimer:(POBRNLatencyTimer *)latencyTimer;
+
++ (nullable id<POBRewardedAdEvent>)rewardedEventHandlerWithConfig:(POBRNGamConfig *)config
+                                                     latencyTimer:(POBRNLatencyTimer *)latencyTimer;
+
+@end
+
+NS_ASSUME_NONNULL_END
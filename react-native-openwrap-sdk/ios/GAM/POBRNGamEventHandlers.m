@@ -0,0 +1,88 @@
+#import "POBRNGamEventHandlers.h"
+
+// The OpenWrapHandlerDFP headers are only reachable when the GAM subspec is installed.
+#if __has_include(<OpenWrapHandlerDFP/OpenWrapHandlerDFP.h>)
+#define POBRN_GAM_AVAILABLE 1
+#import <OpenWrapHandlerDFP/OpenWrapHandlerDFP.h>
+#import <GoogleMobileAds/GoogleMobileAds.h>
+#else
+#define POBRN_GAM_AVAILABLE 0
+#endif
+
+NS_ASSUME_NONNULL_BEGIN
+
+@implementation POBRNGamEventHandlers
+
++ (BOOL)isAvailable {
+    return POBRN_GAM_AVAILABLE;
+}
+
++ (void)start {
+#if POBRN_GAM_AVAILABLE
+    [[GADMobileAds sharedInstance] startWithCompletionHandler:nil];
+#endif
+}
+
++ (nullable id<POBBannerEvent>)bannerEventHandlerWithConfig:(POBRNGamConfig *)config
+                                                    adSizes:(NSArray<POBAdSize *> *)adSizes
+                                               latencyTimer:(POBRNLatencyTimer *)latencyTimer {
+#if POBRN_GAM_AVAILABLE
+    NSMutableArray<NSValue *> *gamSizes = [NSMutableArray new];
+    for (POBAdSize *adSize in adSizes) {
+        [gamSizes addObject:NSValueFromGADAdSize(GADAdSizeFromCGSize(adSize.cgSize))];
+    }
+    DFPBannerEventHandler *eventHandler = [[DFPBannerEventHandler alloc] initWithAdUnitId:config.adUnitId
+                                                                                 andSizes:gamSizes];
+    eventHandler.configBlock = ^(GAMBannerView *view, GAMRequest *request, POBBid *bid) {
+        [self onAdServerRequest:request config:config latencyTimer:latencyTimer];
+    };
+    return eventHandler;
+#else
+    return nil;
+#endif
+}
+
++ (nullable id<POBInterstitialEvent>)interstitialEventHandlerWithConfig:(POBRNGamConfig *)config
+                                                           latencyTimer:(POBRNLatencyTimer *)latencyTimer {
+#if POBRN_GAM_AVAILABLE
+    DFPInterstitialEventHandler *eventHandler = [[DFPInterstitialEventHandler alloc] initWithAdUnitId:config.adUnitId];
+    eventHandler.configBlock = ^(GAMRequest *request, POBBid *bid) {
+        [self onAdServerRequest:request config:config latencyTimer:latencyTimer];
+    };
+    return eventHandler;
+#else
+    return nil;
+#endif
+}
+
++ (nullable id<POBRewardedAdEvent>)rewardedEventHandlerWithConfig:(POBRNGamConfig *)config
+                                                     latencyTimer:(POBRNLatencyTimer *)latencyTimer {
+#if POBRN_GAM_AVAILABLE
+    DFPRewardedEventHandler *eventHandler = [[DFPRewardedEventHandler alloc] initWithAdUnitId:config.adUnitId];
+    eventHandler.configBlock = ^(GAMRequest *request, POBBid *bid) {
+        [self onAdServerRequest:request config:config latencyTimer:latencyTimer];
+    };
+    return eventHandler;
+#else
+    return nil;
+#endif
+}
+
+#pragma mark - Private methods
+
+#if POBRN_GAM_AVAILABLE
++ (void)onAdServerRequest:(GAMRequest *)request
+                   config:(POBRNGamConfig *)config
+             latencyTimer:(POBRNLatencyTimer *)latencyTimer {
+    [latencyTimer markAdServerRequest];
+    if (config.customTargeting.count > 0) {
+        NSMutableDictionary *customTargeting = [NSMutableDictionary dictionaryWithDictionary:request.customTargeting ?: @{}];
+        [customTargeting addEntriesFromDictionary:[config gamCustomTargeting]];
+        request.customTargeting = customTargeting;
+    }
+}
+#endif
+
+@end
+
+NS_ASSUME_NONNULL_END
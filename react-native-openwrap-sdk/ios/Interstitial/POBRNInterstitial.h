@@ -1,6 +1,7 @@
 #import <Foundation/Foundation.h>
 #import "POBRNEventEmitter.h"
 #import "POBRNFullScreenAd.h"
+#import "POBRNGamConfig.h"
 
 NS_ASSUME_NONNULL_BEGIN
 
@@ -22,7 +23,21 @@ NS_ASSUME_NONNULL_BEGIN
                       eventEmitter:(POBRNEventEmitter *)eventEmitter
                        publisherId:(NSString *)publisherId
                          profileId:(NSNumber *)profileId
-                          adUnitId:(NSString *)adUnitId NS_DESIGNATED_INITIALIZER;
+                          adUnitId:(NSString *)adUnitId;
+
+/**
+ * Creates an instance of @c POBRNInterstitial which loads the ad through the GAM event handler, when
+ * it is available, for header bidding.
+ *
+ * @param gamConfig GAM details of the ad unit, nil to load the ad from OpenWrap only.
+ * @see initWithInstanceId:eventEmitter:publisherId:profileId:adUnitId:
+ */
+- (instancetype)initWithInstanceId:(NSString *)instanceId
+                      eventEmitter:(POBRNEventEmitter *)eventEmitter
+                       publisherId:(NSString *)publisherId
+                         profileId:(NSNumber *)profileId
+                          adUnitId:(NSString *)adUnitId
+                         gamConfig:(nullable POBRNGamConfig *)gamConfig NS_DESIGNATED_INITIALIZER;
 - (instancetype)init NS_UNAVAILABLE;
 
 @end
@@ -1,13 +1,36 @@
 #import "POBRNInterstitial.h"
 #import "POBRNAdHelper.h"
+#import "POBRNBidLandscape.h"
+#import "POBRNConstants.h"
+#import "POBRNFullScreenArbiter.h"
+#import "POBRNGamEventHandlers.h"
+#import "POBRNLatencyTimer.h"
+#import "POBRNMediaCache.h"
+#import "POBRNMediationRule.h"
+#import "POBRNPreloadScheduler.h"
+#import "POBRNRequestCoalescer.h"
+#import "POBRNShowFallback.h"
+#import "POBRNSystemTrace.h"
+#import "POBRNTracer.h"
 #import <OpenWrapSDK/OpenWrapSDK.h>
+#import <React/RCTLog.h>
 
 @interface POBRNInterstitial () <
     POBInterstitialDelegate,
     POBInterstitialVideoDelegate,
-    POBBidEventDelegate>
+    POBBidEventDelegate, POBRNCoalescedFlight>
 
 @property (nonatomic, strong) NSString *instanceId;
+@property (nonatomic, strong) NSString *publisherId;
+@property (nonatomic, strong) NSNumber *profileId;
+@property (nonatomic, strong) NSString *adUnitId;
+@property (nonatomic, nullable, copy) NSString *requestParameters;
+@property (nonatomic, nullable, copy) NSString *impressionParameters;
+// Key of the current load in POBRNRequestCoalescer.
+@property (nonatomic, nullable, copy) NSString *flightKey;
+@property (nonatomic, strong) POBRNLatencyTimer *latencyTimer;
+// Bid of the current auction, received through the bid event delegate.
+@property (nonatomic, strong, nullable) POBBid *pendingBid;
 // Keep weak reference to avoid retain cycle.
 @property (nonatomic, nullable, weak) POBRNEventEmitter *eventEmitter;
 @property (nonatomic, nullable, strong) POBInterstitial *interstitial;
@@ -21,17 +44,52 @@
                        publisherId:(NSString *)publisherId
                          profileId:(NSNumber *)profileId
                           adUnitId:(NSString *)adUnitId {
+    return [self initWithInstanceId:instanceId
+                       eventEmitter:eventEmitter
+                        publisherId:publisherId
+                          profileId:profileId
+                           adUnitId:adUnitId
+                          gamConfig:nil];
+}
+
+- (instancetype)initWithInstanceId:(NSString *)instanceId
+                      eventEmitter:(POBRNEventEmitter *)eventEmitter
+                       publisherId:(NSString *)publisherId
+                         profileId:(NSNumber *)profileId
+                          adUnitId:(NSString *)adUnitId
+                         gamConfig:(nullable POBRNGamConfig *)gamConfig {
     self = [super init];
     if (self) {
         _instanceId = instanceId;
+        _publisherId = publisherId;
+        _profileId = profileId;
+        _adUnitId = adUnitId;
         _eventEmitter = eventEmitter;
-        _interstitial = [[POBInterstitial alloc] initWithPublisherId:publisherId
-                                                           profileId:profileId
-                                                            adUnitId:adUnitId];
+        _latencyTimer = [[POBRNLatencyTimer alloc] initWithAdFormat:POBRNAdFormatInterstitial
+                                                           adUnitId:adUnitId];
+        [POBRNTracer recordStep:POBRNTraceStepCreate
+                       adFormat:POBRNAdFormatInterstitial
+                     instanceId:instanceId];
+        id<POBInterstitialEvent> eventHandler = [self eventHandlerWithGamConfig:gamConfig];
+        if (eventHandler) {
+            _interstitial = [[POBInterstitial alloc] initWithPublisherId:publisherId
+                                                               profileId:profileId
+                                                                adUnitId:adUnitId
+                                                            eventHandler:eventHandler];
+        } else {
+            _interstitial = [[POBInterstitial alloc] initWithPublisherId:publisherId
+                                                               profileId:profileId
+                                                                adUnitId:adUnitId];
+        }
         _interstitial.delegate = self;
         _interstitial.videoDelegate = self;
         // Setting the adPosition to fullScreen for Interstitial Ads.
         _interstitial.impression.adPosition = POBAdPositionFullscreen;
+        // Bound the wait on OpenWrap before the GAM request, an explicit network timeout of the
+        // request parameters takes precedence.
+        if (gamConfig.owNetworkTimeout > 0) {
+            _interstitial.request.networkTimeout = gamConfig.owNetworkTimeout;
+        }
     }
     return self;
 }
@@ -39,10 +97,32 @@
 #pragma mark - Public / POBRNFullScreenAd methods
 
 - (void)loadAd {
-    [self.interstitial loadAd];
+    // Preloads are deferred until their predicted show falls within the bid validity window.
+    __weak typeof(self) weakSelf = self;
+    [POBRNPreloadScheduler scheduleLoadForAdUnitId:self.adUnitId
+                                        instanceId:self.instanceId
+                                              load:^{
+        [weakSelf loadNow];
+    }];
+}
+
+- (void)loadNow {
+    // Identical loads run one at a time, see POBRNRequestCoalescer.
+    NSString *key = [POBRNRequestCoalescer keyWithPublisherId:self.publisherId
+                                                    profileId:self.profileId
+                                                     adUnitId:self.adUnitId
+                                            requestParameters:self.requestParameters
+                                         impressionParameters:self.impressionParameters];
+    if (self.flightKey && ![self.flightKey isEqualToString:key]) {
+        [self completeFlightWithError:nil];
+    }
+    self.flightKey = key;
+    [POBRNRequestCoalescer loadFlight:self forKey:key adUnitId:self.adUnitId];
 }
 
 - (void)showAd {
+    [self traceStep:POBRNTraceStepShow];
+    [self.latencyTimer markShow];
     [self.interstitial showFromViewController:[POBRNAdHelper topViewController]];
 }
 
@@ -51,21 +131,38 @@
 }
 
 - (void)destroyAd {
+    [self traceStep:POBRNTraceStepDestroy];
+    // Destroyed from the module queue, the arbiter runs on the main thread.
+    NSString *instanceId = self.instanceId;
+    dispatch_async(dispatch_get_main_queue(), ^{
+        [POBRNFullScreenArbiter fullScreenAdDidDismiss:instanceId];
+        [POBRNPreloadScheduler cancelInstanceId:instanceId];
+    });
+    [self completeFlightWithError:nil];
+    [POBRNMediaCache evictKey:self.instanceId];
     self.interstitial.delegate = nil;
     self.interstitial.videoDelegate = nil;
     self.interstitial = nil;
 }
 
 - (void)setRequestParameters:(NSString *)jsonString {
+    self.requestParameters = jsonString;
+    [self traceStep:POBRNTraceStepSetRequestParams];
+    POBRN_SYSTEM_TRACE_BEGIN(setRequestParams, self.instanceId, self.adUnitId);
     [POBRNAdHelper setUpRequest:self.interstitial.request
                  withParameters:jsonString
                andNestedParsing:NO];
+    POBRN_SYSTEM_TRACE_END(setRequestParams);
 }
 
 - (void)setImpressionParameters:(NSString *)jsonString {
+    self.impressionParameters = jsonString;
+    [self traceStep:POBRNTraceStepSetImpressionParams];
+    POBRN_SYSTEM_TRACE_BEGIN(setImpressionParams, self.instanceId, self.adUnitId);
     [POBRNAdHelper setUpImpression:self.interstitial.impression
                     withParameters:jsonString
                   andNestedParsing:NO];
+    POBRN_SYSTEM_TRACE_END(setImpressionParams);
     // Setting the adPosition to fullScreen for Interstitial Ads.
     self.interstitial.impression.adPosition = POBAdPositionFullscreen;
 }
@@ -77,10 +174,12 @@
 }
 
 - (BOOL)proceedToLoadAd {
+    [self traceStep:POBRNTraceStepProceedToLoad];
     return [self.interstitial proceedToLoadAd];
 }
 
 - (void)proceedOnError:(NSString *)jsonString {
+    [self traceStep:POBRNTraceStepProceedOnError];
     NSDictionary *errorDetails = [POBRNAdHelper convertJsonStringToJSON:jsonString error:nil];
     NSNumber *errCode = errorDetails[POBRN_ERROR_CODE];
     NSString *errMsg  = errorDetails[POBRN_ERROR_MESSAGE];
@@ -96,34 +195,77 @@
     return [self.interstitial.bid isExpired];
 }
 
+- (BOOL)isLoading {
+    // A load deferred by the preload scheduler counts, it is started on the next show point.
+    return self.flightKey != nil || [POBRNPreloadScheduler isDeferred:self.instanceId];
+}
+
+- (double)bidPrice {
+    return self.interstitial.bid.price.doubleValue;
+}
+
 #pragma POBBidEventDelegate
 
 - (void)bidEvent:(id<POBBidEvent>)bidEventObject didReceiveBid:(POBBid *)bid {
-    NSDictionary *bidDetails = [POBRNAdHelper bidDictionaryFromBid:self.interstitial.bid];
-    [self.eventEmitter emitEventWithEmbeddedEventName:POBRN_EVENT_BID_RECEIVED
-                                           instanceId:self.instanceId
-                                           andPayload:bidDetails];
+    [self traceStep:POBRNTraceStepBidReceived];
+    [self.latencyTimer markBidReceived];
+    self.pendingBid = bid;
+    POBRNMediationRule *rule = [POBRNMediationRule ruleForAdUnitId:self.adUnitId];
+    if (rule) {
+        // Evaluate the registered mediation rule right away and only notify its outcome.
+        POBRNMediationOutcome *outcome = [rule applyToBidEvent:bidEventObject
+                                                           bid:bid
+                                                    waitMillis:[self.latencyTimer durationForMetric:POBRNLatencyMetricLoadToBid]];
+        [self traceStep:outcome.won ? POBRNTraceStepProceedToLoad : POBRNTraceStepProceedOnError];
+        [self.eventEmitter emitEvent:POBRNEventMediationOutcome
+                          instanceId:self.instanceId
+                          andPayload:[self.latencyTimer attachToPayload:[outcome dictionaryWithBid:bid]]];
+        return;
+    }
+    POBRN_SYSTEM_TRACE_BEGIN(bidDictionary, self.instanceId, self.adUnitId);
+    NSDictionary *bidDetails = [self.latencyTimer attachToPayload:[POBRNAdHelper bidDictionaryFromBid:self.interstitial.bid]];
+    POBRN_SYSTEM_TRACE_END(bidDictionary);
+    [self.eventEmitter emitEvent:POBRNEventBidReceived
+                      instanceId:self.instanceId
+                      andPayload:bidDetails];
 }
 
 - (void)bidEvent:(id<POBBidEvent>)bidEventObject didFailToReceiveBidWithError:(NSError *)error {
-    [self sendEvent:POBRN_EVENT_BID_RECEIVE_FAILED withError:error];
+    [self traceStep:POBRNTraceStepBidFailed];
+    [self sendEvent:POBRNEventBidFailed withError:error];
 }
 
 #pragma mark - POBInterstitialDelegate
 
 - (void)interstitialDidReceiveAd:(POBInterstitial *)interstitial {
-    NSDictionary *bidDetails = [POBRNAdHelper bidDictionaryFromBid:interstitial.bid];
-    [self.eventEmitter emitEventWithEmbeddedEventName:POBRN_EVENT_AD_RECEIVED
-                                           instanceId:self.instanceId
-                                           andPayload:bidDetails];
+    [self traceStep:POBRNTraceStepAdReceived];
+    [self.latencyTimer markAdReceived];
+    [self recordAuctionWithBid:(interstitial.bid ?: self.pendingBid) rendered:YES];
+    [self completeFlightWithError:nil];
+    [POBRNPreloadScheduler adDidReceive:self.instanceId bytes:interstitial.bid.creativeTag.length];
+    // Shows the ad right away if a show of its group is waiting for it.
+    [POBRNShowFallback adDidReceive:self.instanceId];
+    [POBRNMediaCache prefetchCreative:interstitial.bid.creativeTag forKey:self.instanceId];
+    POBRN_SYSTEM_TRACE_BEGIN(bidDictionary, self.instanceId, self.adUnitId);
+    NSDictionary *bidDetails = [self.latencyTimer attachToPayload:[POBRNAdHelper bidDictionaryFromBid:interstitial.bid]];
+    POBRN_SYSTEM_TRACE_END(bidDictionary);
+    [self.eventEmitter emitEvent:POBRNEventAdReceived
+                      instanceId:self.instanceId
+                      andPayload:bidDetails];
 }
 
 - (void)interstitial:(POBInterstitial *)interstitial didFailToReceiveAdWithError:(NSError *)error {
-    [self sendEvent:POBRN_EVENT_FAILED_TO_LOAD_AD withError:error];
+    [self traceStep:POBRNTraceStepAdFailedToLoad];
+    [self.latencyTimer markLoadFailed];
+    [self recordAuctionWithBid:self.pendingBid rendered:NO];
+    [self completeFlightWithError:error];
+    [self sendEvent:POBRNEventAdFailedToLoad withError:error];
 }
 
 - (void)interstitial:(POBInterstitial *)interstitial didFailToShowAdWithError:(NSError *)error {
-    [self sendEvent:POBRN_EVENT_FAILED_TO_SHOW_AD withError:error];
+    [self traceStep:POBRNTraceStepAdFailedToShow];
+    [POBRNFullScreenArbiter fullScreenAdDidDismiss:self.instanceId];
+    [self sendEvent:POBRNEventAdFailedToShow withError:error];
 }
 
 - (void)interstitialWillPresentAd:(POBInterstitial *)interstitial {
@@ -131,41 +273,103 @@
 }
 
 - (void)interstitialDidPresentAd:(POBInterstitial *)interstitial {
-    [self sendEvent:POBRN_EVENT_AD_OPENED];
+    [self traceStep:POBRNTraceStepAdOpened];
+    [POBRNFullScreenArbiter fullScreenAdDidPresent:self.instanceId];
+    [POBRNPreloadScheduler adDidShow:self.instanceId];
+    [self.latencyTimer markOpened];
+    [self.eventEmitter emitEvent:POBRNEventAdOpened
+                      instanceId:self.instanceId
+                      andPayload:[self.latencyTimer attachToPayload:nil]];
 }
 
 - (void)interstitialDidDismissAd:(POBInterstitial *)interstitial {
-    [self sendEvent:POBRN_EVENT_AD_CLOSED];
+    [self traceStep:POBRNTraceStepClose];
+    [POBRNFullScreenArbiter fullScreenAdDidDismiss:self.instanceId];
+    [self sendEvent:POBRNEventAdClosed];
 }
 
 - (void)interstitialDidClickAd:(POBInterstitial *)interstitial {
-    [self sendEvent:POBRN_EVENT_DID_CLICK_AD];
+    [self traceStep:POBRNTraceStepClick];
+    [self sendEvent:POBRNEventAdClicked];
 }
 
 - (void)interstitialDidExpireAd:(POBInterstitial *)interstitial {
-    [self sendEvent:POBRN_EVENT_AD_EXPIRED];
+    [self traceStep:POBRNTraceStepExpired];
+    [POBRNPreloadScheduler adDidExpire:self.instanceId];
+    [POBRNMediaCache evictKey:self.instanceId];
+    [self sendEvent:POBRNEventAdExpired];
 }
 
 - (void)interstitialWillLeaveApplication:(POBInterstitial *)interstitial {
-    [self sendEvent:POBRN_EVENT_WILL_LEAVE_APP];
+    [self sendEvent:POBRNEventAppLeaving];
 }
 
 #pragma mark - POBInterstitialVideoDelegate
 
 - (void)interstitialDidFinishVideoPlayback:(POBInterstitial *)interstitial {
-    [self sendEvent:POBRN_EVENT_VIDEO_PLAYBACK_COMPLETED];
+    [self sendEvent:POBRNEventVideoPlaybackCompleted];
+}
+
+#pragma mark - POBRNCoalescedFlight
+
+- (void)startFlight {
+    [self traceStep:POBRNTraceStepLoad];
+    [self.latencyTimer markLoad];
+    // A native mediation rule needs the bid events, even without a JS bid event listener.
+    if ([POBRNMediationRule ruleForAdUnitId:self.adUnitId]) {
+        [self setBidEvent];
+    }
+    [self.interstitial loadAd];
+}
+
+- (void)failFlightWithError:(NSError *)error {
+    self.flightKey = nil;
+    [self traceStep:POBRNTraceStepAdFailedToLoad];
+    [self sendEvent:POBRNEventAdFailedToLoad withError:error];
 }
 
 #pragma mark - Private methods
 
-- (void)sendEvent:(NSString *)eventName {
-    [self sendEvent:eventName withError:nil];
+/** Completes the current load in POBRNRequestCoalescer, so the next identical load can start. */
+- (void)completeFlightWithError:(nullable NSError *)error {
+    NSString *key = self.flightKey;
+    if (!key) {
+        return;
+    }
+    self.flightKey = nil;
+    [POBRNRequestCoalescer completeFlight:self forKey:key adUnitId:self.adUnitId error:error];
+}
+
+- (nullable id<POBInterstitialEvent>)eventHandlerWithGamConfig:(nullable POBRNGamConfig *)gamConfig {
+    if (!gamConfig) {
+        return nil;
+    }
+    id<POBInterstitialEvent> eventHandler = [POBRNGamEventHandlers interstitialEventHandlerWithConfig:gamConfig
+                                                                                        latencyTimer:self.latencyTimer];
+    if (!eventHandler) {
+        RCTLogWarn(POBRN_GAM_UNAVAILABLE_MSG, self.adUnitId);
+    }
+    return eventHandler;
+}
+
+// Records the outcome of the current auction in the bid landscape log.
+- (void)recordAuctionWithBid:(nullable POBBid *)bid rendered:(BOOL)rendered {
+    self.pendingBid = nil;
+    [POBRNBidLandscape recordAdFormat:POBRNAdFormatInterstitial adUnitId:self.adUnitId bid:bid rendered:rendered];
+}
+
+- (void)traceStep:(POBRNTraceStep)step {
+    [POBRNTracer recordStep:step adFormat:POBRNAdFormatInterstitial instanceId:self.instanceId];
+}
+
+- (void)sendEvent:(POBRNEvent)event {
+    [self sendEvent:event withError:nil];
 }
 
-- (void)sendEvent:(NSString *)eventName withError:(nullable NSError *)error {
-    [self.eventEmitter emitEventWithEmbeddedEventName:eventName
-                                           instanceId:self.instanceId
-                                                error:error];
+- (void)sendEvent:(POBRNEvent)event withError:(nullable NSError *)error {
+    [self.eventEmitter emitEvent:event
+                      instanceId:self.instanceId
+                           error:error];
 }
 
 @end
@@ -1,5 +1,6 @@
 #import <Foundation/Foundation.h>
 #import <OpenWrapSDK/OpenWrapSDK.h>
+#import "POBRNGamConfig.h"
 
 NS_ASSUME_NONNULL_BEGIN
 
@@ -13,6 +14,8 @@ NS_ASSUME_NONNULL_BEGIN
 @property(nonatomic, readonly) NSString *adUnitId;
 @property(nonatomic, readonly) NSArray<POBAdSize *> *bannerSizes;
 @property(nonatomic, readonly) BOOL enableGetBidPrice;
+/** GAM header bidding details, nil if the ad unit is loaded from OpenWrap only. */
+@property(nonatomic, readonly, nullable) POBRNGamConfig *gamConfig;
 
 - (instancetype)init NS_UNAVAILABLE;
 
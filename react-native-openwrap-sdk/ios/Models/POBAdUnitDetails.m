@@ -6,6 +6,7 @@ NS_ASSUME_NONNULL_BEGIN
 
 @interface POBAdUnitDetails ()
 @property(nonatomic, readwrite) BOOL enableGetBidPrice;
+@property(nonatomic, readwrite, nullable) POBRNGamConfig *gamConfig;
 @end
 
 @implementation POBAdUnitDetails
@@ -56,6 +57,7 @@ NS_ASSUME_NONNULL_BEGIN
                                                                            adUnitId:adUnitId
                                                                         bannerSizes:[bannerSizes copy]];
     [adUnitDetails setEnableGetBidPrice:enableGetBidPrice];
+    [adUnitDetails setGamConfig:[POBRNGamConfig configWithDictionary:dictionary[POBRN_GAM_CONFIG]]];
     return adUnitDetails;
 }
 
@@ -0,0 +1,47 @@
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * Model class, maintains the GAM header bidding details of an ad unit.
+ */
+@interface POBRNGamConfig : NSObject
+
+/** The GAM ad unit id. */
+@property(nonatomic, readonly) NSString *adUnitId;
+
+/** Custom targeting applied natively on every GAM request, keyed by targeting key. */
+@property(nonatomic, readonly) NSDictionary<NSString *, NSArray<NSString *> *> *customTargeting;
+
+/** Maximum time to wait for the OpenWrap bid before the GAM request, 0 to keep the OpenWrap SDK default. */
+@property(nonatomic, readonly) double owTimeoutMillis;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/**
+ * Creates a @c POBRNGamConfig instance from the GAM details, customTargeting values can be a
+ * string or an array of strings.
+ * Example = {
+ *    "adUnitId": "/15671365/pm_sdk/PMSDK-Demo-App-Banner",
+ *    "customTargeting": { "section": "sports", "tags": ["a", "b"] },
+ *    "owTimeoutMs": 1000
+ *    }
+ *
+ * @param dictionary The GAM details.
+ * @return An instance of @c POBRNGamConfig, nil if the adUnitId is missing.
+ */
++ (nullable POBRNGamConfig *)configWithDictionary:(nullable NSDictionary *)dictionary;
+
+/**
+ * Returns the custom targeting as expected by GAMRequest, multiple values are comma separated.
+ */
+- (NSDictionary<NSString *, NSString *> *)gamCustomTargeting;
+
+/**
+ * Returns the OpenWrap network timeout to apply on the request in seconds, 0 if no timeout is configured.
+ */
+- (NSTimeInterval)owNetworkTimeout;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,61 @@
+#import "POBRNGamConfig.h"
+#import "POBRNConstants.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+@implementation POBRNGamConfig
+
+- (instancetype)initWithAdUnitId:(NSString *)adUnitId
+                 customTargeting:(NSDictionary<NSString *, NSArray<NSString *> *> *)customTargeting
+                 owTimeoutMillis:(double)owTimeoutMillis {
+    self = [super init];
+    if (self) {
+        _adUnitId = [adUnitId copy];
+        _customTargeting = [customTargeting copy];
+        _owTimeoutMillis = owTimeoutMillis;
+    }
+    return self;
+}
+
++ (nullable POBRNGamConfig *)configWithDictionary:(nullable NSDictionary *)dictionary {
+    if (![dictionary isKindOfClass:[NSDictionary class]]) {
+        return nil;
+    }
+    NSString *adUnitId = dictionary[POBRN_AD_UNIT_ID];
+    if (![adUnitId isKindOfClass:[NSString class]]) {
+        return nil;
+    }
+
+    NSMutableDictionary<NSString *, NSArray<NSString *> *> *customTargeting = [NSMutableDictionary new];
+    NSDictionary *targeting = dictionary[POBRN_GAM_CUSTOM_TARGETING];
+    if ([targeting isKindOfClass:[NSDictionary class]]) {
+        [targeting enumerateKeysAndObjectsUsingBlock:^(NSString *key, id value, BOOL *stop) {
+            NSMutableArray<NSString *> *values = [NSMutableArray new];
+            for (id item in ([value isKindOfClass:[NSArray class]] ? value : @[value])) {
+                [values addObject:[item description]];
+            }
+            customTargeting[key] = values;
+        }];
+    }
+
+    NSNumber *owTimeout = dictionary[POBRN_GAM_OW_TIMEOUT];
+    return [[POBRNGamConfig alloc] initWithAdUnitId:adUnitId
+                                    customTargeting:customTargeting
+                                    owTimeoutMillis:[owTimeout isKindOfClass:[NSNumber class]] ? owTimeout.doubleValue : 0];
+}
+
+- (NSDictionary<NSString *, NSString *> *)gamCustomTargeting {
+    NSMutableDictionary<NSString *, NSString *> *targeting = [NSMutableDictionary new];
+    [self.customTargeting enumerateKeysAndObjectsUsingBlock:^(NSString *key, NSArray<NSString *> *values, BOOL *stop) {
+        targeting[key] = [values componentsJoinedByString:@","];
+    }];
+    return targeting;
+}
+
+- (NSTimeInterval)owNetworkTimeout {
+    return self.owTimeoutMillis > 0 ? self.owTimeoutMillis / 1000.0 : 0;
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -1,13 +1,110 @@
 #import "OpenWrapSDKModule.h"
 #import <OpenWrapSDK/OpenWrapSDK.h>
 #import "OpenWrapSDKModuleHelper.h"
+#import "POBRNAdHelper.h"
+#import "POBRNAdTemplate.h"
+#import "POBRNBannerLoadScheduler.h"
+#import "POBRNBannerRefreshCoordinator.h"
+#import "POBRNBidLandscape.h"
 #import "POBRNConstants.h"
+#import "POBRNFullScreenArbiter.h"
+#import "POBRNGamEventHandlers.h"
+#import "POBRNLatencyTracker.h"
+#import "POBRNMediaCache.h"
+#import "POBRNMediationRule.h"
+#import "POBRNNoticeDispatcher.h"
+#import "POBRNPluginStartup.h"
+#import "POBRNPreloadScheduler.h"
+#import "POBRNRequestCoalescer.h"
+#import "POBRNSDKConfigurator.h"
+#import "POBRNSystemTrace.h"
+#import "POBRNTracer.h"
+#import "POBRNWebViewPool.h"
 
 @implementation OpenWrapSDKModule
 
 // To export a module named OpenWrapSDKModule
 RCT_EXPORT_MODULE()
 
+/**
+ * The module itself is created lazily off the main thread, the first time JS uses it, see requiresMainQueueSetup.
+ * The plugin startup does not wait for it, see POBRNPluginStartup.
+ */
+- (instancetype)init {
+    self = [super init];
+    if (self) {
+        // Never let the bundled configuration override the values set by JS.
+        [POBRNPluginStartup waitUntilConfigured];
+    }
+    return self;
+}
+
+/*!
+ @abstract Applies the global configuration in one call. Values unchanged since the previous configuration are skipped.
+ @param config json string having the configuration, see POBRNSDKConfigurator for the supported keys
+ */
+RCT_EXPORT_METHOD(configure:(NSString *)config) {
+    NSData *data = [config dataUsingEncoding:NSUTF8StringEncoding];
+    id configDictionary = data ? [NSJSONSerialization JSONObjectWithData:data options:0 error:nil] : nil;
+    if ([configDictionary isKindOfClass:[NSDictionary class]]) {
+        [POBRNSDKConfigurator applyConfig:configDictionary];
+    }
+}
+
+/*!
+ @abstract Registers the in-house mediation rule of the given ad unit id, evaluated natively on bid received.
+ @param adUnitId ad unit id of the placement
+ @param rule json string having the rule, see POBRNMediationRule for the supported keys
+ */
+RCT_EXPORT_METHOD(setMediationRule:(NSString *)adUnitId rule:(NSString *)rule) {
+    NSDictionary *ruleDictionary = [POBRNAdHelper convertJsonStringToJSON:rule error:nil];
+    if ([ruleDictionary isKindOfClass:[NSDictionary class]]) {
+        [POBRNMediationRule registerRule:[[POBRNMediationRule alloc] initWithDictionary:ruleDictionary]
+                             forAdUnitId:adUnitId];
+    }
+}
+
+/*!
+ @abstract Removes the in-house mediation rule of the given ad unit id.
+ */
+RCT_EXPORT_METHOD(removeMediationRule:(NSString *)adUnitId) {
+    [POBRNMediationRule unregisterRuleForAdUnitId:adUnitId];
+}
+
+/*!
+ @abstract Registers request parameters once, parsed natively and applied to the ads whose request
+ parameters refer to the template by "templateId".
+ @param templateId id of the template, replaces the template previously registered with this id
+ @param params json string of the request parameters, see POBRNRequestTemplate
+ */
+RCT_EXPORT_METHOD(registerRequestTemplate:(NSString *)templateId params:(NSString *)params) {
+    NSDictionary *dictionary = [POBRNAdHelper convertJsonStringToJSON:params error:nil];
+    if ([dictionary isKindOfClass:[NSDictionary class]]) {
+        [POBRNRequestTemplate registerTemplate:[[POBRNRequestTemplate alloc] initWithDictionary:dictionary]
+                                        withId:templateId];
+    }
+}
+
+/*!
+ @abstract Registers impression parameters once, see registerRequestTemplate.
+ @param params json string of the impression parameters, see POBRNImpressionTemplate
+ */
+RCT_EXPORT_METHOD(registerImpressionTemplate:(NSString *)templateId params:(NSString *)params) {
+    NSDictionary *dictionary = [POBRNAdHelper convertJsonStringToJSON:params error:nil];
+    if ([dictionary isKindOfClass:[NSDictionary class]]) {
+        [POBRNImpressionTemplate registerTemplate:[[POBRNImpressionTemplate alloc] initWithDictionary:dictionary]
+                                           withId:templateId];
+    }
+}
+
+/*!
+ @abstract Removes the request and impression templates registered with the given id.
+ */
+RCT_EXPORT_METHOD(removeTemplate:(NSString *)templateId) {
+    [POBRNRequestTemplate unregisterTemplateWithId:templateId];
+    [POBRNImpressionTemplate unregisterTemplateWithId:templateId];
+}
+
 /*!
  @abstract Sets log level across all ad formats.
  @param logLevel log level to set.
@@ -15,6 +112,7 @@ RCT_EXPORT_MODULE()
 RCT_EXPORT_METHOD(setLogLevel:(NSInteger)logLevel) {
     POBSDKLogLevel log_level = [OpenWrapSDKModuleHelper pobSDKLogLevel:logLevel];
     [OpenWrapSDK setLogLevel:log_level];
+    [POBRNSDKConfigurator invalidateKey:POBRN_CONFIG_LOG_LEVEL];
 }
 
 /*!
@@ -23,6 +121,7 @@ RCT_EXPORT_METHOD(setLogLevel:(NSInteger)logLevel) {
  */
 RCT_EXPORT_METHOD(allowLocationAccess:(BOOL)allow) {
     [OpenWrapSDK allowLocationAccess:allow];
+    [POBRNSDKConfigurator invalidateKey:POBRN_CONFIG_ALLOW_LOCATION_ACCESS];
 }
 
 /*!
@@ -32,6 +131,7 @@ RCT_EXPORT_METHOD(allowLocationAccess:(BOOL)allow) {
  */
 RCT_EXPORT_METHOD(setUseInternalBrowser:(BOOL)use) {
     [OpenWrapSDK useInternalBrowser:use];
+    [POBRNSDKConfigurator invalidateKey:POBRN_CONFIG_USE_INTERNAL_BROWSER];
 }
 
 /*!
@@ -41,6 +141,7 @@ RCT_EXPORT_METHOD(setLocation:(NSString *)location) {
     CLLocation *loc = [OpenWrapSDKModuleHelper parseJsonToLocation:location];
     POBLocSource src = [OpenWrapSDKModuleHelper parseSourceFromJsonString:location];
     [OpenWrapSDK setLocation:loc source:src];
+    [POBRNSDKConfigurator invalidateKey:POBRN_CONFIG_LOCATION];
 }
 
 /*!
@@ -53,6 +154,7 @@ RCT_EXPORT_METHOD(setLocation:(NSString *)location) {
  */
 RCT_EXPORT_METHOD(setCoppa:(BOOL)enable) {
     [OpenWrapSDK setCoppaEnabled:enable];
+    [POBRNSDKConfigurator invalidateKey:POBRN_CONFIG_COPPA];
 }
 
 /*!
@@ -61,6 +163,7 @@ RCT_EXPORT_METHOD(setCoppa:(BOOL)enable) {
  */
 RCT_EXPORT_METHOD(setSSLEnabled:(BOOL)enable) {
     [OpenWrapSDK setSSLEnabled:enable];
+    [POBRNSDKConfigurator invalidateKey:POBRN_CONFIG_SSL_ENABLED];
 }
 
 /*!
@@ -74,6 +177,7 @@ RCT_EXPORT_METHOD(setSSLEnabled:(BOOL)enable) {
  */
 RCT_EXPORT_METHOD(allowAdvertisingId:(BOOL)allow) {
     [OpenWrapSDK allowAdvertisingId:allow];
+    [POBRNSDKConfigurator invalidateKey:POBRN_CONFIG_ALLOW_ADVERTISING_ID];
 }
 
 /*!
@@ -84,6 +188,7 @@ RCT_EXPORT_METHOD(allowAdvertisingId:(BOOL)allow) {
  */
 RCT_EXPORT_METHOD(allowAVAudioSessionAccess:(BOOL)allow) {
     [OpenWrapSDK allowAVAudioSessionAccess:allow];
+    [POBRNSDKConfigurator invalidateKey:POBRN_CONFIG_ALLOW_AV_AUDIO_SESSION_ACCESS];
 }
 
 /*!
@@ -94,6 +199,7 @@ RCT_EXPORT_METHOD(setApplicationInfo:(NSString *)appInfo) {
     POBApplicationInfo *applicationInfo = [OpenWrapSDKModuleHelper parseJsonToApplicationInfo:appInfo];
     if (applicationInfo != nil) {
         [OpenWrapSDK setApplicationInfo:applicationInfo];
+        [POBRNSDKConfigurator invalidateKey:POBRN_CONFIG_APPLICATION_INFO];
     }
 }
 
@@ -105,12 +211,257 @@ RCT_EXPORT_METHOD(setUserInfo:(NSString *)userInfo) {
     POBUserInfo *usrInfo = [OpenWrapSDKModuleHelper parseJsonToUserInfo:userInfo];
     if (usrInfo != nil) {
         [OpenWrapSDK setUserInfo:usrInfo];
+        [POBRNSDKConfigurator invalidateKey:POBRN_CONFIG_USER_INFO];
     }
 }
 
+/*!
+ @abstract Enables or disables the lifecycle tracing of the plugin ad instances.
+ @param enabled boolean value
+ */
+RCT_EXPORT_METHOD(setTracingEnabled:(BOOL)enabled) {
+    [POBRNTracer setEnabled:enabled];
+}
+
+/*!
+ @abstract Enables or disables the os_signpost intervals around the plugin hot paths.
+ @param enabled boolean value
+ */
+RCT_EXPORT_METHOD(setSystemTracingEnabled:(BOOL)enabled) {
+    [POBRNSystemTrace setEnabled:enabled];
+}
+
+/*!
+ @abstract Removes all the recorded lifecycle trace entries.
+ */
+RCT_EXPORT_METHOD(clearTrace) {
+    [POBRNTracer clear];
+}
+
+/*!
+ @abstract Returns the recorded lifecycle trace entries in Chrome trace-event JSON format.
+ */
+RCT_EXPORT_METHOD(getTrace:(RCTPromiseResolveBlock)resolve
+                    reject:(RCTPromiseRejectBlock)reject) {
+    resolve([POBRNTracer chromeTraceJSON]);
+}
+
+/*!
+ @abstract Returns the ad latency percentiles measured per ad format and ad unit id as a JSON array string.
+ */
+RCT_EXPORT_METHOD(getLatencyStats:(RCTPromiseResolveBlock)resolve
+                           reject:(RCTPromiseRejectBlock)reject) {
+    NSData *data = [NSJSONSerialization dataWithJSONObject:[POBRNLatencyTracker stats] options:0 error:nil];
+    resolve(data ? [[NSString alloc] initWithData:data encoding:NSUTF8StringEncoding] : @"[]");
+}
+
+/*!
+ @abstract Removes all the measured ad latencies.
+ */
+RCT_EXPORT_METHOD(resetLatencyStats) {
+    [POBRNLatencyTracker reset];
+}
+
+/*!
+ @abstract Enables or disables attaching the measured ad latencies to the ad event payloads.
+ @param enabled boolean value
+ */
+RCT_EXPORT_METHOD(setLatencyInEventPayloadEnabled:(BOOL)enabled) {
+    POBRNLatencyTracker.payloadEnabled = enabled;
+}
+
+/*!
+ @abstract Returns the number of auctions started and avoided by the request coalescing, per ad unit, as a JSON array string.
+ */
+RCT_EXPORT_METHOD(getRequestCoalescingStats:(RCTPromiseResolveBlock)resolve
+                                     reject:(RCTPromiseRejectBlock)reject) {
+    NSData *data = [NSJSONSerialization dataWithJSONObject:[POBRNRequestCoalescer stats] options:0 error:nil];
+    resolve(data ? [[NSString alloc] initWithData:data encoding:NSUTF8StringEncoding] : @"[]");
+}
+
+/*!
+ @abstract Removes all the request coalescing stats.
+ */
+RCT_EXPORT_METHOD(resetRequestCoalescingStats) {
+    [POBRNRequestCoalescer resetStats];
+}
+
+/*!
+ @abstract Limits the banner loads in flight, see POBRNBannerLoadScheduler.
+ @param count maximum number of concurrent banner loads, 0 for no limit
+ */
+RCT_EXPORT_METHOD(setMaxConcurrentBannerLoads:(NSInteger)count) {
+    dispatch_async(dispatch_get_main_queue(), ^{
+        POBRNBannerLoadScheduler.maxConcurrentLoads = (NSUInteger)MAX(count, 0);
+    });
+}
+
+/*!
+ @abstract Enables or disables the alignment of the banner auto refreshes in shared windows, see POBRNBannerRefreshCoordinator.
+ @param enabled boolean value
+ */
+RCT_EXPORT_METHOD(setBannerRefreshAlignmentEnabled:(BOOL)enabled) {
+    dispatch_async(dispatch_get_main_queue(), ^{
+        POBRNBannerRefreshCoordinator.enabled = enabled;
+    });
+}
+
+/*!
+ @abstract Returns the banner requests, radio wake ups and estimated radio active time, without and with the refresh alignment, as a JSON string.
+ */
+RCT_EXPORT_METHOD(getBannerRefreshStats:(RCTPromiseResolveBlock)resolve
+                                 reject:(RCTPromiseRejectBlock)reject) {
+    NSData *data = [NSJSONSerialization dataWithJSONObject:[POBRNBannerRefreshCoordinator stats] options:0 error:nil];
+    resolve(data ? [[NSString alloc] initWithData:data encoding:NSUTF8StringEncoding] : @"{}");
+}
+
+/*!
+ @abstract Removes all the banner refresh stats.
+ */
+RCT_EXPORT_METHOD(resetBannerRefreshStats) {
+    [POBRNBannerRefreshCoordinator resetStats];
+}
+
+/*!
+ @abstract Returns the banner refreshes and loads held back while the full screen ads were showing, and the estimated bytes freed, as a JSON string.
+ */
+RCT_EXPORT_METHOD(getFullScreenArbitrationStats:(RCTPromiseResolveBlock)resolve
+                                         reject:(RCTPromiseRejectBlock)reject) {
+    NSData *data = [NSJSONSerialization dataWithJSONObject:[POBRNFullScreenArbiter stats] options:0 error:nil];
+    resolve(data ? [[NSString alloc] initWithData:data encoding:NSUTF8StringEncoding] : @"{}");
+}
+
+/*!
+ @abstract Removes all the full screen arbitration stats.
+ */
+RCT_EXPORT_METHOD(resetFullScreenArbitrationStats) {
+    [POBRNFullScreenArbiter resetStats];
+}
+
+/*!
+ @abstract Sets the number of web views kept warm, see POBRNWebViewPool.
+ @param size number of web views, 0 to disable the pool
+ */
+RCT_EXPORT_METHOD(setWebViewPoolSize:(NSInteger)size) {
+    dispatch_async(dispatch_get_main_queue(), ^{
+        POBRNWebViewPool.maxSize = MAX(size, 0);
+    });
+    [POBRNSDKConfigurator invalidateKey:POBRN_CONFIG_WEBVIEW_POOL_SIZE];
+}
+
+/*!
+ @abstract Enables or disables the prefetch of the video media files, see POBRNMediaCache.
+ @param enabled boolean value
+ @param maxBytes maximum size of the cached files in bytes
+ */
+RCT_EXPORT_METHOD(setMediaPrecacheEnabled:(BOOL)enabled maxBytes:(double)maxBytes) {
+    POBRNMediaCache.enabled = enabled;
+    POBRNMediaCache.maxBytes = (unsigned long long)MAX(maxBytes, 0);
+}
+
+/*!
+ @abstract Returns the media prefetch stats, e.g. the number of downloads and the bytes downloaded, as a JSON string.
+ */
+RCT_EXPORT_METHOD(getMediaCacheStats:(RCTPromiseResolveBlock)resolve
+                              reject:(RCTPromiseRejectBlock)reject) {
+    NSData *data = [NSJSONSerialization dataWithJSONObject:[POBRNMediaCache stats] options:0 error:nil];
+    resolve(data ? [[NSString alloc] initWithData:data encoding:NSUTF8StringEncoding] : @"{}");
+}
+
+/*!
+ @abstract Removes all the media cache stats.
+ */
+RCT_EXPORT_METHOD(resetMediaCacheStats) {
+    [POBRNMediaCache resetStats];
+}
+
+/*!
+ @abstract Queues a win or loss notice, delivered in batches and retried until delivered, see POBRNNoticeDispatcher.
+ @param url notice URL, its macros already replaced
+ */
+RCT_EXPORT_METHOD(sendNotice:(NSString *)url) {
+    [POBRNNoticeDispatcher enqueueURL:url];
+}
+
+/*!
+ @abstract Returns the notice queue depth, delivery counts and latency percentiles as a JSON string.
+ */
+RCT_EXPORT_METHOD(getNoticeStats:(RCTPromiseResolveBlock)resolve
+                          reject:(RCTPromiseRejectBlock)reject) {
+    NSData *data = [NSJSONSerialization dataWithJSONObject:[POBRNNoticeDispatcher stats] options:0 error:nil];
+    resolve(data ? [[NSString alloc] initWithData:data encoding:NSUTF8StringEncoding] : @"{}");
+}
+
+/*!
+ @abstract Removes all the notice stats.
+ */
+RCT_EXPORT_METHOD(resetNoticeStats) {
+    [POBRNNoticeDispatcher resetStats];
+}
+
+/*!
+ @abstract Enables or disables the recording of the auction outcomes, see POBRNBidLandscape.
+ @param capacity number of auction outcomes retained
+ */
+RCT_EXPORT_METHOD(setBidLandscapeEnabled:(BOOL)enabled capacity:(double)capacity) {
+    [POBRNBidLandscape setEnabled:enabled capacity:(NSUInteger)capacity];
+}
+
+/*!
+ @abstract Returns the per partner win rates and per ad unit price percentiles of the recorded auctions as a JSON string.
+ */
+RCT_EXPORT_METHOD(getBidLandscapeSummary:(RCTPromiseResolveBlock)resolve
+                                  reject:(RCTPromiseRejectBlock)reject) {
+    NSData *data = [NSJSONSerialization dataWithJSONObject:[POBRNBidLandscape summary] options:0 error:nil];
+    resolve(data ? [[NSString alloc] initWithData:data encoding:NSUTF8StringEncoding] : @"{}");
+}
+
+/*!
+ @abstract Exports the recorded auction outcomes into a binary file and returns its path, nil if nothing is recorded.
+ */
+RCT_EXPORT_METHOD(exportBidLandscape:(RCTPromiseResolveBlock)resolve
+                              reject:(RCTPromiseRejectBlock)reject) {
+    resolve([POBRNBidLandscape exportToFile]);
+}
+
+/*!
+ @abstract Removes all the recorded auction outcomes.
+ */
+RCT_EXPORT_METHOD(clearBidLandscape) {
+    [POBRNBidLandscape clear];
+}
+
+/*!
+ @abstract Defers the loads of the full screen ads until their predicted show falls within the bid validity window, see POBRNPreloadScheduler.
+ */
+RCT_EXPORT_METHOD(setPreloadSchedulingEnabled:(BOOL)enabled) {
+    dispatch_async(dispatch_get_main_queue(), ^{
+        POBRNPreloadScheduler.enabled = enabled;
+    });
+}
+
+/*!
+ @abstract Returns the per ad unit wasted auctions and bytes, and the learned show rate and timings as a JSON string.
+ */
+RCT_EXPORT_METHOD(getPreloadStats:(RCTPromiseResolveBlock)resolve
+                           reject:(RCTPromiseRejectBlock)reject) {
+    NSData *data = [NSJSONSerialization dataWithJSONObject:[POBRNPreloadScheduler stats] options:0 error:nil];
+    resolve(data ? [[NSString alloc] initWithData:data encoding:NSUTF8StringEncoding] : @"{}");
+}
+
+/*!
+ @abstract Removes all the preload stats.
+ */
+RCT_EXPORT_METHOD(resetPreloadStats) {
+    [POBRNPreloadScheduler resetStats];
+}
+
 - (NSDictionary *)constantsToExport {
     NSString *sdkVersion = [OpenWrapSDK version];
-    return @{ POBRN_OW_SDK_VERSION: sdkVersion };
+    return @{
+        POBRN_OW_SDK_VERSION: sdkVersion,
+        POBRN_GAM_SUPPORTED: @([POBRNGamEventHandlers isAvailable])
+    };
 }
 
 + (BOOL)requiresMainQueueSetup {
@@ -10,7 +10,8 @@ NS_ASSUME_NONNULL_BEGIN
 + (UIViewController *)topViewController;
 
 /**
- * Parses and set up ad request parameters on the ad request @c POBRequest instance.
+ * Parses and set up ad request parameters on the ad request @c POBRequest instance. The
+ * POBRNRequestTemplate referred by "templateId", if any, is applied first.
  *
  * @param jsonString A JSON string with the ad request parameters.
  * @param nestedParsing A boolean indicate if request parameter should be parsed from the
@@ -21,7 +22,8 @@ NS_ASSUME_NONNULL_BEGIN
     andNestedParsing:(BOOL)nestedParsing;
 
 /**
- * Parses and set up ad impression parameters on the ad impression @c POBImpression instance.
+ * Parses and set up ad impression parameters on the ad impression @c POBImpression instance. The
+ * POBRNImpressionTemplate referred by "templateId", if any, is applied first.
  *
  * @param jsonString A JSON string with the ad impression parameters.
  * @param nestedParsing A boolean indicate if impression parameters should be parsed from the
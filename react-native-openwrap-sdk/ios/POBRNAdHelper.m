@@ -1,4 +1,5 @@
 #import "POBRNAdHelper.h"
+#import "POBRNAdTemplate.h"
 #import "POBRNConstants.h"
 #import <React/RCTLog.h>
 
@@ -34,31 +35,16 @@ NS_ASSUME_NONNULL_BEGIN
         dictionary = dictionary[POBRN_REQUEST];
     }
 
-    NSNumber *bidSummaryEnabled = dictionary[POBRN_IS_BID_SUMMARY_ENABLED];
-    NSNumber *debugEnabled = dictionary[POBRN_IS_DEBUG_ENABLED];
-    NSNumber *testModeEnabled = dictionary[POBRN_IS_TEST_MODE_ENABLED];
-    NSNumber *networkTimeout = dictionary[POBRN_NETWORK_TIMEOUT];
-    NSNumber *profileVersionId = dictionary[POBRN_PROFILE_VERSION_ID];
-    NSString *adServerURL = dictionary[POBRN_AD_SERVER_URL];
-
-    request.versionId = profileVersionId;
-    request.adServerURL = adServerURL;
-
-    if (bidSummaryEnabled != nil) {
-        request.bidSummaryEnabled = [bidSummaryEnabled boolValue];
-    }
-
-    if (debugEnabled != nil) {
-        request.debug = [debugEnabled boolValue];
-    }
-
-    if (testModeEnabled != nil) {
-        request.testModeEnabled = [testModeEnabled boolValue];
-    }
-
-    if (networkTimeout != nil) {
-        request.networkTimeout = [networkTimeout doubleValue];
+    // Apply the referred template first, the other parameters override it.
+    NSString *templateId = dictionary[POBRN_TEMPLATE_ID];
+    if (templateId != nil) {
+        POBRNRequestTemplate *requestTemplate = [POBRNRequestTemplate templateWithId:templateId];
+        if (requestTemplate == nil) {
+            RCTLogWarn(POBRN_TEMPLATE_NOT_FOUND_MSG, templateId);
+        }
+        [requestTemplate applyToRequest:request];
     }
+    [[[POBRNRequestTemplate alloc] initWithDictionary:dictionary] applyToRequest:request];
 }
 
 + (void)setUpImpression:(POBImpression *)impression
@@ -85,26 +71,16 @@ NS_ASSUME_NONNULL_BEGIN
         dictionary = dictionary[POBRN_IMPRESSION];
     }
 
-    NSNumber *adPosition = dictionary[POBRN_AD_POSITION];
-    if (adPosition != nil) {
-        impression.adPosition = [adPosition integerValue];
-    }
-
-    NSString *testCreativeId = dictionary[POBRN_TEST_CREATIVE_ID];
-    impression.testCreativeId = testCreativeId;
-
-    // Convert custom parameter string into dictionary.
-    NSString *customParamsJSON = dictionary[POBRN_CUSTOM_PARAMS];
-    if (customParamsJSON.length > 0) {
-        NSDictionary *customParamsDict = [self convertJsonStringToJSON:customParamsJSON
-                                                                 error:&parsingError];
-        if (parsingError != nil || customParamsDict.count == 0) {
-            RCTLogInfo(@"Ad impression custom parameters parsing failed, error: %@",
-                       parsingError.localizedDescription);
-            return;
+    // Apply the referred template first, the other parameters override it.
+    NSString *templateId = dictionary[POBRN_TEMPLATE_ID];
+    if (templateId != nil) {
+        POBRNImpressionTemplate *impressionTemplate = [POBRNImpressionTemplate templateWithId:templateId];
+        if (impressionTemplate == nil) {
+            RCTLogWarn(POBRN_TEMPLATE_NOT_FOUND_MSG, templateId);
         }
-        impression.customParams = customParamsDict;
+        [impressionTemplate applyToImpression:impression];
     }
+    [[[POBRNImpressionTemplate alloc] initWithDictionary:dictionary] applyToImpression:impression];
 }
 
 #pragma mark - Objects to NSDictionary conversion methods
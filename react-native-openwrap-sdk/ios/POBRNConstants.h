@@ -1,6 +1,9 @@
 #ifndef POBRNConstants_h
 #define POBRNConstants_h
 
+// Full screen ad event ids and payload key codes, generated from scripts/event-schema.json
+#import "POBRNEventSchema.h"
+
 #define POBRN_KEYWORDS @"keywords"
 
 // AppInfo Keys
@@ -36,11 +39,25 @@
 #define POBRN_INVALID_REQUEST_FAILURE_MSG   @"Failed to parse ad unit config."
 
 #define POBRN_OW_SDK_VERSION @"ow_sdk_version"
+#define POBRN_GAM_SUPPORTED  @"gam_supported"
+
+// SDK configuration keys
+#define POBRN_CONFIG_LOG_LEVEL                      @"logLevel"
+#define POBRN_CONFIG_ALLOW_LOCATION_ACCESS          @"allowLocationAccess"
+#define POBRN_CONFIG_COPPA                          @"coppa"
+#define POBRN_CONFIG_SSL_ENABLED                    @"sslEnabled"
+#define POBRN_CONFIG_USE_INTERNAL_BROWSER           @"useInternalBrowser"
+#define POBRN_CONFIG_ALLOW_ADVERTISING_ID           @"allowAdvertisingId"
+#define POBRN_CONFIG_ALLOW_AV_AUDIO_SESSION_ACCESS  @"allowAVAudioSessionAccess"
+#define POBRN_CONFIG_APPLICATION_INFO               @"applicationInfo"
+#define POBRN_CONFIG_USER_INFO                      @"userInfo"
+#define POBRN_CONFIG_LOCATION                       @"location"
+#define POBRN_CONFIG_WEBVIEW_POOL_SIZE              @"webViewPoolSize"
+// Bundle resource applied natively when the plugin is loaded, before the JS bundle runs.
+#define POBRN_BUNDLED_CONFIG_FILE                   @"openwrap_sdk_config"
 
 // Event payload data constants
-#define POBRN_EVENT_PAYLOAD_EXTRA_KEY       @"ext"
 #define POBRN_AD_INSTANCE_ID                @"instanceId"
-#define POBRN_EVENT_NAME_KEY                @"eventName"
 #define POBRN_ERROR_CODE                    @"errorCode"
 #define POBRN_ERROR_MESSAGE                 @"errorMessage"
 #define POBRN_REWARD_AMOUNT                 @"rewardAmount"
@@ -48,6 +65,7 @@
 #define POBRN_BANNER_FORCE_REFRESH_STATUS   @"forceRefreshStatus"
 #define POBRN_BANNER_PROCEED_TO_LOAD_AD_STATUS  @"proceedToLoadAdStatus"
 #define POBRN_BID_EXPIRY_STATUS             @"bidExpiryStatus"
+#define POBRN_LATENCY                       @"latency"
 
 // Ad unit details constants
 #define POBRN_PUBLISHER_ID          @"publisherId"
@@ -72,6 +90,10 @@
 #define POBRN_CUSTOM_PARAMS     @"customParams"
 #define POBRN_IMPRESSION        @"impression"
 
+// Request and impression template constants
+#define POBRN_TEMPLATE_ID               @"templateId"
+#define POBRN_TEMPLATE_NOT_FOUND_MSG    @"No request or impression template registered with id %@"
+
 // Bid parameter constants
 #define POBRN_BID_PRICE             @"price"
 #define POBRN_BID_TARGETING         @"targeting"
@@ -90,27 +112,33 @@
 #define POBRN_BID_REFRESH_INTERVAL  @"refreshInterval"
 #define POBRN_ENABLE_GET_BID_PRICE  @"enableGetBidPrice"
 
+// In-house mediation rule constants
+#define POBRN_MEDIATION_FLOOR               @"floor"
+#define POBRN_MEDIATION_PARTNER_FLOORS      @"partnerFloors"
+#define POBRN_MEDIATION_ALLOWED_PARTNERS    @"allowedPartners"
+#define POBRN_MEDIATION_MAX_WAIT            @"maxWaitMs"
+#define POBRN_MEDIATION_WON                 @"won"
+#define POBRN_MEDIATION_REASON              @"reason"
+
+// GAM header bidding constants
+#define POBRN_GAM_CONFIG                    @"gam"
+#define POBRN_GAM_CUSTOM_TARGETING          @"customTargeting"
+#define POBRN_GAM_OW_TIMEOUT                @"owTimeoutMs"
+#define POBRN_GAM_UNAVAILABLE_MSG           @"GAM event handler is not available, loading without GAM for ad unit %@"
+
 typedef NS_ENUM(NSInteger, POBRNFullScreenAdType) {
     POBRNFullScreenAdTypeInterstitial = 0,
     POBRNFullScreenAdTypeRewarded,
 };
 
+typedef NS_ENUM(NSInteger, POBRNAdFormat) {
+    POBRNAdFormatBanner = 0,
+    POBRNAdFormatInterstitial,
+    POBRNAdFormatRewarded,
+};
+
 // Global event as per ad type
 #define POBRN_INTERSTITIAL_AD_EVENT @"pob_rn_interstitial_ad_event"
 #define POBRN_REWARDED_AD_EVENT     @"pob_rn_rewarded_ad_event"
 
-// Ad callback event name
-#define POBRN_EVENT_AD_RECEIVED                @"onAdReceived"
-#define POBRN_EVENT_FAILED_TO_LOAD_AD          @"onAdFailedToLoad"
-#define POBRN_EVENT_FAILED_TO_SHOW_AD          @"onAdFailedToShow"
-#define POBRN_EVENT_DID_CLICK_AD               @"onAdClicked"
-#define POBRN_EVENT_AD_OPENED                  @"onAdOpened"
-#define POBRN_EVENT_AD_CLOSED                  @"onAdClosed"
-#define POBRN_EVENT_AD_EXPIRED                 @"onAdExpired"
-#define POBRN_EVENT_WILL_LEAVE_APP             @"onAppLeaving"
-#define POBRN_EVENT_VIDEO_PLAYBACK_COMPLETED   @"onVideoPlaybackCompleted"
-#define POBRN_EVENT_RECEIVE_REWARD             @"onReceiveReward"
-#define POBRN_EVENT_BID_RECEIVED               @"onBidReceived"
-#define POBRN_EVENT_BID_RECEIVE_FAILED         @"onBidFailed"
-
 #endif /* POBRNConstants_h */
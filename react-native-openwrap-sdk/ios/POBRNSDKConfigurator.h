@@ -0,0 +1,50 @@
+#import <Foundation/Foundation.h>
+
+/*!
+ Applies the global OpenWrapSDK configuration in one go. The last applied value of every key is
+ remembered, so unchanged values are not applied again whether they come from the bundled
+ configuration or from JS. The individual setters of the plugin invalidate the value of their key,
+ see invalidateKey:.
+ */
+@interface POBRNSDKConfigurator : NSObject
+
+/*!
+ @abstract Applies the configuration dictionary, every key is optional.
+ @param config configuration dictionary
+ Example = {
+    "logLevel": 4,
+    "allowLocationAccess": true,
+    "coppa": false,
+    "sslEnabled": true,
+    "useInternalBrowser": false,
+    "allowAdvertisingId": true,
+    "allowAVAudioSessionAccess": true,
+    "applicationInfo": { "domain": "example.com", "storeUrl": "https://example.com/app" },
+    "userInfo": { "city": "Pune", "birthYear": 1990 },
+    "location": { "latitude": 1.2, "longitude": 1.5, "source": 1 },
+    "webViewPoolSize": 1
+    }
+ @return keys which were applied, i.e. skipping the unchanged ones
+ */
++ (NSArray<NSString *> *)applyConfig:(NSDictionary *)config;
+
+/*!
+ @abstract Applies the configuration bundled in the main bundle as openwrap_sdk_config.json, if any.
+ It can be called from application:didFinishLaunchingWithOptions: to configure the SDK before
+ React Native starts, it is anyway called when the plugin starts, see POBRNPluginStartup.
+ */
++ (void)applyBundledConfig;
+
+/*!
+ @abstract Forgets the applied value of a key, set since then by its individual setter, so that the next
+ configuration applies it again.
+ @param key configuration key
+ */
++ (void)invalidateKey:(NSString *)key;
+
+/*!
+ @abstract Forgets the applied configuration, so that the next values are applied again.
+ */
++ (void)reset;
+
+@end
@@ -0,0 +1,131 @@
+#import "POBRNSDKConfigurator.h"
+#import <OpenWrapSDK/OpenWrapSDK.h>
+#import <React/RCTLog.h>
+#import "OpenWrapSDKModuleHelper.h"
+#import "POBRNConstants.h"
+#import "POBRNWebViewPool.h"
+
+@implementation POBRNSDKConfigurator
+
+static NSMutableDictionary *appliedConfig;
+
++ (void)initialize {
+    if (self == [POBRNSDKConfigurator class]) {
+        appliedConfig = [NSMutableDictionary new];
+    }
+}
+
++ (NSArray<NSString *> *)applyConfig:(NSDictionary *)config {
+    NSMutableArray<NSString *> *appliedKeys = [NSMutableArray new];
+    @synchronized (self) {
+        for (NSString *key in config) {
+            id value = config[key];
+            if ([appliedConfig[key] isEqual:value]) {
+                continue;
+            }
+            if ([self applyValue:value forKey:key]) {
+                appliedConfig[key] = value;
+                [appliedKeys addObject:key];
+            }
+        }
+    }
+    return appliedKeys;
+}
+
++ (void)applyBundledConfig {
+    NSString *path = [[NSBundle mainBundle] pathForResource:POBRN_BUNDLED_CONFIG_FILE ofType:@"json"];
+    NSData *data = path ? [NSData dataWithContentsOfFile:path] : nil;
+    if (data == nil) {
+        // No bundled configuration, no action required.
+        return;
+    }
+    id config = [NSJSONSerialization JSONObjectWithData:data options:0 error:nil];
+    if ([config isKindOfClass:[NSDictionary class]]) {
+        [self applyConfig:config];
+    } else {
+        RCTLogWarn(@"Unable to parse the bundled OpenWrap SDK configuration.");
+    }
+}
+
++ (void)invalidateKey:(NSString *)key {
+    @synchronized (self) {
+        [appliedConfig removeObjectForKey:key];
+    }
+}
+
++ (void)reset {
+    @synchronized (self) {
+        [appliedConfig removeAllObjects];
+    }
+}
+
+/*!
+ @abstract Applies the value of given key on OpenWrapSDK
+ @return YES if the key and its value are supported, NO otherwise
+ */
++ (BOOL)applyValue:(id)value forKey:(NSString *)key {
+    if ([key isEqualToString:POBRN_CONFIG_APPLICATION_INFO] ||
+        [key isEqualToString:POBRN_CONFIG_USER_INFO] ||
+        [key isEqualToString:POBRN_CONFIG_LOCATION]) {
+        if (![value isKindOfClass:[NSDictionary class]]) {
+            return NO;
+        }
+        // The helper parses json strings, as received from the individual setters.
+        NSData *data = [NSJSONSerialization dataWithJSONObject:value options:0 error:nil];
+        NSString *json = [[NSString alloc] initWithData:data encoding:NSUTF8StringEncoding];
+        if ([key isEqualToString:POBRN_CONFIG_APPLICATION_INFO]) {
+            POBApplicationInfo *applicationInfo = [OpenWrapSDKModuleHelper parseJsonToApplicationInfo:json];
+            if (applicationInfo == nil) {
+                return NO;
+            }
+            [OpenWrapSDK setApplicationInfo:applicationInfo];
+        } else if ([key isEqualToString:POBRN_CONFIG_USER_INFO]) {
+            POBUserInfo *userInfo = [OpenWrapSDKModuleHelper parseJsonToUserInfo:json];
+            if (userInfo == nil) {
+                return NO;
+            }
+            [OpenWrapSDK setUserInfo:userInfo];
+        } else {
+            CLLocation *location = [OpenWrapSDKModuleHelper parseJsonToLocation:json];
+            if (location == nil) {
+                return NO;
+            }
+            [OpenWrapSDK setLocation:location source:[OpenWrapSDKModuleHelper parseSourceFromJsonString:json]];
+        }
+        return YES;
+    }
+
+    if (![value isKindOfClass:[NSNumber class]]) {
+        return NO;
+    }
+    if ([key isEqualToString:POBRN_CONFIG_LOG_LEVEL]) {
+        NSInteger logLevel = [value integerValue];
+        if (logLevel < POBRN_LogLevel_ALL || logLevel > POBRN_LogLevel_OFF) {
+            return NO;
+        }
+        [OpenWrapSDK setLogLevel:[OpenWrapSDKModuleHelper pobSDKLogLevel:logLevel]];
+    } else if ([key isEqualToString:POBRN_CONFIG_ALLOW_LOCATION_ACCESS]) {
+        [OpenWrapSDK allowLocationAccess:[value boolValue]];
+    } else if ([key isEqualToString:POBRN_CONFIG_COPPA]) {
+        [OpenWrapSDK setCoppaEnabled:[value boolValue]];
+    } else if ([key isEqualToString:POBRN_CONFIG_SSL_ENABLED]) {
+        [OpenWrapSDK setSSLEnabled:[value boolValue]];
+    } else if ([key isEqualToString:POBRN_CONFIG_USE_INTERNAL_BROWSER]) {
+        [OpenWrapSDK useInternalBrowser:[value boolValue]];
+    } else if ([key isEqualToString:POBRN_CONFIG_ALLOW_ADVERTISING_ID]) {
+        [OpenWrapSDK allowAdvertisingId:[value boolValue]];
+    } else if ([key isEqualToString:POBRN_CONFIG_ALLOW_AV_AUDIO_SESSION_ACCESS]) {
+        [OpenWrapSDK allowAVAudioSessionAccess:[value boolValue]];
+    } else if ([key isEqualToString:POBRN_CONFIG_WEBVIEW_POOL_SIZE]) {
+        NSUInteger size = (NSUInteger)MAX([value integerValue], 0);
+        // The pool is only accessed on the main thread.
+        dispatch_async(dispatch_get_main_queue(), ^{
+            POBRNWebViewPool.maxSize = size;
+        });
+    } else {
+        return NO;
+    }
+    return YES;
+}
+
+@end
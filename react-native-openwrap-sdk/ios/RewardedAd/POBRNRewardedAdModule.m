@@ -1,10 +1,13 @@
 #import "POBRNRewardedAdModule.h"
 #import "POBRNConstants.h"
+#import "POBRNAdHelper.h"
 #import "POBRNFullScreenAdProvider.h"
 #import "POBRNFullScreenAdManager.h"
+#import "POBRNShowFallback.h"
 #import "POBRNRewardedAd.h"
 
 #import <OpenWrapSDK/OpenWrapSDK.h>
+#import <React/RCTLog.h>
 
 NS_ASSUME_NONNULL_BEGIN
 
@@ -50,6 +53,35 @@ RCT_EXPORT_METHOD(createAdInstance:(nonnull NSString *)instanceId
     [POBRNFullScreenAdManager add:rewardedAd forInstanceId:instanceId];
 }
 
+/**
+ * Creates the rewarded ad with given unique ad instance id, which loads through the GAM event handler
+ * for header bidding. It falls back to OpenWrap only if the GAM event handler is not available.
+ *
+ * @param instanceId A string identifier passed to uniquely identify each ad instance.
+ * @param publisherId Unique identifier assigned at the time of publisher onboarding.
+ * @param profileId Profile id of the ad tag.
+ * @param adUnitId An unit id used to identify unique placement on screen.
+ * @param gamConfig GAM details JSON string of the ad unit.
+ */
+RCT_EXPORT_METHOD(createGamAdInstance:(nonnull NSString *)instanceId
+                          publisherId:(nonnull NSString *)publisherId
+                            profileId:(nonnull NSNumber *)profileId
+                             adUnitId:(nonnull NSString *)adUnitId
+                            gamConfig:(nonnull NSString *)gamConfig) {
+    NSError *parsingError = nil;
+    NSDictionary *gamDetails = [POBRNAdHelper convertJsonStringToJSON:gamConfig error:&parsingError];
+    if (parsingError) {
+        RCTLogWarn(@"GAM config parsing failed, error: %@", parsingError.localizedDescription);
+    }
+    id<POBRNFullScreenAd> rewardedAd = [[POBRNRewardedAd alloc] initWithInstanceId:instanceId
+                                                                      eventEmitter:self
+                                                                       publisherId:publisherId
+                                                                         profileId:profileId
+                                                                          adUnitId:adUnitId
+                                                                         gamConfig:[POBRNGamConfig configWithDictionary:gamDetails]];
+    [POBRNFullScreenAdManager add:rewardedAd forInstanceId:instanceId];
+}
+
 /**
  * Loads a rewarded ad using the @c POBRewardedAd class instance mapped with given instance unique id.
  *
@@ -175,6 +207,43 @@ RCT_EXPORT_METHOD(isBidExpired:(NSString *)instanceId
     resolve(isBidExpired);
 }
 
+#pragma mark - Show groups
+
+/**
+ * Adds the ad to a show group, see @c POBRNShowFallback.
+ *
+ * @param group Name of the show group.
+ * @param instanceId A string identifier passed to uniquely identify each ad instance.
+ */
+RCT_EXPORT_METHOD(addToGroup:(nonnull NSString *)group
+                  instanceId:(nonnull NSString *)instanceId) {
+    [POBRNFullScreenAdManager addInstanceId:instanceId toGroup:group];
+}
+
+RCT_EXPORT_METHOD(removeFromGroup:(nonnull NSString *)group
+                       instanceId:(nonnull NSString *)instanceId) {
+    [POBRNFullScreenAdManager removeInstanceId:instanceId fromGroup:group];
+}
+
+/**
+ * Shows the best ready ad of a show group, interstitial or rewarded, see @c POBRNShowFallback.
+ *
+ * @param group Name of the show group.
+ * @param budgetMillis Time to wait for a loading ad when none of the group is ready.
+ * @param resolve A promise resolve block to return the instance id of the ad shown, nil if none was shown.
+ * @param reject A promise reject block which can be used for returning any failures.
+ */
+RCT_EXPORT_METHOD(showBestAvailable:(nonnull NSString *)group
+                       budgetMillis:(double)budgetMillis
+                            resolve:(RCTPromiseResolveBlock)resolve
+                             reject:(RCTPromiseRejectBlock)reject) {
+    [POBRNShowFallback showBestAvailableInGroup:group
+                                   budgetMillis:budgetMillis
+                                     completion:^(NSString *_Nullable instanceId) {
+        resolve(instanceId);
+    }];
+}
+
 @end
 
 NS_ASSUME_NONNULL_END
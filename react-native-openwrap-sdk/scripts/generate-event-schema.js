@@ -0,0 +1,203 @@
+#!/usr/bin/env node
+/**
+ * Generates the full screen ad event ids and the payload key codes of the three layers from
+ * scripts/event-schema.json:
+ * - android/src/main/java/com/pubmatic/sdk/openwrap/reactnative/POBRNEventSchema.kt
+ * - ios/Common/POBRNEventSchema.h
+ * - src/common/POBEventSchema.ts
+ *
+ * Usage:
+ *   node scripts/generate-event-schema.js [--check]
+ *
+ * - check: writes nothing, exits with an error if a generated file is not up to date.
+ *
+ * The events are emitted as `{"i": instanceId, "e": event id, "x": ext}`, the top level keys of
+ * the ext being replaced by their codes. The ids and codes are part of the bridge protocol, add
+ * new events and keys at the end, never renumber them.
+ */
+const fs = require('fs');
+const path = require('path');
+
+const ROOT = path.resolve(__dirname, '..');
+const SCHEMA_FILE = path.join(__dirname, 'event-schema.json');
+const KOTLIN_FILE = 'android/src/main/java/com/pubmatic/sdk/openwrap/reactnative/POBRNEventSchema.kt';
+const OBJC_FILE = 'ios/Common/POBRNEventSchema.h';
+const TS_FILE = 'src/common/POBEventSchema.ts';
+const HEADER = '// Generated by scripts/generate-event-schema.js from scripts/event-schema.json, do not edit.';
+
+/**
+ * Throws if the event ids are not dense and in order, or if a name or code is duplicated.
+ */
+function validate(schema) {
+  schema.events.forEach((event, index) => {
+    if (event.id !== index) {
+      throw new Error(`Event ${event.constant} has id ${event.id}, expected ${index}`);
+    }
+  });
+  const unique = (values, what) => {
+    const duplicates = values.filter((value, index) => values.indexOf(value) !== index);
+    if (duplicates.length) {
+      throw new Error(`Duplicated ${what}: ${duplicates.join(', ')}`);
+    }
+  };
+  unique(schema.events.map((event) => event.constant), 'event constants');
+  unique(schema.events.map((event) => event.name), 'event names');
+  unique(schema.envelope.map((key) => key.code), 'envelope codes');
+  unique(schema.keys.map((key) => key.name), 'key names');
+  unique(schema.keys.map((key) => key.code), 'key codes');
+}
+
+/**
+ * Converts an upper snake case constant to upper camel case, e.g. AD_RECEIVED to AdReceived.
+ */
+function camelCase(constant) {
+  return constant
+    .toLowerCase()
+    .replace(/(^|_)([a-z])/g, (_, __, c) => c.toUpperCase());
+}
+
+function renderKotlin(schema) {
+  const lines = [
+    HEADER,
+    'package com.pubmatic.sdk.openwrap.reactnative',
+    '',
+    '/**',
+    ' * Ids of the full screen ad events and codes of their payload keys, shared with the iOS and JS',
+    ' * layers. An event is emitted as `{"i": instanceId, "e": event id, "x": ext}`, the top level keys',
+    ' * of the ext being replaced by their codes.',
+    ' */',
+    'internal object POBRNEventSchema {',
+    '',
+    '    //region: Event ids',
+  ];
+  schema.events.forEach((event) => {
+    lines.push(`    /** ${event.doc} */`, `    const val ${event.constant} = ${event.id}`);
+  });
+  lines.push(`    const val EVENT_COUNT = ${schema.events.length}`, '    //endregion', '');
+  lines.push('    //region: Event names');
+  schema.events.forEach((event) => {
+    lines.push(`    const val ${event.constant}_NAME = "${event.name}"`);
+  });
+  lines.push('    //endregion', '');
+  lines.push('    //region: Envelope keys');
+  schema.envelope.forEach((key) => {
+    lines.push(`    const val ${key.constant}_KEY = "${key.code}"`);
+  });
+  lines.push('    //endregion', '');
+  lines.push('    /** Codes of the ext keys, by key name. */', '    val KEY_CODES: Map<String, String> = hashMapOf(');
+  schema.keys.forEach((key, index) => {
+    lines.push(`        "${key.name}" to "${key.code}"${index < schema.keys.length - 1 ? ',' : ''}`);
+  });
+  lines.push('    )', '}', '');
+  return lines.join('\n');
+}
+
+function renderObjC(schema) {
+  const lines = [
+    HEADER,
+    '#ifndef POBRNEventSchema_h',
+    '#define POBRNEventSchema_h',
+    '',
+    '#import <Foundation/Foundation.h>',
+    '',
+    '/**',
+    ' * Ids of the full screen ad events, shared with the Android and JS layers. An event is emitted as',
+    ' * {"i": instanceId, "e": event id, "x": ext}, the top level keys of the ext being replaced by their codes.',
+    ' */',
+    'typedef NS_ENUM(NSInteger, POBRNEvent) {',
+  ];
+  schema.events.forEach((event) => {
+    lines.push(`    /** ${event.doc} */`, `    POBRNEvent${camelCase(event.constant)} = ${event.id},`);
+  });
+  lines.push('};', '', `#define POBRN_EVENT_COUNT ${schema.events.length}`, '');
+  lines.push('// Event payload envelope keys');
+  schema.envelope.forEach((key) => {
+    lines.push(`#define POBRN_EVENT_KEY_${key.constant} @"${key.code}"`);
+  });
+  lines.push('', '// Codes of the ext keys, by key name', '#define POBRN_EVENT_KEY_CODES @{ \\');
+  schema.keys.forEach((key, index) => {
+    lines.push(`    @"${key.name}": @"${key.code}"${index < schema.keys.length - 1 ? ',' : ''} \\`);
+  });
+  lines.push('}', '', '#endif /* POBRNEventSchema_h */', '');
+  return lines.join('\n');
+}
+
+function renderTs(schema) {
+  const lines = [
+    HEADER,
+    '',
+    '/**',
+    ' * Ids of the full screen ad events, shared with the native layers. An event is emitted as',
+    ' * `{"i": instanceId, "e": event id, "x": ext}`, the top level keys of the ext being replaced by',
+    ' * their codes.',
+    ' */',
+    'export const POBEvent = {',
+  ];
+  schema.events.forEach((event) => {
+    lines.push(`  /** ${event.doc} */`, `  ${event.constant}: ${event.id},`);
+  });
+  lines.push('} as const;', '');
+  lines.push('export type POBEventId = (typeof POBEvent)[keyof typeof POBEvent];', '');
+  lines.push('/** Number of events, the ids are in [0, POB_EVENT_COUNT). */');
+  lines.push(`export const POB_EVENT_COUNT = ${schema.events.length};`, '');
+  lines.push('/** Names of the events, by event id. */', 'export const POB_EVENT_NAMES: readonly string[] = [');
+  schema.events.forEach((event) => lines.push(`  '${event.name}',`));
+  lines.push('];', '');
+  lines.push('/** Keys of the event payload envelope. */', 'export const POBEventKey = {');
+  schema.envelope.forEach((key) => lines.push(`  ${key.constant}: '${key.code}',`));
+  lines.push('} as const;', '');
+  lines.push('/** Names of the ext keys, by code. */');
+  lines.push('export const POB_EVENT_KEY_NAMES: ReadonlyMap<string, string> = new Map([');
+  schema.keys.forEach((key) => lines.push(`  ['${key.code}', '${key.name}'],`));
+  lines.push(']);', '');
+  return lines.join('\n');
+}
+
+/**
+ * Returns the content of the generated files, by path relative to the package root.
+ */
+function render(schema) {
+  validate(schema);
+  return {
+    [KOTLIN_FILE]: renderKotlin(schema),
+    [OBJC_FILE]: renderObjC(schema),
+    [TS_FILE]: renderTs(schema),
+  };
+}
+
+function readSchema() {
+  return JSON.parse(fs.readFileSync(SCHEMA_FILE, 'utf-8'));
+}
+
+/**
+ * Returns the paths of the generated files whose content differs from the schema.
+ */
+function staleFiles() {
+  return Object.entries(render(readSchema()))
+    .filter(([file, content]) => {
+      const fullPath = path.join(ROOT, file);
+      return !fs.existsSync(fullPath) || fs.readFileSync(fullPath, 'utf-8') !== content;
+    })
+    .map(([file]) => file);
+}
+
+if (require.main === module) {
+  if (process.argv.includes('--check')) {
+    const stale = staleFiles();
+    if (stale.length) {
+      console.error(`Out of date, run yarn schema: ${stale.join(', ')}`);
+      process.exit(1);
+    }
+  } else {
+    Object.entries(render(readSchema())).forEach(([file, content]) => {
+      fs.writeFileSync(path.join(ROOT, file), content);
+      console.log(`Generated ${file}`);
+    });
+  }
+}
+
+module.exports = {
+  render,
+  readSchema,
+  staleFiles,
+};
@@ -0,0 +1,191 @@
+#!/usr/bin/env node
+/**
+ * Local stub of the OpenWrap ad server. It answers every ad request with a canned OpenRTB bid
+ * response, so the plugin can be load tested offline by pointing `POBRequest.adServerUrl` to it.
+ *
+ * Usage:
+ *   node scripts/stub-ad-server.js [--port 8089] [--latency 100] [--jitter 50]
+ *                                  [--no-fill-rate 0.2] [--width 320] [--height 50]
+ *                                  [--price 1.5] [--media-bytes 65536]
+ *
+ * - latency/jitter: the response is delayed by `latency` + a random value in [0, jitter) ms.
+ * - no-fill-rate: ratio in [0, 1] of requests answered with HTTP 204 (no bid).
+ * - width/height: creative size, defaults to the first size of the requested impression.
+ * - media-bytes: size of the media files of the VAST creatives returned for video impressions,
+ *   served from /media/.
+ *
+ * The bids carry win and loss notice URLs served from /track/, answered with HTTP 200.
+ *
+ * The module also exports `createStubAdServer(options)` for use from the jest harness.
+ */
+const http = require('http');
+
+const DEFAULT_OPTIONS = {
+  port: 8089,
+  latency: 0,
+  jitter: 0,
+  noFillRate: 0,
+  width: undefined,
+  height: undefined,
+  price: 1.5,
+  mediaBytes: 64 * 1024,
+};
+
+// Sizes of the media files of the VAST creatives.
+const MEDIA_SIZES = [
+  [480, 270],
+  [1280, 720],
+  [1920, 1080],
+];
+
+/**
+ * Parses `--key value` command line arguments into stub server options.
+ */
+function parseArgs(argv) {
+  const options = { ...DEFAULT_OPTIONS };
+  for (let i = 0; i < argv.length; i += 2) {
+    const key = argv[i].replace(/^--/, '').replace(/-([a-z])/g, (_, c) => c.toUpperCase());
+    if (!(key in DEFAULT_OPTIONS)) {
+      throw new Error(`Unknown option ${argv[i]}`);
+    }
+    options[key] = Number(argv[i + 1]);
+  }
+  return options;
+}
+
+/**
+ * Returns the creative size for the given impression, preferring the configured size.
+ */
+function creativeSize(imp, options) {
+  if (options.width && options.height) {
+    return { w: options.width, h: options.height };
+  }
+  if (imp && imp.video) {
+    return { w: imp.video.w || 320, h: imp.video.h || 480 };
+  }
+  const banner = (imp && imp.banner) || {};
+  const format = (banner.format && banner.format[0]) || banner;
+  return { w: format.w || 320, h: format.h || 50 };
+}
+
+/**
+ * Builds a VAST 3.0 inline creative with one progressive MP4 media file per size of MEDIA_SIZES,
+ * served by the stub at `baseUrl`.
+ */
+function buildVast(baseUrl) {
+  const mediaFiles = MEDIA_SIZES.map(
+    ([w, h]) =>
+      `<MediaFile delivery="progressive" type="video/mp4" width="${w}" height="${h}" bitrate="${h * 2}">` +
+      `<![CDATA[${baseUrl}/media/${w}x${h}.mp4]]></MediaFile>`
+  ).join('');
+  return (
+    '<VAST version="3.0"><Ad id="stub-video"><InLine><AdSystem>OpenWrap stub</AdSystem>' +
+    '<AdTitle>OpenWrap stub video</AdTitle><Creatives><Creative><Linear><Duration>00:00:15</Duration>' +
+    `<MediaFiles>${mediaFiles}</MediaFiles></Linear></Creative></Creatives></InLine></Ad></VAST>`
+  );
+}
+
+/**
+ * Builds an OpenRTB 2.5 bid response with one bid for every impression of the request.
+ */
+function buildBidResponse(request, options, baseUrl = '') {
+  const imps = request.imp && request.imp.length > 0 ? request.imp : [{ id: '1' }];
+  const bids = imps.map((imp, index) => {
+    const { w, h } = creativeSize(imp, options);
+    const isVideo = Boolean(imp.video);
+    return {
+      id: `stub-bid-${Date.now()}-${index}`,
+      impid: imp.id,
+      price: options.price,
+      adm: isVideo
+        ? buildVast(baseUrl)
+        : `<div style="width:${w}px;height:${h}px;background:#0a84ff;color:#fff">OpenWrap stub ${w}x${h}</div>`,
+      crid: 'stub-creative',
+      nurl: `${baseUrl}/track/win?price=\${AUCTION_PRICE}`,
+      lurl: `${baseUrl}/track/loss?reason=\${AUCTION_LOSS}`,
+      w,
+      h,
+      ext: { crtype: isVideo ? 'video' : 'banner' },
+    };
+  });
+  return {
+    id: request.id || 'stub-response',
+    cur: 'USD',
+    seatbid: [{ seat: 'pubmatic', bid: bids }],
+  };
+}
+
+/**
+ * Creates, but does not start, the stub server. Request counters are kept on `server.stats`.
+ */
+function createStubAdServer(overrides = {}) {
+  const options = { ...DEFAULT_OPTIONS, ...overrides };
+  const stats = { requests: 0, bids: 0, noFills: 0, errors: 0, mediaRequests: 0, trackerRequests: 0 };
+  const server = http.createServer((req, res) => {
+    if (req.url && req.url.startsWith('/media/')) {
+      stats.mediaRequests++;
+      res.writeHead(200, { 'Content-Type': 'video/mp4', 'Content-Length': options.mediaBytes });
+      res.end(Buffer.alloc(options.mediaBytes));
+      return;
+    }
+    if (req.url && req.url.startsWith('/track/')) {
+      stats.trackerRequests++;
+      res.writeHead(200, { 'Content-Length': 0 });
+      res.end();
+      return;
+    }
+    let body = '';
+    req.on('data', (chunk) => {
+      body += chunk;
+    });
+    req.on('end', () => {
+      stats.requests++;
+      let request = {};
+      try {
+        request = body.length > 0 ? JSON.parse(body) : {};
+      } catch (e) {
+        stats.errors++;
+        res.writeHead(400);
+        res.end();
+        return;
+      }
+      const delay = options.latency + Math.random() * options.jitter;
+      setTimeout(() => {
+        if (Math.random() < options.noFillRate) {
+          stats.noFills++;
+          res.writeHead(204);
+          res.end();
+          return;
+        }
+        stats.bids++;
+        res.writeHead(200, { 'Content-Type': 'application/json' });
+        const baseUrl = `http://${req.headers.host || `localhost:${server.address().port}`}`;
+        res.end(JSON.stringify(buildBidResponse(request, options, baseUrl)));
+      }, delay);
+    });
+  });
+  server.stats = stats;
+  server.options = options;
+  return server;
+}
+
+if (require.main === module) {
+  const options = parseArgs(process.argv.slice(2));
+  const server = createStubAdServer(options);
+  server.listen(options.port, () => {
+    console.log(`OpenWrap stub ad server listening on http://localhost:${server.address().port}`);
+    console.log(`Options: ${JSON.stringify(options)}`);
+  });
+  process.on('SIGINT', () => {
+    console.log(`\nStats: ${JSON.stringify(server.stats)}`);
+    server.close(() => process.exit(0));
+  });
+}
+
+module.exports = {
+  createStubAdServer,
+  buildBidResponse,
+  buildVast,
+  parseArgs,
+  DEFAULT_OPTIONS,
+};
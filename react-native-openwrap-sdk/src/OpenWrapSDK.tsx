@@ -1,26 +1,48 @@
-import { NativeModules, Platform } from 'react-native';
-
-const LINKING_ERROR =
-  `The package 'react-native-openwrap-sdk' doesn't seem to be linked. Make sure: \n\n` +
-  Platform.select({ ios: "- You have run 'pod install'\n", default: '' }) +
-  '- You rebuilt the app after installing the package\n' +
-  '- You are not using Expo Go\n';
-
-const OpenWrapSDKModule = NativeModules.OpenWrapSDKModule
-  ? NativeModules.OpenWrapSDKModule
-  : new Proxy(
-    {},
-    {
-      get() {
-        throw new Error(LINKING_ERROR);
-      },
-    }
-  );
+import { lazyNativeModule } from './common/POBNativeModules';
+
+// Resolved on first use, so that importing the package does not create the native module.
+const OpenWrapSDKModule = lazyNativeModule('OpenWrapSDKModule');
 
 import { POBUserInfo } from './models/POBUserInfo';
 import { POBApplicationInfo } from './models/POBApplicationInfo';
 import { POBLocation } from './models/POBLocation';
-const { ow_sdk_version } = OpenWrapSDKModule.getConstants();
+import { POBLatencyStats } from './models/POBLatencyStats';
+import type { POBRequestCoalescingStats } from './models/POBRequestCoalescingStats';
+import type { POBMediaCacheStats } from './models/POBMediaCacheStats';
+import type { POBNoticeStats } from './models/POBNoticeStats';
+import type { POBBidLandscapeSummary } from './models/POBBidLandscapeSummary';
+import type { POBPreloadStats } from './models/POBPreloadStats';
+import type { POBBid } from './models/POBBid';
+import type { POBBannerRefreshStats } from './models/POBBannerRefreshStats';
+import type { POBFullScreenArbitrationStats } from './models/POBFullScreenArbitrationStats';
+import { POBSDKConfig } from './models/POBSDKConfig';
+import { POBMediationRule } from './models/POBMediationRule';
+import type { POBRequest } from './models/POBRequest';
+import type { POBImpression } from './models/POBImpression';
+import type { POBGamConfig } from './models/POBGamConfig';
+import { POBEventRecorder } from './common/POBEventRecorder';
+import type { POBEventTrace } from './common/POBEventRecorder';
+// Native constants, read synchronously on the first getVersion() or isGamSupported() call.
+type SDKConstants = { ow_sdk_version: string; gam_supported?: boolean };
+let constants: SDKConstants | undefined;
+// Last configuration passed to configure(), to skip the bridge call when it is unchanged. Cleared by
+// the individual setters, the next configure() then applies the values they changed again.
+let lastConfigJson: string | undefined;
+/**
+ * Replaces the OpenRTB auction macros, known on the JS side, of a notice URL.
+ */
+function replaceNoticeMacros(url: string, bid: POBBid, auctionPrice: number): string {
+  const macros: [string, string | undefined][] = [
+    ['${AUCTION_PRICE}', String(auctionPrice)],
+    ['${AUCTION_BID_ID}', bid.bidId],
+    ['${AUCTION_IMP_ID}', bid.impressionId],
+  ];
+  return macros.reduce(
+    (result, [macro, value]) => (value === undefined ? result : result.split(macro).join(encodeURIComponent(value))),
+    url
+  );
+}
+
 /**
  * Provides global configurations for the OpenWrap SDK, e.g. enabling logging, location access,
  * etc. These configurations are globally applicable for OpenWrap SDK; you don't have to set
@@ -33,7 +55,103 @@ export class OpenWrapSDK {
    * @return sdk version
    */
   public static getVersion(): string {
-    return ow_sdk_version;
+    return OpenWrapSDK.constants().ow_sdk_version;
+  }
+
+  /**
+   * Returns true if the OpenWrap GAM event handler is included in the app, i.e. ads created with a
+   * {@link POBGamConfig} are loaded through GAM. It is included with the gradle property
+   * 'PubmaticOpenwrapSdk_gamEventHandlerEnabled=true' on Android and the
+   * 'react-native-openwrap-sdk/GAM' pod on iOS.
+   *
+   * @return true if GAM header bidding is supported
+   */
+  public static isGamSupported(): boolean {
+    return OpenWrapSDK.constants().gam_supported === true;
+  }
+
+  private static constants(): SDKConstants {
+    if (!constants) {
+      constants = OpenWrapSDKModule.getConstants() as SDKConstants;
+    }
+    return constants;
+  }
+
+  /**
+   * Applies the global configuration in a single native call, instead of calling the individual
+   * setters one by one. Natively, the values unchanged since the previous configuration are
+   * skipped.
+   * <p>
+   * The same configuration can also be bundled with the app, as the asset
+   * 'openwrap_sdk_config.json' on Android and the resource 'openwrap_sdk_config.json' of the main
+   * bundle on iOS. It is then applied natively, before the JS bundle starts.
+   *
+   * @param config configuration to apply, see {@link POBSDKConfig}
+   */
+  public static configure(config: POBSDKConfig) {
+    var configJson: string = JSON.stringify(config);
+    if (configJson === lastConfigJson) {
+      return;
+    }
+    lastConfigJson = configJson;
+    OpenWrapSDKModule.configure(configJson);
+  }
+
+  /**
+   * Registers the in-house mediation rule of an ad unit id, replacing the previous one. When the
+   * OpenWrap bid of an ad with this ad unit id is received, the rule is evaluated natively and the
+   * ad proceeds to load, or to error, without a JS round trip. Only the outcome is notified through
+   * {@link POBBidEventListener.onMediationOutcome}.
+   *
+   * @param adUnitId ad unit id of the placement
+   * @param rule the {@link POBMediationRule} to apply
+   */
+  public static setMediationRule(adUnitId: string, rule: POBMediationRule) {
+    OpenWrapSDKModule.setMediationRule(adUnitId, JSON.stringify(rule));
+  }
+
+  /**
+   * Removes the in-house mediation rule of an ad unit id, the bid events are then notified to JS
+   * as usual.
+   *
+   * @param adUnitId ad unit id of the placement
+   */
+  public static removeMediationRule(adUnitId: string) {
+    OpenWrapSDKModule.removeMediationRule(adUnitId);
+  }
+
+  /**
+   * Registers request parameters shared by many ads, e.g. of a screen, replacing the template
+   * previously registered with this id. They are sent and parsed once, the ads refer to them with
+   * {@link POBRequest.templateId}. Register the template before loading the ads referring to it.
+   *
+   * @param templateId id of the template
+   * @param request the shared {@link POBRequest} parameters
+   */
+  public static registerRequestTemplate(templateId: string, request: POBRequest) {
+    OpenWrapSDKModule.registerRequestTemplate(templateId, JSON.stringify(request));
+  }
+
+  /**
+   * Registers impression parameters shared by many ads, e.g. the custom parameters of the user
+   * targeting, see {@link registerRequestTemplate}. The ads refer to them with
+   * {@link POBImpression.templateId}.
+   *
+   * @param templateId id of the template
+   * @param impression the shared {@link POBImpression} parameters
+   */
+  public static registerImpressionTemplate(templateId: string, impression: POBImpression) {
+    OpenWrapSDKModule.registerImpressionTemplate(templateId, JSON.stringify(impression));
+  }
+
+  /**
+   * Removes the request and impression templates registered with the given id. The ads already
+   * set up keep their parameters.
+   *
+   * @param templateId id of the templates
+   */
+  public static removeTemplate(templateId: string) {
+    OpenWrapSDKModule.removeTemplate(templateId);
   }
 
   /**
@@ -43,6 +161,7 @@ export class OpenWrapSDK {
    * @param logLevel log level to set.
    */
   public static setLogLevel(logLevel: OpenWrapSDK.LogLevel) {
+    lastConfigJson = undefined;
     OpenWrapSDKModule.setLogLevel(logLevel);
   }
 
@@ -61,6 +180,7 @@ export class OpenWrapSDK {
    * @param allowLocationAccess enable or disable location access behavior
    */
   public static allowLocationAccess(allowLocationAccess: boolean) {
+    lastConfigJson = undefined;
     OpenWrapSDKModule.allowLocationAccess(allowLocationAccess);
   }
 
@@ -75,6 +195,7 @@ export class OpenWrapSDK {
    * @param coppa Visitor state for COPPA compliance.
    */
   public static setCoppa(coppa: boolean) {
+    lastConfigJson = undefined;
     OpenWrapSDKModule.setCoppa(coppa);
   }
 
@@ -87,6 +208,7 @@ export class OpenWrapSDK {
    * @param sslEnabled false for disable secure creative mode. Default is set to true.
    */
   public static setSSLEnabled(sslEnabled: boolean) {
+    lastConfigJson = undefined;
     OpenWrapSDKModule.setSSLEnabled(sslEnabled);
   }
 
@@ -99,6 +221,7 @@ export class OpenWrapSDK {
    * @param useInternalBrowser boolean value that enables/disables the use of internal browser.
    */
   public static setUseInternalBrowser(useInternalBrowser: boolean) {
+    lastConfigJson = undefined;
     OpenWrapSDKModule.setUseInternalBrowser(useInternalBrowser);
   }
 
@@ -113,6 +236,7 @@ export class OpenWrapSDK {
    * @param allowAdvertisingId state of advertisement id usage
    */
   public static allowAdvertisingId(allowAdvertisingId: boolean) {
+    lastConfigJson = undefined;
     OpenWrapSDKModule.allowAdvertisingId(allowAdvertisingId);
   }
 
@@ -123,6 +247,7 @@ export class OpenWrapSDK {
    * @param applicationInfo Instance of POBApplicationInfo class with required application details
    */
   public static setApplicationInfo(applicationInfo: POBApplicationInfo) {
+    lastConfigJson = undefined;
     var applicationInfoJson: string = JSON.stringify(applicationInfo);
     OpenWrapSDKModule.setApplicationInfo(applicationInfoJson);
   }
@@ -137,6 +262,7 @@ export class OpenWrapSDK {
    * @param location User's current location
    */
   public static setLocation(location: POBLocation) {
+    lastConfigJson = undefined;
     var locationJson: string = JSON.stringify(location);
     OpenWrapSDKModule.setLocation(locationJson);
   }
@@ -146,6 +272,7 @@ export class OpenWrapSDK {
    * @param allow allow audio session access
    */
   public static allowAVAudioSessionAccess(allow: boolean) {
+    lastConfigJson = undefined;
     if (Platform.OS === 'ios') {
       OpenWrapSDKModule.allowAVAudioSessionAccess(allow);
     }
@@ -157,9 +284,337 @@ export class OpenWrapSDK {
    * @param userInfo Instance of POBUserInfo class with required user details
    */
   public static setUserInfo(userInfo: POBUserInfo) {
+    lastConfigJson = undefined;
     var userInfoJson: string = JSON.stringify(userInfo);
     OpenWrapSDKModule.setUserInfo(userInfoJson);
   }
+
+  /**
+   * Enables or disables the native lifecycle tracing of banner, interstitial and rewarded ad
+   * instances. Tracing is disabled by default. Already recorded entries are retained when
+   * tracing is disabled.
+   *
+   * @param enabled true to record the lifecycle steps, false otherwise.
+   */
+  public static setTracingEnabled(enabled: boolean) {
+    OpenWrapSDKModule.setTracingEnabled(enabled);
+  }
+
+  /**
+   * Enables or disables the platform trace sections around the native plugin hot paths: ad unit
+   * parsing, request and impression setup, bid payload building, event emission and banner layout.
+   * They show up in Perfetto/systrace captures on Android and as os_signpost intervals in
+   * Instruments on iOS 12+, with the instance id and ad unit id. Disabled by default.
+   *
+   * @param enabled true to emit the trace sections, false otherwise.
+   */
+  public static setSystemTracingEnabled(enabled: boolean) {
+    OpenWrapSDKModule.setSystemTracingEnabled(enabled);
+  }
+
+  /**
+   * Removes all the recorded lifecycle trace entries.
+   */
+  public static clearTrace() {
+    OpenWrapSDKModule.clearTrace();
+  }
+
+  /**
+   * Starts recording the native ad events received by the JS layer: the events of the
+   * interstitial and rewarded ads and the direct events of the banners. The trace can be replayed
+   * by the jest replay harness, to measure and regression test the JS layer without a device.
+   * A new recording discards the events recorded so far.
+   */
+  public static startEventRecording() {
+    POBEventRecorder.start();
+  }
+
+  /**
+   * Stops recording the native ad events.
+   *
+   * @return the recorded {@link POBEventTrace}, to be saved as JSON.
+   */
+  public static stopEventRecording(): POBEventTrace {
+    return POBEventRecorder.stop();
+  }
+
+  /**
+   * Returns the recorded lifecycle trace entries in the Chrome trace-event JSON format. The
+   * result can be saved to a file and opened in chrome://tracing or https://ui.perfetto.dev
+   *
+   * @return Promise resolved with the trace JSON string.
+   */
+  public static getTrace(): Promise<string> {
+    return OpenWrapSDKModule.getTrace();
+  }
+
+  /**
+   * Returns the ad latency percentiles measured natively per ad format, ad unit id and metric.
+   * See {@link POBAdLatency} for the measured metrics.
+   *
+   * @return Promise resolved with the list of {@link POBLatencyStats}.
+   */
+  public static getLatencyStats(): Promise<POBLatencyStats[]> {
+    return OpenWrapSDKModule.getLatencyStats().then((stats: string) => JSON.parse(stats));
+  }
+
+  /**
+   * Removes all the measured ad latencies.
+   */
+  public static resetLatencyStats() {
+    OpenWrapSDKModule.resetLatencyStats();
+  }
+
+  /**
+   * Enables or disables attaching the latencies measured for an ad instance to its events.
+   * Once enabled, the latencies are available through getLatency() of the full screen ads and the
+   * onAdReceived callback of POBBannerView. Disabled by default.
+   *
+   * @param enabled true to attach the latencies, false otherwise.
+   */
+  public static setLatencyInEventPayloadEnabled(enabled: boolean) {
+    OpenWrapSDKModule.setLatencyInEventPayloadEnabled(enabled);
+  }
+
+  /**
+   * Limits the number of banner loads in flight. Banner loads are queued natively and started
+   * in the order of their visibility: visible banners first, then the ones closest to the
+   * viewport. No banner load starts during a fast scroll or fling. Defaults to 2.
+   * <p>
+   * The queue wait and the time from the load request to the ad being visible are reported as
+   * the queueWait and requestToFirstVisible latencies.
+   *
+   * @param count maximum number of concurrent banner loads, 0 for no limit.
+   */
+  public static setMaxConcurrentBannerLoads(count: number) {
+    OpenWrapSDKModule.setMaxConcurrentBannerLoads(count);
+  }
+
+  /**
+   * Enables or disables the alignment of the banner auto refreshes. Once enabled, the banners are
+   * refreshed natively in batches instead of on their own timers, so that the banners on screen
+   * hit the network together. A banner is never refreshed before its bid refresh interval, and
+   * is delayed by at most a quarter of it. Disabled by default.
+   *
+   * @param enabled true to align the refreshes.
+   */
+  public static setBannerRefreshAlignmentEnabled(enabled: boolean) {
+    OpenWrapSDKModule.setBannerRefreshAlignmentEnabled(enabled);
+  }
+
+  /**
+   * Returns the banner requests, radio wake ups and estimated radio active time, without and
+   * with the refresh alignment.
+   *
+   * @return Promise resolved with the {@link POBBannerRefreshStats}.
+   */
+  public static getBannerRefreshStats(): Promise<POBBannerRefreshStats> {
+    return OpenWrapSDKModule.getBannerRefreshStats().then((stats: string) => JSON.parse(stats));
+  }
+
+  /**
+   * Removes all the banner refresh stats.
+   */
+  public static resetBannerRefreshStats() {
+    OpenWrapSDKModule.resetBannerRefreshStats();
+  }
+
+  /**
+   * Returns the banner activity held back while the interstitial and rewarded ads were showing.
+   * From the first full screen ad opened until the last one is closed, the banner refreshes are
+   * paused and the queued banner loads deferred natively, the banners whose refresh fell due
+   * meanwhile refresh once closed.
+   *
+   * @return Promise resolved with the {@link POBFullScreenArbitrationStats}.
+   */
+  public static getFullScreenArbitrationStats(): Promise<POBFullScreenArbitrationStats> {
+    return OpenWrapSDKModule.getFullScreenArbitrationStats().then((stats: string) => JSON.parse(stats));
+  }
+
+  /**
+   * Removes all the full screen arbitration stats.
+   */
+  public static resetFullScreenArbitrationStats() {
+    OpenWrapSDKModule.resetFullScreenArbitrationStats();
+  }
+
+  /**
+   * Sets the number of WebViews kept warm natively. The pool is filled once the app is idle
+   * after startup, so the first creative render and the renders after all the previous ads were
+   * destroyed do not pay for starting the web engine. The pool is not filled on low RAM Android
+   * devices and is drained on memory pressure. Disabled by default, at most 2. Set it in the
+   * bundled configuration, as 'webViewPoolSize', for the pool to be filled at startup.
+   *
+   * @param size number of WebViews, 0 to disable the pool.
+   */
+  public static setWebViewPoolSize(size: number) {
+    lastConfigJson = undefined;
+    OpenWrapSDKModule.setWebViewPoolSize(size);
+  }
+
+  /**
+   * Returns the number of auctions started and avoided natively per ad unit. Identical loads,
+   * i.e. with the same publisher id, profile id, ad unit id, request and impression parameters,
+   * are coalesced: a load of an ad already loading is ignored, full screen loads run one at a
+   * time and share a no fill, and a banner unmounted while loading hands its load over to a
+   * banner mounted with the same details within 3 seconds.
+   *
+   * @return Promise resolved with the list of {@link POBRequestCoalescingStats}.
+   */
+  public static getRequestCoalescingStats(): Promise<POBRequestCoalescingStats[]> {
+    return OpenWrapSDKModule.getRequestCoalescingStats().then((stats: string) => JSON.parse(stats));
+  }
+
+  /**
+   * Removes all the request coalescing stats.
+   */
+  public static resetRequestCoalescingStats() {
+    OpenWrapSDKModule.resetRequestCoalescingStats();
+  }
+
+  /**
+   * Enables or disables the native prefetch of the video media files. Once a video interstitial
+   * or rewarded ad is received on an unmetered network, the media file of the rendition fitting
+   * the screen best is downloaded into a size bounded LRU disk cache. The file is evicted when the
+   * bid expires or the ad is destroyed. Disabled by default.
+   *
+   * The OpenWrap SDK player does not play from this cache: it downloads the media file again when
+   * the ad is shown, so enabling the prefetch adds to the video traffic.
+   *
+   * @param enabled true to enable the prefetch.
+   * @param maxBytes maximum size of the cached files in bytes, defaults to 50 MB.
+   */
+  public static setMediaPrecacheEnabled(enabled: boolean, maxBytes: number = 50 * 1024 * 1024) {
+    OpenWrapSDKModule.setMediaPrecacheEnabled(enabled, maxBytes);
+  }
+
+  /**
+   * Returns the native media prefetch stats, e.g. the number of downloads and the bytes downloaded.
+   *
+   * @return Promise resolved with the {@link POBMediaCacheStats}.
+   */
+  public static getMediaCacheStats(): Promise<POBMediaCacheStats> {
+    return OpenWrapSDKModule.getMediaCacheStats().then((stats: string) => JSON.parse(stats));
+  }
+
+  /**
+   * Removes all the media cache stats.
+   */
+  public static resetMediaCacheStats() {
+    OpenWrapSDKModule.resetMediaCacheStats();
+  }
+
+  /**
+   * Sends the win notice, i.e. the nurl, of a bid which won the client side auction run by the
+   * app. The notice is persisted natively and delivered in batches, retried with a backoff until
+   * delivered, also across app sessions and while offline. Does nothing if the bid has no nurl.
+   *
+   * @param bid winning bid.
+   * @param auctionPrice clearing price replacing the ${AUCTION_PRICE} macro, defaults to the bid price.
+   */
+  public static sendWinNotice(bid: POBBid, auctionPrice: number = bid.price) {
+    if (bid.nurl) {
+      OpenWrapSDKModule.sendNotice(replaceNoticeMacros(bid.nurl, bid, auctionPrice));
+    }
+  }
+
+  /**
+   * Sends the loss notice, i.e. the lurl, of a bid which lost the client side auction run by the
+   * app, delivered like the win notices. Does nothing if the bid has no lurl.
+   *
+   * @param bid losing bid.
+   * @param lossReason OpenRTB loss reason code replacing the ${AUCTION_LOSS} macro, e.g. 102 when
+   * the bid lost to a higher bid.
+   * @param auctionPrice clearing price replacing the ${AUCTION_PRICE} macro, defaults to the bid price.
+   */
+  public static sendLossNotice(bid: POBBid, lossReason: number, auctionPrice: number = bid.price) {
+    if (bid.lurl) {
+      OpenWrapSDKModule.sendNotice(
+        replaceNoticeMacros(bid.lurl, bid, auctionPrice).split('${AUCTION_LOSS}').join(String(lossReason))
+      );
+    }
+  }
+
+  /**
+   * Returns the native notice queue stats, e.g. its depth and the delivery latency.
+   *
+   * @return Promise resolved with the {@link POBNoticeStats}.
+   */
+  public static getNoticeStats(): Promise<POBNoticeStats> {
+    return OpenWrapSDKModule.getNoticeStats().then((stats: string) => JSON.parse(stats));
+  }
+
+  /**
+   * Removes all the notice stats.
+   */
+  public static resetNoticeStats() {
+    OpenWrapSDKModule.resetNoticeStats();
+  }
+
+  /**
+   * Enables or disables the recording of the auction outcomes in a native memory-mapped log,
+   * persisted across the sessions. Disabled by default.
+   *
+   * @param enabled true to record the outcome of each auction.
+   * @param capacity Number of auction outcomes retained, the oldest ones are overwritten.
+   */
+  public static setBidLandscapeEnabled(enabled: boolean, capacity: number = 16384) {
+    OpenWrapSDKModule.setBidLandscapeEnabled(enabled, capacity);
+  }
+
+  /**
+   * Returns the per partner win rates and the per ad unit price percentiles of the recorded auctions.
+   *
+   * @return Promise resolved with the {@link POBBidLandscapeSummary}.
+   */
+  public static getBidLandscapeSummary(): Promise<POBBidLandscapeSummary> {
+    return OpenWrapSDKModule.getBidLandscapeSummary().then((summary: string) => JSON.parse(summary));
+  }
+
+  /**
+   * Exports the recorded auction outcomes into a binary file, e.g. to be uploaded for an offline analysis.
+   *
+   * @return Promise resolved with the path of the file, null if nothing is recorded.
+   */
+  public static exportBidLandscape(): Promise<string | null> {
+    return OpenWrapSDKModule.exportBidLandscape();
+  }
+
+  /**
+   * Removes all the recorded auction outcomes.
+   */
+  public static clearBidLandscape() {
+    OpenWrapSDKModule.clearBidLandscape();
+  }
+
+  /**
+   * Enables or disables the scheduling of the interstitial and rewarded ad loads. When enabled, a
+   * load is deferred until the show predicted from the previous ads of the ad unit falls within the
+   * bid validity window, and the ad units whose ads often expire unseen are throttled. Disabled by
+   * default.
+   *
+   * @param enabled true to defer the loads.
+   */
+  public static setPreloadSchedulingEnabled(enabled: boolean) {
+    OpenWrapSDKModule.setPreloadSchedulingEnabled(enabled);
+  }
+
+  /**
+   * Returns, per ad unit, the auctions and bytes wasted on ads expired unseen, with the show rate and
+   * timings learned by the preload scheduler.
+   *
+   * @return Promise resolved with the {@link POBPreloadStats}.
+   */
+  public static getPreloadStats(): Promise<POBPreloadStats> {
+    return OpenWrapSDKModule.getPreloadStats().then((stats: string) => JSON.parse(stats));
+  }
+
+  /**
+   * Removes all the preload stats, keeping what the scheduler learned.
+   */
+  public static resetPreloadStats() {
+    OpenWrapSDKModule.resetPreloadStats();
+  }
 }
 
 export namespace OpenWrapSDK {
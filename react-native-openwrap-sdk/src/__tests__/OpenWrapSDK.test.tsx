@@ -2,6 +2,9 @@ import { OpenWrapSDK } from '../OpenWrapSDK';
 import { POBApplicationInfo } from '../models/POBApplicationInfo';
 import { POBLocation } from '../models/POBLocation';
 import { POBUserInfo } from '../models/POBUserInfo';
+import { POBBid } from '../models/POBBid';
+import { POBRequest } from '../models/POBRequest';
+import { POBImpression } from '../models/POBImpression';
 var actualLogLevel: OpenWrapSDK.LogLevel;
 var actualAllowLocationAccess: Boolean;
 var actualCoppa: boolean;
@@ -12,6 +15,28 @@ var actualUserInfo: string | null;
 var actualApplicationInfo: string | null;
 var actualLocation: string | null;
 var actualAudioSessionEnabled: boolean;
+var actualTracingEnabled: boolean;
+var actualSystemTracingEnabled: boolean;
+var traceCleared: boolean = false;
+var latencyStatsReset: boolean = false;
+var coalescingStatsReset: boolean = false;
+var actualLatencyInPayload: boolean;
+var actualMaxConcurrentBannerLoads: number;
+var actualWebViewPoolSize: number;
+var actualMediaPrecache: { enabled: boolean; maxBytes: number };
+var mediaCacheStatsReset: boolean = false;
+var sentNotices: string[] = [];
+var noticeStatsReset: boolean = false;
+var actualBidLandscape: [boolean, number] | undefined;
+var bidLandscapeCleared: boolean = false;
+var actualPreloadScheduling: boolean;
+var preloadStatsReset: boolean = false;
+var actualRefreshAlignment: boolean;
+var refreshStatsReset: boolean = false;
+var arbitrationStatsReset: boolean = false;
+var configureCalls: string[] = [];
+var mediationRules: { [adUnitId: string]: string } = {};
+var templates: { [templateId: string]: string } = {};
 // Mock the OpenWrapSDKModule NativeModule and Platform for making it available for test cases.
 jest.mock('react-native', () => {
   return {
@@ -19,6 +44,7 @@ jest.mock('react-native', () => {
       OpenWrapSDKModule: {
         getConstants: jest.fn(() => ({
           ow_sdk_version: '3.4.0',
+          gam_supported: false,
         })),
 
         setLogLevel(logLevel: OpenWrapSDK.LogLevel) {
@@ -60,6 +86,166 @@ jest.mock('react-native', () => {
         setUserInfo(userInfo: string) {
           actualUserInfo = userInfo;
         },
+
+        setTracingEnabled(enabled: boolean) {
+          actualTracingEnabled = enabled;
+        },
+
+        setSystemTracingEnabled(enabled: boolean) {
+          actualSystemTracingEnabled = enabled;
+        },
+
+        clearTrace() {
+          traceCleared = true;
+        },
+
+        getTrace() {
+          return Promise.resolve('{"traceEvents":[]}');
+        },
+
+        getLatencyStats() {
+          return Promise.resolve(
+            '[{"adFormat":"banner","adUnitId":"unit","metric":"loadToAdReceived","count":3,"p50":100,"p90":200,"p99":250,"max":250}]'
+          );
+        },
+
+        resetLatencyStats() {
+          latencyStatsReset = true;
+        },
+
+        setMaxConcurrentBannerLoads(count: number) {
+          actualMaxConcurrentBannerLoads = count;
+        },
+
+        setBannerRefreshAlignmentEnabled(enabled: boolean) {
+          actualRefreshAlignment = enabled;
+        },
+
+        getBannerRefreshStats() {
+          return Promise.resolve(
+            '{"uncoordinated":{"requests":9,"wakeUps":9,"radioActiveMillis":90000,"elapsedMillis":90000},"coordinated":{"requests":9,"wakeUps":3,"radioActiveMillis":30000,"elapsedMillis":90000}}'
+          );
+        },
+
+        resetBannerRefreshStats() {
+          refreshStatsReset = true;
+        },
+
+        getFullScreenArbitrationStats() {
+          return Promise.resolve(
+            '{"shows":2,"showMillis":60000,"suspendedBanners":4,"suppressedRefreshes":3,"deferredLoads":1,"caughtUpBanners":2,"averageResponseBytes":2000,"estimatedBytesFreed":8000}'
+          );
+        },
+
+        resetFullScreenArbitrationStats() {
+          arbitrationStatsReset = true;
+        },
+
+        setWebViewPoolSize(size: number) {
+          actualWebViewPoolSize = size;
+        },
+
+        getRequestCoalescingStats() {
+          return Promise.resolve(
+            '[{"adUnitId":"unit","auctions":2,"queued":1,"avoided":3,"avoidedByReason":{"duplicate":1,"sharedNoFill":1,"adopted":1}}]'
+          );
+        },
+
+        resetRequestCoalescingStats() {
+          coalescingStatsReset = true;
+        },
+
+        setMediaPrecacheEnabled(enabled: boolean, maxBytes: number) {
+          actualMediaPrecache = { enabled, maxBytes };
+        },
+
+        getMediaCacheStats() {
+          return Promise.resolve(
+            '{"prefetches":4,"alreadyCached":1,"downloads":3,"skippedMetered":2,"failures":0,"bytesDownloaded":300,"cachedBytes":200}'
+          );
+        },
+
+        resetMediaCacheStats() {
+          mediaCacheStatsReset = true;
+        },
+
+        sendNotice(url: string) {
+          sentNotices.push(url);
+        },
+
+        getNoticeStats() {
+          return Promise.resolve(
+            '{"queueDepth":1,"enqueued":5,"delivered":3,"retries":2,"dropped":1,"restored":0,"latencyP50Millis":1000,"latencyP95Millis":6000,"latencyMaxMillis":6100}'
+          );
+        },
+
+        resetNoticeStats() {
+          noticeStatsReset = true;
+        },
+
+        setBidLandscapeEnabled(enabled: boolean, capacity: number) {
+          actualBidLandscape = [enabled, capacity];
+        },
+
+        getBidLandscapeSummary() {
+          return Promise.resolve(
+            '{"rows":3,"partners":[{"partnerName":"pubmatic","bids":2,"wins":1,"winRate":0.5}],' +
+              '"adUnits":[{"adUnitId":"feed","auctions":3,"noBids":1,"priceP50":1.5,"priceP90":2,"priceP99":2}]}'
+          );
+        },
+
+        exportBidLandscape() {
+          return Promise.resolve('/data/pobrn_bid_landscape_export.bin');
+        },
+
+        clearBidLandscape() {
+          bidLandscapeCleared = true;
+        },
+
+        setPreloadSchedulingEnabled(enabled: boolean) {
+          actualPreloadScheduling = enabled;
+        },
+
+        getPreloadStats() {
+          return Promise.resolve(
+            '{"adUnits":[{"adUnitId":"level_end","loads":4,"deferredLoads":1,"received":3,"shown":1,' +
+              '"wastedAuctions":2,"wastedBytes":4096,"showRate":0.33,"expiryRate":0.36,' +
+              '"loadToShowMillis":2400000,"validityMillis":1800000,"throttled":false}]}'
+          );
+        },
+
+        resetPreloadStats() {
+          preloadStatsReset = true;
+        },
+
+        setLatencyInEventPayloadEnabled(enabled: boolean) {
+          actualLatencyInPayload = enabled;
+        },
+
+        configure(config: string) {
+          configureCalls.push(config);
+        },
+
+        setMediationRule(adUnitId: string, rule: string) {
+          mediationRules[adUnitId] = rule;
+        },
+
+        removeMediationRule(adUnitId: string) {
+          delete mediationRules[adUnitId];
+        },
+
+        registerRequestTemplate(templateId: string, params: string) {
+          templates['request_' + templateId] = params;
+        },
+
+        registerImpressionTemplate(templateId: string, params: string) {
+          templates['impression_' + templateId] = params;
+        },
+
+        removeTemplate(templateId: string) {
+          delete templates['request_' + templateId];
+          delete templates['impression_' + templateId];
+        },
       },
     },
     Platform: {
@@ -75,6 +261,10 @@ test('testSDKVersion', () => {
   expect(OpenWrapSDK.getVersion()).toBe('3.4.0');
 });
 
+test('testIsGamSupported', () => {
+  expect(OpenWrapSDK.isGamSupported()).toBe(false);
+});
+
 test('testLogLevel', () => {
   OpenWrapSDK.setLogLevel(OpenWrapSDK.LogLevel.All);
   expect(OpenWrapSDK.LogLevel.All).toBe(actualLogLevel);
@@ -171,3 +361,263 @@ test('setUserInfo', () => {
   let expectedUserInfo: string = JSON.stringify(userInfo);
   expect(actualUserInfo).toEqual(expectedUserInfo);
 });
+
+test('setTracingEnabled', () => {
+  OpenWrapSDK.setTracingEnabled(true);
+  expect(true).toBe(actualTracingEnabled);
+  OpenWrapSDK.setTracingEnabled(false);
+  expect(false).toBe(actualTracingEnabled);
+});
+
+test('setSystemTracingEnabled', () => {
+  OpenWrapSDK.setSystemTracingEnabled(true);
+  expect(true).toBe(actualSystemTracingEnabled);
+  OpenWrapSDK.setSystemTracingEnabled(false);
+  expect(false).toBe(actualSystemTracingEnabled);
+});
+
+test('clearTrace', () => {
+  OpenWrapSDK.clearTrace();
+  expect(traceCleared).toBe(true);
+});
+
+test('getTrace', async () => {
+  const trace = await OpenWrapSDK.getTrace();
+  expect(JSON.parse(trace).traceEvents).toEqual([]);
+});
+
+test('getLatencyStats', async () => {
+  const stats = await OpenWrapSDK.getLatencyStats();
+  expect(stats.length).toBe(1);
+  expect(stats[0]!.adFormat).toBe('banner');
+  expect(stats[0]!.metric).toBe('loadToAdReceived');
+  expect(stats[0]!.p90).toBe(200);
+});
+
+test('resetLatencyStats', () => {
+  OpenWrapSDK.resetLatencyStats();
+  expect(latencyStatsReset).toBe(true);
+});
+
+test('setLatencyInEventPayloadEnabled', () => {
+  OpenWrapSDK.setLatencyInEventPayloadEnabled(true);
+  expect(true).toBe(actualLatencyInPayload);
+  OpenWrapSDK.setLatencyInEventPayloadEnabled(false);
+  expect(false).toBe(actualLatencyInPayload);
+});
+
+test('setMaxConcurrentBannerLoads', () => {
+  OpenWrapSDK.setMaxConcurrentBannerLoads(4);
+  expect(4).toBe(actualMaxConcurrentBannerLoads);
+});
+
+test('setBannerRefreshAlignmentEnabled', () => {
+  OpenWrapSDK.setBannerRefreshAlignmentEnabled(true);
+  expect(actualRefreshAlignment).toBe(true);
+});
+
+test('getBannerRefreshStats', async () => {
+  const stats = await OpenWrapSDK.getBannerRefreshStats();
+  expect(stats.uncoordinated.wakeUps).toBe(9);
+  expect(stats.coordinated.wakeUps).toBe(3);
+  expect(stats.coordinated.radioActiveMillis).toBe(30000);
+});
+
+test('resetBannerRefreshStats', () => {
+  OpenWrapSDK.resetBannerRefreshStats();
+  expect(refreshStatsReset).toBe(true);
+});
+
+test('getFullScreenArbitrationStats', async () => {
+  const stats = await OpenWrapSDK.getFullScreenArbitrationStats();
+  expect(stats.shows).toBe(2);
+  expect(stats.suppressedRefreshes).toBe(3);
+  expect(stats.estimatedBytesFreed).toBe(8000);
+});
+
+test('resetFullScreenArbitrationStats', () => {
+  OpenWrapSDK.resetFullScreenArbitrationStats();
+  expect(arbitrationStatsReset).toBe(true);
+});
+
+test('setWebViewPoolSize', () => {
+  OpenWrapSDK.setWebViewPoolSize(0);
+  expect(0).toBe(actualWebViewPoolSize);
+});
+
+test('getRequestCoalescingStats', async () => {
+  const stats = await OpenWrapSDK.getRequestCoalescingStats();
+  expect(stats.length).toBe(1);
+  expect(stats[0]!.auctions).toBe(2);
+  expect(stats[0]!.avoided).toBe(3);
+  expect(stats[0]!.avoidedByReason.adopted).toBe(1);
+});
+
+test('resetRequestCoalescingStats', () => {
+  OpenWrapSDK.resetRequestCoalescingStats();
+  expect(coalescingStatsReset).toBe(true);
+});
+
+test('setMediaPrecacheEnabled', () => {
+  OpenWrapSDK.setMediaPrecacheEnabled(true);
+  expect(actualMediaPrecache).toEqual({ enabled: true, maxBytes: 50 * 1024 * 1024 });
+  OpenWrapSDK.setMediaPrecacheEnabled(false, 1024);
+  expect(actualMediaPrecache).toEqual({ enabled: false, maxBytes: 1024 });
+});
+
+test('getMediaCacheStats', async () => {
+  const stats = await OpenWrapSDK.getMediaCacheStats();
+  expect(stats.downloads).toBe(3);
+  expect(stats.bytesDownloaded).toBe(300);
+  expect(stats.skippedMetered).toBe(2);
+});
+
+test('resetMediaCacheStats', () => {
+  OpenWrapSDK.resetMediaCacheStats();
+  expect(mediaCacheStatsReset).toBe(true);
+});
+
+function noticeBid(nurl?: string, lurl?: string): POBBid {
+  return new POBBid(
+    {
+      price: 1.5,
+      height: 50,
+      width: 320,
+      bidId: 'bid 1',
+      impressionId: 'imp1',
+      grossPrice: 2,
+      status: POBBid.BID_STATUS_OK,
+      nurl,
+      lurl,
+      refreshInterval: 30,
+    },
+    { isBidExpired: () => Promise.resolve(false) }
+  );
+}
+
+test('sendWinNotice', () => {
+  sentNotices = [];
+  OpenWrapSDK.sendWinNotice(noticeBid('https://t.example/win?p=${AUCTION_PRICE}&b=${AUCTION_BID_ID}&i=${AUCTION_IMP_ID}'));
+  OpenWrapSDK.sendWinNotice(noticeBid('https://t.example/win?p=${AUCTION_PRICE}'), 1.2);
+  OpenWrapSDK.sendWinNotice(noticeBid());
+  expect(sentNotices).toEqual(['https://t.example/win?p=1.5&b=bid%201&i=imp1', 'https://t.example/win?p=1.2']);
+});
+
+test('sendLossNotice', () => {
+  sentNotices = [];
+  OpenWrapSDK.sendLossNotice(noticeBid(undefined, 'https://t.example/loss?r=${AUCTION_LOSS}&p=${AUCTION_PRICE}'), 102, 2.1);
+  OpenWrapSDK.sendLossNotice(noticeBid('https://t.example/win'), 102);
+  expect(sentNotices).toEqual(['https://t.example/loss?r=102&p=2.1']);
+});
+
+test('getNoticeStats', async () => {
+  const stats = await OpenWrapSDK.getNoticeStats();
+  expect(stats.queueDepth).toBe(1);
+  expect(stats.retries).toBe(2);
+  expect(stats.latencyP95Millis).toBe(6000);
+});
+
+test('resetNoticeStats', () => {
+  OpenWrapSDK.resetNoticeStats();
+  expect(noticeStatsReset).toBe(true);
+});
+
+test('setBidLandscapeEnabled', () => {
+  OpenWrapSDK.setBidLandscapeEnabled(true);
+  expect(actualBidLandscape).toEqual([true, 16384]);
+  OpenWrapSDK.setBidLandscapeEnabled(true, 1000);
+  expect(actualBidLandscape).toEqual([true, 1000]);
+});
+
+test('getBidLandscapeSummary', async () => {
+  const summary = await OpenWrapSDK.getBidLandscapeSummary();
+  expect(summary.rows).toBe(3);
+  expect(summary.partners[0]?.winRate).toBe(0.5);
+  expect(summary.adUnits[0]?.noBids).toBe(1);
+  expect(summary.adUnits[0]?.priceP50).toBe(1.5);
+});
+
+test('exportBidLandscape', async () => {
+  expect(await OpenWrapSDK.exportBidLandscape()).toBe('/data/pobrn_bid_landscape_export.bin');
+});
+
+test('clearBidLandscape', () => {
+  OpenWrapSDK.clearBidLandscape();
+  expect(bidLandscapeCleared).toBe(true);
+});
+
+test('setPreloadSchedulingEnabled', () => {
+  OpenWrapSDK.setPreloadSchedulingEnabled(true);
+  expect(actualPreloadScheduling).toBe(true);
+  OpenWrapSDK.setPreloadSchedulingEnabled(false);
+  expect(actualPreloadScheduling).toBe(false);
+});
+
+test('getPreloadStats', async () => {
+  const stats = await OpenWrapSDK.getPreloadStats();
+  expect(stats.adUnits[0]?.adUnitId).toBe('level_end');
+  expect(stats.adUnits[0]?.wastedAuctions).toBe(2);
+  expect(stats.adUnits[0]?.wastedBytes).toBe(4096);
+  expect(stats.adUnits[0]?.throttled).toBe(false);
+});
+
+test('resetPreloadStats', () => {
+  OpenWrapSDK.resetPreloadStats();
+  expect(preloadStatsReset).toBe(true);
+});
+
+test('configure', () => {
+  const userInfo = new POBUserInfo();
+  userInfo.city = 'Pune';
+  const config = {
+    logLevel: OpenWrapSDK.LogLevel.Debug,
+    coppa: true,
+    userInfo: userInfo,
+  };
+  OpenWrapSDK.configure(config);
+  expect(configureCalls.length).toBe(1);
+  expect(JSON.parse(configureCalls[0]!)).toEqual(JSON.parse(JSON.stringify(config)));
+
+  // Unchanged configuration does not cross the bridge again.
+  OpenWrapSDK.configure({ ...config });
+  expect(configureCalls.length).toBe(1);
+
+  OpenWrapSDK.configure({ ...config, coppa: false });
+  expect(configureCalls.length).toBe(2);
+  expect(JSON.parse(configureCalls[1]!).coppa).toBe(false);
+
+  // An individual setter changed the value, the same configuration crosses the bridge again.
+  OpenWrapSDK.setCoppa(true);
+  OpenWrapSDK.configure({ ...config, coppa: false });
+  expect(configureCalls.length).toBe(3);
+});
+
+test('mediationRule', () => {
+  const rule = {
+    floor: 0.5,
+    partnerFloors: { pubmatic: 0.8 },
+    allowedPartners: ['pubmatic'],
+    maxWaitMs: 500,
+  };
+  OpenWrapSDK.setMediationRule('adUnit', rule);
+  expect(JSON.parse(mediationRules['adUnit']!)).toEqual(rule);
+
+  OpenWrapSDK.removeMediationRule('adUnit');
+  expect(mediationRules['adUnit']).toBeUndefined();
+});
+
+test('requestAndImpressionTemplates', () => {
+  const request = new POBRequest();
+  request.testMode = true;
+  request.versionId = 3;
+  OpenWrapSDK.registerRequestTemplate('feed', request);
+  expect(JSON.parse(templates['request_feed']!)).toEqual({ testMode: true, versionId: 3 });
+
+  const impression = new POBImpression();
+  impression.customParameters = new Map([['genre', ['news', 'sports']]]);
+  OpenWrapSDK.registerImpressionTemplate('feed', impression);
+  expect(JSON.parse(JSON.parse(templates['impression_feed']!).customParams)).toEqual({ genre: ['news', 'sports'] });
+
+  OpenWrapSDK.removeTemplate('feed');
+  expect(templates).toEqual({});
+});
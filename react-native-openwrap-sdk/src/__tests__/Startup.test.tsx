@@ -0,0 +1,47 @@
+import { NativeEventEmitter } from 'react-native';
+import { OpenWrapSDK, POBInterstitial } from '../index';
+
+// Names of the native modules resolved so far, resolving a native module may create it natively.
+var mockResolvedModules: string[] = [];
+
+jest.mock('react-native', () => {
+    return {
+        NativeModules: new Proxy(
+            {},
+            {
+                get(_target, name: string) {
+                    mockResolvedModules.push(name);
+                    return {
+                        getConstants: jest.fn(() => ({ ow_sdk_version: '3.4.0', gam_supported: false })),
+                        createAdInstance: jest.fn(),
+                    };
+                },
+            }
+        ),
+        NativeEventEmitter: jest.fn().mockImplementation(() => ({
+            addListener: jest.fn(),
+        })),
+        InteractionManager: {},
+        requireNativeComponent: jest.fn(),
+        UIManager: {},
+        Platform: { OS: 'ios' },
+    };
+});
+
+describe('Startup', () => {
+    it('should initialize the native modules on first use only', () => {
+        // Importing the package does not touch the native side.
+        expect(mockResolvedModules).toEqual([]);
+        expect(NativeEventEmitter).not.toHaveBeenCalled();
+
+        // The SDK version is still read synchronously.
+        expect(OpenWrapSDK.getVersion()).toBe('3.4.0');
+        expect(OpenWrapSDK.isGamSupported()).toBe(false);
+        expect(mockResolvedModules).toEqual(['OpenWrapSDKModule']);
+
+        // The event emitters are created with the first full screen ad.
+        new POBInterstitial('pubId', 1, 'adUnitId');
+        expect(NativeEventEmitter).toHaveBeenCalledTimes(2);
+        expect(mockResolvedModules).toContain('POBRNInterstitialModule');
+    });
+});
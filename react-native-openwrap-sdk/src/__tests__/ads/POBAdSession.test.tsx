@@ -0,0 +1,166 @@
+import { NativeModules } from 'react-native';
+import { POBAdSession } from '../../ads/POBAdSession';
+import { POBInterstitial } from '../../ads/POBInterstitial';
+import { POBInterstitialListener } from '../../ads/POBInterstitialListener';
+import { POBBannerView } from '../../ads/POBBannerView';
+import { POBConstants } from '../../common/POBConstants';
+import { POBEvent } from '../../common/POBEventSchema';
+import { encodeAdEvent } from '../../common/POBEventPayload';
+
+// Listeners of the native ad events, by event key.
+var mockEventListeners: { [key: string]: (adInfo: string) => void } = {};
+// Tasks waiting for the interactions to be done.
+var mockIdleTasks: (() => void)[] = [];
+
+jest.mock('react-native', () => {
+    return {
+        NativeModules: {
+            POBRNInterstitialModule: {
+                createAdInstance: jest.fn(),
+                loadAd: jest.fn(),
+                destroy: jest.fn(),
+            },
+        },
+        NativeEventEmitter: jest.fn().mockImplementation(() => ({
+            addListener: jest.fn((key: string, listener: (adInfo: string) => void) => {
+                mockEventListeners[key] = listener;
+            }),
+        })),
+        InteractionManager: {
+            runAfterInteractions: jest.fn((task: () => void) => {
+                mockIdleTasks.push(task);
+                return { cancel: () => mockIdleTasks.splice(mockIdleTasks.indexOf(task), 1) };
+            }),
+        },
+        requireNativeComponent: jest.fn(),
+        UIManager: {},
+        Platform: { OS: 'ios' },
+    };
+});
+
+describe('POBAdSession', () => {
+    const loadAd = NativeModules.POBRNInterstitialModule.loadAd as jest.Mock;
+    const destroy = NativeModules.POBRNInterstitialModule.destroy as jest.Mock;
+
+    beforeEach(() => {
+        jest.useFakeTimers();
+        loadAd.mockClear();
+        destroy.mockClear();
+        mockIdleTasks = [];
+        POBAdSession.resetPrefetchStats();
+    });
+
+    afterEach(() => {
+        jest.useRealTimers();
+    });
+
+    it('should hand over a received prefetched ad', () => {
+        POBAdSession.prefetch('Level', { interstitial: createAd });
+        expect(loadAd).not.toHaveBeenCalled();
+
+        runIdleTasks();
+        expect(loadAd).toHaveBeenCalledTimes(1);
+        const instanceId = loadAd.mock.calls[0]?.[0];
+        emitEvent(instanceId, POBEvent.AD_RECEIVED, {});
+
+        const listener = { onAdReceived: jest.fn() } as unknown as POBInterstitialListener;
+        const session = POBAdSession.forScreen('Level');
+        const ad = session.takeAd('interstitial', createAd, (ad) => ad.setListener(listener));
+        expect(ad['instanceId']).toBe(instanceId);
+        // The load outcome is replayed to the listener, without loading again.
+        expect(listener.onAdReceived).toHaveBeenCalledWith(ad);
+        expect(loadAd).toHaveBeenCalledTimes(1);
+        expect(session.takeAd('interstitial', createAd)).toBe(ad);
+
+        const stats = POBAdSession.getPrefetchStats();
+        expect(stats.prefetched).toBe(1);
+        expect(stats.hits).toBe(1);
+        expect(stats.hitRate).toBe(1);
+        session.destroy();
+    });
+
+    it('should load the ad of a screen not prefetched', () => {
+        const session = POBAdSession.forScreen('Home');
+        const ad = session.takeAd('interstitial', createAd);
+
+        expect(loadAd).toHaveBeenCalledWith(ad['instanceId']);
+        expect(POBAdSession.getPrefetchStats().misses).toBe(1);
+        expect(POBAdSession.getPrefetchStats().hitRate).toBe(0);
+
+        session.destroy();
+        expect(destroy).toHaveBeenCalledWith(ad['instanceId']);
+        // A new session is created once destroyed.
+        expect(POBAdSession.forScreen('Home')).not.toBe(session);
+        POBAdSession.forScreen('Home').destroy();
+    });
+
+    it('should replace a failed prefetched ad', () => {
+        POBAdSession.prefetch('Level', { interstitial: createAd });
+        runIdleTasks();
+        const prefetchedInstanceId = loadAd.mock.calls[0]?.[0];
+        emitEvent(prefetchedInstanceId, POBEvent.AD_FAILED_TO_LOAD, { errorCode: 1002, errorMessage: 'No ads' });
+
+        const session = POBAdSession.forScreen('Level');
+        const ad = session.takeAd('interstitial', createAd);
+        expect(ad['instanceId']).not.toBe(prefetchedInstanceId);
+        expect(destroy).toHaveBeenCalledWith(prefetchedInstanceId);
+
+        const stats = POBAdSession.getPrefetchStats();
+        expect(stats.wasted).toBe(1);
+        expect(stats.misses).toBe(1);
+        session.destroy();
+    });
+
+    it('should destroy the prefetched ads not taken in time', () => {
+        POBAdSession.prefetch('Level', { interstitial: createAd }, 1_000);
+        runIdleTasks();
+        const instanceId = loadAd.mock.calls[0]?.[0];
+
+        jest.advanceTimersByTime(1_000);
+        expect(destroy).toHaveBeenCalledWith(instanceId);
+        expect(POBAdSession.getPrefetchStats().wasted).toBe(1);
+    });
+
+    it('should not prefetch once the screen is mounted', () => {
+        POBAdSession.prefetch('Level', { interstitial: createAd });
+        const session = POBAdSession.forScreen('Level');
+        expect(mockIdleTasks.length).toBe(0);
+
+        POBAdSession.prefetch('Level', { interstitial: createAd });
+        expect(mockIdleTasks.length).toBe(0);
+        session.destroy();
+    });
+
+    it('should track the screen focus', () => {
+        const session = POBAdSession.forScreen('Home');
+        const listener = jest.fn();
+        const removeListener = session.addFocusListener(listener);
+        expect(session.bannerAutoRefreshState()).toBe(POBBannerView.AutoRefreshState.DEFAULT);
+
+        session.blur();
+        expect(session.isFocused()).toBe(false);
+        expect(session.bannerAutoRefreshState()).toBe(POBBannerView.AutoRefreshState.PAUSE);
+        session.focus();
+        expect(session.bannerAutoRefreshState()).toBe(POBBannerView.AutoRefreshState.RESUME);
+        expect(listener.mock.calls).toEqual([[false], [true]]);
+
+        removeListener();
+        session.blur();
+        expect(listener).toHaveBeenCalledTimes(2);
+        session.destroy();
+    });
+});
+
+function createAd(): POBInterstitial {
+    return new POBInterstitial('pubId', 1, 'adUnitId');
+}
+
+function runIdleTasks() {
+    const tasks = mockIdleTasks;
+    mockIdleTasks = [];
+    tasks.forEach((task) => task());
+}
+
+function emitEvent(instanceId: string, event: number, ext: any) {
+    mockEventListeners[POBConstants.INTERSTITIAL_AD_EVENT_KEY]!(encodeAdEvent(instanceId, event, ext));
+}
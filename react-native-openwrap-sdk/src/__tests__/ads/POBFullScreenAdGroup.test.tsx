@@ -0,0 +1,79 @@
+import { NativeModules } from 'react-native';
+import { POBFullScreenAdGroup } from '../../ads/POBFullScreenAdGroup';
+import { POBInterstitial } from '../../ads/POBInterstitial';
+import { POBRewardedAd } from '../../ads/POBRewardedAd';
+import { POBAdManager } from '../../common/POBAdManager';
+
+jest.mock('react-native', () => {
+    const fullScreenModule = () => ({
+        createAdInstance: jest.fn(),
+        destroy: jest.fn(),
+        addToGroup: jest.fn(),
+        removeFromGroup: jest.fn(),
+        showBestAvailable: jest.fn(),
+    });
+    return {
+        NativeModules: {
+            POBRNInterstitialModule: fullScreenModule(),
+            POBRNRewardedAdModule: fullScreenModule(),
+        },
+        NativeEventEmitter: jest.fn().mockImplementation(() => ({
+            addListener: jest.fn(),
+        })),
+        requireNativeComponent: jest.fn(),
+        UIManager: {},
+        Platform: { OS: 'ios' },
+    };
+});
+
+describe('POBFullScreenAdGroup', () => {
+    const interstitialModule = NativeModules.POBRNInterstitialModule;
+    const rewardedModule = NativeModules.POBRNRewardedAdModule;
+
+    beforeEach(() => {
+        jest.clearAllMocks();
+    });
+
+    it('should add the ads to the native group of their module', () => {
+        const group = new POBFullScreenAdGroup('level_end');
+        const interstitial = new POBInterstitial('pub', 1, 'interstitial');
+        const rewarded = POBRewardedAd.getRewardedAd('pub', 1, 'rewarded');
+        group.add(interstitial);
+        group.add(rewarded);
+        group.add(interstitial);
+
+        const interstitialId = POBAdManager.getInstance().instanceIdOf(interstitial);
+        const rewardedId = POBAdManager.getInstance().instanceIdOf(rewarded);
+        expect(interstitialModule.addToGroup).toHaveBeenCalledTimes(1);
+        expect(interstitialModule.addToGroup).toHaveBeenCalledWith('level_end', interstitialId);
+        expect(rewardedModule.addToGroup).toHaveBeenCalledWith('level_end', rewardedId);
+
+        group.remove(rewarded);
+        group.remove(rewarded);
+        expect(rewardedModule.removeFromGroup).toHaveBeenCalledTimes(1);
+        expect(rewardedModule.removeFromGroup).toHaveBeenCalledWith('level_end', rewardedId);
+    });
+
+    it('should resolve with the ad shown', async () => {
+        const group = new POBFullScreenAdGroup('level_end');
+        const interstitial = new POBInterstitial('pub', 1, 'interstitial');
+        const rewarded = POBRewardedAd.getRewardedAd('pub', 1, 'rewarded');
+        group.add(interstitial);
+        group.add(rewarded);
+
+        const rewardedId = POBAdManager.getInstance().instanceIdOf(rewarded);
+        interstitialModule.showBestAvailable.mockResolvedValueOnce(rewardedId);
+        expect(await group.showBestAvailable()).toBe(rewarded);
+        expect(interstitialModule.showBestAvailable).toHaveBeenCalledWith('level_end', POBFullScreenAdGroup.DEFAULT_BUDGET_MS);
+
+        interstitialModule.showBestAvailable.mockResolvedValueOnce(null);
+        expect(await group.showBestAvailable(0)).toBeUndefined();
+        expect(interstitialModule.showBestAvailable).toHaveBeenLastCalledWith('level_end', 0);
+    });
+
+    it('should not show an empty group', async () => {
+        expect(await new POBFullScreenAdGroup('empty').showBestAvailable()).toBeUndefined();
+        expect(interstitialModule.showBestAvailable).not.toHaveBeenCalled();
+        expect(rewardedModule.showBestAvailable).not.toHaveBeenCalled();
+    });
+});
@@ -2,13 +2,17 @@ import { POBInterstitialListener } from '../../ads/POBInterstitialListener';
 import { POBInterstitial } from '../../ads/POBInterstitial';
 
 import { POBError } from '../../models/POBError';
-import { POBConstants } from '../../common/POBConstants';
+import { POBEvent } from '../../common/POBEventSchema';
+import { POBBid } from '../../models/POBBid';
+import type { POBMediationOutcome } from '../../models/POBMediationOutcome';
+import type { POBBidEvent } from '../../ads/POBBidEvent';
 
 var isCalled: number;
 var actPubId: string;
 var actInstanceId: string;
 var actProfileId: number;
 var actAdUnitId: string;
+var actGamConfig: string;
 
 jest.mock('react-native', () => {
     return {
@@ -21,6 +25,12 @@ jest.mock('react-native', () => {
                     actProfileId = profileId;
                     actAdUnitId = adUnitId;
                 },
+                createGamAdInstance(instanceId: string, publisherId: string, profileId: number, adUnitId: string, gamConfig: string) {
+                    isCalled = 7;
+                    actInstanceId = instanceId;
+                    actAdUnitId = adUnitId;
+                    actGamConfig = gamConfig;
+                },
                 loadAd(instanceId: string) {
                     actInstanceId = instanceId;
                     isCalled = 2;
@@ -36,6 +46,10 @@ jest.mock('react-native', () => {
                 isReady(instanceId: string) {
                     actInstanceId = instanceId;
                     isCalled = 5;
+                },
+                setBidEvent(instanceId: string) {
+                    actInstanceId = instanceId;
+                    isCalled = 6;
                 }
             },
         },
@@ -95,6 +109,19 @@ describe('POBInterstitial', () => {
         expect(adUnitId).toBe(actAdUnitId);
     });
 
+    it('testCreateGamInstance', () => {
+        const gamConfig = {
+            adUnitId: '/15671365/pm_sdk/PMSDK-Demo-App-Interstitial',
+            customTargeting: { section: 'sports', tags: ['a', 'b'] },
+            owTimeoutMs: 1000,
+        };
+        const gamInstance = new POBInterstitial(publisherId, profileId, adUnitId, gamConfig);
+        expect(gamInstance).toBeInstanceOf(POBInterstitial);
+        expect(7).toBe(isCalled);
+        expect(adUnitId).toBe(actAdUnitId);
+        expect(JSON.parse(actGamConfig)).toEqual(gamConfig);
+    });
+
     it('testLoadAd', () => {
         instance.loadAd();
         expect(2).toBe(isCalled);
@@ -111,30 +138,68 @@ describe('POBInterstitial', () => {
     });
 
     it('testIsReceiveEvent', () => {
-        instance.onAdEvent(POBConstants.AD_RECEIVED_EVENT, "");
+        instance.onAdEvent(POBEvent.AD_RECEIVED, "");
         expect(1).toBe(isEventCalled);
         var errorInfoJSON: string = JSON.stringify({
             errorCode: "ABC123",
             errorMessage: "testLoad"
         });
-        instance.onAdEvent(POBConstants.AD_FAILED_TO_LOAD_EVENT, errorInfoJSON);
+        instance.onAdEvent(POBEvent.AD_FAILED_TO_LOAD, errorInfoJSON);
         expect(2).toBe(isEventCalled);
         errorInfoJSON = JSON.stringify({
             errorCode: "123ABC",
             errorMessage: "testShow"
         });
-        instance.onAdEvent(POBConstants.AD_FAILED_TO_SHOW_EVENT, errorInfoJSON);
+        instance.onAdEvent(POBEvent.AD_FAILED_TO_SHOW, errorInfoJSON);
         expect(3).toBe(isEventCalled);
-        instance.onAdEvent(POBConstants.AD_CLICKED_EVENT, "");
+        instance.onAdEvent(POBEvent.AD_CLICKED, "");
         expect(4).toBe(isEventCalled);
-        instance.onAdEvent(POBConstants.AD_OPEN_EVENT, "");
+        instance.onAdEvent(POBEvent.AD_OPENED, "");
         expect(5).toBe(isEventCalled);
-        instance.onAdEvent(POBConstants.AD_CLOSE_EVENT, "");
+        instance.onAdEvent(POBEvent.AD_CLOSED, "");
         expect(6).toBe(isEventCalled);
-        instance.onAdEvent(POBConstants.AD_EXPIRED_EVENT, "");
+        instance.onAdEvent(POBEvent.AD_EXPIRED, "");
         expect(7).toBe(isEventCalled);
-        instance.onAdEvent(POBConstants.APP_LEAVE_EVENT, "");
+        instance.onAdEvent(POBEvent.APP_LEAVING, "");
         expect(8).toBe(isEventCalled);
     });
 
+    it('testLatency', () => {
+        expect(instance.getLatency()).toBeUndefined();
+        instance.onAdEvent(POBEvent.AD_RECEIVED, { latency: { loadToAdReceived: 120.5 } });
+        expect(instance.getLatency()?.loadToAdReceived).toBe(120.5);
+        instance.onAdEvent(POBEvent.AD_OPENED, { latency: { loadToAdReceived: 120.5, showToOpened: 30 } });
+        expect(instance.getLatency()?.showToOpened).toBe(30);
+        // Events without latency keep the last measured values.
+        instance.onAdEvent(POBEvent.AD_CLOSED, null);
+        expect(instance.getLatency()?.showToOpened).toBe(30);
+    });
+
+    it('testMediationOutcome', () => {
+        var outcome: POBMediationOutcome | undefined;
+        var bidReceived = false;
+        instance.setBidEventListener({
+            onBidReceived(_bidEvent: POBBidEvent, _bid: POBBid): void {
+                bidReceived = true;
+            },
+            onBidFailed(_bidEvent: POBBidEvent, _error: POBError): void {},
+            onMediationOutcome(_bidEvent: POBBidEvent, mediationOutcome: POBMediationOutcome): void {
+                outcome = mediationOutcome;
+            },
+        });
+        instance.onAdEvent(POBEvent.MEDIATION_OUTCOME, {
+            won: false,
+            reason: 'belowFloor',
+            errorCode: 0,
+            price: 0.2,
+            partnerName: 'pubmatic',
+            latency: { loadToBid: 80 },
+        });
+        expect(bidReceived).toBe(false);
+        expect(outcome?.won).toBe(false);
+        expect(outcome?.reason).toBe('belowFloor');
+        expect(outcome?.price).toBe(0.2);
+        expect(instance.getLatency()?.loadToBid).toBe(80);
+    });
+
 });
@@ -2,7 +2,7 @@ import { POBRewardedAdListener } from '../../ads/POBRewardedAdListener';
 import { POBRewardedAd } from '../../ads/POBRewardedAd';
 
 import { POBError } from '../../models/POBError';
-import { POBConstants } from '../../common/POBConstants';
+import { POBEvent } from '../../common/POBEventSchema';
 
 var isCalled: number;
 var actPubId: string;
@@ -111,29 +111,29 @@ describe('POBRewardedAd', () => {
     });
 
     it('testIsReceiveEvent', () => {
-        instance.onAdEvent(POBConstants.AD_RECEIVED_EVENT, "");
+        instance.onAdEvent(POBEvent.AD_RECEIVED, "");
         expect(1).toBe(isEventCalled);
         var errorInfoJSON: string = JSON.stringify({
             errorCode: "ABC123",
             errorMessage: "testLoad"
         });
-        instance.onAdEvent(POBConstants.AD_FAILED_TO_LOAD_EVENT, errorInfoJSON);
+        instance.onAdEvent(POBEvent.AD_FAILED_TO_LOAD, errorInfoJSON);
         expect(2).toBe(isEventCalled);
         errorInfoJSON = JSON.stringify({
             errorCode: "123ABC",
             errorMessage: "testShow"
         });
-        instance.onAdEvent(POBConstants.AD_FAILED_TO_SHOW_EVENT, errorInfoJSON);
+        instance.onAdEvent(POBEvent.AD_FAILED_TO_SHOW, errorInfoJSON);
         expect(3).toBe(isEventCalled);
-        instance.onAdEvent(POBConstants.AD_CLICKED_EVENT, "");
+        instance.onAdEvent(POBEvent.AD_CLICKED, "");
         expect(4).toBe(isEventCalled);
-        instance.onAdEvent(POBConstants.AD_OPEN_EVENT, "");
+        instance.onAdEvent(POBEvent.AD_OPENED, "");
         expect(5).toBe(isEventCalled);
-        instance.onAdEvent(POBConstants.AD_CLOSE_EVENT, "");
+        instance.onAdEvent(POBEvent.AD_CLOSED, "");
         expect(6).toBe(isEventCalled);
-        instance.onAdEvent(POBConstants.AD_EXPIRED_EVENT, "");
+        instance.onAdEvent(POBEvent.AD_EXPIRED, "");
         expect(7).toBe(isEventCalled);
-        instance.onAdEvent(POBConstants.APP_LEAVE_EVENT, "");
+        instance.onAdEvent(POBEvent.APP_LEAVING, "");
         expect(8).toBe(isEventCalled);
     });
 
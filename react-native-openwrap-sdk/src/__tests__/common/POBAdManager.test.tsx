@@ -3,11 +3,23 @@ import { POBFullScreenAds } from '../../ads/POBFullScreenAds';
 import { POBImpression } from '../../models/POBImpression';
 import { POBRequest } from '../../models/POBRequest';
 import { POBBid } from '../../models/POBBid';
+import { POBInterstitial } from '../../ads/POBInterstitial';
+import { NativeModules } from 'react-native';
+import { setFlagsFromString } from 'v8';
+import { runInNewContext } from 'vm';
+
+// Expose the garbage collector to force the collection of the dropped ads.
+setFlagsFromString('--expose-gc');
+const gc: () => void = runInNewContext('gc');
 
 jest.mock('react-native', () => {
     return {
         NativeModules: {
-            POBRNInterstitialModule: {},
+            POBRNInterstitialModule: {
+                createAdInstance: jest.fn(),
+                loadAd: jest.fn(),
+                destroy: jest.fn(),
+            },
         },
         NativeEventEmitter: jest.fn().mockImplementation(() => ({
             addListener: jest.fn(),
@@ -36,8 +48,63 @@ describe('POBAdManager', () => {
         adManager.remove(instanceId);
         expect(adManager['instanceMap'].has(instanceId)).toBe(false);
     });
+
+    it('should destroy the native ad of a collected ad', async () => {
+        const destroy = NativeModules.POBRNInterstitialModule.destroy as jest.Mock;
+        destroy.mockClear();
+        const droppedInstanceId = createAndDropAd(false);
+
+        await collectGarbageUntil(() => destroy.mock.calls.length > 0);
+        expect(destroy).toHaveBeenCalledWith(droppedInstanceId);
+        expect(adManager['instanceMap'].has(droppedInstanceId)).toBe(false);
+    });
+
+    it('should keep a loading ad alive', async () => {
+        const destroy = NativeModules.POBRNInterstitialModule.destroy as jest.Mock;
+        destroy.mockClear();
+        const loadingInstanceId = createAndDropAd(true);
+
+        await collectGarbageUntil(() => destroy.mock.calls.length > 0);
+        expect(destroy).not.toHaveBeenCalled();
+        expect(adManager['instanceMap'].get(loadingInstanceId)?.deref()).toBeDefined();
+        adManager.remove(loadingInstanceId);
+    });
+
+    it('should not destroy the native ad of a destroyed ad again', async () => {
+        const destroy = NativeModules.POBRNInterstitialModule.destroy as jest.Mock;
+        destroy.mockClear();
+        (() => {
+            new POBInterstitial('pubId', 1, 'adUnitId').destroy();
+        })();
+
+        await collectGarbageUntil(() => destroy.mock.calls.length > 1);
+        expect(destroy).toHaveBeenCalledTimes(1);
+    });
 });
 
+/**
+ * Creates an interstitial without keeping any reference to it.
+ * @returns instance id of the ad
+ */
+function createAndDropAd(load: boolean): string {
+    const ad = new POBInterstitial('pubId', 1, 'adUnitId');
+    if (load) {
+        ad.loadAd();
+    }
+    return ad['instanceId'];
+}
+
+/**
+ * Forces garbage collections, letting the finalization callbacks run in between, until the given
+ * condition is met or a few attempts were made.
+ */
+async function collectGarbageUntil(condition: () => boolean) {
+    for (let i = 0; i < 10 && !condition(); i++) {
+        gc();
+        await new Promise((resolve) => setTimeout(resolve, 0));
+    }
+}
+
 class MyPOBFullScreenAds implements POBFullScreenAds {
     getBid(): POBBid | undefined {
         return undefined;
@@ -60,7 +127,7 @@ class MyPOBFullScreenAds implements POBFullScreenAds {
     destroy(): void {
 
     }
-    onAdEvent(eventName: string, adInfo: any): void {
+    onAdEvent(event: number, adInfo: any): void {
 
     }
 }
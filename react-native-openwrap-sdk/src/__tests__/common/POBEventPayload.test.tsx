@@ -0,0 +1,40 @@
+import { decodeAdEvent, encodeAdEvent, eventTable } from '../../common/POBEventPayload';
+import { POBEvent, POB_EVENT_COUNT, POB_EVENT_NAMES } from '../../common/POBEventSchema';
+
+const { staleFiles } = require('../../../scripts/generate-event-schema');
+
+describe('POBEventPayload', () => {
+    it('should keep the generated files in sync with the schema', () => {
+        expect(staleFiles()).toEqual([]);
+        expect(POB_EVENT_NAMES.length).toBe(POB_EVENT_COUNT);
+        expect(POB_EVENT_NAMES[POBEvent.AD_RECEIVED]).toBe('onAdReceived');
+    });
+
+    it('should decode the compact payload', () => {
+        const payload = '{"i":"1_0","e":1,"x":{"c":1002,"m":"No ads","l":{"loadToAdFailed":80},"unknown":true}}';
+        expect(decodeAdEvent(payload)).toEqual({
+            instanceId: '1_0',
+            event: POBEvent.AD_FAILED_TO_LOAD,
+            ext: { errorCode: 1002, errorMessage: 'No ads', latency: { loadToAdFailed: 80 }, unknown: true },
+        });
+        expect(decodeAdEvent('{"i":"1_0","e":3}')).toEqual({ instanceId: '1_0', event: POBEvent.AD_CLICKED, ext: undefined });
+    });
+
+    it('should encode like the native layers', () => {
+        const bid = { price: 1.5, partnerName: 'pubmatic', targeting: { pwtecp: '1.50' } };
+        const payload = encodeAdEvent('1_0', POBEvent.AD_RECEIVED, bid);
+        expect(JSON.parse(payload)).toEqual({ i: '1_0', e: 0, x: { p: 1.5, pn: 'pubmatic', t: { pwtecp: '1.50' } } });
+        expect(decodeAdEvent(payload).ext).toEqual(bid);
+        // Smaller than the payload with the event and key names.
+        expect(payload.length).toBeLessThan(JSON.stringify({ instanceId: '1_0', eventName: 'onAdReceived', ext: bid }).length);
+    });
+
+    it('should dispatch through a dense table', () => {
+        const onClick = jest.fn();
+        const table = eventTable<string>({ [POBEvent.AD_CLICKED]: onClick });
+        expect(table.length).toBe(POB_EVENT_COUNT);
+        table.forEach((handler) => handler('ad', undefined));
+        expect(onClick).toHaveBeenCalledTimes(1);
+        expect(onClick).toHaveBeenCalledWith('ad', undefined);
+    });
+});
@@ -0,0 +1,68 @@
+import { decodeAdEvent, encodeAdEvent, eventTable } from '../../common/POBEventPayload';
+import { POB_EVENT_COUNT, POB_EVENT_NAMES } from '../../common/POBEventSchema';
+
+/**
+ * Compares the dispatch of the full screen ad events by integer id through the jump table with the
+ * former dispatch by event name, and the size of their payloads. Only the payload size is asserted,
+ * the timings are reported.
+ *
+ * POBRN_BENCH_EVENTS sets the number of dispatched events.
+ */
+const EVENTS = Number(process.env.POBRN_BENCH_EVENTS ?? 100000);
+
+const ext = { price: 2.5, grossPrice: 3.1, partnerName: 'pubmatic', bidId: 'bid_1', impressionId: 'imp_1', width: 320, height: 480, targeting: { pwtecp: '2.50', pwtbst: '1' } };
+
+type Counter = { calls: number };
+
+function namedDispatch(ad: Counter, eventName: string) {
+  switch (eventName) {
+    case 'onAdReceived':
+    case 'onAdFailedToLoad':
+    case 'onAdFailedToShow':
+    case 'onAdClicked':
+    case 'onAdOpened':
+    case 'onAdClosed':
+    case 'onAdExpired':
+    case 'onAppLeaving':
+    case 'onReceiveReward':
+    case 'onVideoPlaybackCompleted':
+    case 'onBidReceived':
+    case 'onBidFailed':
+    case 'onMediationOutcome':
+      ad.calls++;
+      break;
+  }
+}
+
+function measure(payloads: string[], dispatch: (payload: string) => void): number {
+  const start = process.hrtime.bigint();
+  for (let i = 0; i < EVENTS; i++) {
+    dispatch(payloads[i % payloads.length]!);
+  }
+  return Number(process.hrtime.bigint() - start) / EVENTS;
+}
+
+describe('POBEventDispatch', () => {
+  it('should dispatch smaller payloads by event id', () => {
+    const ids = Array.from({ length: POB_EVENT_COUNT }, (_, event) => event);
+    const compactPayloads = ids.map((event) => encodeAdEvent('1_0', event, ext));
+    const namedPayloads = ids.map((event) => JSON.stringify({ instanceId: '1_0', eventName: POB_EVENT_NAMES[event], ext }));
+
+    const named: Counter = { calls: 0 };
+    const table: Counter = { calls: 0 };
+    const handlers = eventTable<Counter>(Object.fromEntries(ids.map((event) => [event, (ad: Counter) => ad.calls++])));
+
+    // Warm up both paths before measuring.
+    measure(namedPayloads, (payload) => namedDispatch(named, JSON.parse(payload).eventName));
+    measure(compactPayloads, (payload) => handlers[decodeAdEvent(payload).event]?.(table, undefined));
+
+    const namedNs = measure(namedPayloads, (payload) => namedDispatch(named, JSON.parse(payload).eventName));
+    const tableNs = measure(compactPayloads, (payload) => handlers[decodeAdEvent(payload).event]?.(table, undefined));
+    const namedBytes = namedPayloads.reduce((sum, payload) => sum + payload.length, 0) / namedPayloads.length;
+    const compactBytes = compactPayloads.reduce((sum, payload) => sum + payload.length, 0) / compactPayloads.length;
+    console.log(`POBEventDispatch: ${JSON.stringify({ events: EVENTS, namedNs, tableNs, namedBytes, compactBytes })}`);
+
+    expect(table.calls).toBe(named.calls);
+    expect(compactBytes).toBeLessThan(namedBytes);
+  });
+});
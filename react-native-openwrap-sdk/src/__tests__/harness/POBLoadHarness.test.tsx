@@ -0,0 +1,287 @@
+import { AddressInfo } from 'net';
+import { POBInterstitial } from '../../ads/POBInterstitial';
+import { POBInterstitialListener } from '../../ads/POBInterstitialListener';
+import { POBRewardedAd } from '../../ads/POBRewardedAd';
+import { POBRewardedAdListener } from '../../ads/POBRewardedAdListener';
+import { POBAdManager } from '../../common/POBAdManager';
+import { POBConstants } from '../../common/POBConstants';
+
+/**
+ * End to end load harness of the TS layer. The native modules are replaced by a fake bridge which
+ * requests the bid from the local stub ad server (scripts/stub-ad-server.js) and emits the plugin
+ * events back through the NativeEventEmitter, exactly like the native layers do.
+ *
+ * Tune it with the environment variables:
+ * - POBRN_HARNESS_CYCLES: number of create/load/show/destroy cycles per ad format (default 500).
+ * - POBRN_HARNESS_CONCURRENCY: number of cycles in flight (default 20).
+ * - POBRN_HARNESS_LATENCY / POBRN_HARNESS_NO_FILL_RATE: stub server latency (ms) and no-fill rate.
+ */
+const { createStubAdServer } = require('../../../scripts/stub-ad-server');
+
+const CYCLES = Number(process.env.POBRN_HARNESS_CYCLES ?? 500);
+const CONCURRENCY = Number(process.env.POBRN_HARNESS_CONCURRENCY ?? 20);
+
+var mockStubPort = 0;
+var mockNativeInstances = new Set<string>();
+// Not initialized here, the emitters register their listeners while the imports are evaluated.
+var mockListeners: Map<string, Array<(adInfo: string) => void>>;
+
+jest.mock('react-native', () => {
+  const http = require('http');
+
+  const { POBEvent } = require('../../common/POBEventSchema');
+  const { encodeAdEvent } = require('../../common/POBEventPayload');
+
+  const emit = (eventKey: string, instanceId: string, event: number, ext?: any) => {
+    const payload = encodeAdEvent(instanceId, event, ext);
+    (mockListeners.get(eventKey) ?? []).forEach((listener) => listener(payload));
+  };
+
+  // Requests a bid from the stub server and converts it to the plugin's bid payload.
+  const requestBid = (instanceId: string): Promise<any> =>
+    new Promise((resolve) => {
+      const body = JSON.stringify({
+        id: instanceId,
+        imp: [{ id: '1', banner: { format: [{ w: 320, h: 480 }] } }],
+      });
+      const req = http.request(
+        { host: '127.0.0.1', port: mockStubPort, method: 'POST', path: '/openrtb/2.5' },
+        (res: any) => {
+          let data = '';
+          res.on('data', (chunk: string) => (data += chunk));
+          res.on('end', () => {
+            if (res.statusCode !== 200) {
+              resolve(undefined);
+              return;
+            }
+            const bid = JSON.parse(data).seatbid[0].bid[0];
+            resolve({
+              price: bid.price,
+              grossPrice: bid.price,
+              width: bid.w,
+              height: bid.h,
+              bidId: bid.id,
+              impressionId: bid.impid,
+              creativeId: bid.crid,
+              partnerName: 'pubmatic',
+              crType: bid.ext.crtype,
+              status: 1,
+              refreshInterval: 0,
+            });
+          });
+        }
+      );
+      req.on('error', () => resolve(undefined));
+      req.end(body);
+    });
+
+  const createModule = (eventKey: string) => ({
+    createAdInstance(instanceId: string) {
+      mockNativeInstances.add(instanceId);
+    },
+    loadAd(instanceId: string) {
+      requestBid(instanceId).then((bid) => {
+        if (!mockNativeInstances.has(instanceId)) {
+          return;
+        }
+        if (bid) {
+          emit(eventKey, instanceId, POBEvent.AD_RECEIVED, bid);
+        } else {
+          emit(eventKey, instanceId, POBEvent.AD_FAILED_TO_LOAD, {
+            errorCode: 1002,
+            errorMessage: 'No ads available',
+          });
+        }
+      });
+    },
+    showAd(instanceId: string) {
+      setImmediate(() => {
+        emit(eventKey, instanceId, POBEvent.AD_OPENED);
+        emit(eventKey, instanceId, POBEvent.AD_CLOSED);
+      });
+    },
+    destroy(instanceId: string) {
+      mockNativeInstances.delete(instanceId);
+    },
+  });
+
+  return {
+    NativeModules: {
+      POBRNInterstitialModule: createModule('pob_rn_interstitial_ad_event'),
+      POBRNRewardedAdModule: createModule('pob_rn_rewarded_ad_event'),
+    },
+    NativeEventEmitter: jest.fn().mockImplementation(() => ({
+      addListener(eventKey: string, listener: (adInfo: string) => void) {
+        mockListeners = mockListeners ?? new Map();
+        mockListeners.set(eventKey, [...(mockListeners.get(eventKey) ?? []), listener]);
+      },
+    })),
+  };
+});
+
+type CycleResult = { filled: boolean; loadMs: number; showMs: number };
+
+type HarnessReport = {
+  cycles: number;
+  filled: number;
+  throughputPerSecond: number;
+  loadMs: { p50: number; p90: number; p99: number };
+  showMs: { p50: number; p90: number; p99: number };
+  leakedJsInstances: number;
+  leakedNativeInstances: number;
+};
+
+function now(): number {
+  return Number(process.hrtime.bigint()) / 1e6;
+}
+
+function percentile(sorted: number[], p: number): number {
+  if (sorted.length === 0) {
+    return 0;
+  }
+  const rank = Math.max(1, Math.ceil((p / 100) * sorted.length));
+  return Math.round(sorted[rank - 1]! * 100) / 100;
+}
+
+function distribution(values: number[]) {
+  const sorted = [...values].sort((a, b) => a - b);
+  return { p50: percentile(sorted, 50), p90: percentile(sorted, 90), p99: percentile(sorted, 99) };
+}
+
+/** Ad operations shared by both full screen formats. */
+type HarnessAd = {
+  load(onLoaded: (filled: boolean) => void): void;
+  show(onClosed: () => void): void;
+  destroy(): void;
+};
+
+function interstitialAd(): HarnessAd {
+  const ad = new POBInterstitial('156276', 1165, '/15671365/pm_sdk/PMSDK-Demo-App-Interstitial');
+  let loaded: (filled: boolean) => void = () => {};
+  let closed: () => void = () => {};
+  ad.setListener(
+    new (class extends POBInterstitialListener {
+      onAdReceived(): void {
+        loaded(true);
+      }
+      onAdFailedToLoad(): void {
+        loaded(false);
+      }
+      onAdClosed(): void {
+        closed();
+      }
+    })()
+  );
+  return {
+    load: (onLoaded) => {
+      loaded = onLoaded;
+      ad.loadAd();
+    },
+    show: (onClosed) => {
+      closed = onClosed;
+      ad.show();
+    },
+    destroy: () => ad.destroy(),
+  };
+}
+
+function rewardedAd(): HarnessAd {
+  const ad = POBRewardedAd.getRewardedAd('156276', 1165, '/15671365/pm_sdk/PMSDK-Demo-App-Rewarded');
+  let loaded: (filled: boolean) => void = () => {};
+  let closed: () => void = () => {};
+  ad.setListener(
+    new (class extends POBRewardedAdListener {
+      onAdReceived(): void {
+        loaded(true);
+      }
+      onAdFailedToLoad(): void {
+        loaded(false);
+      }
+      onAdClosed(): void {
+        closed();
+      }
+    })()
+  );
+  return {
+    load: (onLoaded) => {
+      loaded = onLoaded;
+      ad.loadAd();
+    },
+    show: (onClosed) => {
+      closed = onClosed;
+      ad.show();
+    },
+    destroy: () => ad.destroy(),
+  };
+}
+
+async function runCycle(factory: () => HarnessAd): Promise<CycleResult> {
+  const ad = factory();
+  const loadStart = now();
+  const filled = await new Promise<boolean>((resolve) => ad.load(resolve));
+  const loadMs = now() - loadStart;
+  let showMs = 0;
+  if (filled) {
+    const showStart = now();
+    await new Promise<void>((resolve) => ad.show(resolve));
+    showMs = now() - showStart;
+  }
+  ad.destroy();
+  return { filled, loadMs, showMs };
+}
+
+async function runHarness(factory: () => HarnessAd): Promise<HarnessReport> {
+  const results: CycleResult[] = [];
+  let started = 0;
+  const start = now();
+  const worker = async () => {
+    while (started < CYCLES) {
+      started++;
+      results.push(await runCycle(factory));
+    }
+  };
+  await Promise.all(Array.from({ length: CONCURRENCY }, worker));
+  const elapsedSeconds = (now() - start) / 1000;
+  const filled = results.filter((result) => result.filled);
+  return {
+    cycles: results.length,
+    filled: filled.length,
+    throughputPerSecond: Math.round(results.length / elapsedSeconds),
+    loadMs: distribution(results.map((result) => result.loadMs)),
+    showMs: distribution(filled.map((result) => result.showMs)),
+    leakedJsInstances: POBAdManager.getInstance().size(),
+    leakedNativeInstances: mockNativeInstances.size,
+  };
+}
+
+describe('POBLoadHarness', () => {
+  let server: any;
+
+  beforeAll((done) => {
+    server = createStubAdServer({
+      latency: Number(process.env.POBRN_HARNESS_LATENCY ?? 0),
+      noFillRate: Number(process.env.POBRN_HARNESS_NO_FILL_RATE ?? 0.1),
+    });
+    server.listen(0, '127.0.0.1', () => {
+      mockStubPort = (server.address() as AddressInfo).port;
+      done();
+    });
+  });
+
+  afterAll((done) => {
+    server.close(done);
+  });
+
+  it.each([
+    ['interstitial', interstitialAd, POBConstants.INTERSTITIAL_AD_EVENT_KEY],
+    ['rewarded', rewardedAd, POBConstants.REWARDED_AD_EVENT_KEY],
+  ])('drives %s create/load/show/destroy cycles', async (format, factory, eventKey) => {
+    expect(mockListeners.has(eventKey)).toBe(true);
+    const report = await runHarness(factory);
+    console.log(`POBLoadHarness ${format}: ${JSON.stringify(report)}`);
+
+    expect(report.cycles).toBe(CYCLES);
+    expect(report.leakedJsInstances).toBe(0);
+    expect(report.leakedNativeInstances).toBe(0);
+  }, 120000);
+});
@@ -0,0 +1,318 @@
+import { readFileSync } from 'fs';
+import { join } from 'path';
+import { POBInterstitial } from '../../ads/POBInterstitial';
+import { POBRewardedAd } from '../../ads/POBRewardedAd';
+import { POBBannerView } from '../../ads/POBBannerView';
+import { POBFullScreenAds } from '../../ads/POBFullScreenAds';
+import { POBConstants } from '../../common/POBConstants';
+import { decodeAdEvent } from '../../common/POBEventPayload';
+import { POBEvent } from '../../common/POBEventSchema';
+import { POBEventRecorder, POBEventTrace, POBTraceChannel, POBTraceEvent } from '../../common/POBEventRecorder';
+
+/**
+ * Replays recorded native event traces (OpenWrapSDK.startEventRecording) against many simulated
+ * ad instances, through the same entry points as the native layers: the NativeEventEmitter of the
+ * full screen ads and the direct event props of the banners. Reports the JS dispatch cost, the
+ * POBBid/POBError allocations and the latency from the native event to the app listener.
+ *
+ * Tune it with the environment variables:
+ * - POBRN_REPLAY_TRACE: trace file to replay (default traces/sample-session.json).
+ * - POBRN_REPLAY_INSTANCES: number of simulated copies of every recorded ad (default 1000).
+ * - POBRN_REPLAY_SPEED: 0 replays as fast as possible (default), 1 at the recorded speed, N times
+ *   faster otherwise.
+ */
+const TRACE_FILE = process.env.POBRN_REPLAY_TRACE ?? join(__dirname, 'traces', 'sample-session.json');
+const INSTANCES = Number(process.env.POBRN_REPLAY_INSTANCES ?? 1000);
+const SPEED = Number(process.env.POBRN_REPLAY_SPEED ?? 0);
+
+// Not initialized here, the emitters register their listeners while the imports are evaluated.
+var mockListeners: Map<string, (payload: string) => void>;
+var mockAllocations = { bids: 0, errors: 0 };
+var mockCreatedInstanceId = '';
+
+jest.mock('react-native', () => {
+  // The native ad calls have no effect, only the events matter.
+  const createAdInstance = (instanceId: string) => {
+    mockCreatedInstanceId = instanceId;
+  };
+  const nativeModule = new Proxy(
+    {},
+    { get: (_target, property) => (property === 'createAdInstance' ? createAdInstance : () => undefined) }
+  );
+  return {
+    NativeModules: {
+      POBRNInterstitialModule: nativeModule,
+      POBRNRewardedAdModule: nativeModule,
+    },
+    NativeEventEmitter: jest.fn().mockImplementation(() => ({
+      addListener(eventKey: string, listener: (payload: string) => void) {
+        mockListeners = mockListeners ?? new Map();
+        mockListeners.set(eventKey, listener);
+      },
+    })),
+    requireNativeComponent: jest.fn(() => 'POBRNBannerView'),
+    UIManager: {
+      getViewManagerConfig: () => ({ Commands: {} }),
+      dispatchViewManagerCommand: jest.fn(),
+    },
+    Platform: { OS: 'ios', select: () => 'ios' },
+  };
+});
+
+// Counts the allocations of the event objects.
+jest.mock('../../models/POBBid', () => {
+  const actual = jest.requireActual('../../models/POBBid');
+  class POBBid extends actual.POBBid {
+    constructor(...args: any[]) {
+      super(...args);
+      mockAllocations.bids++;
+    }
+  }
+  return { ...actual, POBBid };
+});
+
+jest.mock('../../models/POBError', () => {
+  const actual = jest.requireActual('../../models/POBError');
+  class POBError extends actual.POBError {
+    constructor(...args: any[]) {
+      super(...args);
+      mockAllocations.errors++;
+    }
+  }
+  return { ...actual, POBError };
+});
+
+type ReplayReport = {
+  events: number;
+  instances: number;
+  speed: number;
+  dispatchNs: { p50: number; p99: number; mean: number };
+  listenerLatencyUs: { p50: number; p99: number };
+  lagMs?: { p50: number; p99: number };
+  allocationsPerEvent: { bids: number; errors: number };
+  heapDeltaBytes: number;
+  listenerCalls: number;
+};
+
+// A trace event bound to a simulated instance.
+type Dispatch = () => void;
+
+function now(): number {
+  return Number(process.hrtime.bigint()) / 1e6;
+}
+
+function percentile(sorted: number[], p: number): number {
+  if (sorted.length === 0) {
+    return 0;
+  }
+  return sorted[Math.min(sorted.length - 1, Math.floor((sorted.length * p) / 100))]!;
+}
+
+function readTrace(file: string): POBEventTrace {
+  const trace = JSON.parse(readFileSync(file, 'utf-8'));
+  if (trace.version !== 1) {
+    throw new Error(`Unsupported trace version ${trace.version}`);
+  }
+  return trace;
+}
+
+/**
+ * Simulated instances of the recorded ads, notifying the listener calls to onListener.
+ */
+class ReplayWorld {
+  // Kept strongly, POBAdManager only holds the ads weakly.
+  readonly ads: POBFullScreenAds[] = [];
+  // Instance ids of the copies of a recorded full screen ad, by recorded instance id.
+  private readonly fullScreenIds = new Map<string, string[]>();
+  // Event props of the copies of a recorded banner, by banner number.
+  private readonly banners = new Map<number, any[]>();
+
+  constructor(trace: POBEventTrace, private readonly copies: number, private readonly onListener: () => void) {
+    trace.events.forEach((event) => {
+      if (event[1] === POBTraceChannel.BANNER) {
+        if (!this.banners.has(event[2])) {
+          this.banners.set(event[2], this.createBanners());
+        }
+      } else {
+        const { instanceId } = decodeAdEvent(event[2]);
+        if (!this.fullScreenIds.has(instanceId)) {
+          this.fullScreenIds.set(instanceId, this.createFullScreenAds(event[1]));
+        }
+      }
+    });
+  }
+
+  instanceCount(): number {
+    return this.ads.length + this.banners.size * this.copies;
+  }
+
+  /**
+   * Returns the dispatches of the event to every copy of its ad, the payloads being prepared
+   * beforehand so that only the JS layer is measured.
+   */
+  dispatches(event: POBTraceEvent): Dispatch[] {
+    if (event[1] === POBTraceChannel.BANNER) {
+      const [, , banner, eventName, nativeEvent] = event;
+      return this.banners.get(banner)!.map((props) => () => props[eventName]?.({ nativeEvent }));
+    }
+    const [, channel, payload] = event;
+    const eventKey = channel === POBTraceChannel.INTERSTITIAL
+      ? POBConstants.INTERSTITIAL_AD_EVENT_KEY
+      : POBConstants.REWARDED_AD_EVENT_KEY;
+    const recordedId = JSON.stringify(decodeAdEvent(payload).instanceId);
+    return this.fullScreenIds.get(JSON.parse(recordedId))!.map((instanceId) => {
+      // The instance id is the first key of the payload.
+      const copyPayload = payload.replace(recordedId, JSON.stringify(instanceId));
+      return () => mockListeners.get(eventKey)!(copyPayload);
+    });
+  }
+
+  private createFullScreenAds(channel: 0 | 1): string[] {
+    const onListener = this.onListener;
+    const listener: any = new Proxy({}, { get: () => onListener });
+    const bidEventListener = { onBidReceived: onListener, onBidFailed: onListener, onMediationOutcome: onListener };
+    const ids: string[] = [];
+    for (let i = 0; i < this.copies; i++) {
+      const ad = channel === POBTraceChannel.INTERSTITIAL
+        ? new POBInterstitial('156276', 1165, 'replay')
+        : POBRewardedAd.getRewardedAd('156276', 1165, 'replay');
+      ad.setListener(listener);
+      ad.setBidEventListener(bidEventListener);
+      ad.loadAd();
+      this.ads.push(ad);
+      ids.push(mockCreatedInstanceId);
+    }
+    return ids;
+  }
+
+  private createBanners(): any[] {
+    const onListener = this.onListener;
+    const props: any[] = [];
+    for (let i = 0; i < this.copies; i++) {
+      const banner = new POBBannerView({
+        adUnitDetails: { publisherId: '156276', profileId: 1165, adUnitId: 'replay', adSizes: [] },
+        onAdReceived: onListener,
+        onAdFailed: onListener,
+        onAdClicked: onListener,
+        onAdOpened: onListener,
+        onAdClosed: onListener,
+        onAppLeaving: onListener,
+        bidEventListener: { onBidReceived: onListener, onBidFailed: onListener, onMediationOutcome: onListener },
+      });
+      // Not mounted, the state is applied synchronously instead of rendering.
+      (banner as any).setState = (state: any) => {
+        (banner as any).state = { ...banner.state, ...state };
+      };
+      props.push(banner.render().props);
+    }
+    return props;
+  }
+}
+
+/**
+ * Replays the trace against the given number of copies of its ads.
+ */
+async function replay(trace: POBEventTrace, copies: number, speed: number): Promise<ReplayReport> {
+  let dispatchStart = 0;
+  let listenerCalls = 0;
+  const listenerLatencies: number[] = [];
+  const world = new ReplayWorld(trace, copies, () => {
+    listenerCalls++;
+    listenerLatencies.push((now() - dispatchStart) * 1000);
+  });
+
+  const dispatchTimes: number[] = [];
+  const lags: number[] = [];
+  const run = (dispatches: Dispatch[]) => {
+    dispatches.forEach((dispatch) => {
+      dispatchStart = now();
+      dispatch();
+      dispatchTimes.push((now() - dispatchStart) * 1e6);
+    });
+  };
+
+  const events = trace.events.map((event) => ({ offsetMs: event[0], dispatches: world.dispatches(event) }));
+  const allocationsBefore = { ...mockAllocations };
+  const heapBefore = process.memoryUsage().heapUsed;
+  if (speed > 0) {
+    const start = now();
+    await Promise.all(
+      events.map(
+        ({ offsetMs, dispatches }) =>
+          new Promise<void>((resolve) => {
+            setTimeout(() => {
+              lags.push(now() - start - offsetMs / speed);
+              run(dispatches);
+              resolve();
+            }, offsetMs / speed);
+          })
+      )
+    );
+  } else {
+    events.forEach(({ dispatches }) => run(dispatches));
+  }
+  const heapDeltaBytes = process.memoryUsage().heapUsed - heapBefore;
+
+  const sortedDispatch = [...dispatchTimes].sort((a, b) => a - b);
+  const sortedLatencies = [...listenerLatencies].sort((a, b) => a - b);
+  const sortedLags = [...lags].sort((a, b) => a - b);
+  return {
+    events: dispatchTimes.length,
+    instances: world.instanceCount(),
+    speed,
+    dispatchNs: {
+      p50: percentile(sortedDispatch, 50),
+      p99: percentile(sortedDispatch, 99),
+      mean: dispatchTimes.reduce((sum, time) => sum + time, 0) / Math.max(1, dispatchTimes.length),
+    },
+    listenerLatencyUs: { p50: percentile(sortedLatencies, 50), p99: percentile(sortedLatencies, 99) },
+    lagMs: speed > 0 ? { p50: percentile(sortedLags, 50), p99: percentile(sortedLags, 99) } : undefined,
+    allocationsPerEvent: {
+      bids: (mockAllocations.bids - allocationsBefore.bids) / Math.max(1, dispatchTimes.length),
+      errors: (mockAllocations.errors - allocationsBefore.errors) / Math.max(1, dispatchTimes.length),
+    },
+    heapDeltaBytes,
+    listenerCalls,
+  };
+}
+
+// Event identity, independent of the instance ids and banner numbers of the recording.
+function normalize(event: POBTraceEvent): any {
+  if (event[1] === POBTraceChannel.BANNER) {
+    return [event[1], event[3], event[4]];
+  }
+  const { event: id, ext } = decodeAdEvent(event[2]);
+  return [event[1], id, ext];
+}
+
+describe('POBReplayHarness', () => {
+  const trace = readTrace(TRACE_FILE);
+
+  it('should record the events as received from the native layers', async () => {
+    POBEventRecorder.start();
+    await replay(trace, 1, 0);
+    const recorded = POBEventRecorder.stop();
+
+    expect(recorded.events.map(normalize)).toEqual(trace.events.map(normalize));
+    expect(POBEventRecorder.isRecording()).toBe(false);
+  });
+
+  it(
+    'should replay the trace against the simulated instances',
+    async () => {
+      const report = await replay(trace, INSTANCES, SPEED);
+      console.log(`POBReplayHarness: ${JSON.stringify(report)}`);
+
+      expect(report.events).toBe(trace.events.length * INSTANCES);
+      expect(report.listenerCalls).toBeGreaterThan(0);
+      // One bid per received bid or ad, nothing is allocated for the other events.
+      const bidEvents = trace.events.filter((event) =>
+        event[1] === POBTraceChannel.BANNER
+          ? event[3] === 'onAdReceived' || event[3] === 'onBidReceived'
+          : [POBEvent.AD_RECEIVED, POBEvent.BID_RECEIVED].includes(decodeAdEvent(event[2]).event as any)
+      ).length;
+      expect(report.allocationsPerEvent.bids * report.events).toBeCloseTo(bidEvents * INSTANCES);
+    },
+    SPEED > 0 ? 60000 + Math.max(...trace.events.map((event) => event[0])) / SPEED : 60000
+  );
+});
@@ -0,0 +1,292 @@
+import { InteractionManager } from 'react-native';
+import { POBFullScreenAds } from './POBFullScreenAds';
+import { POBBannerView } from './POBBannerView';
+import { POBAdManager } from '../common/POBAdManager';
+import { POBEvent } from '../common/POBEventSchema';
+import type { POBAdSessionStats } from '../models/POBAdSessionStats';
+
+// Load outcome events of a prefetched ad, replayed to the ad once handed over to its screen.
+const RECORDED_EVENTS: number[] = [
+    POBEvent.AD_RECEIVED,
+    POBEvent.AD_FAILED_TO_LOAD,
+    POBEvent.AD_EXPIRED,
+];
+
+// Events after which a prefetched ad can no longer be shown.
+const STALE_EVENTS: number[] = [
+    POBEvent.AD_FAILED_TO_LOAD,
+    POBEvent.AD_EXPIRED,
+];
+
+/**
+ * An ad loaded ahead of its screen, with the events received meanwhile.
+ */
+type PrefetchedAd = { ad: POBFullScreenAds, events: { event: number, adInfo: any }[] };
+
+/**
+ * The prefetch of a declared next screen.
+ */
+type Prefetch = {
+    ads: Map<string, PrefetchedAd>,
+    task?: { cancel(): void },
+    expiryTimer?: ReturnType<typeof setTimeout>,
+};
+
+/**
+ * Groups the full screen ads of a screen, so that they are destroyed with the screen, and lets the
+ * ads of the likely next screen load ahead of the navigation.
+ *
+ * - {@link POBAdSession.forScreen} returns the session of a mounted screen, whose ads are taken with
+ *   {@link takeAd} and destroyed with {@link destroy} when the screen unmounts.
+ * - {@link POBAdSession.prefetch} declares the next screen: once the interactions and animations in
+ *   progress are done, its ads are created and loaded. When the screen mounts, {@link takeAd} hands
+ *   them over right away, replaying their load outcome to the listener. Prefetched ads not taken
+ *   within the prefetch time to live are destroyed.
+ * - {@link blur} and {@link focus} track the screen focus, see {@link bannerAutoRefreshState}.
+ *
+ * Usage:
+ * POBAdSession.prefetch('Level', { reward: () => new POBRewardedAd(publisherId, profileId, adUnitId) });
+ * // On the Level screen
+ * const session = POBAdSession.forScreen('Level');
+ * const rewarded = session.takeAd('reward', () => new POBRewardedAd(publisherId, profileId, adUnitId),
+ *   (ad) => ad.setListener(listener));
+ * // On unmount
+ * session.destroy();
+ */
+export class POBAdSession {
+
+    /**
+     * Default time a prefetched ad waits for its screen, in milliseconds.
+     */
+    static readonly DEFAULT_PREFETCH_TTL_MS = 60_000;
+
+    private static sessions: Map<string, POBAdSession> = new Map();
+
+    private static prefetches: Map<string, Prefetch> = new Map();
+
+    private static stats = { prefetched: 0, hits: 0, loadingHits: 0, misses: 0, wasted: 0 };
+
+    /**
+     * Name of the screen.
+     */
+    readonly screen: string;
+
+    // Ads taken by the screen, by key.
+    private ads: Map<string, POBFullScreenAds> = new Map();
+
+    // Ads prefetched for the screen and not taken yet, by key.
+    private prefetched: Map<string, PrefetchedAd>;
+
+    private focused = true;
+
+    private blurred = false;
+
+    private focusListeners: Set<(focused: boolean) => void> = new Set();
+
+    private constructor(screen: string, prefetched: Map<string, PrefetchedAd>) {
+        this.screen = screen;
+        this.prefetched = prefetched;
+    }
+
+    /**
+     * Returns the session of a screen, created on the first call. A new session takes over the ads
+     * prefetched for the screen.
+     *
+     * @param screen name of the screen
+     */
+    static forScreen(screen: string): POBAdSession {
+        let session = POBAdSession.sessions.get(screen);
+        if (!session) {
+            const prefetch = POBAdSession.prefetches.get(screen);
+            POBAdSession.prefetches.delete(screen);
+            // A prefetch not started yet would compete with the mounting screen.
+            prefetch?.task?.cancel();
+            if (prefetch?.expiryTimer) {
+                clearTimeout(prefetch.expiryTimer);
+            }
+            session = new POBAdSession(screen, prefetch?.ads ?? new Map());
+            POBAdSession.sessions.set(screen, session);
+        }
+        return session;
+    }
+
+    /**
+     * Declares the likely next screen and prefetches its ads once the app is idle. Replaces the
+     * previous prefetch of the screen, has no effect while the screen is mounted.
+     *
+     * @param screen name of the next screen
+     * @param factories creates each ad of the screen by key, the ads are loaded by the session
+     * @param ttlMs time the prefetched ads wait for their screen before being destroyed
+     */
+    static prefetch(
+        screen: string,
+        factories: { [key: string]: () => POBFullScreenAds },
+        ttlMs: number = POBAdSession.DEFAULT_PREFETCH_TTL_MS
+    ): void {
+        if (POBAdSession.sessions.has(screen)) {
+            return;
+        }
+        POBAdSession.cancelPrefetch(screen);
+        const prefetch: Prefetch = { ads: new Map() };
+        prefetch.task = InteractionManager.runAfterInteractions(() => {
+            prefetch.task = undefined;
+            for (const [key, factory] of Object.entries(factories)) {
+                const prefetchedAd: PrefetchedAd = { ad: factory(), events: [] };
+                prefetchedAd.ad.loadAd();
+                POBAdManager.getInstance().observe(prefetchedAd.ad, (event: number, adInfo: any) => {
+                    if (RECORDED_EVENTS.includes(event)) {
+                        prefetchedAd.events.push({ event, adInfo });
+                    }
+                });
+                prefetch.ads.set(key, prefetchedAd);
+                POBAdSession.stats.prefetched++;
+            }
+        });
+        prefetch.expiryTimer = setTimeout(() => POBAdSession.cancelPrefetch(screen), ttlMs);
+        POBAdSession.prefetches.set(screen, prefetch);
+    }
+
+    /**
+     * Cancels the prefetch of a screen, destroying its prefetched ads.
+     *
+     * @param screen name of the screen
+     */
+    static cancelPrefetch(screen: string): void {
+        const prefetch = POBAdSession.prefetches.get(screen);
+        if (!prefetch) {
+            return;
+        }
+        POBAdSession.prefetches.delete(screen);
+        prefetch.task?.cancel();
+        if (prefetch.expiryTimer) {
+            clearTimeout(prefetch.expiryTimer);
+        }
+        prefetch.ads.forEach((prefetchedAd) => POBAdSession.discard(prefetchedAd));
+    }
+
+    /**
+     * Returns the prefetch stats of all the sessions.
+     */
+    static getPrefetchStats(): POBAdSessionStats {
+        const stats = POBAdSession.stats;
+        const served = stats.hits + stats.loadingHits;
+        const total = served + stats.misses;
+        return { ...stats, hitRate: total == 0 ? 0 : served / total };
+    }
+
+    /**
+     * Removes all the prefetch stats.
+     */
+    static resetPrefetchStats(): void {
+        POBAdSession.stats = { prefetched: 0, hits: 0, loadingHits: 0, misses: 0, wasted: 0 };
+    }
+
+    /**
+     * Returns the ad of the given key: the ad already taken, else the prefetched ad, else a new ad
+     * created and loaded. A prefetched ad is configured then receives the events of its load, e.g.
+     * onAdReceived, right away. A prefetched ad whose load failed or bid expired is replaced.
+     *
+     * @param key identifies the ad within the screen
+     * @param create creates the ad when not prefetched
+     * @param configure sets up the ad, e.g. its listener, before it is loaded or handed over
+     */
+    takeAd<T extends POBFullScreenAds>(key: string, create: () => T, configure?: (ad: T) => void): T {
+        const taken = this.ads.get(key);
+        if (taken) {
+            return taken as T;
+        }
+        const prefetchedAd = this.prefetched.get(key);
+        this.prefetched.delete(key);
+        const lastEvent = prefetchedAd?.events[prefetchedAd.events.length - 1]?.event;
+        if (prefetchedAd && !(lastEvent !== undefined && STALE_EVENTS.includes(lastEvent))) {
+            const ad = prefetchedAd.ad as T;
+            POBAdManager.getInstance().observe(ad, undefined);
+            configure?.(ad);
+            prefetchedAd.events.forEach(({ event, adInfo }) => ad.onAdEvent(event, adInfo));
+            if (lastEvent == POBEvent.AD_RECEIVED) {
+                POBAdSession.stats.hits++;
+            } else {
+                POBAdSession.stats.loadingHits++;
+            }
+            this.ads.set(key, ad);
+            return ad;
+        }
+        if (prefetchedAd) {
+            POBAdSession.discard(prefetchedAd);
+        }
+        const ad = create();
+        configure?.(ad);
+        ad.loadAd();
+        POBAdSession.stats.misses++;
+        this.ads.set(key, ad);
+        return ad;
+    }
+
+    /**
+     * Marks the screen as blurred, e.g. when another screen is pushed on top of it.
+     */
+    blur(): void {
+        if (this.focused) {
+            this.focused = false;
+            this.blurred = true;
+            this.focusListeners.forEach((listener) => listener(false));
+        }
+    }
+
+    /**
+     * Marks the screen as focused again.
+     */
+    focus(): void {
+        if (!this.focused) {
+            this.focused = true;
+            this.focusListeners.forEach((listener) => listener(true));
+        }
+    }
+
+    /**
+     * Returns whether the screen is focused.
+     */
+    isFocused(): boolean {
+        return this.focused;
+    }
+
+    /**
+     * Adds a listener notified when the screen is blurred or focused again.
+     *
+     * @returns a function removing the listener
+     */
+    addFocusListener(listener: (focused: boolean) => void): () => void {
+        this.focusListeners.add(listener);
+        return () => this.focusListeners.delete(listener);
+    }
+
+    /**
+     * Returns the auto refresh state for the banners of the screen: paused while blurred, resumed
+     * once focused again.
+     */
+    bannerAutoRefreshState(): POBBannerView.AutoRefreshState {
+        if (!this.focused) {
+            return POBBannerView.AutoRefreshState.PAUSE;
+        }
+        return this.blurred ? POBBannerView.AutoRefreshState.RESUME : POBBannerView.AutoRefreshState.DEFAULT;
+    }
+
+    /**
+     * Destroys the ads of the screen, taken or not, when the screen unmounts.
+     */
+    destroy(): void {
+        this.ads.forEach((ad) => ad.destroy());
+        this.ads.clear();
+        this.prefetched.forEach((prefetchedAd) => POBAdSession.discard(prefetchedAd));
+        this.prefetched.clear();
+        this.focusListeners.clear();
+        if (POBAdSession.sessions.get(this.screen) === this) {
+            POBAdSession.sessions.delete(this.screen);
+        }
+    }
+
+    private static discard(prefetchedAd: PrefetchedAd): void {
+        prefetchedAd.ad.destroy();
+        POBAdSession.stats.wasted++;
+    }
+}
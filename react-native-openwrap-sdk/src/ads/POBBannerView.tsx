@@ -8,10 +8,16 @@ import { POBAdUnitDetails } from '../models/POBAdUnitDetails';
 import { POBAdSize } from '../models/POBAdSize';
 import { POBError } from '../models/POBError';
 import { POBBid } from '../models/POBBid';
+import { POBAdLatency } from '../models/POBAdLatency';
 import { POBBidError } from '../models/POBBidError';
 import { POBBidEventListener } from './POBBidEventListener';
+import type { POBMediationOutcome } from '../models/POBMediationOutcome';
 import { POBBidEvent } from './POBBidEvent';
 import { POBBidHandler } from '../models/POBBidHandler';
+import { POBEventRecorder } from '../common/POBEventRecorder';
+
+// Creation order of the banners, identifying them in the recorded traces.
+let bannerSequence = 0;
 
 /**
  * Props required for POBBannerView component.
@@ -38,9 +44,11 @@ type POBBannerViewProps = {
    * Callback event, notifies the ad is loaded successfully.
    * @param adSize the POBAdSize of the loaded ad.
    * @param bid the POBBid for the Ad Received.
+   * @param latency the latencies measured for the load, available only when enabled with
+   * OpenWrapSDK.setLatencyInEventPayloadEnabled.
    * @returns void
    */
-  onAdReceived?: (adSize: POBAdSize, bid: POBBid) => void;
+  onAdReceived?: (adSize: POBAdSize, bid: POBBid, latency?: POBAdLatency) => void;
 
   /**
    * Callback event, notifies an error occurred while loading an ad.
@@ -119,6 +127,9 @@ export class POBBannerView extends Component<POBBannerViewProps, BannerViewState
   // Local variable to maintain proceedOnError state count.
   private proceedOnErrorCount: number;
 
+  // Number of the banner in the traces of POBEventRecorder.
+  private readonly recorderId = bannerSequence++;
+
   private resolveProccedToLoadAd?: (value: Boolean | PromiseLike<Boolean>) => void;
 
   /**
@@ -150,63 +161,72 @@ export class POBBannerView extends Component<POBBannerViewProps, BannerViewState
    * It updates the state with the received ad size and invokes the onAdReceived callback.
    * @param event - The event object containing the ad size information.
    */
-  private onAdReceived = (event: any) => {
+  private onAdReceived = this.recorded('onAdReceived', (event: any) => {
     const { width, height } = event.nativeEvent;
     this.setState({ width, height });
     const adSize: POBAdSize = new POBAdSize(width, height);
     const bid = new POBBid(event.nativeEvent, this);
-    this.props.onAdReceived?.(adSize, bid);
-  };
+    this.props.onAdReceived?.(adSize, bid, event.nativeEvent.latency);
+  });
 
   /**
    * Event handler for the onAdFailedToLoad event.
    * It invokes the onAdFailedToLoad callback with the error object.
    * @param event - The event object containing the error information.
    */
-  private onAdFailedToLoad = (event: any) => {
+  private onAdFailedToLoad = this.recorded('onAdFailedToLoad', (event: any) => {
     const { errorCode, errorMessage } = event.nativeEvent;
     const error: POBError = new POBError(errorCode, errorMessage);
     this.props.onAdFailed?.(error);
-  };
+  });
 
   /**
    * Event handler for the onBidReceived event.
    * It creates the bid with the received data and invokes the onBidReceived callback.
    * @param event - The event object containing the bid information.
    */
-  private onBidReceived = (event: any) => {
+  private onBidReceived = this.recorded('onBidReceived', (event: any) => {
     const bid: POBBid = new POBBid(event.nativeEvent, this);
     this.props.bidEventListener?.onBidReceived(this, bid);
-  }
+  });
+
+  /**
+   * Event handler for the onMediationOutcome event.
+   * It invokes the onMediationOutcome callback with the outcome of the native mediation rule.
+   * @param event - The event object containing the outcome.
+   */
+  private onMediationOutcome = this.recorded('onMediationOutcome', (event: any) => {
+    this.props.bidEventListener?.onMediationOutcome?.(this, event.nativeEvent);
+  });
 
   /**
    * Event handler for the onBidFailed event.
    * It creates the error with the received data and invokes the onBidFailed callback.
    * @param event - The event object containing error information.
    */
-  private onBidFailed = (event: any) => {
+  private onBidFailed = this.recorded('onBidFailed', (event: any) => {
     const { errorCode, errorMessage } = event.nativeEvent;
     const error: POBError = {
       errorCode: errorCode,
       errorMessage: errorMessage,
     };
     this.props.bidEventListener?.onBidFailed(this, error)
-  }
+  });
 
   /**
    * The force refresh status event.
    * @param event The event object containing the force refresh state information.
    */
-  private onForceRefresh = (event: any) => {
+  private onForceRefresh = this.recorded('onForceRefresh', (event: any) => {
     const { forceRefreshStatus } = event.nativeEvent;
     this.props.onForceRefresh?.(forceRefreshStatus);
-  };
+  });
 
-  private onProceedToLoadAd = (event: any) => {
+  private onProceedToLoadAd = this.recorded('onProceedToLoadAd', (event: any) => {
     const { proceedToLoadAdStatus } = event.nativeEvent;
 
     this.resolveProccedToLoadAd?.(proceedToLoadAdStatus === 1 ? true : false);
-  }
+  });
 
   /**
    * Callback function invoked upon completion of fetching the bid expiry status.
@@ -214,10 +234,10 @@ export class POBBannerView extends Component<POBBannerViewProps, BannerViewState
    *
    * @param event The event object containing the bid expiry status.
    */
-  private onBidExpiryStatusEvent = (event: any) => {
+  private onBidExpiryStatusEvent = this.recorded('onBidExpiryStatusEvent', (event: any) => {
     const { bidExpiryStatus } = event.nativeEvent;
     this.isBidExpiredPromiseResolver?.(bidExpiryStatus === 1 ? true : false);
-  }
+  });
 
   /**
    * Initiates the process to fetch the bid expiry status for the banner view.
@@ -243,6 +263,26 @@ export class POBBannerView extends Component<POBBannerViewProps, BannerViewState
     }
   }
 
+  private onAdClicked = this.recorded('onAdClicked', () => this.props.onAdClicked?.());
+
+  private onAdOpened = this.recorded('onAdOpened', () => this.props.onAdOpened?.());
+
+  private onAdClosed = this.recorded('onAdClosed', () => this.props.onAdClosed?.());
+
+  private onAppLeaving = this.recorded('onAppLeaving', () => this.props.onAppLeaving?.());
+
+  /**
+   * Wraps a native event handler, to record its events while {@link POBEventRecorder} is recording.
+   */
+  private recorded(eventName: string, handler: (event: any) => void): (event: any) => void {
+    return (event: any) => {
+      if (POBEventRecorder.isRecording()) {
+        POBEventRecorder.recordBannerEvent(this.recorderId, eventName, event.nativeEvent);
+      }
+      handler(event);
+    };
+  }
+
   // POBBidEvent interface methods:
 
   /**
@@ -301,12 +341,13 @@ export class POBBannerView extends Component<POBBannerViewProps, BannerViewState
         forceRefresh={this.props.forceRefresh}
         onAdReceived={this.onAdReceived}
         onAdFailedToLoad={this.onAdFailedToLoad}
-        onAdClicked={this.props.onAdClicked}
-        onAdOpened={this.props.onAdOpened}
-        onAdClosed={this.props.onAdClosed}
-        onAppLeaving={this.props.onAppLeaving}
+        onAdClicked={this.onAdClicked}
+        onAdOpened={this.onAdOpened}
+        onAdClosed={this.onAdClosed}
+        onAppLeaving={this.onAppLeaving}
         onBidFailed={this.onBidFailed}
         onBidReceived={this.onBidReceived}
+        onMediationOutcome={this.onMediationOutcome}
         proceedToLoadAd={this.state.proceedToLoadAdCount}
         onProceedToLoadAd={this.onProceedToLoadAd}
         proceedOnError={this.state.proceedOnErrorStr}
@@ -439,6 +480,13 @@ type POBRNBannerViewProps = {
    */
   onBidFailed?: (error: POBError) => void;
 
+  /**
+   * Callback event, notifies the outcome of the native mediation rule evaluated on bid received
+   *
+   * @param outcome the {@link POBMediationOutcome} of the rule
+   */
+  onMediationOutcome?: (outcome: POBMediationOutcome) => void;
+
   /**
    * A callback function invoked when the bid expiry status is fetched.
    * This function is called with the fetched bid expiry status.
@@ -1,6 +1,7 @@
 import { POBError } from './../models/POBError';
 import { POBBid } from './../models/POBBid';
 import { POBBidEvent } from './POBBidEvent';
+import type { POBMediationOutcome } from './../models/POBMediationOutcome';
 
 /**
  * Interface for notifying bid events.
@@ -23,4 +24,15 @@ export interface POBBidEventListener {
      * @param error the error of type {@link POBError} while fetching bid
      */
     onBidFailed(bidEvent: POBBidEvent, error: POBError): void;
+
+    /**
+     * Notifies the outcome of the in-house mediation rule registered for the ad unit id with
+     * OpenWrapSDK.setMediationRule. The bid flow has already proceeded natively, so onBidReceived
+     * is not called and neither proceedToLoadAd() nor proceedOnError() must be called.
+     *
+     * @param bidEvent reference of {@link POBBidEvent} interface i.e. Instance of class which implements
+     *                 {@link POBBidEvent}
+     * @param outcome the {@link POBMediationOutcome} of the rule
+     */
+    onMediationOutcome?(bidEvent: POBBidEvent, outcome: POBMediationOutcome): void;
 }
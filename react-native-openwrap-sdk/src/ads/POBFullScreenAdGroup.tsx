@@ -0,0 +1,93 @@
+import { lazyNativeModule } from '../common/POBNativeModules';
+import { POBFullScreenAds } from './POBFullScreenAds';
+import { POBRewardedAd } from './POBRewardedAd';
+import { POBAdManager } from '../common/POBAdManager';
+
+const POBRNInterstitialModule = lazyNativeModule('POBRNInterstitialModule');
+const POBRNRewardedAdModule = lazyNativeModule('POBRNRewardedAdModule');
+
+// Native module of the given ad.
+const nativeModuleOf = (ad: POBFullScreenAds) => ad instanceof POBRewardedAd ? POBRNRewardedAdModule : POBRNInterstitialModule;
+
+/**
+ * Groups interchangeable full screen ads of a show point, so the point is not lost when one of them
+ * is still loading or its bid expired.
+ *
+ * {@link showBestAvailable} checks, in one native pass, the readiness and the bid expiry of every ad
+ * of the group and shows the ready one with the highest bid price. The ads neither ready nor loading,
+ * e.g. failed or expired, load again to replace it. When no ad is ready but some are loading, the
+ * show waits up to the latency budget for the first of them to be received.
+ *
+ * Usage:
+ * const group = new POBFullScreenAdGroup('level_end');
+ * group.add(interstitial);
+ * group.add(rewarded);
+ * const shown = await group.showBestAvailable();
+ */
+export class POBFullScreenAdGroup {
+
+    /**
+     * Default time to wait for a loading ad when none of the group is ready, in milliseconds.
+     */
+    static readonly DEFAULT_BUDGET_MS = 300;
+
+    /**
+     * Name of the group, unique across the app.
+     */
+    readonly name: string;
+
+    // Ads of the group, by instance id.
+    private ads: Map<string, POBFullScreenAds> = new Map();
+
+    /**
+     * Constructor.
+     * @param name Name of the group, unique across the app.
+     */
+    constructor(name: string) {
+        this.name = name;
+    }
+
+    /**
+     * Adds an interstitial or rewarded ad to the group.
+     * @param ad the ad, it is loaded by the app as usual
+     */
+    add(ad: POBFullScreenAds): void {
+        const instanceId = POBAdManager.getInstance().instanceIdOf(ad);
+        if (instanceId == undefined || this.ads.has(instanceId)) {
+            return;
+        }
+        this.ads.set(instanceId, ad);
+        nativeModuleOf(ad).addToGroup(this.name, instanceId);
+    }
+
+    /**
+     * Removes an ad from the group. A destroyed ad leaves the group by itself.
+     */
+    remove(ad: POBFullScreenAds): void {
+        const instanceId = POBAdManager.getInstance().instanceIdOf(ad);
+        if (instanceId == undefined || !this.ads.delete(instanceId)) {
+            return;
+        }
+        nativeModuleOf(ad).removeFromGroup(this.name, instanceId);
+    }
+
+    /**
+     * Shows the ready ad of the group with the highest bid price, waiting up to the budget for a
+     * loading ad when none is ready, and loads the replacements of the failed and expired ones.
+     *
+     * @param budgetMs Time to wait for a loading ad when none is ready, 0 not to wait.
+     * @returns Promise resolved with the ad shown, undefined if none could be shown in the budget.
+     */
+    showBestAvailable(budgetMs: number = POBFullScreenAdGroup.DEFAULT_BUDGET_MS): Promise<POBFullScreenAds | undefined> {
+        const first = this.ads.values().next().value;
+        if (first == undefined) {
+            return Promise.resolve(undefined);
+        }
+        // Kept alive and notified of their events, whichever is shown or reloaded.
+        this.ads.forEach((ad, instanceId) => POBAdManager.getInstance().put(instanceId, ad));
+        // The groups are shared by both native modules, which can show a mixed group.
+        return nativeModuleOf(first)
+            .showBestAvailable(this.name, budgetMs)
+            .then((instanceId: string | null) => (instanceId == null ? undefined : this.ads.get(instanceId)));
+    }
+}
@@ -29,10 +29,10 @@ export interface POBFullScreenAds {
 
     /**
      * Method to Receive callback events from native modules
-     * @param eventName event name
+     * @param event event id, see POBEvent
      * @param adInfo ad info JSON string
      */
-    onAdEvent(eventName: string, adInfo: any): void;
+    onAdEvent(event: number, adInfo: any): void;
 
     /**
      * Setter for setting the request parameters on the Ad.
@@ -1,19 +1,25 @@
-import { NativeModules } from 'react-native';
+import { lazyNativeModule } from '../common/POBNativeModules';
 import { POBInterstitialListener } from './POBInterstitialListener';
 import { POBVideoListener } from './POBVideoListener';
 import { POBFullScreenAds } from './POBFullScreenAds';
 import { POBAdManager } from '../common/POBAdManager';
-import { POBConstants } from '../common/POBConstants';
+import { POBEvent } from '../common/POBEventSchema';
+import { eventTable } from '../common/POBEventPayload';
 import { POBError } from '../models/POBError';
 import { POBRequest } from '../models/POBRequest';
 import { POBImpression } from '../models/POBImpression';
 import { POBBid } from '../models/POBBid';
+import { POBAdLatency } from '../models/POBAdLatency';
+import type { POBGamConfig } from '../models/POBGamConfig';
 import { POBBidEventListener } from './POBBidEventListener';
 import { POBBidError } from 'src/models/POBBidError';
 import { POBFullScreenBidEvent } from './POBFullScreenBidEvent';
 import { POBBidHandler } from '../models/POBBidHandler';
 
-const POBRNInterstitialModule = NativeModules.POBRNInterstitialModule;
+const POBRNInterstitialModule = lazyNativeModule('POBRNInterstitialModule');
+
+// Destroys the native ad of an ad collected without destroy() being called.
+const destroyNativeAd = (instanceId: string) => POBRNInterstitialModule.destroy(instanceId);
 
 
 /**
@@ -37,6 +43,8 @@ export class POBInterstitial implements POBFullScreenAds, POBFullScreenBidEvent,
 
     private bid?: POBBid;
 
+    private latency?: POBAdLatency;
+
     /**
      * Constructor.
      * Initializes and returns newly allocated interstitial object for supporting `No Ad Server Configuration`
@@ -44,67 +52,75 @@ export class POBInterstitial implements POBFullScreenAds, POBFullScreenBidEvent,
      * @param publisherId Identifier of the publisher
      * @param profileId   Profile ID of an ad tag
      * @param adUnitId    Ad unit id used to identify unique placement on screen
+     * @param gamConfig   Optional GAM details, to load the ad through GAM for header bidding
      */
-    constructor(publisherId: string, profileId: number, adUnitId: string) {
+    constructor(publisherId: string, profileId: number, adUnitId: string, gamConfig?: POBGamConfig) {
         this.publisherId = publisherId;
         this.profileId = profileId;
         this.adUnitId = adUnitId;
-        this.instanceId = new Date().getTime().toString();
-        POBRNInterstitialModule.createAdInstance(
-            this.instanceId,
-            this.publisherId,
-            this.profileId,
-            this.adUnitId
-        );
+        this.instanceId = POBAdManager.generateInstanceId();
+        if (gamConfig) {
+            POBRNInterstitialModule.createGamAdInstance(
+                this.instanceId,
+                this.publisherId,
+                this.profileId,
+                this.adUnitId,
+                JSON.stringify(gamConfig)
+            );
+        } else {
+            POBRNInterstitialModule.createAdInstance(
+                this.instanceId,
+                this.publisherId,
+                this.profileId,
+                this.adUnitId
+            );
+        }
+        POBAdManager.getInstance().register(this.instanceId, this, destroyNativeAd);
     }
 
+    // Handlers of the ad events, indexed by event id, see POBEvent.
+    private static readonly eventHandlers = eventTable<POBInterstitial>({
+        [POBEvent.AD_RECEIVED]: (ad, adInfo) => {
+            ad.bid = new POBBid(adInfo, ad);
+            ad.updateLatency(adInfo);
+            ad.listener?.onAdReceived(ad);
+        },
+        [POBEvent.AD_FAILED_TO_LOAD]: (ad, adInfo) => {
+            ad.listener?.onAdFailedToLoad(ad, new POBError(adInfo.errorCode, adInfo.errorMessage));
+        },
+        [POBEvent.AD_FAILED_TO_SHOW]: (ad, adInfo) => {
+            ad.listener?.onAdFailedToShow(ad, new POBError(adInfo.errorCode, adInfo.errorMessage));
+        },
+        [POBEvent.AD_CLICKED]: (ad) => ad.listener?.onAdClicked(ad),
+        [POBEvent.AD_OPENED]: (ad, adInfo) => {
+            ad.updateLatency(adInfo);
+            ad.listener?.onAdOpened(ad);
+        },
+        [POBEvent.AD_CLOSED]: (ad) => ad.listener?.onAdClosed(ad),
+        [POBEvent.AD_EXPIRED]: (ad) => ad.listener?.onAdExpired(ad),
+        [POBEvent.APP_LEAVING]: (ad) => ad.listener?.onAppLeaving(ad),
+        [POBEvent.VIDEO_PLAYBACK_COMPLETED]: (ad) => ad.videoListener?.onVideoPlaybackCompleted(ad),
+        [POBEvent.BID_RECEIVED]: (ad, adInfo) => {
+            ad.bid = new POBBid(adInfo, ad);
+            ad.updateLatency(adInfo);
+            ad.bidEventListener?.onBidReceived(ad, ad.bid);
+        },
+        [POBEvent.MEDIATION_OUTCOME]: (ad, adInfo) => {
+            ad.updateLatency(adInfo);
+            ad.bidEventListener?.onMediationOutcome?.(ad, adInfo);
+        },
+        [POBEvent.BID_FAILED]: (ad, adInfo) => {
+            ad.bidEventListener?.onBidFailed(ad, new POBError(adInfo.errorCode, adInfo.errorMessage));
+        },
+    });
+
     /**
      * Method to Receive callback events from native modules
-     * @param eventName event name
+     * @param event event id, see POBEvent
      * @param adInfo ad info JSON string
      */
-    onAdEvent(eventName: string, _adInfo: any): void {
-        switch (eventName) {
-            case POBConstants.AD_RECEIVED_EVENT:
-                this.bid = new POBBid(_adInfo, this);
-                this.listener?.onAdReceived(this);
-                break;
-            case POBConstants.AD_FAILED_TO_LOAD_EVENT:
-                var error = new POBError(_adInfo.errorCode, _adInfo.errorMessage);
-                this.listener?.onAdFailedToLoad(this, error);
-                break;
-            case POBConstants.AD_FAILED_TO_SHOW_EVENT:
-                var error = new POBError(_adInfo.errorCode, _adInfo.errorMessage);
-                this.listener?.onAdFailedToShow(this, error);
-                break;
-            case POBConstants.AD_CLICKED_EVENT:
-                this.listener?.onAdClicked(this);
-                break;
-            case POBConstants.AD_OPEN_EVENT:
-                this.listener?.onAdOpened(this);
-                break;
-            case POBConstants.AD_CLOSE_EVENT:
-                this.listener?.onAdClosed(this);
-                break;
-            case POBConstants.AD_EXPIRED_EVENT:
-                this.listener?.onAdExpired(this);
-                break;
-            case POBConstants.APP_LEAVE_EVENT:
-                this.listener?.onAppLeaving(this);
-                break;
-            case POBConstants.VIDEO_PLAYBACK_COMPLETED:
-                this.videoListener?.onVideoPlaybackCompleted(this);
-                break;
-            case POBConstants.BID_RECEIVED:
-                this.bid = new POBBid(_adInfo, this);
-                this.bidEventListener?.onBidReceived(this, this.bid);
-                break;
-            case POBConstants.BID_FAILED:
-                var error = new POBError(_adInfo.errorCode, _adInfo.errorMessage);
-                this.bidEventListener?.onBidFailed(this, error);
-                break;
-            default:
-        }
+    onAdEvent(event: number, adInfo: any): void {
+        POBInterstitial.eventHandlers[event]?.(this, adInfo);
     }
 
     /**
@@ -121,6 +137,7 @@ export class POBInterstitial implements POBFullScreenAds, POBFullScreenBidEvent,
      * check if isReady returns true before calling show().
      */
     show(): void {
+        POBAdManager.getInstance().put(this.instanceId, this);
         POBRNInterstitialModule.showAd(this.instanceId);
     }
 
@@ -164,6 +181,22 @@ export class POBInterstitial implements POBFullScreenAds, POBFullScreenBidEvent,
         return this.bid
     }
 
+    /**
+     * Get the latencies measured for the latest load and show of this ad. Available only when
+     * enabled with {@link OpenWrapSDK.setLatencyInEventPayloadEnabled}.
+     *
+     * @returns {@link POBAdLatency} if measured else undefined.
+     */
+    getLatency(): POBAdLatency | undefined {
+        return this.latency;
+    }
+
+    private updateLatency(adInfo: any): void {
+        if (adInfo?.latency != undefined) {
+            this.latency = adInfo.latency;
+        }
+    }
+
     /**
      * Sets instance of POBVideoListener for getting callbacks of VAST based video ad
      *
@@ -1,19 +1,25 @@
-import { NativeModules } from 'react-native';
+import { lazyNativeModule } from '../common/POBNativeModules';
 import { POBRewardedAdListener } from './POBRewardedAdListener';
 import { POBFullScreenAds } from './POBFullScreenAds';
 import { POBAdManager } from '../common/POBAdManager';
-import { POBConstants } from '../common/POBConstants';
+import { POBEvent } from '../common/POBEventSchema';
+import { eventTable } from '../common/POBEventPayload';
 import { POBError } from '../models/POBError';
 import { POBReward } from '../models/POBReward';
 import { POBRequest } from '../models/POBRequest';
 import { POBImpression } from '../models/POBImpression';
 import { POBBid } from '../models/POBBid';
+import { POBAdLatency } from '../models/POBAdLatency';
+import type { POBGamConfig } from '../models/POBGamConfig';
 import { POBBidEventListener } from './POBBidEventListener';
 import { POBBidError } from '../models/POBBidError';
 import { POBFullScreenBidEvent } from './POBFullScreenBidEvent';
 import { POBBidHandler } from '../models/POBBidHandler';
 
-const POBRNRewardedAdModule = NativeModules.POBRNRewardedAdModule;
+const POBRNRewardedAdModule = lazyNativeModule('POBRNRewardedAdModule');
+
+// Destroys the native ad of an ad collected without destroy() being called.
+const destroyNativeAd = (instanceId: string) => POBRNRewardedAdModule.destroy(instanceId);
 
 /**
  * Displays full-screen rewarded ads.
@@ -34,15 +40,18 @@ export class POBRewardedAd implements POBFullScreenAds, POBFullScreenBidEvent, P
 
     private bid?: POBBid;
 
+    private latency?: POBAdLatency;
+
     /**
      * Method to get newly allocated rewarded object
      * @param publisherId Identifier of the publisher
      * @param profileId Profile ID of an ad tag
      * @param adUnitId Ad unit id used to identify unique placement on screen
+     * @param gamConfig Optional GAM details, to load the ad through GAM for header bidding
      * @returns newly allocated rewarded object
      */
-    static getRewardedAd(publisherId: string, profileId: number, adUnitId: string): POBRewardedAd {
-        return new POBRewardedAd(publisherId, profileId, adUnitId);
+    static getRewardedAd(publisherId: string, profileId: number, adUnitId: string, gamConfig?: POBGamConfig): POBRewardedAd {
+        return new POBRewardedAd(publisherId, profileId, adUnitId, gamConfig);
     }
 
     /**
@@ -52,68 +61,77 @@ export class POBRewardedAd implements POBFullScreenAds, POBFullScreenBidEvent, P
      * @param publisherId Identifier of the publisher
      * @param profileId   Profile ID of an ad tag
      * @param adUnitId    Ad unit id used to identify unique placement on screen
+     * @param gamConfig   Optional GAM details, to load the ad through GAM for header bidding
      */
-    private constructor(publisherId: string, profileId: number, adUnitId: string) {
+    private constructor(publisherId: string, profileId: number, adUnitId: string, gamConfig?: POBGamConfig) {
         this.publisherId = publisherId;
         this.profileId = profileId;
         this.adUnitId = adUnitId;
-        this.instanceId = new Date().getTime().toString();
-        POBRNRewardedAdModule.createAdInstance(
-            this.instanceId,
-            this.publisherId,
-            this.profileId,
-            this.adUnitId
-        );
+        this.instanceId = POBAdManager.generateInstanceId();
+        if (gamConfig) {
+            POBRNRewardedAdModule.createGamAdInstance(
+                this.instanceId,
+                this.publisherId,
+                this.profileId,
+                this.adUnitId,
+                JSON.stringify(gamConfig)
+            );
+        } else {
+            POBRNRewardedAdModule.createAdInstance(
+                this.instanceId,
+                this.publisherId,
+                this.profileId,
+                this.adUnitId
+            );
+        }
+        POBAdManager.getInstance().register(this.instanceId, this, destroyNativeAd);
     }
 
+    // Handlers of the ad events, indexed by event id, see POBEvent.
+    private static readonly eventHandlers = eventTable<POBRewardedAd>({
+        [POBEvent.AD_RECEIVED]: (ad, adInfo) => {
+            ad.bid = new POBBid(adInfo, ad);
+            ad.updateLatency(adInfo);
+            ad.listener?.onAdReceived(ad);
+        },
+        [POBEvent.AD_FAILED_TO_LOAD]: (ad, adInfo) => {
+            ad.listener?.onAdFailedToLoad(ad, new POBError(adInfo.errorCode, adInfo.errorMessage));
+        },
+        [POBEvent.AD_FAILED_TO_SHOW]: (ad, adInfo) => {
+            ad.listener?.onAdFailedToShow(ad, new POBError(adInfo.errorCode, adInfo.errorMessage));
+        },
+        [POBEvent.AD_CLICKED]: (ad) => ad.listener?.onAdClicked(ad),
+        [POBEvent.AD_OPENED]: (ad, adInfo) => {
+            ad.updateLatency(adInfo);
+            ad.listener?.onAdOpened(ad);
+        },
+        [POBEvent.AD_CLOSED]: (ad) => ad.listener?.onAdClosed(ad),
+        [POBEvent.AD_EXPIRED]: (ad) => ad.listener?.onAdExpired(ad),
+        [POBEvent.APP_LEAVING]: (ad) => ad.listener?.onAppLeaving(ad),
+        [POBEvent.RECEIVE_REWARD]: (ad, adInfo) => {
+            ad.listener?.onReceiveReward(ad, new POBReward(adInfo.rewardCurrencyType, adInfo.rewardAmount));
+        },
+        [POBEvent.BID_RECEIVED]: (ad, adInfo) => {
+            ad.bid = new POBBid(adInfo, ad);
+            ad.updateLatency(adInfo);
+            ad.bidEventListener?.onBidReceived(ad, ad.bid);
+        },
+        [POBEvent.MEDIATION_OUTCOME]: (ad, adInfo) => {
+            ad.updateLatency(adInfo);
+            ad.bidEventListener?.onMediationOutcome?.(ad, adInfo);
+        },
+        [POBEvent.BID_FAILED]: (ad, adInfo) => {
+            ad.bidEventListener?.onBidFailed(ad, new POBError(adInfo.errorCode, adInfo.errorMessage));
+        },
+    });
+
     /**
-     * Method to receive callback events from native modules
-     * @param eventName event name
+     * Method to Receive callback events from native modules
+     * @param event event id, see POBEvent
      * @param adInfo ad info JSON string
      */
-    onAdEvent(eventName: string, _adInfo: any): void {
-        switch (eventName) {
-            case POBConstants.AD_RECEIVED_EVENT:
-                this.bid = new POBBid(_adInfo, this);
-                this.listener?.onAdReceived(this);
-                break;
-            case POBConstants.AD_FAILED_TO_LOAD_EVENT:
-                var error = new POBError(_adInfo.errorCode, _adInfo.errorMessage);
-                this.listener?.onAdFailedToLoad(this, error);
-                break;
-            case POBConstants.AD_FAILED_TO_SHOW_EVENT:
-                var error = new POBError(_adInfo.errorCode, _adInfo.errorMessage);
-                this.listener?.onAdFailedToShow(this, error);
-                break;
-            case POBConstants.AD_CLICKED_EVENT:
-                this.listener?.onAdClicked(this);
-                break;
-            case POBConstants.AD_OPEN_EVENT:
-                this.listener?.onAdOpened(this);
-                break;
-            case POBConstants.AD_CLOSE_EVENT:
-                this.listener?.onAdClosed(this);
-                break;
-            case POBConstants.AD_EXPIRED_EVENT:
-                this.listener?.onAdExpired(this);
-                break;
-            case POBConstants.APP_LEAVE_EVENT:
-                this.listener?.onAppLeaving(this);
-                break;
-            case POBConstants.RECEIVE_REWARD_EVENT:
-                var reward = new POBReward(_adInfo.rewardCurrencyType, _adInfo.rewardAmount);
-                this.listener?.onReceiveReward(this, reward);
-                break;
-            case POBConstants.BID_RECEIVED:
-                this.bid = new POBBid(_adInfo, this);
-                this.bidEventListener?.onBidReceived(this, this.bid);
-                break;
-            case POBConstants.BID_FAILED:
-                var error = new POBError(_adInfo.errorCode, _adInfo.errorMessage);
-                this.bidEventListener?.onBidFailed(this, error);
-                break;
-            default:
-        }
+    onAdEvent(event: number, adInfo: any): void {
+        POBRewardedAd.eventHandlers[event]?.(this, adInfo);
     }
 
     /**
@@ -149,6 +167,7 @@ export class POBRewardedAd implements POBFullScreenAds, POBFullScreenBidEvent, P
      * check if isReady returns true before calling show().
      */
     show(): void {
+        POBAdManager.getInstance().put(this.instanceId, this);
         POBRNRewardedAdModule.showAd(this.instanceId);
     }
 
@@ -191,6 +210,22 @@ export class POBRewardedAd implements POBFullScreenAds, POBFullScreenBidEvent, P
         return this.bid;
     }
 
+    /**
+     * Get the latencies measured for the latest load and show of this ad. Available only when
+     * enabled with {@link OpenWrapSDK.setLatencyInEventPayloadEnabled}.
+     *
+     * @returns {@link POBAdLatency} if measured else undefined.
+     */
+    getLatency(): POBAdLatency | undefined {
+        return this.latency;
+    }
+
+    private updateLatency(adInfo: any): void {
+        if (adInfo?.latency != undefined) {
+            this.latency = adInfo.latency;
+        }
+    }
+
     /**
      * Setter can be used to set request parameters on {@link POBRewardedAd} object.
      * Call this method before loading the Ad to set the request parameters for the Ad.
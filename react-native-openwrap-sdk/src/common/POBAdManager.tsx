@@ -1,18 +1,61 @@
 import { NativeEventEmitter, NativeModules } from 'react-native';
 import { POBFullScreenAds } from "../ads/POBFullScreenAds";
 import { POBConstants } from './POBConstants';
-const POBRNInterstitialModule = NativeModules.POBRNInterstitialModule;
-const interstitialEventEmitter = new NativeEventEmitter(POBRNInterstitialModule);
-const POBRNRewardedAdModule = NativeModules.POBRNRewardedAdModule;
-const rewardedEventEmitter = new NativeEventEmitter(POBRNRewardedAdModule);
+import { POBEvent } from './POBEventSchema';
+import { decodeAdEvent } from './POBEventPayload';
+import { POBEventRecorder, POBTraceChannel } from './POBEventRecorder';
 
+// Sequence appended to the instance ids, so ads created within the same millisecond stay unique.
+let instanceSequence = 0;
+
+// Whether the JS engine lets the ads be collected, e.g. Hermes does not support FinalizationRegistry.
+const isCollectable = typeof WeakRef !== 'undefined' && typeof FinalizationRegistry !== 'undefined';
+
+// Events ending the load or the show of an ad, after which it is no longer kept alive.
+const SETTLING_EVENTS: ReadonlySet<number> = new Set([
+    POBEvent.AD_RECEIVED,
+    POBEvent.AD_FAILED_TO_LOAD,
+    POBEvent.AD_FAILED_TO_SHOW,
+    POBEvent.AD_CLOSED,
+    POBEvent.BID_FAILED,
+]);
+
+/**
+ * Reference to an ad stored in the AdManager map.
+ */
+type AdRef = { deref(): POBFullScreenAds | undefined };
 
 /**
- *  Ad Manager class to store ad instances of OW ads
+ * Details needed to destroy the native ad once its JS object was collected.
+ */
+type NativeAd = { instanceId: string, destroyNative: (instanceId: string) => void };
+
+
+/**
+ *  Ad Manager class to store ad instances of OW ads.
+ *
+ *  Ads are referenced weakly, so an ad dropped by the app without calling destroy() is collected
+ *  and its native ad destroyed. An ad is kept alive while its load or show is in progress, so
+ *  that its events still reach its listener. Where the JS engine lacks WeakRef or
+ *  FinalizationRegistry, ads are referenced strongly until destroy() is called.
  */
 export class POBAdManager {
 
-    private instanceMap: Map<string, POBFullScreenAds>
+    private instanceMap: Map<string, AdRef>
+
+    // Ads kept alive while their load or show is in progress.
+    private pendingAds: Map<string, POBFullScreenAds>
+
+    // Unregister tokens of the ads registered for the native cleanup, by instance id.
+    private registrations: Map<string, object>
+
+    private registry?: FinalizationRegistry<NativeAd>
+
+    // Instance ids of the registered ads, not keeping them alive.
+    private instanceIds: WeakMap<POBFullScreenAds, string>
+
+    // Observers of the events of an ad, notified before the ad itself, by instance id.
+    private observers: Map<string, (event: number, adInfo: any) => void>
 
     private static instance: POBAdManager | null = null;
 
@@ -27,34 +70,81 @@ export class POBAdManager {
         return POBAdManager.instance;
     }
 
+    /**
+     * Generates a unique identifier for a new full screen ad instance.
+     * @returns unique instance id
+     */
+    static generateInstanceId(): string {
+        return `${new Date().getTime()}_${instanceSequence++}`;
+    }
+
     /**
      * Constructor
      */
     private constructor() {
         this.instanceMap = new Map();
+        this.pendingAds = new Map();
+        this.registrations = new Map();
+        this.observers = new Map();
+        this.instanceIds = new WeakMap();
+        if (isCollectable) {
+            this.registry = new FinalizationRegistry((nativeAd: NativeAd) => this.onAdCollected(nativeAd));
+        }
+        // Created with the first ad rather than on import, so an app never showing a full screen ad
+        // does not create the native modules.
+        const interstitialEventEmitter = new NativeEventEmitter(NativeModules.POBRNInterstitialModule);
+        const rewardedEventEmitter = new NativeEventEmitter(NativeModules.POBRNRewardedAdModule);
         interstitialEventEmitter.addListener(POBConstants.INTERSTITIAL_AD_EVENT_KEY, (adInfo: string) => {
+            POBEventRecorder.recordFullScreenEvent(POBTraceChannel.INTERSTITIAL, adInfo);
             this.notifyOnAdEvent(adInfo);
         })
         rewardedEventEmitter.addListener(POBConstants.REWARDED_AD_EVENT_KEY, (adInfo: string) => {
+            POBEventRecorder.recordFullScreenEvent(POBTraceChannel.REWARDED, adInfo);
             this.notifyOnAdEvent(adInfo);
         })
     }
 
-    private notifyOnAdEvent(adInfo: string) {
-        var adInfoJson = JSON.parse(adInfo);
-        if (this.instanceMap.has(adInfoJson.instanceId)) {
-            var ad = this.instanceMap.get(adInfoJson.instanceId)
+    private notifyOnAdEvent(payload: string) {
+        const { instanceId, event, ext } = decodeAdEvent(payload);
+        this.observers.get(instanceId)?.(event, ext);
+        if (this.instanceMap.has(instanceId)) {
+            var ad = this.instanceMap.get(instanceId)?.deref()
+            if (SETTLING_EVENTS.has(event)) {
+                this.pendingAds.delete(instanceId);
+            }
             if (ad != null) {
-                ad.onAdEvent(adInfoJson.eventName, adInfoJson.ext);
+                ad.onAdEvent(event, ext);
             }
         }
     }
 
+    private onAdCollected(nativeAd: NativeAd) {
+        this.instanceMap.delete(nativeAd.instanceId);
+        this.registrations.delete(nativeAd.instanceId);
+        this.observers.delete(nativeAd.instanceId);
+        nativeAd.destroyNative(nativeAd.instanceId);
+    }
+
+    /**
+     *  Method to register a newly created ad, so that its native ad is destroyed once the ad is
+     *  collected without destroy() being called.
+     *  @param destroyNative destroys the native ad of the given instance id, it must not reference the ad
+     */
+    register(instanceId: string, ad: POBFullScreenAds, destroyNative: (instanceId: string) => void): void {
+        this.instanceIds.set(ad, instanceId);
+        if (this.registry) {
+            const token = {};
+            this.registrations.set(instanceId, token);
+            this.registry.register(ad, { instanceId, destroyNative }, token);
+        }
+    }
+
     /**
-     *  Method to put ad object in AdManager map
+     *  Method to put ad object in AdManager map, keeping it alive until its load or show ends.
      */
     put(instanceId: string, ad: POBFullScreenAds): void {
-        this.instanceMap.set(instanceId, ad)
+        this.instanceMap.set(instanceId, isCollectable ? new WeakRef(ad) : { deref: () => ad });
+        this.pendingAds.set(instanceId, ad);
     }
 
     /**
@@ -62,6 +152,48 @@ export class POBAdManager {
      */
     remove(instanceId: string): void {
         this.instanceMap.delete(instanceId);
+        this.pendingAds.delete(instanceId);
+        this.observers.delete(instanceId);
+        const token = this.registrations.get(instanceId);
+        if (token) {
+            this.registry?.unregister(token);
+            this.registrations.delete(instanceId);
+        }
+    }
+
+    /**
+     *  Method to observe the events of an ad put in AdManager map, e.g. to record them while no
+     *  listener is set. An ad has at most one observer, the observer is notified before the ad.
+     *  @param observer the observer, undefined to stop observing
+     *  @returns false if the ad is not in AdManager map
+     */
+    observe(ad: POBFullScreenAds, observer?: (event: number, adInfo: any) => void): boolean {
+        for (const [instanceId, ref] of this.instanceMap) {
+            if (ref.deref() === ad) {
+                if (observer) {
+                    this.observers.set(instanceId, observer);
+                } else {
+                    this.observers.delete(instanceId);
+                }
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     *  Method to get the instance id of a registered ad
+     *  @returns undefined if the ad was not registered
+     */
+    instanceIdOf(ad: POBFullScreenAds): string | undefined {
+        return this.instanceIds.get(ad);
+    }
+
+    /**
+     *  Method to get the number of ad objects in AdManager map
+     */
+    size(): number {
+        return this.instanceMap.size;
     }
 
 }
\ No newline at end of file
@@ -0,0 +1,65 @@
+import { POBEventKey, POB_EVENT_COUNT, POB_EVENT_KEY_NAMES } from './POBEventSchema';
+
+/**
+ * A full screen ad event received from the native layers.
+ */
+export type POBAdEvent = { instanceId: string; event: number; ext: any };
+
+/**
+ * Handler of an event of the given ad class.
+ */
+export type POBAdEventHandler<T> = (ad: T, adInfo: any) => void;
+
+// Codes of the ext keys, by key name.
+const keyCodes = new Map(Array.from(POB_EVENT_KEY_NAMES, ([code, name]) => [name, code]));
+
+const ignoreEvent = () => {};
+
+/**
+ * Decodes the payload of a full screen ad event, restoring the names of the top level ext keys.
+ * Unknown keys are kept as is.
+ *
+ * @param payload event payload JSON string, see POBEventSchema
+ */
+export function decodeAdEvent(payload: string): POBAdEvent {
+  const json = JSON.parse(payload);
+  const compactExt = json[POBEventKey.EXT];
+  let ext: any;
+  if (compactExt != null) {
+    ext = {};
+    for (const code in compactExt) {
+      ext[POB_EVENT_KEY_NAMES.get(code) ?? code] = compactExt[code];
+    }
+  }
+  return { instanceId: json[POBEventKey.INSTANCE_ID], event: json[POBEventKey.EVENT], ext };
+}
+
+/**
+ * Encodes a full screen ad event the way the native layers do, e.g. to emit events from a fake
+ * native module.
+ */
+export function encodeAdEvent(instanceId: string, event: number, ext?: any): string {
+  const json: any = { [POBEventKey.INSTANCE_ID]: instanceId, [POBEventKey.EVENT]: event };
+  if (ext != null) {
+    const compactExt: any = {};
+    for (const name in ext) {
+      compactExt[keyCodes.get(name) ?? name] = ext[name];
+    }
+    json[POBEventKey.EXT] = compactExt;
+  }
+  return JSON.stringify(json);
+}
+
+/**
+ * Builds the dense jump table dispatching the events of an ad class: the handler of an event is
+ * at the index of its id, the events without handler are ignored.
+ *
+ * @param handlers handlers of the ad class, by event id
+ */
+export function eventTable<T>(handlers: { [event: number]: POBAdEventHandler<T> }): readonly POBAdEventHandler<T>[] {
+  const table: POBAdEventHandler<T>[] = [];
+  for (let event = 0; event < POB_EVENT_COUNT; event++) {
+    table.push(handlers[event] ?? ignoreEvent);
+  }
+  return table;
+}
@@ -0,0 +1,64 @@
+/**
+ * Channel of a recorded native event.
+ */
+export const POBTraceChannel = {
+  INTERSTITIAL: 0,
+  REWARDED: 1,
+  BANNER: 2,
+} as const;
+
+/**
+ * A recorded native event, with its offset in ms from the start of the recording:
+ * - full screen ads: `[offsetMs, channel, payload]`, the payload as emitted, see POBEventSchema.
+ * - banners: `[offsetMs, channel, banner, eventName, nativeEvent]`, the banner being numbered in
+ *   creation order.
+ */
+export type POBTraceEvent =
+  | [offsetMs: number, channel: 0 | 1, payload: string]
+  | [offsetMs: number, channel: 2, banner: number, eventName: string, nativeEvent: any];
+
+/**
+ * Trace of the native events received by the JS layer, replayed by the jest harness
+ * (src/__tests__/harness/POBReplayHarness.test.tsx).
+ */
+export type POBEventTrace = { version: 1; events: POBTraceEvent[] };
+
+let events: POBTraceEvent[] | undefined;
+let startTime = 0;
+
+/**
+ * Records the native event streams, as received by the JS layer: the full screen ad events
+ * dispatched by POBAdManager and the direct events of the banners. Nothing is recorded, and the
+ * hooks cost a single check, until {@link start} is called.
+ */
+export class POBEventRecorder {
+  /**
+   * Starts a new recording, discarding the events recorded so far.
+   */
+  static start(): void {
+    events = [];
+    startTime = Date.now();
+  }
+
+  /**
+   * Stops the recording.
+   * @returns the recorded trace, empty if the recording was not started
+   */
+  static stop(): POBEventTrace {
+    const trace: POBEventTrace = { version: 1, events: events ?? [] };
+    events = undefined;
+    return trace;
+  }
+
+  static isRecording(): boolean {
+    return events !== undefined;
+  }
+
+  static recordFullScreenEvent(channel: 0 | 1, payload: string): void {
+    events?.push([Date.now() - startTime, channel, payload]);
+  }
+
+  static recordBannerEvent(banner: number, eventName: string, nativeEvent: any): void {
+    events?.push([Date.now() - startTime, POBTraceChannel.BANNER, banner, eventName, nativeEvent]);
+  }
+}
@@ -0,0 +1,92 @@
+// Generated by scripts/generate-event-schema.js from scripts/event-schema.json, do not edit.
+
+/**
+ * Ids of the full screen ad events, shared with the native layers. An event is emitted as
+ * `{"i": instanceId, "e": event id, "x": ext}`, the top level keys of the ext being replaced by
+ * their codes.
+ */
+export const POBEvent = {
+  /** The ad is received. */
+  AD_RECEIVED: 0,
+  /** The ad failed to load. */
+  AD_FAILED_TO_LOAD: 1,
+  /** The ad failed to show. */
+  AD_FAILED_TO_SHOW: 2,
+  /** The ad is clicked. */
+  AD_CLICKED: 3,
+  /** The ad is presented in full screen. */
+  AD_OPENED: 4,
+  /** The ad is dismissed. */
+  AD_CLOSED: 5,
+  /** The received ad expired. */
+  AD_EXPIRED: 6,
+  /** The app goes to the background after a click. */
+  APP_LEAVING: 7,
+  /** The user earned the reward of a rewarded ad. */
+  RECEIVE_REWARD: 8,
+  /** The video of the ad played until its end. */
+  VIDEO_PLAYBACK_COMPLETED: 9,
+  /** The OpenWrap bid is received, waiting for proceedToLoadAd or proceedOnError. */
+  BID_RECEIVED: 10,
+  /** No OpenWrap bid is received. */
+  BID_FAILED: 11,
+  /** The native mediation rule decided on the OpenWrap bid. */
+  MEDIATION_OUTCOME: 12,
+} as const;
+
+export type POBEventId = (typeof POBEvent)[keyof typeof POBEvent];
+
+/** Number of events, the ids are in [0, POB_EVENT_COUNT). */
+export const POB_EVENT_COUNT = 13;
+
+/** Names of the events, by event id. */
+export const POB_EVENT_NAMES: readonly string[] = [
+  'onAdReceived',
+  'onAdFailedToLoad',
+  'onAdFailedToShow',
+  'onAdClicked',
+  'onAdOpened',
+  'onAdClosed',
+  'onAdExpired',
+  'onAppLeaving',
+  'onReceiveReward',
+  'onVideoPlaybackCompleted',
+  'onBidReceived',
+  'onBidFailed',
+  'onMediationOutcome',
+];
+
+/** Keys of the event payload envelope. */
+export const POBEventKey = {
+  INSTANCE_ID: 'i',
+  EVENT: 'e',
+  EXT: 'x',
+} as const;
+
+/** Names of the ext keys, by code. */
+export const POB_EVENT_KEY_NAMES: ReadonlyMap<string, string> = new Map([
+  ['c', 'errorCode'],
+  ['m', 'errorMessage'],
+  ['p', 'price'],
+  ['g', 'grossPrice'],
+  ['t', 'targeting'],
+  ['w', 'width'],
+  ['h', 'height'],
+  ['ct', 'crType'],
+  ['pn', 'partnerName'],
+  ['b', 'bidId'],
+  ['im', 'impressionId'],
+  ['bu', 'bundle'],
+  ['s', 'status'],
+  ['ci', 'creativeId'],
+  ['nu', 'nurl'],
+  ['lu', 'lurl'],
+  ['cr', 'creative'],
+  ['d', 'dealId'],
+  ['ri', 'refreshInterval'],
+  ['ra', 'rewardAmount'],
+  ['rc', 'rewardCurrencyType'],
+  ['l', 'latency'],
+  ['wo', 'won'],
+  ['r', 'reason'],
+]);
@@ -0,0 +1,35 @@
+import { NativeModules, Platform } from 'react-native';
+
+/**
+ * Returns the native module of the given name, resolved on its first use instead of when the
+ * package is imported. Resolving a native module may create it on the native side and read its
+ * constants, which would otherwise add to the app startup even if no ad is ever shown.
+ * Using the returned module throws a linking error if the native module is missing.
+ * @param name name of the native module
+ * @returns the native module, resolved lazily
+ */
+export function lazyNativeModule(name: string): any {
+    let nativeModule: any;
+    return new Proxy(
+        {},
+        {
+            get(_target, property) {
+                if (nativeModule == null) {
+                    nativeModule = NativeModules[name];
+                    if (nativeModule == null) {
+                        throw new Error(linkingError());
+                    }
+                }
+                const value = nativeModule[property];
+                return typeof value === 'function' ? value.bind(nativeModule) : value;
+            },
+        }
+    );
+}
+
+function linkingError(): string {
+    return `The package 'react-native-openwrap-sdk' doesn't seem to be linked. Make sure: \n\n` +
+        Platform.select({ ios: "- You have run 'pod install'\n", default: '' }) +
+        '- You rebuilt the app after installing the package\n' +
+        '- You are not using Expo Go\n';
+}
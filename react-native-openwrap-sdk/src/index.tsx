@@ -11,6 +11,25 @@ export { POBRequest } from './models/POBRequest';
 export { POBImpression } from './models/POBImpression';
 export { POBBid } from './models/POBBid';
 export { POBBidError } from './models/POBBidError';
+export type { POBAdLatency } from './models/POBAdLatency';
+export type { POBLatencyStats } from './models/POBLatencyStats';
+export type { POBSDKConfig } from './models/POBSDKConfig';
+export type { POBMediationRule } from './models/POBMediationRule';
+export type { POBMediationOutcome } from './models/POBMediationOutcome';
+export type { POBGamConfig } from './models/POBGamConfig';
+export type { POBRequestCoalescingStats } from './models/POBRequestCoalescingStats';
+export type { POBMediaCacheStats } from './models/POBMediaCacheStats';
+export type { POBNoticeStats } from './models/POBNoticeStats';
+export type {
+  POBBidLandscapeSummary,
+  POBPartnerWinRate,
+  POBAdUnitPriceStats,
+} from './models/POBBidLandscapeSummary';
+export type { POBPreloadStats, POBAdUnitPreloadStats } from './models/POBPreloadStats';
+export type { POBBannerRefreshStats, POBRadioUsage } from './models/POBBannerRefreshStats';
+export type { POBFullScreenArbitrationStats } from './models/POBFullScreenArbitrationStats';
+export type { POBAdSessionStats } from './models/POBAdSessionStats';
+export type { POBEventTrace, POBTraceEvent } from './common/POBEventRecorder';
 
 // Export interstitial ad classes
 export { POBInterstitial } from './ads/POBInterstitial';
@@ -24,6 +43,12 @@ export { POBRewardedAdListener } from './ads/POBRewardedAdListener';
 // Export POBBannerView component
 export { POBBannerView } from './ads/POBBannerView';
 
+// Export POBAdSession to scope the ads to the screens
+export { POBAdSession } from './ads/POBAdSession';
+
+// Export POBFullScreenAdGroup to show the best ready ad of a group
+export { POBFullScreenAdGroup } from './ads/POBFullScreenAdGroup';
+
 // Export POBBidEventListener to use 'get bid price'  feature
 export { POBBidEventListener } from './ads/POBBidEventListener';
 export { POBBidEvent } from './ads/POBBidEvent';
@@ -0,0 +1,54 @@
+/**
+ * Latencies measured natively for the latest load and show of an ad, in milliseconds. Only the
+ * metrics applicable to the ad format and its configuration are available.
+ * Attached to the ad events once enabled with {@link OpenWrapSDK.setLatencyInEventPayloadEnabled}.
+ */
+export type POBAdLatency = {
+  /**
+   * From loadAd() to the bid received event. Available when a bid event listener is set.
+   */
+  loadToBid?: number;
+
+  /**
+   * From the bid received event to the ad received event. Available when a bid event listener is set.
+   */
+  bidToAdReceived?: number;
+
+  /**
+   * From loadAd() to the ad received event.
+   */
+  loadToAdReceived?: number;
+
+  /**
+   * From show() to the ad opened event. Full screen ads only.
+   */
+  showToOpened?: number;
+
+  /**
+   * From loadAd() to the first frame rendered with the ad. Banner ads only, recorded in
+   * {@link OpenWrapSDK.getLatencyStats} as it happens after the ad received event.
+   */
+  loadToFirstFrame?: number;
+
+  /**
+   * From loadAd() to the GAM request, i.e. the wait on the OpenWrap auction. GAM ads only.
+   */
+  loadToAdServerRequest?: number;
+
+  /**
+   * From the GAM request to the ad received event. GAM ads only.
+   */
+  adServerRequestToAdReceived?: number;
+
+  /**
+   * From the banner load request to the start of its load, queued as per
+   * {@link OpenWrapSDK.setMaxConcurrentBannerLoads}. Banner ads only.
+   */
+  queueWait?: number;
+
+  /**
+   * From the banner load request to the received ad being visible on screen. Banner ads only,
+   * recorded in {@link OpenWrapSDK.getLatencyStats} as it happens after the ad received event.
+   */
+  requestToFirstVisible?: number;
+};
@@ -0,0 +1,35 @@
+/**
+ * Prefetch stats of the {@link POBAdSession}s, accumulated since the stats were reset.
+ */
+export type POBAdSessionStats = {
+  /**
+   * Number of ads prefetched for a declared next screen.
+   */
+  prefetched: number;
+
+  /**
+   * Number of prefetched ads handed over already received.
+   */
+  hits: number;
+
+  /**
+   * Number of prefetched ads handed over while still loading.
+   */
+  loadingHits: number;
+
+  /**
+   * Number of ads created and loaded on their screen, not served by a prefetched ad.
+   */
+  misses: number;
+
+  /**
+   * Number of prefetched ads destroyed without being handed over: the user did not navigate to the
+   * declared screen in time, or their load failed or their bid expired first.
+   */
+  wasted: number;
+
+  /**
+   * Share of the ads of the screens served by a prefetched ad, from 0 to 1.
+   */
+  hitRate: number;
+};
@@ -1,4 +1,5 @@
 import { POBAdSize } from './POBAdSize';
+import type { POBGamConfig } from './POBGamConfig';
 import { POBImpression } from './POBImpression';
 import { POBRequest } from './POBRequest';
 /**
@@ -12,4 +13,5 @@ export interface POBAdUnitDetails {
   request?: POBRequest;
   impression?: POBImpression;
   enableGetBidPrice?: number;
+  gam?: POBGamConfig;
 }
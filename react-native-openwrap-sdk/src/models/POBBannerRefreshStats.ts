@@ -0,0 +1,40 @@
+/**
+ * Banner requests and estimated cellular radio usage of one refresh mode.
+ */
+export type POBRadioUsage = {
+  /**
+   * Number of banner ad requests, i.e. loads and refreshes.
+   */
+  requests: number;
+
+  /**
+   * Number of requests which woke the radio up, i.e. not within the radio tail of a previous one.
+   */
+  wakeUps: number;
+
+  /**
+   * Estimated time the radio stayed in its high power state, assuming a 10 seconds tail per request.
+   */
+  radioActiveMillis: number;
+
+  /**
+   * Time spent in this mode since the stats were reset.
+   */
+  elapsedMillis: number;
+};
+
+/**
+ * Banner refresh stats, accumulated natively across all the banners, without and with the
+ * refresh alignment, so that both can be compared.
+ */
+export type POBBannerRefreshStats = {
+  /**
+   * Usage while every banner refreshes on its own timer.
+   */
+  uncoordinated: POBRadioUsage;
+
+  /**
+   * Usage while the banner refreshes are aligned.
+   */
+  coordinated: POBRadioUsage;
+};
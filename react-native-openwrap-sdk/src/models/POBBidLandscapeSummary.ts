@@ -0,0 +1,79 @@
+/**
+ * Win rate of a bidding partner, computed from the recorded auction outcomes.
+ */
+export type POBPartnerWinRate = {
+  /**
+   * Name of the partner, null if it could not be recorded.
+   */
+  partnerName: string | null;
+
+  /**
+   * Number of auctions in which the partner returned the bid.
+   */
+  bids: number;
+
+  /**
+   * Number of bids of the partner which were rendered.
+   */
+  wins: number;
+
+  /**
+   * Ratio of the wins to the bids, between 0 and 1.
+   */
+  winRate: number;
+};
+
+/**
+ * Price distribution of an ad unit, computed from the recorded auction outcomes.
+ */
+export type POBAdUnitPriceStats = {
+  /**
+   * Ad unit id, null if it could not be recorded.
+   */
+  adUnitId: string | null;
+
+  /**
+   * Number of recorded auctions of the ad unit.
+   */
+  auctions: number;
+
+  /**
+   * Number of auctions of the ad unit which returned no bid.
+   */
+  noBids: number;
+
+  /**
+   * Median price of the bids received by the ad unit.
+   */
+  priceP50: number;
+
+  /**
+   * 90th percentile of the price of the bids received by the ad unit.
+   */
+  priceP90: number;
+
+  /**
+   * 99th percentile of the price of the bids received by the ad unit.
+   */
+  priceP99: number;
+};
+
+/**
+ * Summary of the auction outcomes retained by the native bid landscape log.
+ */
+export type POBBidLandscapeSummary = {
+  /**
+   * Number of auction outcomes retained by the log.
+   */
+  rows: number;
+
+  /**
+   * Win rate of each partner.
+   */
+  partners: POBPartnerWinRate[];
+
+  /**
+   * Price percentiles of each ad unit.
+   */
+  adUnits: POBAdUnitPriceStats[];
+};
@@ -0,0 +1,46 @@
+/**
+ * Banner activity held back while the interstitial and rewarded ads were showing, accumulated
+ * natively since the stats were reset.
+ */
+export type POBFullScreenArbitrationStats = {
+  /**
+   * Number of shows, overlapping full screen ads count as one show.
+   */
+  shows: number;
+
+  /**
+   * Total time the full screen ads were showing.
+   */
+  showMillis: number;
+
+  /**
+   * Number of banners paused when a show started.
+   */
+  suspendedBanners: number;
+
+  /**
+   * Number of banner refreshes which fell due during the shows.
+   */
+  suppressedRefreshes: number;
+
+  /**
+   * Number of queued banner loads still deferred when the shows ended.
+   */
+  deferredLoads: number;
+
+  /**
+   * Number of banners refreshed right away when a show ended, as their refresh fell due meanwhile.
+   */
+  caughtUpBanners: number;
+
+  /**
+   * Average size of the banner ad responses, in bytes.
+   */
+  averageResponseBytes: number;
+
+  /**
+   * Estimated bandwidth freed for the full screen ads: the suppressed refreshes and deferred loads
+   * times the average response size. The creative assets are not counted, so it is a lower bound.
+   */
+  estimatedBytesFreed: number;
+};
@@ -0,0 +1,25 @@
+import type { OpenWrapSDK } from '../OpenWrapSDK';
+
+/**
+ * GAM header bidding details of an ad unit. The ad is loaded through the OpenWrap GAM event
+ * handler, which needs to be included in the app, see {@link OpenWrapSDK.isGamSupported}.
+ * Otherwise the ad is loaded from OpenWrap only.
+ */
+export type POBGamConfig = {
+  /**
+   * The GAM ad unit id.
+   */
+  adUnitId: string;
+
+  /**
+   * Custom targeting applied natively on the GAM request, along with the OpenWrap targeting.
+   */
+  customTargeting?: { [key: string]: string | string[] };
+
+  /**
+   * Maximum time in milliseconds to wait for the OpenWrap bid before the GAM request is sent.
+   * Applied as the network timeout of the OpenWrap request, rounded up to seconds. The network
+   * timeout set on the request parameters takes precedence.
+   */
+  owTimeoutMs?: number;
+};
@@ -10,6 +10,13 @@ export class POBImpression {
 
   private customParams?: string;
 
+  /**
+   * Id of the impression template, registered with {@link OpenWrapSDK.registerImpressionTemplate},
+   * to apply to the Ad impression. The other parameters set on this impression override the
+   * template, the {@link adPosition} of this impression always applies.
+   */
+  templateId?: string;
+
   /**
    * Custom parameters in the form of a Map. To set multiple values against same key, use array. Only use list of string as values.
    */
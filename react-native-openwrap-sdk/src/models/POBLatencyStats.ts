@@ -0,0 +1,45 @@
+/**
+ * Latency percentiles of one metric for one placement, accumulated natively across all the ad
+ * instances of the same ad format and ad unit id. All the values are in milliseconds.
+ */
+export type POBLatencyStats = {
+  /**
+   * Ad format of the placement, one of 'banner', 'interstitial' or 'rewarded'.
+   */
+  adFormat: string;
+
+  /**
+   * Ad unit id of the placement.
+   */
+  adUnitId: string;
+
+  /**
+   * Measured metric, one of the {@link POBAdLatency} keys.
+   */
+  metric: string;
+
+  /**
+   * Number of recorded values.
+   */
+  count: number;
+
+  /**
+   * Median latency.
+   */
+  p50: number;
+
+  /**
+   * 90th percentile latency.
+   */
+  p90: number;
+
+  /**
+   * 99th percentile latency.
+   */
+  p99: number;
+
+  /**
+   * Highest recorded latency.
+   */
+  max: number;
+};
@@ -0,0 +1,41 @@
+/**
+ * Counters of the native video media prefetch, accumulated across all the interstitial and
+ * rewarded ad instances. The OpenWrap SDK player downloads the media file again when the ad
+ * plays, so these counters describe the prefetch traffic only, none of it being saved.
+ */
+export type POBMediaCacheStats = {
+  /**
+   * Number of media files prefetched after a video ad was received.
+   */
+  prefetches: number;
+
+  /**
+   * Number of prefetches of a media file which was already cached, thus not downloaded again.
+   */
+  alreadyCached: number;
+
+  /**
+   * Number of prefetches which downloaded the media file.
+   */
+  downloads: number;
+
+  /**
+   * Number of prefetches skipped because the network was metered.
+   */
+  skippedMetered: number;
+
+  /**
+   * Number of failed downloads.
+   */
+  failures: number;
+
+  /**
+   * Bytes downloaded by the prefetches.
+   */
+  bytesDownloaded: number;
+
+  /**
+   * Current size of the cached files in bytes.
+   */
+  cachedBytes: number;
+};
@@ -0,0 +1,40 @@
+import type { POBAdLatency } from './POBAdLatency';
+import type { POBBidError } from './POBBidError';
+import type { POBMediationRule } from './POBMediationRule';
+
+/**
+ * Outcome of a {@link POBMediationRule} evaluated natively on bid received.
+ */
+export type POBMediationOutcome = {
+  /**
+   * True if the OpenWrap bid won and the ad proceeds to load, false if it proceeded on error.
+   */
+  won: boolean;
+
+  /**
+   * Reason of the outcome, one of 'won', 'bidExpired', 'bidStatus', 'maxWaitExceeded',
+   * 'partnerNotAllowed' and 'belowFloor'.
+   */
+  reason: string;
+
+  /**
+   * The {@link POBBidError.POBBidErrorCode} the ad proceeded on error with, when lost.
+   */
+  errorCode?: POBBidError.POBBidErrorCode;
+
+  /**
+   * Price of the OpenWrap bid.
+   */
+  price: number;
+
+  /**
+   * Partner name of the OpenWrap bid.
+   */
+  partnerName?: string;
+
+  /**
+   * Latencies measured so far, available only when enabled with
+   * OpenWrapSDK.setLatencyInEventPayloadEnabled.
+   */
+  latency?: POBAdLatency;
+};
@@ -0,0 +1,31 @@
+import type { OpenWrapSDK } from '../OpenWrapSDK';
+
+/**
+ * In-house mediation rule of a placement, registered with {@link OpenWrapSDK.setMediationRule}.
+ * The rule is evaluated natively when the OpenWrap bid is received, so that the ad proceeds to
+ * load, or to error, without waiting for JS. Every property is optional.
+ */
+export type POBMediationRule = {
+  /**
+   * Minimum bid price for the OpenWrap bid to win.
+   */
+  floor?: number;
+
+  /**
+   * Minimum bid price per partner name, overriding {@link floor} for that partner.
+   */
+  partnerFloors?: { [partnerName: string]: number };
+
+  /**
+   * Partners allowed to win, in any order. A bid of any other partner loses.
+   * All the partners are allowed when empty or omitted.
+   */
+  allowedPartners?: string[];
+
+  /**
+   * Maximum time in milliseconds from loadAd() to the bid. It is checked once the bid is received:
+   * a bid received later loses. It is not a timeout, the bid is still awaited as long as the SDK
+   * waits for it. Not applied when 0 or omitted.
+   */
+  maxWaitMs?: number;
+};
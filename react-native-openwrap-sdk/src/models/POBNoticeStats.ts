@@ -0,0 +1,49 @@
+/**
+ * Counters of the native win and loss notice queue, accumulated across all the ad instances.
+ */
+export type POBNoticeStats = {
+  /**
+   * Number of notices waiting to be delivered.
+   */
+  queueDepth: number;
+
+  /**
+   * Number of notices queued.
+   */
+  enqueued: number;
+
+  /**
+   * Number of notices delivered.
+   */
+  delivered: number;
+
+  /**
+   * Number of failed notice requests scheduled for a retry.
+   */
+  retries: number;
+
+  /**
+   * Number of notices dropped, e.g. rejected by the server, out of attempts or expired.
+   */
+  dropped: number;
+
+  /**
+   * Number of notices queued by a previous session and restored from disk.
+   */
+  restored: number;
+
+  /**
+   * Median delay from the queueing to the delivery of a notice in milliseconds.
+   */
+  latencyP50Millis: number;
+
+  /**
+   * 95th percentile of the delay from the queueing to the delivery of a notice in milliseconds.
+   */
+  latencyP95Millis: number;
+
+  /**
+   * Maximum delay from the queueing to the delivery of a notice in milliseconds.
+   */
+  latencyMaxMillis: number;
+};
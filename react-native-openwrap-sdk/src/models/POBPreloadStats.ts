@@ -0,0 +1,74 @@
+/**
+ * Preload stats of a full screen ad unit, with what the native preload scheduler learned of it.
+ */
+export type POBAdUnitPreloadStats = {
+  /**
+   * Ad unit id.
+   */
+  adUnitId: string;
+
+  /**
+   * Number of loads called.
+   */
+  loads: number;
+
+  /**
+   * Number of loads deferred by the scheduler.
+   */
+  deferredLoads: number;
+
+  /**
+   * Number of ads received.
+   */
+  received: number;
+
+  /**
+   * Number of ads shown.
+   */
+  shown: number;
+
+  /**
+   * Number of ads received which expired before being shown, each a wasted auction.
+   */
+  wastedAuctions: number;
+
+  /**
+   * Creative bytes of the ads which expired before being shown.
+   */
+  wastedBytes: number;
+
+  /**
+   * Ratio of the ads shown to the ads received.
+   */
+  showRate: number;
+
+  /**
+   * Moving average of the received ads which expired before being shown, between 0 and 1.
+   */
+  expiryRate: number;
+
+  /**
+   * Moving average of the time from the load call to the show of an ad, in milliseconds.
+   */
+  loadToShowMillis: number;
+
+  /**
+   * Moving average of the time from the receipt to the expiry of an ad, in milliseconds.
+   */
+  validityMillis: number;
+
+  /**
+   * Whether the loads of the ad unit wait while one of its ads is received and not shown yet.
+   */
+  throttled: boolean;
+};
+
+/**
+ * Stats of the native preload scheduler, per full screen ad unit.
+ */
+export type POBPreloadStats = {
+  /**
+   * Stats of each ad unit loaded.
+   */
+  adUnits: POBAdUnitPreloadStats[];
+};
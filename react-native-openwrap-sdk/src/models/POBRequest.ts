@@ -39,4 +39,10 @@ export class POBRequest {
    * Maximum network timeout for Ad request.
    */
   networkTimeout?: number;
+
+  /**
+   * Id of the request template, registered with {@link OpenWrapSDK.registerRequestTemplate}, to
+   * apply to the Ad request. The other parameters set on this request override the template.
+   */
+  templateId?: string;
 }
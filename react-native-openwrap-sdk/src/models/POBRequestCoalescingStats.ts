@@ -0,0 +1,46 @@
+/**
+ * Request coalescing counters of one ad unit, accumulated natively across all its ad instances.
+ * Identical loads, i.e. with the same publisher id, profile id, ad unit id, request and
+ * impression parameters, are coalesced instead of starting concurrent auctions.
+ */
+export type POBRequestCoalescingStats = {
+  /**
+   * Ad unit id.
+   */
+  adUnitId: string;
+
+  /**
+   * Number of auctions started.
+   */
+  auctions: number;
+
+  /**
+   * Number of full screen loads queued behind an identical load in flight.
+   */
+  queued: number;
+
+  /**
+   * Number of auctions avoided, in total.
+   */
+  avoided: number;
+
+  /**
+   * Number of auctions avoided, per reason.
+   */
+  avoidedByReason: {
+    /**
+     * Loads of an ad which was already loading.
+     */
+    duplicate: number;
+
+    /**
+     * Queued full screen loads which failed with the no fill of the load they were queued behind.
+     */
+    sharedNoFill: number;
+
+    /**
+     * Banner loads adopted from a banner unmounted while loading the same ad, e.g. on a remount.
+     */
+    adopted: number;
+  };
+};
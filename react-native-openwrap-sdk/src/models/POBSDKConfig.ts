@@ -0,0 +1,66 @@
+import type { OpenWrapSDK } from '../OpenWrapSDK';
+import type { POBApplicationInfo } from './POBApplicationInfo';
+import type { POBLocation } from './POBLocation';
+import type { POBUserInfo } from './POBUserInfo';
+
+/**
+ * Global configuration of the OpenWrap SDK, applied in one native call by
+ * {@link OpenWrapSDK.configure}. Every property is optional and mirrors the individual
+ * OpenWrapSDK setter of the same name; omitted properties are left unchanged.
+ */
+export type POBSDKConfig = {
+  /**
+   * See {@link OpenWrapSDK.setLogLevel}
+   */
+  logLevel?: OpenWrapSDK.LogLevel;
+
+  /**
+   * See {@link OpenWrapSDK.allowLocationAccess}
+   */
+  allowLocationAccess?: boolean;
+
+  /**
+   * See {@link OpenWrapSDK.setCoppa}
+   */
+  coppa?: boolean;
+
+  /**
+   * See {@link OpenWrapSDK.setSSLEnabled}
+   */
+  sslEnabled?: boolean;
+
+  /**
+   * See {@link OpenWrapSDK.setUseInternalBrowser}
+   */
+  useInternalBrowser?: boolean;
+
+  /**
+   * See {@link OpenWrapSDK.allowAdvertisingId}
+   */
+  allowAdvertisingId?: boolean;
+
+  /**
+   * See {@link OpenWrapSDK.allowAVAudioSessionAccess}, applicable to iOS only.
+   */
+  allowAVAudioSessionAccess?: boolean;
+
+  /**
+   * See {@link OpenWrapSDK.setApplicationInfo}
+   */
+  applicationInfo?: POBApplicationInfo;
+
+  /**
+   * See {@link OpenWrapSDK.setUserInfo}
+   */
+  userInfo?: POBUserInfo;
+
+  /**
+   * See {@link OpenWrapSDK.setLocation}
+   */
+  location?: POBLocation;
+
+  /**
+   * See {@link OpenWrapSDK.setWebViewPoolSize}
+   */
+  webViewPoolSize?: number;
+};